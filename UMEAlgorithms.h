@@ -0,0 +1,591 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_ALGORITHMS_H_
+#define UME_ALGORITHMS_H_
+
+// Array-level algorithms.
+//
+// Loops over arrays usually consist of three parts: a peeling loop reaching an aligned address,
+// a main loop processing full vectors and a remainder loop for the last elements. The functions
+// below implement these parts once. The user only provides the operation on vector types:
+//
+//     typedef UME::SIMD::SIMDVec<float, 8> VEC_T;
+//
+//     // y[i] = 2 * x[i] + 1
+//     UME::SIMD::transform<VEC_T>(x, y, n, [](VEC_T const & a) { return a * 2.0f + 1.0f; });
+//
+//     // sum of squares
+//     float s = UME::SIMD::transform_reduce<VEC_T>(x, n, 0.0f,
+//         [](VEC_T const & a, VEC_T const & b) { return a + b; },
+//         [](VEC_T const & a) { return a * a; });
+//
+// Peeling aligns the output array (transform) or the first input array (reductions), so that
+// the main loop does not access vectors split between cache lines. Peeling and remainder are
+// handled with a single LOADTAIL/STORETAIL vector operation each, so no scalar code is executed
+// for any array length. Padding elements of a tail vector are set to zero before calling the
+// user operation. The results computed for padding elements
+// are never stored, and reductions replace them with the identity element, so the user
+// operation does not need to care about them.
+//
+// Reductions accumulate into several independent vectors, so consecutive iterations do not
+// depend on each other. Because of that, and because of the final horizontal reduction, the
+// order of floating-point operations differs from a sequential loop.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "UMESimd.h"
+
+// Default distance, in elements, at which the prefetching loops request data ahead of its use.
+// Indirect and strided loops usually access a different cache line for each element, so this
+// is also the number of cache lines requested ahead.
+#ifndef UME_PREFETCH_DISTANCE
+#define UME_PREFETCH_DISTANCE 16
+#endif
+
+namespace UME {
+namespace SIMD {
+
+    // Prefetch hints of the prefetching loops, see UME_PREFETCH_* in UMESimd.h.
+    enum class Prefetch {
+        T0,
+        T1,
+        T2,
+        NTA,
+        W
+    };
+
+namespace ALGORITHMS {
+
+    // Number of independent accumulators used by reductions.
+    const int UNROLL = 4;
+
+    // Number of leading elements to process before 'p' becomes aligned for VEC_T.
+    // Returns 0 if 'p' cannot be aligned by skipping whole elements.
+    template<typename VEC_T, typename SCALAR_T>
+    UME_FORCE_INLINE std::size_t peelCount(SCALAR_T const * p, std::size_t n) {
+        std::size_t alignment = VEC_T::alignment();
+        std::size_t misalignment = std::size_t(reinterpret_cast<uintptr_t>(p) % alignment);
+        if (misalignment == 0 || (misalignment % sizeof(SCALAR_T)) != 0) return 0;
+        std::size_t peel = (alignment - misalignment) / sizeof(SCALAR_T);
+        return peel < n ? peel : n;
+    }
+
+    // Mask with the first 'count' elements set.
+    template<typename VEC_T>
+    UME_FORCE_INLINE typename SIMDTraits<VEC_T>::MASK_T tailMask(uint32_t count) {
+        typename SIMDTraits<VEC_T>::MASK_T mask(false);
+        for (uint32_t i = 0; i < count; i++) mask.insert(i, true);
+        return mask;
+    }
+
+    // Reduce all elements of 'a' to a single value, using a vector operation.
+    template<typename VEC_T, typename REDUCE_OP>
+    UME_FORCE_INLINE typename SIMDTraits<VEC_T>::SCALAR_T horizontal(VEC_T const & a, REDUCE_OP const & op) {
+        VEC_T t0(a.extract(0));
+        for (uint32_t i = 1; i < VEC_T::length(); i++) {
+            t0 = op(t0, VEC_T(a.extract(i)));
+        }
+        return t0.extract(0);
+    }
+
+    // Load 'count' elements starting at 'p'. Elements past 'count' are set to 'identity'.
+    template<typename VEC_T>
+    UME_FORCE_INLINE VEC_T loadTail(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * p,
+        uint32_t count,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity)
+    {
+        VEC_T t0;
+        t0.loadTail(p, count);
+        return VEC_T(identity).blend(tailMask<VEC_T>(count), t0);
+    }
+
+    // Generic driver for reductions over 'n' elements. 'loadOp(i, count)' returns a vector
+    // holding transformed elements [i, i + count), with padding elements set to 'identity'.
+    // It is called with count == VEC_T::length() for all vectors except peeling and remainder.
+    // Returns the accumulators combined into a single vector.
+    template<typename VEC_T, typename LOAD_OP, typename REDUCE_OP>
+    UME_FORCE_INLINE VEC_T reduceDriver(
+        std::size_t peel,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        LOAD_OP const & loadOp,
+        REDUCE_OP const & reduceOp)
+    {
+        const std::size_t VEC_LEN = VEC_T::length();
+
+        VEC_T acc[UNROLL];
+        for (int j = 0; j < UNROLL; j++) acc[j] = VEC_T(identity);
+
+        std::size_t i = 0;
+        if (peel > 0) {
+            acc[0] = reduceOp(acc[0], loadOp(0, uint32_t(peel)));
+            i = peel;
+        }
+        for (; i + UNROLL * VEC_LEN <= n; i += UNROLL * VEC_LEN) {
+            for (int j = 0; j < UNROLL; j++) {
+                acc[j] = reduceOp(acc[j], loadOp(i + j * VEC_LEN, uint32_t(VEC_LEN)));
+            }
+        }
+        for (; i + VEC_LEN <= n; i += VEC_LEN) {
+            acc[0] = reduceOp(acc[0], loadOp(i, uint32_t(VEC_LEN)));
+        }
+        if (i < n) {
+            acc[1] = reduceOp(acc[1], loadOp(i, uint32_t(n - i)));
+        }
+
+        for (int j = 1; j < UNROLL; j++) acc[0] = reduceOp(acc[0], acc[j]);
+        return acc[0];
+    }
+
+    // Vector reduction of 'n' elements. Elements of the result still have to be reduced.
+    template<typename VEC_T, typename REDUCE_OP>
+    UME_FORCE_INLINE VEC_T reduceToVector(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        REDUCE_OP const & reduceOp)
+    {
+        const uint32_t VEC_LEN = VEC_T::length();
+        std::size_t peel = peelCount<VEC_T>(in, n);
+        auto loadOp = [in, identity, VEC_LEN](std::size_t i, uint32_t count) -> VEC_T {
+            if (count != VEC_LEN) return loadTail<VEC_T>(in + i, count, identity);
+            VEC_T t0;
+            t0.load(in + i);
+            return t0;
+        };
+        return reduceDriver<VEC_T>(peel, n, identity, loadOp, reduceOp);
+    }
+
+    // Vector reduction of 'n' transformed elements. Elements of the result still have to be reduced.
+    template<typename VEC_T, typename REDUCE_OP, typename UNARY_OP>
+    UME_FORCE_INLINE VEC_T transformReduceToVector(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        REDUCE_OP const & reduceOp,
+        UNARY_OP const & transformOp)
+    {
+        const uint32_t VEC_LEN = VEC_T::length();
+        std::size_t peel = peelCount<VEC_T>(in, n);
+        auto loadOp = [in, identity, VEC_LEN, &transformOp](std::size_t i, uint32_t count) -> VEC_T {
+            VEC_T t0;
+            if (count != VEC_LEN) {
+                t0.loadTail(in + i, count);
+                return VEC_T(identity).blend(tailMask<VEC_T>(count), transformOp(t0));
+            }
+            t0.load(in + i);
+            return transformOp(t0);
+        };
+        return reduceDriver<VEC_T>(peel, n, identity, loadOp, reduceOp);
+    }
+
+    // Prefetch 'p' with a hint known at compile time.
+    template<Prefetch HINT>
+    UME_FORCE_INLINE void prefetch(void const * p) {
+        switch (HINT) {
+        case Prefetch::T0:  UME_PREFETCH_T0(p); break;
+        case Prefetch::T1:  UME_PREFETCH_T1(p); break;
+        case Prefetch::T2:  UME_PREFETCH_T2(p); break;
+        case Prefetch::NTA: UME_PREFETCH_NTA(p); break;
+        case Prefetch::W:   UME_PREFETCH_W(p); break;
+        }
+    }
+
+}
+
+    // out[i] = op(in[i]), for i in [0, n).
+    // 'op' takes and returns VEC_T. 'in' and 'out' may be the same array.
+    template<typename VEC_T, typename UNARY_OP>
+    UME_FORCE_INLINE void transform(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        UNARY_OP const & op)
+    {
+        const std::size_t VEC_LEN = VEC_T::length();
+        std::size_t peel = ALGORITHMS::peelCount<VEC_T>(out, n);
+        VEC_T t0;
+        std::size_t i = 0;
+        if (peel > 0) {
+            t0.loadTail(in, uint32_t(peel));
+            op(t0).storeTail(out, uint32_t(peel));
+            i = peel;
+        }
+        for (; i + VEC_LEN <= n; i += VEC_LEN) {
+            t0.load(in + i);
+            op(t0).store(out + i);
+        }
+        if (i < n) {
+            t0.loadTail(in + i, uint32_t(n - i));
+            op(t0).storeTail(out + i, uint32_t(n - i));
+        }
+    }
+
+    // out[i] = op(in1[i], in2[i]), for i in [0, n).
+    template<typename VEC_T, typename BINARY_OP>
+    UME_FORCE_INLINE void transform(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in1,
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in2,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        BINARY_OP const & op)
+    {
+        const std::size_t VEC_LEN = VEC_T::length();
+        std::size_t peel = ALGORITHMS::peelCount<VEC_T>(out, n);
+        VEC_T t0, t1;
+        std::size_t i = 0;
+        if (peel > 0) {
+            t0.loadTail(in1, uint32_t(peel));
+            t1.loadTail(in2, uint32_t(peel));
+            op(t0, t1).storeTail(out, uint32_t(peel));
+            i = peel;
+        }
+        for (; i + VEC_LEN <= n; i += VEC_LEN) {
+            t0.load(in1 + i);
+            t1.load(in2 + i);
+            op(t0, t1).store(out + i);
+        }
+        if (i < n) {
+            t0.loadTail(in1 + i, uint32_t(n - i));
+            t1.loadTail(in2 + i, uint32_t(n - i));
+            op(t0, t1).storeTail(out + i, uint32_t(n - i));
+        }
+    }
+
+    // Reduce 'n' elements with 'reduceOp', which has to be associative and commutative.
+    // 'identity' is the neutral element of 'reduceOp' (0 for addition, 1 for multiplication, ...).
+    template<typename VEC_T, typename REDUCE_OP>
+    UME_FORCE_INLINE typename SIMDTraits<VEC_T>::SCALAR_T reduce(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        REDUCE_OP const & reduceOp)
+    {
+        VEC_T t0 = ALGORITHMS::reduceToVector<VEC_T>(in, n, identity, reduceOp);
+        return ALGORITHMS::horizontal(t0, reduceOp);
+    }
+
+    // Sum of 'n' elements.
+    template<typename VEC_T>
+    UME_FORCE_INLINE typename SIMDTraits<VEC_T>::SCALAR_T reduce(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n)
+    {
+        typedef typename SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+        return reduce<VEC_T>(in, n, SCALAR_T(0),
+            [](VEC_T const & a, VEC_T const & b) { return a + b; });
+    }
+
+    // reduceOp(transformOp(in[0]), transformOp(in[1]), ...)
+    template<typename VEC_T, typename REDUCE_OP, typename UNARY_OP>
+    UME_FORCE_INLINE typename SIMDTraits<VEC_T>::SCALAR_T transform_reduce(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        REDUCE_OP const & reduceOp,
+        UNARY_OP const & transformOp)
+    {
+        VEC_T t0 = ALGORITHMS::transformReduceToVector<VEC_T>(in, n, identity, reduceOp, transformOp);
+        return ALGORITHMS::horizontal(t0, reduceOp);
+    }
+
+    // reduceOp(transformOp(in1[0], in2[0]), transformOp(in1[1], in2[1]), ...)
+    // For example a dot product uses addition as 'reduceOp' and multiplication as 'transformOp'.
+    template<typename VEC_T, typename REDUCE_OP, typename BINARY_OP>
+    UME_FORCE_INLINE typename SIMDTraits<VEC_T>::SCALAR_T transform_reduce(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in1,
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in2,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        REDUCE_OP const & reduceOp,
+        BINARY_OP const & transformOp)
+    {
+        const uint32_t VEC_LEN = VEC_T::length();
+        std::size_t peel = ALGORITHMS::peelCount<VEC_T>(in1, n);
+        auto loadOp = [in1, in2, identity, VEC_LEN, &transformOp](std::size_t i, uint32_t count) -> VEC_T {
+            VEC_T t0, t1;
+            if (count != VEC_LEN) {
+                t0.loadTail(in1 + i, count);
+                t1.loadTail(in2 + i, count);
+                return VEC_T(identity).blend(ALGORITHMS::tailMask<VEC_T>(count), transformOp(t0, t1));
+            }
+            t0.load(in1 + i);
+            t1.load(in2 + i);
+            return transformOp(t0, t1);
+        };
+        VEC_T t0 = ALGORITHMS::reduceDriver<VEC_T>(peel, n, identity, loadOp, reduceOp);
+        return ALGORITHMS::horizontal(t0, reduceOp);
+    }
+
+    // out[i] = scanOp(in[0], in[1], ..., in[i]), for i in [0, n). 'scanOp' takes and returns
+    // VEC_T and has to be associative. 'identity' is its neutral element.
+    //
+    // The prefix of each vector is computed in log2(VEC_T::length()) steps. Step 's' shifts the
+    // vector by 's' elements with PERMUTEV, filling the first 's' elements with 'identity', and
+    // combines it with the unshifted vector. The result of the last element is then broadcast
+    // and combined with the next vector.
+    template<typename VEC_T, typename SCAN_OP>
+    UME_FORCE_INLINE void inclusive_scan(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        SCAN_OP const & scanOp)
+    {
+        typedef typename SIMDTraits<VEC_T>::UINT_VEC_T    UINT_VEC_T;
+        typedef typename SIMDTraits<VEC_T>::SCALAR_UINT_T SCALAR_UINT_T;
+        typedef typename SIMDTraits<VEC_T>::MASK_T        MASK_T;
+        const std::size_t VEC_LEN = VEC_T::length();
+        // Enough steps for vectors of up to 256 elements.
+        const int MAX_STEPS = 8;
+
+        // Permutation indices and lanes receiving a shifted element, for each step.
+        UINT_VEC_T shift[MAX_STEPS];
+        MASK_T valid[MAX_STEPS];
+        UINT_VEC_T lanes;
+        for (uint32_t j = 0; j < VEC_LEN; j++) lanes.insert(j, SCALAR_UINT_T(j));
+        int steps = 0;
+        for (std::size_t k = 1; k < VEC_LEN; k *= 2, steps++) {
+            shift[steps] = lanes.sub(SCALAR_UINT_T(k));
+            valid[steps] = lanes.cmpge(SCALAR_UINT_T(k));
+        }
+        UINT_VEC_T last(SCALAR_UINT_T(VEC_LEN - 1));
+
+        VEC_T identityVec(identity);
+        VEC_T carry(identity);
+        VEC_T t0;
+        for (std::size_t i = 0; i < n; i += VEC_LEN) {
+            uint32_t count = (n - i) < VEC_LEN ? uint32_t(n - i) : uint32_t(VEC_LEN);
+            if (count == VEC_LEN) t0.load(in + i);
+            else t0.loadTail(in + i, count);
+
+            for (int k = 0; k < steps; k++) {
+                t0 = scanOp(identityVec.blend(valid[k], t0.permute(shift[k])), t0);
+            }
+            t0 = scanOp(carry, t0);
+
+            if (count == VEC_LEN) t0.store(out + i);
+            else t0.storeTail(out + i, count);
+            carry = t0.permute(last);
+        }
+    }
+
+    // out[i] = in[0] + in[1] + ... + in[i], for i in [0, n).
+    template<typename VEC_T>
+    UME_FORCE_INLINE void inclusive_scan(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n)
+    {
+        typedef typename SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+        inclusive_scan<VEC_T>(in, out, n, SCALAR_T(0),
+            [](VEC_T const & a, VEC_T const & b) { return a + b; });
+    }
+
+    // Number of elements for which 'pred' is true. 'pred' takes VEC_T and returns its mask type.
+    template<typename VEC_T, typename PREDICATE>
+    UME_FORCE_INLINE uint64_t count_if(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        PREDICATE const & pred)
+    {
+        typedef typename SIMDTraits<VEC_T>::UINT_VEC_T    UINT_VEC_T;
+        typedef typename SIMDTraits<VEC_T>::SCALAR_UINT_T SCALAR_UINT_T;
+        const std::size_t VEC_LEN = VEC_T::length();
+        // Per-element counters are flushed before they can overflow (255 iterations for 8-bit types).
+        const std::size_t FLUSH_LEN = std::size_t(SCALAR_UINT_T(~SCALAR_UINT_T(0))) < std::size_t(1 << 30) ?
+            std::size_t(SCALAR_UINT_T(~SCALAR_UINT_T(0))) : std::size_t(1 << 30);
+
+        uint64_t total = 0;
+        UINT_VEC_T counters[ALGORITHMS::UNROLL];
+        VEC_T t0;
+
+        auto flush = [&total, &counters]() {
+            for (int j = 0; j < ALGORITHMS::UNROLL; j++) {
+                for (uint32_t k = 0; k < UINT_VEC_T::length(); k++) total += uint64_t(counters[j].extract(k));
+                counters[j] = UINT_VEC_T(SCALAR_UINT_T(0));
+            }
+        };
+        for (int j = 0; j < ALGORITHMS::UNROLL; j++) counters[j] = UINT_VEC_T(SCALAR_UINT_T(0));
+
+        std::size_t i = 0;
+        std::size_t iterations = 0;
+        for (; i + ALGORITHMS::UNROLL * VEC_LEN <= n; i += ALGORITHMS::UNROLL * VEC_LEN) {
+            for (int j = 0; j < ALGORITHMS::UNROLL; j++) {
+                t0.load(in + i + j * VEC_LEN);
+                counters[j].prefinc(pred(t0));
+            }
+            if (++iterations == FLUSH_LEN) {
+                flush();
+                iterations = 0;
+            }
+        }
+        flush();
+        for (; i < n; i += VEC_LEN) {
+            uint32_t count = (n - i) < VEC_LEN ? uint32_t(n - i) : uint32_t(VEC_LEN);
+            t0.loadTail(in + i, count);
+            counters[0].prefinc(pred(t0) && ALGORITHMS::tailMask<VEC_T>(count));
+        }
+        flush();
+        return total;
+    }
+
+    // Calls 'op(i, count)' for consecutive blocks of elements [i, i + count) covering [0, n),
+    // with count == VEC_T::length() for all blocks except the last one. 'addressOp(j)' returns
+    // the address accessed for element j. It is called once for each j in [0, n) and the address
+    // is prefetched with HINT before processing the block which ends 'distance' elements before j.
+    // A 'distance' of 0 disables prefetching.
+    //
+    // Hardware prefetchers follow sequential streams, but cannot predict addresses computed
+    // from loaded indices or large strides. Such loops are bound by memory latency, which
+    // requesting the data a few iterations ahead hides:
+    //
+    //     // sum += table[indices[i]]
+    //     UME::SIMD::for_each_prefetched<VEC_T>(n, 16,
+    //         [&](std::size_t j) { return table + indices[j]; },
+    //         [&](std::size_t i, uint32_t count) { ... });
+    template<typename VEC_T, Prefetch HINT = Prefetch::T0, typename ADDRESS_OP, typename BLOCK_OP>
+    UME_FORCE_INLINE void for_each_prefetched(
+        std::size_t n,
+        std::size_t distance,
+        ADDRESS_OP const & addressOp,
+        BLOCK_OP const & op)
+    {
+        const std::size_t VEC_LEN = VEC_T::length();
+        // Elements [0, ahead) have already been prefetched.
+        std::size_t ahead = 0;
+        for (std::size_t i = 0; i < n; i += VEC_LEN) {
+            uint32_t count = (n - i) < VEC_LEN ? uint32_t(n - i) : uint32_t(VEC_LEN);
+            if (distance > 0) {
+                std::size_t end = i + count + distance;
+                if (end > n) end = n;
+                for (; ahead < end; ahead++) ALGORITHMS::prefetch<HINT>(addressOp(ahead));
+            }
+            op(i, count);
+        }
+    }
+
+    // out[i] = table[indices[i]], for i in [0, n).
+    // Elements of 'table' are prefetched 'distance' elements ahead.
+    template<typename VEC_T>
+    UME_FORCE_INLINE void gather(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * table,
+        typename SIMDTraits<VEC_T>::SCALAR_UINT_T const * indices,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        std::size_t distance = UME_PREFETCH_DISTANCE)
+    {
+        typedef typename SIMDTraits<VEC_T>::UINT_VEC_T UINT_VEC_T;
+        const uint32_t VEC_LEN = VEC_T::length();
+        for_each_prefetched<VEC_T>(n, distance,
+            [table, indices](std::size_t j) { return table + indices[j]; },
+            [table, indices, out, VEC_LEN](std::size_t i, uint32_t count) {
+                UINT_VEC_T t0;
+                VEC_T t1;
+                if (count == VEC_LEN) {
+                    t0.load(indices + i);
+                    t1.gather(table, t0);
+                    t1.store(out + i);
+                }
+                else {
+                    // Padding indices are zero, so padding elements read table[0].
+                    t0.loadTail(indices + i, count);
+                    t1.gather(table, t0);
+                    t1.storeTail(out + i, count);
+                }
+            });
+    }
+
+    // out[i] = in[i * stride], for i in [0, n).
+    // Elements of 'in' are prefetched 'distance' elements ahead.
+    template<typename VEC_T>
+    UME_FORCE_INLINE void gather_strided(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        uint32_t stride,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        std::size_t distance = UME_PREFETCH_DISTANCE)
+    {
+        const uint32_t VEC_LEN = VEC_T::length();
+        for_each_prefetched<VEC_T>(n, distance,
+            [in, stride](std::size_t j) { return in + j * stride; },
+            [in, stride, out, VEC_LEN](std::size_t i, uint32_t count) {
+                typedef typename SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+                if (count == VEC_LEN) {
+                    VEC_T t0;
+                    t0.gatheru(in + i * stride, stride);
+                    t0.store(out + i);
+                }
+                else {
+                    VEC_T t0(SCALAR_T(0));
+                    for (uint32_t k = 0; k < count; k++) t0.insert(k, in[(i + k) * stride]);
+                    t0.storeTail(out + i, count);
+                }
+            });
+    }
+
+    // out[indices[i]] = in[i], for i in [0, n).
+    // If indices repeat, the last of the elements is stored, as in a sequential loop.
+    // Elements of 'out' are prefetched for writing 'distance' elements ahead.
+    template<typename VEC_T>
+    UME_FORCE_INLINE void scatter(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        typename SIMDTraits<VEC_T>::SCALAR_UINT_T const * indices,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        std::size_t distance = UME_PREFETCH_DISTANCE)
+    {
+        typedef typename SIMDTraits<VEC_T>::UINT_VEC_T UINT_VEC_T;
+        const uint32_t VEC_LEN = VEC_T::length();
+        for_each_prefetched<VEC_T, Prefetch::W>(n, distance,
+            [out, indices](std::size_t j) { return out + indices[j]; },
+            [in, indices, out, VEC_LEN](std::size_t i, uint32_t count) {
+                UINT_VEC_T t0;
+                VEC_T t1;
+                if (count == VEC_LEN) {
+                    t0.load(indices + i);
+                    t1.load(in + i);
+                    t1.scatter(out, t0);
+                }
+                else {
+                    t0.loadTail(indices + i, count);
+                    t1.loadTail(in + i, count);
+                    t1.scatter(ALGORITHMS::tailMask<VEC_T>(count), out, t0);
+                }
+            });
+    }
+
+}
+}
+
+#endif
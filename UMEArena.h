@@ -0,0 +1,261 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+#ifndef UME_ARENA_H_
+#define UME_ARENA_H_
+
+// Arena allocator for short-lived aligned buffers.
+//
+// DynamicMemory::AlignedMalloc() goes to the system allocator on every call. Code allocating
+// scratch buffers per event (or per any other unit of work) spends a noticeable time there.
+// AlignedArena takes large blocks from AlignedMalloc() once and hands out pieces of them:
+//
+//     UME::AlignedArena & arena = UME::AlignedArena::threadLocal();
+//     for (...each event...) {
+//         float* x = (float*)arena.allocate(n * sizeof(float), VEC_T::alignment());
+//         ...
+//         arena.reset();
+//     }
+//
+// Requests are rounded up to a size class (a power of two between UME_ARENA_MIN_CLASS and
+// UME_ARENA_MAX_CLASS bytes). deallocate() puts a buffer on the free list of its class, and
+// allocate() reuses buffers from that list, so allocation is either a list pop or an increment
+// of the position in the current block. reset() invalidates all buffers at once, keeping the
+// blocks for the next round. Requests above UME_ARENA_MAX_CLASS bytes are passed to
+// AlignedMalloc() and freed by deallocate() or reset().
+//
+// An arena is not thread safe. threadLocal() gives every thread its own arena. When compiled
+// as C++17 with <memory_resource> available, AlignedArenaResource exposes an arena as a
+// std::pmr::memory_resource.
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define UME_ARENA_PMR 1
+#endif
+#endif
+
+#include "UMEMemory.h"
+
+#ifndef UME_ARENA_BLOCK_BYTES
+#define UME_ARENA_BLOCK_BYTES (1024 * 1024)
+#endif
+
+#ifndef UME_ARENA_MIN_CLASS
+#define UME_ARENA_MIN_CLASS 64
+#endif
+
+#ifndef UME_ARENA_MAX_CLASS
+#define UME_ARENA_MAX_CLASS (64 * 1024)
+#endif
+
+namespace UME {
+
+    class AlignedArena {
+    public:
+        // Largest alignment that can be requested.
+        static constexpr std::size_t MAX_ALIGNMENT = 4096;
+
+    private:
+        static const int CLASS_COUNT = 32;
+
+        struct FreeNode { FreeNode* next; };
+
+        std::vector<char*> mBlocks;
+        std::size_t        mBlockBytes;
+        std::size_t        mCurrentBlock;  // index of the block being carved
+        char*              mCursor;        // first free byte of the current block
+        char*              mEnd;           // end of the current block
+        FreeNode*          mFreeLists[CLASS_COUNT];
+        std::vector<void*> mLarge;         // buffers taken directly from AlignedMalloc()
+
+        // Size class of a request: the index of the smallest power of two that is not smaller
+        // than 'size', 'alignment' and UME_ARENA_MIN_CLASS.
+        static int sizeClass(std::size_t size, std::size_t alignment) {
+            std::size_t t0 = size > alignment ? size : alignment;
+            if (t0 < std::size_t(UME_ARENA_MIN_CLASS)) t0 = UME_ARENA_MIN_CLASS;
+#if defined(__GNUC__)
+            return 64 - __builtin_clzll((unsigned long long)(t0 - 1));
+#else
+            int t1 = 0;
+            while ((std::size_t(1) << t1) < t0) t1++;
+            return t1;
+#endif
+        }
+
+        // Take 'bytes' bytes aligned to 'alignment' from the blocks, moving to the next block
+        // (allocating it if needed) when the current one is exhausted.
+        char* carve(std::size_t bytes, std::size_t alignment) {
+            for (;;) {
+                if (mCursor != nullptr) {
+                    char* t0 = (char*)((uintptr_t(mCursor) + alignment - 1) & ~uintptr_t(alignment - 1));
+                    if (t0 + bytes <= mEnd) {
+                        mCursor = t0 + bytes;
+                        return t0;
+                    }
+                    mCurrentBlock++;
+                }
+                if (mCurrentBlock == mBlocks.size()) {
+                    char* t1 = (char*)DynamicMemory::AlignedMalloc(mBlockBytes, MAX_ALIGNMENT);
+                    if (t1 == nullptr) return nullptr;
+                    mBlocks.push_back(t1);
+                }
+                mCursor = mBlocks[mCurrentBlock];
+                mEnd = mCursor + mBlockBytes;
+            }
+        }
+
+        AlignedArena(AlignedArena const &) = delete;
+        AlignedArena & operator= (AlignedArena const &) = delete;
+
+    public:
+        // 'blockBytes' is the size of blocks taken from AlignedMalloc(). It is raised to fit
+        // the largest size class.
+        explicit AlignedArena(std::size_t blockBytes = UME_ARENA_BLOCK_BYTES) :
+            mBlockBytes(blockBytes < std::size_t(UME_ARENA_MAX_CLASS) ? std::size_t(UME_ARENA_MAX_CLASS) : blockBytes),
+            mCurrentBlock(0),
+            mCursor(nullptr),
+            mEnd(nullptr)
+        {
+            for (int i = 0; i < CLASS_COUNT; i++) mFreeLists[i] = nullptr;
+        }
+
+        ~AlignedArena() {
+            release();
+        }
+
+        // Arena of the calling thread.
+        static AlignedArena & threadLocal() {
+            static thread_local AlignedArena arena;
+            return arena;
+        }
+
+        // Allocate 'size' bytes aligned to 'alignment', which has to be a power of two not
+        // larger than MAX_ALIGNMENT. Returns nullptr if the system allocation fails.
+        void* allocate(std::size_t size, std::size_t alignment = UME_ARENA_MIN_CLASS) {
+            int t0 = sizeClass(size, alignment);
+            std::size_t t1 = std::size_t(1) << t0;
+            if (t1 > std::size_t(UME_ARENA_MAX_CLASS)) {
+                void* t2 = DynamicMemory::AlignedMalloc(size, alignment);
+                if (t2 != nullptr) mLarge.push_back(t2);
+                return t2;
+            }
+            FreeNode* t3 = mFreeLists[t0];
+            if (t3 != nullptr) {
+                mFreeLists[t0] = t3->next;
+                return t3;
+            }
+            // Buffers of a class are aligned to the class size (up to MAX_ALIGNMENT), so that
+            // a reused buffer satisfies any alignment that maps to the same class.
+            return carve(t1, t1 < MAX_ALIGNMENT ? t1 : std::size_t(MAX_ALIGNMENT));
+        }
+
+        // Return a buffer obtained from allocate() with the same 'size' and 'alignment'.
+        void deallocate(void* p, std::size_t size, std::size_t alignment = UME_ARENA_MIN_CLASS) {
+            if (p == nullptr) return;
+            int t0 = sizeClass(size, alignment);
+            if ((std::size_t(1) << t0) > std::size_t(UME_ARENA_MAX_CLASS)) {
+                for (std::size_t i = 0; i < mLarge.size(); i++) {
+                    if (mLarge[i] == p) {
+                        mLarge[i] = mLarge.back();
+                        mLarge.pop_back();
+                        break;
+                    }
+                }
+                DynamicMemory::AlignedFree(p);
+                return;
+            }
+            FreeNode* t1 = (FreeNode*)p;
+            t1->next = mFreeLists[t0];
+            mFreeLists[t0] = t1;
+        }
+
+        // Invalidate all buffers. Blocks are kept and reused by following allocations.
+        void reset() {
+            for (std::size_t i = 0; i < mLarge.size(); i++) DynamicMemory::AlignedFree(mLarge[i]);
+            mLarge.clear();
+            for (int i = 0; i < CLASS_COUNT; i++) mFreeLists[i] = nullptr;
+            mCurrentBlock = 0;
+            mCursor = nullptr;
+            mEnd = nullptr;
+        }
+
+        // Invalidate all buffers and return all memory to the system.
+        void release() {
+            reset();
+            for (std::size_t i = 0; i < mBlocks.size(); i++) DynamicMemory::AlignedFree(mBlocks[i]);
+            mBlocks.clear();
+        }
+
+        // Number of bytes held in blocks.
+        std::size_t reservedBytes() const { return mBlocks.size() * mBlockBytes; }
+    };
+
+#if defined(UME_ARENA_PMR)
+    // Polymorphic memory resource allocating from an AlignedArena:
+    //
+    //     UME::AlignedArenaResource resource(UME::AlignedArena::threadLocal());
+    //     std::pmr::vector<float> x(n, &resource);
+    //
+    // Alignments up to AlignedArena::MAX_ALIGNMENT are supported.
+    class AlignedArenaResource : public std::pmr::memory_resource {
+    private:
+        AlignedArena & mArena;
+
+    public:
+        explicit AlignedArenaResource(AlignedArena & arena) : mArena(arena) {}
+
+        AlignedArena & arena() const { return mArena; }
+
+    protected:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            void* t0 = mArena.allocate(bytes, alignment);
+            if (t0 == nullptr) throw std::bad_alloc();
+            return t0;
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            mArena.deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override {
+            AlignedArenaResource const * t0 = dynamic_cast<AlignedArenaResource const *>(&other);
+            return t0 != nullptr && &t0->mArena == &mArena;
+        }
+    };
+#endif
+
+}
+
+#endif
@@ -0,0 +1,492 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_CONTAINERS_H_
+#define UME_CONTAINERS_H_
+
+// Containers with storage laid out for SIMD processing.
+//
+// AlignedVector<T, SIMD_STRIDE> is a resizable array of 'T' aligned for SIMDVec<T, SIMD_STRIDE>.
+// Its storage is always a whole number of vectors: elements past size() up to the next multiple
+// of SIMD_STRIDE (the tail) exist and are zero. A kernel can therefore process the array with
+// full vector operations only, without peeling or remainder loops:
+//
+//     typedef UME::SIMD::SIMDVec<float, 8> VEC_T;
+//
+//     UME::AlignedVector<float, 8> x(n), y(n);
+//     ...
+//     for (std::size_t i = 0; i < x.vecCount(); i++) {
+//         y.setVec(i, x.vec(i) * 2.0f + 1.0f);
+//     }
+//
+// setVec() stores only the first size() elements, so the tail stays zero even if the kernel
+// computes non-zero values for it. Writes through data() or operator[] past size() are not
+// allowed.
+//
+// SoA<SIMD_STRIDE, FIELDS...> and AoSoA<SIMD_STRIDE, FIELDS...> hold records with fields of
+// types FIELDS..., and give access to a vector of one field at a time. SoA keeps every field
+// in a separate AlignedVector. AoSoA interleaves the fields in tiles of SIMD_STRIDE records, so
+// that all fields of a group of records processed together are close in memory.
+//
+// All containers take an optional AllocationPolicy (UMEMemory.h), applied to all their
+// allocations. Large arrays can be backed by huge pages or placed on NUMA nodes this way:
+//
+//     UME::AlignedVector<float, 8> x(n, 0.0f, UME::AllocationPolicy::huge());
+//
+// The policy travels with the storage: copies, moves and swaps carry it along.
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "UMEMemory.h"
+
+namespace UME {
+
+    template<typename T, int SIMD_STRIDE>
+    class AlignedVector {
+        static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+            "AlignedVector requires an arithmetic element type");
+    public:
+        typedef T                                       value_type;
+        typedef std::size_t                             size_type;
+        typedef T*                                      iterator;
+        typedef T const*                                const_iterator;
+        typedef UME::SIMD::SIMDVec<T, SIMD_STRIDE>      VEC_TYPE;
+
+    private:
+        T*        mData;
+        size_type mSize;
+        size_type mCapacity;  // in elements, always a multiple of SIMD_STRIDE
+        AllocationPolicy mPolicy;
+
+        static size_type roundUp(size_type n) {
+            return (n + SIMD_STRIDE - 1) / SIMD_STRIDE * SIMD_STRIDE;
+        }
+
+        // Replace the storage with a zero-filled buffer for 'capacity' elements, keeping
+        // the first 'mSize' elements.
+        void reallocate(size_type capacity) {
+            T* t0 = nullptr;
+            if (capacity > 0) {
+                t0 = (T*)DynamicMemory::AlignedMalloc(capacity * sizeof(T), VEC_TYPE::alignment(), mPolicy);
+                if (t0 == nullptr) throw std::bad_alloc();
+                if (mSize > 0) DynamicMemory::MemCopy(t0, mData, mSize * sizeof(T));
+                DynamicMemory::MemSet(t0 + mSize, 0, (capacity - mSize) * sizeof(T));
+            }
+            if (mData != nullptr) DynamicMemory::AlignedFree(mData, mCapacity * sizeof(T), mPolicy);
+            mData = t0;
+            mCapacity = capacity;
+        }
+
+    public:
+        AlignedVector() : mData(nullptr), mSize(0), mCapacity(0) {}
+
+        explicit AlignedVector(AllocationPolicy const & policy) : mData(nullptr), mSize(0), mCapacity(0), mPolicy(policy) {}
+
+        explicit AlignedVector(size_type count, T value = T(0), AllocationPolicy const & policy = AllocationPolicy())
+            : mData(nullptr), mSize(0), mCapacity(0), mPolicy(policy) {
+            resize(count, value);
+        }
+
+        AlignedVector(AlignedVector const & other) : mData(nullptr), mSize(0), mCapacity(0), mPolicy(other.mPolicy) {
+            reallocate(roundUp(other.mSize));
+            mSize = other.mSize;
+            if (mSize > 0) DynamicMemory::MemCopy(mData, other.mData, mSize * sizeof(T));
+        }
+
+        AlignedVector(AlignedVector && other) : mData(other.mData), mSize(other.mSize), mCapacity(other.mCapacity), mPolicy(other.mPolicy) {
+            other.mData = nullptr;
+            other.mSize = 0;
+            other.mCapacity = 0;
+        }
+
+        ~AlignedVector() {
+            if (mData != nullptr) DynamicMemory::AlignedFree(mData, mCapacity * sizeof(T), mPolicy);
+        }
+
+        AlignedVector & operator= (AlignedVector other) {
+            swap(other);
+            return *this;
+        }
+
+        void swap(AlignedVector & other) {
+            std::swap(mData, other.mData);
+            std::swap(mSize, other.mSize);
+            std::swap(mCapacity, other.mCapacity);
+            std::swap(mPolicy, other.mPolicy);
+        }
+
+        AllocationPolicy const & policy() const { return mPolicy; }
+
+        // Number of elements.
+        size_type size() const { return mSize; }
+        bool empty() const { return mSize == 0; }
+        size_type capacity() const { return mCapacity; }
+        // Number of elements including the zero tail: size() rounded up to a multiple of SIMD_STRIDE.
+        size_type paddedSize() const { return roundUp(mSize); }
+        // Number of vectors covering all elements.
+        size_type vecCount() const { return roundUp(mSize) / SIMD_STRIDE; }
+
+        T* data() { return mData; }
+        T const * data() const { return mData; }
+        T & operator[] (size_type i) { return mData[i]; }
+        T const & operator[] (size_type i) const { return mData[i]; }
+        iterator begin() { return mData; }
+        iterator end() { return mData + mSize; }
+        const_iterator begin() const { return mData; }
+        const_iterator end() const { return mData + mSize; }
+
+        // Vector 'i', holding elements [i*SIMD_STRIDE, (i+1)*SIMD_STRIDE). Tail elements are zero.
+        VEC_TYPE vec(size_type i) const {
+            VEC_TYPE t0;
+            t0.loada(mData + i * SIMD_STRIDE);
+            return t0;
+        }
+
+        // Store 'v' as vector 'i'. Elements past size() are not written.
+        void setVec(size_type i, VEC_TYPE const & v) {
+            size_type first = i * SIMD_STRIDE;
+            if (first + SIMD_STRIDE <= mSize) {
+                v.storea(mData + first);
+            }
+            else {
+                v.storeTail(mData + first, uint32_t(mSize - first));
+            }
+        }
+
+        void reserve(size_type count) {
+            if (count > mCapacity) reallocate(roundUp(count));
+        }
+
+        // Change the number of elements. New elements are set to 'value', and elements
+        // removed from the end are reset to zero, as they become part of the tail.
+        void resize(size_type count, T value = T(0)) {
+            if (count > mCapacity) reallocate(roundUp(count));
+            for (size_type i = mSize; i < count; i++) mData[i] = value;
+            if (count < mSize) DynamicMemory::MemSet(mData + count, 0, (mSize - count) * sizeof(T));
+            mSize = count;
+        }
+
+        void push_back(T value) {
+            if (mSize == mCapacity) {
+                reallocate(mCapacity == 0 ? size_type(SIMD_STRIDE) : 2 * mCapacity);
+            }
+            mData[mSize++] = value;
+        }
+
+        void pop_back() {
+            mData[--mSize] = T(0);
+        }
+
+        void clear() {
+            resize(0);
+        }
+    };
+
+    namespace DETAIL {
+
+        // Compile-time list of indices 0, 1, ..., N-1, used to expand operations over all fields.
+        template<std::size_t... I> struct IndexList {};
+        template<std::size_t N, std::size_t... I> struct MakeIndexList : MakeIndexList<N - 1, N - 1, I...> {};
+        template<std::size_t... I> struct MakeIndexList<0, I...> { typedef IndexList<I...> type; };
+
+        // Byte offsets of field blocks in a tile of AoSoA. Field 'i' is stored as SIMD_STRIDE
+        // consecutive values, at an offset aligned to the alignment of SIMDVec of that field.
+        template<int SIMD_STRIDE, std::size_t OFFSET, typename... FIELDS>
+        struct TileLayout {
+            static constexpr std::size_t alignment = 1;
+            static constexpr std::size_t end = OFFSET;
+            static constexpr std::size_t offset(std::size_t) { return 0; }
+        };
+
+        template<int SIMD_STRIDE, std::size_t OFFSET, typename FIELD, typename... FIELDS>
+        struct TileLayout<SIMD_STRIDE, OFFSET, FIELD, FIELDS...> {
+            static constexpr std::size_t blockBytes = SIMD_STRIDE * sizeof(FIELD);
+            static constexpr std::size_t first = (OFFSET + blockBytes - 1) / blockBytes * blockBytes;
+            typedef TileLayout<SIMD_STRIDE, first + blockBytes, FIELDS...> NEXT;
+            static constexpr std::size_t alignment = blockBytes > NEXT::alignment ? blockBytes : NEXT::alignment;
+            static constexpr std::size_t end = NEXT::end;
+            static constexpr std::size_t offset(std::size_t i) { return i == 0 ? first : NEXT::offset(i - 1); }
+        };
+
+        // Evaluate expressions for their side effects, in order.
+        inline void expand(std::initializer_list<int>) {}
+    }
+
+    // Structure of arrays: every field is stored in its own AlignedVector.
+    //
+    //     typedef UME::SoA<8, float, float, float, int32_t> TRACKS;  // x, y, z, charge
+    //
+    //     TRACKS t;
+    //     t.push_back(x0, y0, z0, q0);
+    //     ...
+    //     for (std::size_t i = 0; i < t.vecCount(); i++) {
+    //         UME::SIMD::SIMDVec<float, 8> r2 = t.load<0>(i) * t.load<0>(i) + t.load<1>(i) * t.load<1>(i);
+    //         ...
+    //     }
+    //
+    // Fields are addressed by their index. All fields have the same size, and share the
+    // properties of AlignedVector: aligned storage padded with zeros to full vectors.
+    template<int SIMD_STRIDE, typename... FIELDS>
+    class SoA {
+    public:
+        typedef std::size_t size_type;
+        template<std::size_t F> struct field_type { typedef typename std::tuple_element<F, std::tuple<FIELDS...>>::type type; };
+        template<std::size_t F> struct vec_type { typedef UME::SIMD::SIMDVec<typename field_type<F>::type, SIMD_STRIDE> type; };
+
+    private:
+        std::tuple<AlignedVector<FIELDS, SIMD_STRIDE>...> mFields;
+        size_type mSize;
+
+        typedef typename DETAIL::MakeIndexList<sizeof...(FIELDS)>::type ALL_FIELDS;
+
+        template<std::size_t... I>
+        void resizeFields(size_type count, DETAIL::IndexList<I...>) {
+            DETAIL::expand({ (std::get<I>(mFields).resize(count), 0)... });
+        }
+        template<std::size_t... I>
+        void reserveFields(size_type count, DETAIL::IndexList<I...>) {
+            DETAIL::expand({ (std::get<I>(mFields).reserve(count), 0)... });
+        }
+        template<std::size_t... I>
+        void pushFields(DETAIL::IndexList<I...>, FIELDS... values) {
+            DETAIL::expand({ (std::get<I>(mFields).push_back(values), 0)... });
+        }
+
+    public:
+        SoA() : mSize(0) {}
+        explicit SoA(AllocationPolicy const & policy) : mFields(AlignedVector<FIELDS, SIMD_STRIDE>(policy)...), mSize(0) {}
+        explicit SoA(size_type count, AllocationPolicy const & policy = AllocationPolicy())
+            : mFields(AlignedVector<FIELDS, SIMD_STRIDE>(policy)...), mSize(0) {
+            resize(count);
+        }
+
+        size_type size() const { return mSize; }
+        bool empty() const { return mSize == 0; }
+        // Number of vectors covering all elements of a field.
+        size_type vecCount() const { return (mSize + SIMD_STRIDE - 1) / SIMD_STRIDE; }
+
+        AllocationPolicy const & policy() const { return std::get<0>(mFields).policy(); }
+
+        void resize(size_type count) {
+            resizeFields(count, ALL_FIELDS());
+            mSize = count;
+        }
+        void reserve(size_type count) {
+            reserveFields(count, ALL_FIELDS());
+        }
+        void clear() { resize(0); }
+        void push_back(FIELDS... values) {
+            pushFields(ALL_FIELDS(), values...);
+            mSize++;
+        }
+
+        // Array of field 'F'.
+        template<std::size_t F>
+        typename field_type<F>::type * data() { return std::get<F>(mFields).data(); }
+        template<std::size_t F>
+        typename field_type<F>::type const * data() const { return std::get<F>(mFields).data(); }
+
+        // Element 'i' of field 'F'.
+        template<std::size_t F>
+        typename field_type<F>::type & get(size_type i) { return std::get<F>(mFields)[i]; }
+        template<std::size_t F>
+        typename field_type<F>::type const & get(size_type i) const { return std::get<F>(mFields)[i]; }
+
+        // Vector 'i' of field 'F', holding elements [i*SIMD_STRIDE, (i+1)*SIMD_STRIDE).
+        template<std::size_t F>
+        typename vec_type<F>::type load(size_type i) const { return std::get<F>(mFields).vec(i); }
+
+        // Store 'v' as vector 'i' of field 'F'. Elements past size() are not written.
+        template<std::size_t F>
+        void store(size_type i, typename vec_type<F>::type const & v) { std::get<F>(mFields).setVec(i, v); }
+    };
+
+    // Array of structures of arrays: elements are grouped in tiles of SIMD_STRIDE elements.
+    // A tile stores SIMD_STRIDE values of the first field, followed by SIMD_STRIDE values of
+    // the second field and so on, so all fields of a vector-wide group of elements are close
+    // to each other in memory. The interface is the same as of SoA, with vector 'i' being
+    // tile 'i':
+    //
+    //     UME::AoSoA<8, float, float, float, int32_t> t(n);
+    //     UME::SIMD::SIMDVec<float, 8> x = t.load<0>(i);
+    //
+    // Field blocks are aligned for their vector type, and elements of the last tile past size()
+    // are zero.
+    template<int SIMD_STRIDE, typename... FIELDS>
+    class AoSoA {
+        typedef DETAIL::TileLayout<SIMD_STRIDE, 0, FIELDS...> LAYOUT;
+    public:
+        typedef std::size_t size_type;
+        template<std::size_t F> struct field_type { typedef typename std::tuple_element<F, std::tuple<FIELDS...>>::type type; };
+        template<std::size_t F> struct vec_type { typedef UME::SIMD::SIMDVec<typename field_type<F>::type, SIMD_STRIDE> type; };
+
+        // Size of a tile in bytes.
+        static constexpr size_type tileBytes() { return (LAYOUT::end + LAYOUT::alignment - 1) / LAYOUT::alignment * LAYOUT::alignment; }
+        static constexpr size_type alignment() { return LAYOUT::alignment; }
+
+    private:
+        char*     mData;
+        size_type mSize;
+        size_type mTiles;  // allocated tiles
+        AllocationPolicy mPolicy;
+
+        typedef typename DETAIL::MakeIndexList<sizeof...(FIELDS)>::type ALL_FIELDS;
+
+        template<std::size_t F>
+        typename field_type<F>::type * block(size_type tile) const {
+            return (typename field_type<F>::type *)(mData + tile * tileBytes() + LAYOUT::offset(F));
+        }
+
+        template<std::size_t... I>
+        void pushFields(DETAIL::IndexList<I...>, FIELDS... values) {
+            DETAIL::expand({ (get<I>(mSize) = values, 0)... });
+        }
+
+        template<std::size_t... I>
+        void clearFields(size_type first, size_type last, DETAIL::IndexList<I...>) {
+            for (size_type i = first; i < last; i++) {
+                DETAIL::expand({ (get<I>(i) = typename field_type<I>::type(0), 0)... });
+            }
+        }
+
+        // Replace the storage with zero-filled memory for 'tiles' tiles, keeping existing elements.
+        void reallocate(size_type tiles) {
+            char* t0 = nullptr;
+            if (tiles > 0) {
+                t0 = (char*)DynamicMemory::AlignedMalloc(tiles * tileBytes(), alignment(), mPolicy);
+                if (t0 == nullptr) throw std::bad_alloc();
+                size_type used = (mSize + SIMD_STRIDE - 1) / SIMD_STRIDE;
+                if (used > 0) DynamicMemory::MemCopy(t0, mData, used * tileBytes());
+                DynamicMemory::MemSet(t0 + used * tileBytes(), 0, (tiles - used) * tileBytes());
+            }
+            if (mData != nullptr) DynamicMemory::AlignedFree(mData, mTiles * tileBytes(), mPolicy);
+            mData = t0;
+            mTiles = tiles;
+        }
+
+    public:
+        AoSoA() : mData(nullptr), mSize(0), mTiles(0) {}
+        explicit AoSoA(AllocationPolicy const & policy) : mData(nullptr), mSize(0), mTiles(0), mPolicy(policy) {}
+        explicit AoSoA(size_type count, AllocationPolicy const & policy = AllocationPolicy())
+            : mData(nullptr), mSize(0), mTiles(0), mPolicy(policy) {
+            resize(count);
+        }
+
+        AoSoA(AoSoA const & other) : mData(nullptr), mSize(0), mTiles(0), mPolicy(other.mPolicy) {
+            reallocate(other.vecCount());
+            mSize = other.mSize;
+            if (mTiles > 0) DynamicMemory::MemCopy(mData, other.mData, mTiles * tileBytes());
+        }
+
+        AoSoA(AoSoA && other) : mData(other.mData), mSize(other.mSize), mTiles(other.mTiles), mPolicy(other.mPolicy) {
+            other.mData = nullptr;
+            other.mSize = 0;
+            other.mTiles = 0;
+        }
+
+        ~AoSoA() {
+            if (mData != nullptr) DynamicMemory::AlignedFree(mData, mTiles * tileBytes(), mPolicy);
+        }
+
+        AoSoA & operator= (AoSoA other) {
+            swap(other);
+            return *this;
+        }
+
+        void swap(AoSoA & other) {
+            std::swap(mData, other.mData);
+            std::swap(mSize, other.mSize);
+            std::swap(mTiles, other.mTiles);
+            std::swap(mPolicy, other.mPolicy);
+        }
+
+        AllocationPolicy const & policy() const { return mPolicy; }
+
+        size_type size() const { return mSize; }
+        bool empty() const { return mSize == 0; }
+        size_type capacity() const { return mTiles * SIMD_STRIDE; }
+        // Number of tiles covering all elements.
+        size_type vecCount() const { return (mSize + SIMD_STRIDE - 1) / SIMD_STRIDE; }
+
+        void reserve(size_type count) {
+            size_type tiles = (count + SIMD_STRIDE - 1) / SIMD_STRIDE;
+            if (tiles > mTiles) reallocate(tiles);
+        }
+
+        // Change the number of elements. New elements are zero.
+        void resize(size_type count) {
+            reserve(count);
+            if (count < mSize) clearFields(count, mSize, ALL_FIELDS());
+            mSize = count;
+        }
+
+        void clear() { resize(0); }
+
+        void push_back(FIELDS... values) {
+            if (mSize == mTiles * SIMD_STRIDE) reallocate(mTiles == 0 ? 1 : 2 * mTiles);
+            pushFields(ALL_FIELDS(), values...);
+            mSize++;
+        }
+
+        // Element 'i' of field 'F'.
+        template<std::size_t F>
+        typename field_type<F>::type & get(size_type i) { return block<F>(i / SIMD_STRIDE)[i % SIMD_STRIDE]; }
+        template<std::size_t F>
+        typename field_type<F>::type const & get(size_type i) const { return block<F>(i / SIMD_STRIDE)[i % SIMD_STRIDE]; }
+
+        // Field 'F' of tile 'i'.
+        template<std::size_t F>
+        typename vec_type<F>::type load(size_type i) const {
+            typename vec_type<F>::type t0;
+            t0.loada(block<F>(i));
+            return t0;
+        }
+
+        // Store 'v' as field 'F' of tile 'i'. Elements past size() are not written.
+        template<std::size_t F>
+        void store(size_type i, typename vec_type<F>::type const & v) {
+            size_type first = i * SIMD_STRIDE;
+            if (first + SIMD_STRIDE <= mSize) {
+                v.storea(block<F>(i));
+            }
+            else {
+                v.storeTail(block<F>(i), uint32_t(mSize - first));
+            }
+        }
+    };
+
+}
+
+#endif
@@ -0,0 +1,275 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_DISPATCH_H_
+#define UME_DISPATCH_H_
+
+// Runtime CPU dispatch.
+//
+// UMESimd.h selects exactly one plugin at compile time, depending on the ISA macros passed
+// to the compiler. To ship a single binary running on machines with different instruction sets,
+// a kernel can be compiled once per plugin, in separate translation units, and the best version
+// selected at startup.
+//
+// Kernel translation units include "UMEDispatchTarget.h" BEFORE "UMESimd.h". This moves the
+// whole library into a namespace specific to the ISA the unit is compiled for, so that inline
+// functions compiled with different instruction sets are never merged by the linker. The same
+// kernel source can then be compiled several times:
+//
+//     // kernel.cpp, compiled with: (none), -msse4.2, -mavx, -mavx2 -mfma, -march=skylake-avx512
+//     #include "UMEDispatchTarget.h"
+//     #include "UMESimd.h"
+//
+//     float UME_DISPATCH_NAME(sum)(float const * a, int n) {
+//         UME::SIMD::SIMDVec<float, 8> vec(0.0f);
+//         ...
+//     }
+//
+// The dispatching translation unit (compiled without any ISA flags) declares all versions
+// and creates a dispatcher. The selection is made once and cached:
+//
+//     #include "UMEDispatch.h"
+//
+//     UME_DISPATCH_DECLARE(float, sum, (float const *, int));
+//
+//     static auto sum = UME_DISPATCH_CREATE(sum);
+//     ...
+//     float s = sum(a, n);
+//
+// Kernel translation units should not include this header, and should avoid instantiating
+// templates (e.g. from the standard library) that are also instantiated in other units, as
+// these are not renamed. Setting the UME_DISPATCH_ISA environment variable to one of
+// "scalar", "sse", "avx", "avx2", "avx512" limits the highest instruction set selected.
+
+#if defined(UME_DISPATCH_TARGET_ISA)
+#error "UMEDispatch.h cannot be included in a kernel translation unit (after UMEDispatchTarget.h)"
+#endif
+
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "UMEBasicTypes.h"
+#include "UMEInline.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define UME_DISPATCH_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace UME {
+namespace SIMD {
+namespace DISPATCH {
+
+    // Instruction sets for which dispatched kernels can be compiled.
+    // Values are ordered so that a higher value supersedes all lower ones.
+    enum ISA {
+        ISA_SCALAR = 0,
+        ISA_SSE,
+        ISA_AVX,
+        ISA_AVX2,
+        ISA_AVX512,
+        ISA_COUNT
+    };
+
+    inline const char* isaName(ISA isa) {
+        switch (isa) {
+        case ISA_SCALAR: return "scalar";
+        case ISA_SSE:    return "sse";
+        case ISA_AVX:    return "avx";
+        case ISA_AVX2:   return "avx2";
+        case ISA_AVX512: return "avx512";
+        default:         return "unknown";
+        }
+    }
+
+#if defined(UME_DISPATCH_X86)
+    inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+        int tmp[4];
+        __cpuidex(tmp, int(leaf), int(subleaf));
+        for (int i = 0; i < 4; i++) regs[i] = uint32_t(tmp[i]);
+#else
+        unsigned int a = 0, b = 0, c = 0, d = 0;
+        if (__get_cpuid_max(leaf & 0x80000000, nullptr) >= leaf) {
+            __cpuid_count(leaf, subleaf, a, b, c, d);
+        }
+        regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+#endif
+    }
+
+    // Register state enabled by the OS (XCR0). Only valid if OSXSAVE is set.
+    inline uint64_t xgetbv() {
+#if defined(_MSC_VER)
+        return uint64_t(_xgetbv(0));
+#else
+        uint32_t eax, edx;
+        __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (uint64_t(edx) << 32) | eax;
+#endif
+    }
+#endif
+
+    // Query the processor for the highest supported ISA. Both the processor and the operating
+    // system (saving of extended register state) have to support an instruction set.
+    inline ISA detectISA() {
+#if defined(UME_DISPATCH_X86)
+        uint32_t leaf1[4], leaf7[4];
+        cpuid(1, 0, leaf1);
+        cpuid(7, 0, leaf7);
+
+        // SSE plugin targets SSE2 + SSSE3 + SSE4.1 + SSE4.2 (Nehalem level)
+        bool sse2    = (leaf1[3] & (1u << 26)) != 0;
+        const uint32_t sseBits = (1u << 9) | (1u << 19) | (1u << 20);
+        if (!sse2 || (leaf1[2] & sseBits) != sseBits) return ISA_SCALAR;
+
+        bool osxsave = (leaf1[2] & (1u << 27)) != 0;
+        bool avx     = (leaf1[2] & (1u << 28)) != 0;
+        bool fma     = (leaf1[2] & (1u << 12)) != 0;
+        if (!osxsave || !avx) return ISA_SSE;
+
+        uint64_t xcr0 = xgetbv();
+        // XMM and YMM state
+        if ((xcr0 & 0x6) != 0x6) return ISA_SSE;
+
+        bool avx2 = (leaf7[1] & (1u << 5)) != 0;
+        if (!avx2 || !fma) return ISA_AVX;
+
+        // opmask, ZMM0-15 upper halves and ZMM16-31 state
+        bool zmmState = (xcr0 & 0xE0) == 0xE0;
+        // AVX512 plugin targets F + CD + DQ + BW + VL (Skylake-SP level)
+        const uint32_t avx512Bits = (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31);
+        if (!zmmState || (leaf7[1] & avx512Bits) != avx512Bits) return ISA_AVX2;
+
+        return ISA_AVX512;
+#else
+        return ISA_SCALAR;
+#endif
+    }
+
+    // Highest ISA that should be used by dispatchers: the detected one, optionally limited by
+    // the UME_DISPATCH_ISA environment variable. Detection is performed only once.
+    inline ISA dispatchISA() {
+        static const ISA isa = []() {
+            ISA detected = detectISA();
+            const char* limit = std::getenv("UME_DISPATCH_ISA");
+            if (limit != nullptr) {
+                for (int i = 0; i < ISA_COUNT; i++) {
+                    if (std::strcmp(limit, isaName(ISA(i))) == 0) {
+                        return ISA(i) < detected ? ISA(i) : detected;
+                    }
+                }
+            }
+            return detected;
+        }();
+        return isa;
+    }
+
+    inline bool isSupported(ISA isa) {
+        return isa <= dispatchISA();
+    }
+
+    // Table of function pointers, one per ISA. The scalar version has to be always provided,
+    // as it is used on machines not supporting any of the other instruction sets. The best
+    // available version is selected when the table is modified, so that calling through
+    // the dispatcher costs a single indirect call.
+    template<typename FUNC_T>
+    class Dispatcher {
+    private:
+        FUNC_T mTable[ISA_COUNT];
+        FUNC_T mSelected;
+        ISA    mSelectedISA;
+
+        inline void select() {
+            for (int i = dispatchISA(); i >= 0; i--) {
+                if (mTable[i] != nullptr) {
+                    mSelected = mTable[i];
+                    mSelectedISA = ISA(i);
+                    return;
+                }
+            }
+        }
+
+    public:
+        explicit Dispatcher(FUNC_T scalarFunc) {
+            for (int i = 0; i < ISA_COUNT; i++) mTable[i] = nullptr;
+            mTable[ISA_SCALAR] = scalarFunc;
+            mSelected = scalarFunc;
+            mSelectedISA = ISA_SCALAR;
+            select();
+        }
+
+        inline Dispatcher & set(ISA isa, FUNC_T func) {
+            mTable[isa] = func;
+            select();
+            return *this;
+        }
+
+        inline FUNC_T get() const { return mSelected; }
+
+        inline ISA selectedISA() const { return mSelectedISA; }
+
+        template<typename... ARGS>
+        UME_FORCE_INLINE auto operator() (ARGS && ... args) const
+            -> decltype(mSelected(std::forward<ARGS>(args)...))
+        {
+            return mSelected(std::forward<ARGS>(args)...);
+        }
+    };
+
+}
+}
+}
+
+// Declare a kernel compiled for a single ISA. ISA_SUFFIX is one of: SCALAR, SSE, AVX, AVX2, AVX512.
+#define UME_DISPATCH_DECLARE_ISA(RETURN_TYPE, NAME, ISA_SUFFIX, ARGS) \
+    RETURN_TYPE NAME##_##ISA_SUFFIX ARGS
+
+// Declare all ISA versions of a kernel defined using UME_DISPATCH_NAME(NAME).
+#define UME_DISPATCH_DECLARE(RETURN_TYPE, NAME, ARGS) \
+    UME_DISPATCH_DECLARE_ISA(RETURN_TYPE, NAME, SCALAR, ARGS); \
+    UME_DISPATCH_DECLARE_ISA(RETURN_TYPE, NAME, SSE, ARGS); \
+    UME_DISPATCH_DECLARE_ISA(RETURN_TYPE, NAME, AVX, ARGS); \
+    UME_DISPATCH_DECLARE_ISA(RETURN_TYPE, NAME, AVX2, ARGS); \
+    UME_DISPATCH_DECLARE_ISA(RETURN_TYPE, NAME, AVX512, ARGS)
+
+// Create a dispatcher selecting between all ISA versions of a kernel.
+#define UME_DISPATCH_CREATE(NAME) \
+    UME::SIMD::DISPATCH::Dispatcher<decltype(&NAME##_SCALAR)>(&NAME##_SCALAR) \
+        .set(UME::SIMD::DISPATCH::ISA_SSE, &NAME##_SSE) \
+        .set(UME::SIMD::DISPATCH::ISA_AVX, &NAME##_AVX) \
+        .set(UME::SIMD::DISPATCH::ISA_AVX2, &NAME##_AVX2) \
+        .set(UME::SIMD::DISPATCH::ISA_AVX512, &NAME##_AVX512)
+
+#endif
@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_DISPATCH_TARGET_H_
+#define UME_DISPATCH_TARGET_H_
+
+// Include this header as the first UME header of a kernel translation unit built for
+// runtime dispatch (see UMEDispatch.h). Depending on the ISA the unit is compiled for,
+// it defines:
+//
+//    UME_DISPATCH_TARGET_ISA  - suffix of the target: SCALAR, SSE, AVX, AVX2 or AVX512,
+//    UME_DISPATCH_NAME(NAME)  - kernel name decorated with the suffix, e.g. NAME_AVX2,
+//
+// and renames the UME namespace (e.g. to UME_AVX2), so that code compiled for different
+// instruction sets never shares symbols.
+
+#if defined(UME_SIMD_H_)
+#error "UMEDispatchTarget.h has to be included before UMESimd.h"
+#endif
+
+#if defined(FORCE_SCALAR)
+    #define UME_DISPATCH_TARGET_ISA SCALAR
+#elif defined(__AVX512F__)
+    #define UME_DISPATCH_TARGET_ISA AVX512
+#elif defined(__AVX2__)
+    #define UME_DISPATCH_TARGET_ISA AVX2
+#elif defined(__AVX__)
+    #define UME_DISPATCH_TARGET_ISA AVX
+#elif defined(__SSE4_2__)
+    #define UME_DISPATCH_TARGET_ISA SSE
+#else
+    #define UME_DISPATCH_TARGET_ISA SCALAR
+    // Make sure plugins for other architectures are not picked.
+    #define FORCE_SCALAR
+#endif
+
+#define UME_DISPATCH_CONCAT_IMPL(A, B) A##_##B
+#define UME_DISPATCH_CONCAT(A, B) UME_DISPATCH_CONCAT_IMPL(A, B)
+
+#define UME_DISPATCH_NAME(NAME) UME_DISPATCH_CONCAT(NAME, UME_DISPATCH_TARGET_ISA)
+
+#if defined(FORCE_SCALAR)
+    #define UME UME_SCALAR
+#elif defined(__AVX512F__)
+    #define UME UME_AVX512
+#elif defined(__AVX2__)
+    #define UME UME_AVX2
+#elif defined(__AVX__)
+    #define UME UME_AVX
+#else
+    #define UME UME_SSE
+#endif
+
+#endif
@@ -36,6 +36,14 @@
 #include <stdlib.h>
 
 #include <iostream>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "UMESimd.h"
 #include "UMEInline.h"
@@ -66,9 +74,99 @@
 
 #define ALIGNED_TYPE(type, alignment) typedef type UME_ALIGN(alignment)
 
+// Size in bytes from which DynamicMemory::MemCopy() and MemSet() use streaming stores.
+// 0 selects half of the last level cache size, detected at run time.
+#ifndef UME_STREAMING_THRESHOLD
+#define UME_STREAMING_THRESHOLD 0
+#endif
+
+// Length of the float vectors used for streaming stores, if the plugin provides them natively.
+#if !defined(FORCE_SCALAR) && !defined(FORCE_OPENMP) && !defined(__MIC__)
+    #if defined(__AVX512F__)
+        #define UME_STREAMING_VEC_LEN 16
+    #elif defined(__AVX__)
+        #define UME_STREAMING_VEC_LEN 8
+    #elif defined(__SSE2__)
+        #define UME_STREAMING_VEC_LEN 4
+    #endif
+#endif
+
 namespace UME
 {
 
+    // Placement of memory allocated with DynamicMemory::AlignedMalloc(size, alignment, policy).
+    //
+    // Large arrays streamed by SIMD kernels benefit from huge pages (fewer TLB misses) and,
+    // on NUMA systems, from being placed on the node(s) of the threads processing them:
+    //
+    //     UME::AllocationPolicy policy = UME::AllocationPolicy::interleave(0x3);
+    //     policy.hugePages = true;
+    //     float* x = (float*) UME::DynamicMemory::AlignedMalloc(n * sizeof(float), 64, policy);
+    //     ...
+    //     UME::DynamicMemory::AlignedFree(x, n * sizeof(float), policy);
+    //
+    // On Linux memory with a non-default policy is mapped directly from the system (mmap), so
+    // that page attributes do not leak to other allocations. Huge pages are requested with
+    // madvise(MADV_HUGEPAGE) and node placement with mbind(). Both are hints: when the system
+    // does not support them the memory is allocated without them. On other systems only the
+    // alignment is applied.
+    //
+    // Without a NUMA node policy, pages are placed on the node of the thread that touches
+    // them first. UME::SIMD::PARALLEL::first_touch() (UMEParallel.h) initializes an array in
+    // parallel with the same distribution of chunks over threads as later parallel loops.
+    struct AllocationPolicy {
+        enum NumaMode {
+            NUMA_DEFAULT,     // placement decided by the system (first touch)
+            NUMA_PREFERRED,   // prefer the first node in 'numaNodes'
+            NUMA_BIND,        // only nodes in 'numaNodes'
+            NUMA_INTERLEAVE   // pages distributed round-robin over nodes in 'numaNodes'
+        };
+
+        static const std::size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+        bool     hugePages;     // back the memory with transparent huge pages
+        bool     hugeAlign;     // align start and size to HUGE_PAGE_BYTES (implied by hugePages)
+        NumaMode numaMode;
+        uint64_t numaNodes;     // bit 'i' selects NUMA node 'i'
+
+        AllocationPolicy() : hugePages(false), hugeAlign(false), numaMode(NUMA_DEFAULT), numaNodes(0) {}
+
+        static AllocationPolicy huge() {
+            AllocationPolicy t0;
+            t0.hugePages = true;
+            t0.hugeAlign = true;
+            return t0;
+        }
+        static AllocationPolicy bind(uint64_t nodes) {
+            AllocationPolicy t0;
+            t0.numaMode = NUMA_BIND;
+            t0.numaNodes = nodes;
+            return t0;
+        }
+        static AllocationPolicy interleave(uint64_t nodes) {
+            AllocationPolicy t0;
+            t0.numaMode = NUMA_INTERLEAVE;
+            t0.numaNodes = nodes;
+            return t0;
+        }
+
+        bool isDefault() const {
+            return !hugePages && !hugeAlign && numaMode == NUMA_DEFAULT;
+        }
+        // Granularity of start and size of an allocation.
+        std::size_t pageBytes() const {
+            return (hugePages || hugeAlign) ? HUGE_PAGE_BYTES : 4096;
+        }
+
+        bool operator== (AllocationPolicy const & other) const {
+            return hugePages == other.hugePages && hugeAlign == other.hugeAlign
+                && numaMode == other.numaMode && numaNodes == other.numaNodes;
+        }
+        bool operator!= (AllocationPolicy const & other) const {
+            return !(*this == other);
+        }
+    };
+
     class DynamicMemory
     {
     public:
@@ -85,7 +183,7 @@ namespace UME
             void* ptr = _aligned_malloc(size, alignment);
             return ptr;
 #elif defined(__GNUC__) || defined(__ICC) || defined(__INTEL_COMPILER)
-            void* memptr;
+            void* memptr = nullptr;
             //std::cout << "AlignedMalloc: memptr(before):" << memptr;
 
             int retval = 0;
@@ -99,6 +197,7 @@ namespace UME
             {
                 std::cout << "posix_memalign error: " << retval << std::endl;
                 std::cout << "sizeof(void*): " << sizeof(void*) << std::endl;
+                memptr = nullptr;
             }
             //std::cout << "AlignedMalloc: memptr(after):" << memptr;
             return memptr;
@@ -124,15 +223,145 @@ namespace UME
 #endif
         }
 
-        static inline UME_ENV_FUNC_ATTRIB void* MemCopy(void *dst, void *src, size_t num)
+        // Allocate with a placement policy. Memory has to be released with
+        // AlignedFree(ptr, size, policy) using the same 'size' and 'policy'.
+        static inline UME_ENV_FUNC_ATTRIB void* AlignedMalloc(std::size_t size, std::size_t alignment, AllocationPolicy const & policy)
         {
-            // TODO: specialize it depending on the architecture and OS
+            if (policy.isDefault()) return AlignedMalloc(size, alignment);
+
+            std::size_t page = policy.pageBytes();
+            if (alignment < page) alignment = page;
+            std::size_t length = (size + page - 1) / page * page;
+#if defined(__linux__)
+            // Over-allocate by 'alignment' and unmap the unaligned head and the tail.
+            void* t0 = mmap(nullptr, length + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (t0 == MAP_FAILED) return nullptr;
+            char* t1 = (char*)((uintptr_t(t0) + alignment - 1) & ~uintptr_t(alignment - 1));
+            std::size_t head = std::size_t(t1 - (char*)t0);
+            if (head > 0) munmap(t0, head);
+            if (alignment - head > 0) munmap(t1 + length, alignment - head);
+#if defined(MADV_HUGEPAGE)
+            if (policy.hugePages) madvise(t1, length, MADV_HUGEPAGE);
+#endif
+#if defined(SYS_mbind)
+            if (policy.numaMode != AllocationPolicy::NUMA_DEFAULT) {
+                // NumaMode values are the MPOL_* modes of <numaif.h>.
+                unsigned long mask = (unsigned long)policy.numaNodes;
+                syscall(SYS_mbind, t1, length, int(policy.numaMode), &mask, sizeof(mask) * 8 + 1, 0);
+            }
+#endif
+            return t1;
+#else
+            return AlignedMalloc(length, alignment);
+#endif
+        }
+
+        static inline UME_ENV_FUNC_ATTRIB void AlignedFree(void *ptr, std::size_t size, AllocationPolicy const & policy)
+        {
+            if (policy.isDefault()) {
+                AlignedFree(ptr);
+                return;
+            }
+#if defined(__linux__)
+            std::size_t page = policy.pageBytes();
+            if (ptr != nullptr) munmap(ptr, (size + page - 1) / page * page);
+#else
+            AlignedFree(ptr);
+#endif
+        }
+
+        // Size of the last level cache in bytes, or 8 MiB if it cannot be determined.
+        static inline UME_ENV_FUNC_ATTRIB std::size_t LastLevelCacheBytes()
+        {
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+            long t0 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+            if (t0 <= 0) t0 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+            if (t0 > 0) return std::size_t(t0);
+#endif
+            return 8 * 1024 * 1024;
+        }
+
+        // MemCopy() and MemSet() write buffers of at least this size with streaming stores.
+        static inline UME_ENV_FUNC_ATTRIB std::size_t StreamingThreshold()
+        {
+            static const std::size_t threshold = (UME_STREAMING_THRESHOLD > 0) ?
+                std::size_t(UME_STREAMING_THRESHOLD) : LastLevelCacheBytes() / 2;
+            return threshold;
+        }
+
+        // Copy 'num' bytes. Buffers of StreamingThreshold() bytes or more are written with
+        // streaming stores (StreamCopy), smaller ones with std::memcpy.
+        static inline UME_ENV_FUNC_ATTRIB void* MemCopy(void *dst, void const *src, size_t num)
+        {
+            if (num >= StreamingThreshold()) return StreamCopy(dst, src, num);
             return std::memcpy(dst, src, num);
         }
+
+        // Set 'count' bytes to 'ch'. Buffers of StreamingThreshold() bytes or more are written
+        // with streaming stores (StreamSet), smaller ones with std::memset.
         static inline UME_ENV_FUNC_ATTRIB void MemSet(void *dst, int ch, std::size_t count)
         {
-            // TODO: specialize it depending on the architecture and OS
+            if (count >= StreamingThreshold()) StreamSet(dst, ch, count);
+            else std::memset(dst, ch, count);
+        }
+
+        // Copy 'num' bytes with streaming (non-temporal) stores. Destination cache lines are
+        // written to memory directly, without being read first and without evicting the data
+        // held in the caches. Pays off for buffers that do not fit in the last level cache and
+        // are not read again soon. The copy is complete and visible to other threads on return.
+        static inline UME_ENV_FUNC_ATTRIB void* StreamCopy(void *dst, void const *src, std::size_t num)
+        {
+#if defined(UME_STREAMING_VEC_LEN)
+            typedef UME::SIMD::SIMDVec<float, UME_STREAMING_VEC_LEN> VEC_T;
+            const std::size_t VEC_BYTES = UME_STREAMING_VEC_LEN * sizeof(float);
+            char* t0 = (char*)dst;
+            char const* t1 = (char const*)src;
+            // Align the destination to a cache line.
+            std::size_t head = (64 - (uintptr_t(t0) & 63)) & 63;
+            if (head > num) head = num;
+            std::memcpy(t0, t1, head);
+            t0 += head;
+            t1 += head;
+            num -= head;
+            for (; num >= 64; num -= 64, t0 += 64, t1 += 64) {
+                for (std::size_t i = 0; i < 64; i += VEC_BYTES) {
+                    VEC_T t2;
+                    t2.load((float const*)(t1 + i));
+                    t2.sstore((float*)(t0 + i));
+                }
+            }
+            _mm_sfence();
+            std::memcpy(t0, t1, num);
+            return dst;
+#else
+            return std::memcpy(dst, src, num);
+#endif
+        }
+
+        // Set 'count' bytes to 'ch' with streaming (non-temporal) stores. See StreamCopy().
+        static inline UME_ENV_FUNC_ATTRIB void StreamSet(void *dst, int ch, std::size_t count)
+        {
+#if defined(UME_STREAMING_VEC_LEN)
+            typedef UME::SIMD::SIMDVec<float, UME_STREAMING_VEC_LEN> VEC_T;
+            const std::size_t VEC_BYTES = UME_STREAMING_VEC_LEN * sizeof(float);
+            char* t0 = (char*)dst;
+            std::size_t head = (64 - (uintptr_t(t0) & 63)) & 63;
+            if (head > count) head = count;
+            std::memset(t0, ch, head);
+            t0 += head;
+            count -= head;
+            uint32_t t1 = uint32_t(uint8_t(ch)) * 0x01010101u;
+            float t2;
+            std::memcpy(&t2, &t1, sizeof(float));
+            VEC_T t3(t2);
+            for (; count >= 64; count -= 64, t0 += 64) {
+                for (std::size_t i = 0; i < 64; i += VEC_BYTES) t3.sstore((float*)(t0 + i));
+            }
+            _mm_sfence();
+            std::memset(t0, ch, count);
+#else
             std::memset(dst, ch, count);
+#endif
         }
     };
 
@@ -148,42 +377,74 @@ namespace UME
         return to;
     }
     
+    // Allocator for standard containers, aligning storage for SIMDVec<T, SIMD_STRIDE>:
+    //
+    //     std::vector<float, UME::AlignedAllocator<float, 8>> x(n);
+    //
+    // Containers allocating other types than 'T' (e.g. list nodes) get memory aligned
+    // for these types only.
+    //
+    // An allocator constructed with an AllocationPolicy applies it to all its allocations:
+    //
+    //     UME::AlignedAllocator<float, 8> hugeAlloc(UME::AllocationPolicy::huge());
+    //     std::vector<float, UME::AlignedAllocator<float, 8>> y(n, 0.0f, hugeAlloc);
     template<class T, int SIMD_STRIDE>
     struct AlignedAllocator {
+        typedef T value_type;
+        template<class U> struct rebind { typedef AlignedAllocator<U, SIMD_STRIDE> other; };
+
+        AllocationPolicy mPolicy;
+
         UME_FUNC_ATTRIB  AlignedAllocator() {}
+        UME_FUNC_ATTRIB  explicit AlignedAllocator(AllocationPolicy const & policy) : mPolicy(policy) {}
         UME_FUNC_ATTRIB  ~AlignedAllocator() {}
-        template <class U> UME_FUNC_ATTRIB  AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE> & other) {}
+        template <class U> UME_FUNC_ATTRIB  AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE> & other) : mPolicy(other.mPolicy) {}
+        // Same as SIMDVec<T, SIMD_STRIDE>::alignment() for arithmetic types.
+        static constexpr std::size_t alignment() {
+            return std::is_arithmetic<T>::value ? SIMD_STRIDE * sizeof(T) : alignof(T);
+        }
+        // Allocate storage for 'n' elements. Throws std::bad_alloc on failure, as
+        // standard containers expect.
         UME_FUNC_ATTRIB  T* allocate(std::size_t n) {
-            uint32_t alignment = UME::SIMD::SIMDVec<T, SIMD_STRIDE>::alignment();
-            return (T*)DynamicMemory::AlignedMalloc(n, std::size_t(alignment));
+            void* t0 = DynamicMemory::AlignedMalloc(n * sizeof(T), alignment(), mPolicy);
+            if (t0 == nullptr && n != 0) throw std::bad_alloc();
+            return (T*)t0;
         }
         UME_FUNC_ATTRIB  void deallocate(T* p, std::size_t n) {
-            DynamicMemory::AlignedFree(p);
+            DynamicMemory::AlignedFree(p, n * sizeof(T), mPolicy);
         }
     };
     
     // Specialize for bool
     template<int SIMD_STRIDE>
     struct AlignedAllocator<bool, SIMD_STRIDE> {
+        typedef bool value_type;
+        template<class U> struct rebind { typedef AlignedAllocator<U, SIMD_STRIDE> other; };
+
+        AllocationPolicy mPolicy;
+
         UME_FUNC_ATTRIB  AlignedAllocator() {}
+        UME_FUNC_ATTRIB  explicit AlignedAllocator(AllocationPolicy const & policy) : mPolicy(policy) {}
         UME_FUNC_ATTRIB  ~AlignedAllocator() {}
-        template <class U> UME_FUNC_ATTRIB AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE> & other) {}
+        template <class U> UME_FUNC_ATTRIB AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE> & other) : mPolicy(other.mPolicy) {}
         UME_FUNC_ATTRIB  bool* allocate(std::size_t n) {
             uint32_t alignment = UME::SIMD::SIMDVecMask<SIMD_STRIDE>::alignment();
-            return (bool*)DynamicMemory::AlignedMalloc(n, std::size_t(alignment));
+            void* t0 = DynamicMemory::AlignedMalloc(n * sizeof(bool), std::size_t(alignment), mPolicy);
+            if (t0 == nullptr && n != 0) throw std::bad_alloc();
+            return (bool*)t0;
         }
         UME_FUNC_ATTRIB  void deallocate(bool* p, std::size_t n) {
-            DynamicMemory::AlignedFree(p);
+            DynamicMemory::AlignedFree(p, n * sizeof(bool), mPolicy);
         }
     };
     
     template <class T, class U, int SIMD_STRIDE1, int SIMD_STRIDE2>
-    UME_FUNC_ATTRIB bool operator==(const AlignedAllocator<T, SIMD_STRIDE1>&, const AlignedAllocator<U, SIMD_STRIDE2>&) {
-        return std::is_same<T, U>::value && (SIMD_STRIDE1 == SIMD_STRIDE2);
+    UME_FUNC_ATTRIB bool operator==(const AlignedAllocator<T, SIMD_STRIDE1>& a, const AlignedAllocator<U, SIMD_STRIDE2>& b) {
+        return SIMD_STRIDE1 == SIMD_STRIDE2 && a.mPolicy == b.mPolicy;
     }
     template <class T, class U, int SIMD_STRIDE1, int SIMD_STRIDE2>
-    UME_FUNC_ATTRIB bool operator!=(const AlignedAllocator<T, SIMD_STRIDE1>&, const AlignedAllocator<U, SIMD_STRIDE2>&) {
-        return !(std::is_same<T, U>::value && (SIMD_STRIDE1 == SIMD_STRIDE2));
+    UME_FUNC_ATTRIB bool operator!=(const AlignedAllocator<T, SIMD_STRIDE1>& a, const AlignedAllocator<U, SIMD_STRIDE2>& b) {
+        return !(a == b);
     }
 #include "utilities/ignore_warnings_pop.h"
     
@@ -0,0 +1,481 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_PARALLEL_H_
+#define UME_PARALLEL_H_
+
+// Multi-threaded execution of SIMD kernels.
+//
+// The plugins vectorise code within a single core. Loops over large arrays are usually limited
+// by memory bandwidth, which a single core cannot saturate. The functions below split an array
+// into chunks and process them on all threads of a pool:
+//
+//     typedef UME::SIMD::SIMDVec<float, 8> VEC_T;
+//
+//     float* x = (float*) UME::DynamicMemory::AlignedMalloc(n * sizeof(float), VEC_T::alignment());
+//     UME::SIMD::PARALLEL::first_touch<VEC_T>(x, n, 0.0f);
+//     ...
+//     UME::SIMD::PARALLEL::transform<VEC_T>(x, x, n, [](VEC_T const & a) { return a * 2.0f; });
+//     float sum = UME::SIMD::PARALLEL::reduce<VEC_T>(x, n);
+//
+// The array is divided into chunks of UME_PARALLEL_CHUNK_BYTES bytes (rounded to full vectors),
+// so that chunk boundaries keep the alignment of the array and a chunk fits in the L2 cache.
+// Each thread owns a contiguous range of chunks. A thread that completes its own range takes
+// remaining chunks from the ranges of other threads (work stealing), so that threads slowed down
+// by other processes do not delay the whole loop.
+//
+// On NUMA systems memory pages are allocated on the node of the thread that touches them
+// first. first_touch() writes the range of chunks owned by each thread on that thread only,
+// without work stealing. Called on freshly allocated memory, with the same pool and array length
+// as later loops, it places each range in the memory local to the thread starting on it. Chunks
+// taken by work stealing in later loops may still be remote. Worker threads are pinned to CPUs
+// on Linux, so that this placement stays valid. The thread calling a parallel function works on
+// the range of thread 0 and is not pinned by the pool; the application can pin it (e.g. with
+// pthread_setaffinity_np()) to keep that range local as well.
+//
+// The thread calling a parallel function takes part in the work and returns once all chunks
+// are processed. Calls made from inside a parallel function run on the calling thread only.
+//
+// Programs using this header have to be compiled with thread support (e.g. -pthread).
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "UMESimd.h"
+#include "UMEAlgorithms.h"
+
+#ifndef UME_PARALLEL_CHUNK_BYTES
+#define UME_PARALLEL_CHUNK_BYTES (64 * 1024)
+#endif
+
+namespace UME {
+namespace SIMD {
+namespace PARALLEL {
+
+    // True for threads executing a job of any pool.
+    inline bool & insideParallelRegion() {
+        static thread_local bool inside = false;
+        return inside;
+    }
+
+    class ThreadPool {
+    private:
+        std::vector<std::thread> mThreads;
+
+        std::mutex              mMutex;
+        std::condition_variable mStartCond;
+        std::condition_variable mDoneCond;
+        std::function<void(unsigned int)> const * mJob;
+        uint64_t                mGeneration;
+        unsigned int            mPending;
+        bool                    mStop;
+        // Exception thrown by a worker in the current job, rethrown by run().
+        std::exception_ptr      mError;
+
+        // Serializes jobs submitted from different threads.
+        std::mutex              mRunMutex;
+
+        void worker(unsigned int id) {
+            insideParallelRegion() = true;
+            uint64_t generation = 0;
+            for (;;) {
+                std::function<void(unsigned int)> const * job;
+                {
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    mStartCond.wait(lock, [this, generation]() { return mStop || mGeneration != generation; });
+                    if (mStop) return;
+                    generation = mGeneration;
+                    job = mJob;
+                }
+                std::exception_ptr error;
+                try {
+                    (*job)(id);
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (error && !mError) mError = error;
+                    if (--mPending == 0) mDoneCond.notify_one();
+                }
+            }
+        }
+
+#if defined(__linux__)
+        // Pin each worker to a different CPU from the set this process is allowed to run on.
+        // The first CPU of the set is left for the calling thread (id 0), which is not pinned:
+        // it belongs to the application, and jobs can be submitted from different threads.
+        void pinWorkers() {
+            cpu_set_t allowed;
+            CPU_ZERO(&allowed);
+            if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return;
+
+            std::vector<int> cpus;
+            for (int i = 0; i < CPU_SETSIZE; i++) {
+                if (CPU_ISSET(i, &allowed)) cpus.push_back(i);
+            }
+            if (cpus.size() < mThreads.size() + 1) return;
+
+            for (std::size_t i = 0; i < mThreads.size(); i++) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(cpus[i + 1], &set);
+                pthread_setaffinity_np(mThreads[i].native_handle(), sizeof(set), &set);
+            }
+        }
+#endif
+
+    public:
+        // Number of threads used when not given explicitly: the UME_NUM_THREADS environment
+        // variable if set, or the number of CPUs available to the process.
+        static unsigned int defaultThreadCount() {
+            const char* env = std::getenv("UME_NUM_THREADS");
+            if (env != nullptr && std::atoi(env) > 0) return (unsigned int)std::atoi(env);
+#if defined(__linux__)
+            cpu_set_t allowed;
+            CPU_ZERO(&allowed);
+            if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0 && CPU_COUNT(&allowed) > 0) {
+                return (unsigned int)CPU_COUNT(&allowed);
+            }
+#endif
+            unsigned int count = std::thread::hardware_concurrency();
+            return count > 0 ? count : 1;
+        }
+
+        // Creates 'threadCount - 1' worker threads. The thread submitting a job is the last one.
+        explicit ThreadPool(unsigned int threadCount = 0, bool pinThreads = true) :
+            mJob(nullptr), mGeneration(0), mPending(0), mStop(false)
+        {
+            if (threadCount == 0) threadCount = defaultThreadCount();
+            for (unsigned int i = 1; i < threadCount; i++) {
+                mThreads.push_back(std::thread(&ThreadPool::worker, this, i));
+            }
+#if defined(__linux__)
+            if (pinThreads) pinWorkers();
+#else
+            (void)pinThreads;
+#endif
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mStop = true;
+            }
+            mStartCond.notify_all();
+            for (std::size_t i = 0; i < mThreads.size(); i++) mThreads[i].join();
+        }
+
+        ThreadPool(ThreadPool const &) = delete;
+        ThreadPool & operator= (ThreadPool const &) = delete;
+
+        inline unsigned int size() const { return (unsigned int)mThreads.size() + 1; }
+
+        // Call 'func(id)' once for each id in [0, size()), each on a different thread.
+        // Returns when all calls have completed. If any call throws, one of the exceptions
+        // is rethrown after all calls have completed.
+        template<typename FUNC_T>
+        void run(FUNC_T const & func) {
+            if (insideParallelRegion() || mThreads.empty()) {
+                for (unsigned int i = 0; i < size(); i++) func(i);
+                return;
+            }
+
+            std::function<void(unsigned int)> job(func);
+            std::lock_guard<std::mutex> runLock(mRunMutex);
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mJob = &job;
+                mPending = (unsigned int)mThreads.size();
+                mGeneration++;
+            }
+            mStartCond.notify_all();
+
+            std::exception_ptr error;
+            insideParallelRegion() = true;
+            try {
+                job(0);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            insideParallelRegion() = false;
+
+            // The workers still use 'job' and the state it refers to, so wait for them even
+            // if the calling thread has thrown.
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mDoneCond.wait(lock, [this]() { return mPending == 0; });
+                mJob = nullptr;
+                if (!error) error = mError;
+                mError = nullptr;
+            }
+            if (error) std::rethrow_exception(error);
+        }
+
+        // Pool shared by all parallel functions when no pool is given. Created on first use.
+        static ThreadPool & global() {
+            static ThreadPool pool;
+            return pool;
+        }
+    };
+
+    // Default number of elements in a chunk: UME_PARALLEL_CHUNK_BYTES, rounded down to full vectors.
+    template<typename VEC_T>
+    inline std::size_t chunkLength() {
+        typedef typename SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+        std::size_t length = UME_PARALLEL_CHUNK_BYTES / sizeof(SCALAR_T);
+        length -= length % VEC_T::length();
+        return length > 0 ? length : VEC_T::length();
+    }
+
+    // Call 'func(threadId, begin, end)' for consecutive ranges [begin, end) of 'chunkLen'
+    // elements covering [0, n). Each thread first processes its own contiguous block of chunks
+    // and then steals chunks from the blocks of other threads.
+    template<typename FUNC_T>
+    void parallel_for(std::size_t n, std::size_t chunkLen, FUNC_T const & func, ThreadPool & pool = ThreadPool::global()) {
+        if (n == 0) return;
+
+        // Aligned to a cache line, so that counters of different threads do not share one.
+        struct alignas(64) ChunkRange {
+            std::atomic<std::size_t> next;
+            std::size_t              end;
+        };
+
+        const unsigned int threadCount = pool.size();
+        const std::size_t chunkCount = (n + chunkLen - 1) / chunkLen;
+        std::vector<ChunkRange, AlignedAllocator<ChunkRange, 1>> ranges(threadCount);
+        for (unsigned int i = 0; i < threadCount; i++) {
+            ranges[i].next = chunkCount * i / threadCount;
+            ranges[i].end = chunkCount * (i + 1) / threadCount;
+        }
+
+        pool.run([&](unsigned int id) {
+            for (unsigned int k = 0; k < threadCount; k++) {
+                ChunkRange & range = ranges[(id + k) % threadCount];
+                for (;;) {
+                    std::size_t chunk = range.next.fetch_add(1);
+                    if (chunk >= range.end) break;
+                    std::size_t begin = chunk * chunkLen;
+                    std::size_t end = (begin + chunkLen) < n ? (begin + chunkLen) : n;
+                    func(id, begin, end);
+                }
+            }
+        });
+    }
+
+    // Same as parallel_for(), but each thread processes only its own block of chunks, without
+    // work stealing. The elements processed by a thread depend only on 'n', 'chunkLen' and the
+    // size of 'pool'.
+    template<typename FUNC_T>
+    void parallel_for_static(std::size_t n, std::size_t chunkLen, FUNC_T const & func, ThreadPool & pool = ThreadPool::global()) {
+        if (n == 0) return;
+
+        const unsigned int threadCount = pool.size();
+        const std::size_t chunkCount = (n + chunkLen - 1) / chunkLen;
+        pool.run([&](unsigned int id) {
+            std::size_t first = chunkCount * id / threadCount;
+            std::size_t last = chunkCount * (id + 1) / threadCount;
+            for (std::size_t chunk = first; chunk < last; chunk++) {
+                std::size_t begin = chunk * chunkLen;
+                std::size_t end = (begin + chunkLen) < n ? (begin + chunkLen) : n;
+                func(id, begin, end);
+            }
+        });
+    }
+
+    // Write 'value' to all elements. Each thread writes only the block of chunks it owns in the
+    // other parallel functions (see parallel_for_static()). On NUMA systems, call it on freshly
+    // allocated memory to place the pages of each block close to the thread starting on it.
+    template<typename VEC_T>
+    void first_touch(
+        typename SIMDTraits<VEC_T>::SCALAR_T * p,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T value,
+        ThreadPool & pool = ThreadPool::global())
+    {
+        const std::size_t VEC_LEN = VEC_T::length();
+        parallel_for_static(n, chunkLength<VEC_T>(), [p, value, VEC_LEN](unsigned int, std::size_t begin, std::size_t end) {
+            VEC_T t0(value);
+            std::size_t i = begin;
+            for (; i + VEC_LEN <= end; i += VEC_LEN) t0.store(p + i);
+            if (i < end) t0.storeTail(p + i, uint32_t(end - i));
+        }, pool);
+    }
+
+    // DynamicMemory::MemCopy() of 'n' bytes, split over the threads of 'pool'. Whether streaming
+    // stores are used depends on the total size.
+    inline void memCopy(void* dst, void const* src, std::size_t n, ThreadPool & pool = ThreadPool::global()) {
+        char* t0 = (char*)dst;
+        char const* t1 = (char const*)src;
+        bool stream = n >= DynamicMemory::StreamingThreshold();
+        parallel_for(n, UME_PARALLEL_CHUNK_BYTES, [t0, t1, stream](unsigned int, std::size_t begin, std::size_t end) {
+            if (stream) DynamicMemory::StreamCopy(t0 + begin, t1 + begin, end - begin);
+            else std::memcpy(t0 + begin, t1 + begin, end - begin);
+        }, pool);
+    }
+
+    // DynamicMemory::MemSet() of 'n' bytes, split over the threads of 'pool'.
+    inline void memSet(void* dst, int ch, std::size_t n, ThreadPool & pool = ThreadPool::global()) {
+        char* t0 = (char*)dst;
+        bool stream = n >= DynamicMemory::StreamingThreshold();
+        parallel_for(n, UME_PARALLEL_CHUNK_BYTES, [t0, ch, stream](unsigned int, std::size_t begin, std::size_t end) {
+            if (stream) DynamicMemory::StreamSet(t0 + begin, ch, end - begin);
+            else std::memset(t0 + begin, ch, end - begin);
+        }, pool);
+    }
+
+    // out[i] = op(in[i]), for i in [0, n).
+    template<typename VEC_T, typename UNARY_OP>
+    void transform(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        UNARY_OP const & op,
+        ThreadPool & pool = ThreadPool::global())
+    {
+        parallel_for(n, chunkLength<VEC_T>(), [in, out, &op](unsigned int, std::size_t begin, std::size_t end) {
+            UME::SIMD::transform<VEC_T>(in + begin, out + begin, end - begin, op);
+        }, pool);
+    }
+
+    // out[i] = op(in1[i], in2[i]), for i in [0, n).
+    template<typename VEC_T, typename BINARY_OP>
+    void transform(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in1,
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in2,
+        typename SIMDTraits<VEC_T>::SCALAR_T * out,
+        std::size_t n,
+        BINARY_OP const & op,
+        ThreadPool & pool = ThreadPool::global())
+    {
+        parallel_for(n, chunkLength<VEC_T>(), [in1, in2, out, &op](unsigned int, std::size_t begin, std::size_t end) {
+            UME::SIMD::transform<VEC_T>(in1 + begin, in2 + begin, out + begin, end - begin, op);
+        }, pool);
+    }
+
+    // Each thread accumulates the vectors returned by 'chunkOp(begin, end)' for its chunks into
+    // a private vector. Returns the per-thread vectors combined with 'reduceOp', in thread order.
+    template<typename VEC_T, typename CHUNK_OP, typename REDUCE_OP>
+    VEC_T reduceChunks(
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        CHUNK_OP const & chunkOp,
+        REDUCE_OP const & reduceOp,
+        ThreadPool & pool)
+    {
+        typedef typename SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+        const std::size_t VEC_LEN = VEC_T::length();
+
+        // Per-thread results are kept in memory as scalars, as std::vector does not guarantee
+        // the alignment of vector types.
+        std::vector<SCALAR_T> partial(pool.size() * VEC_LEN, identity);
+        parallel_for(n, chunkLength<VEC_T>(), [&](unsigned int id, std::size_t begin, std::size_t end) {
+            VEC_T acc;
+            acc.load(&partial[id * VEC_LEN]);
+            acc = reduceOp(acc, chunkOp(begin, end));
+            acc.store(&partial[id * VEC_LEN]);
+        }, pool);
+
+        VEC_T result(identity);
+        for (unsigned int i = 0; i < pool.size(); i++) {
+            VEC_T t0;
+            t0.load(&partial[i * VEC_LEN]);
+            result = reduceOp(result, t0);
+        }
+        return result;
+    }
+
+    // Reduce 'n' elements with 'reduceOp', which has to be associative and commutative.
+    // 'identity' is the neutral element of 'reduceOp'.
+    template<typename VEC_T, typename REDUCE_OP>
+    typename SIMDTraits<VEC_T>::SCALAR_T reduce(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        REDUCE_OP const & reduceOp,
+        ThreadPool & pool = ThreadPool::global())
+    {
+        VEC_T t0 = reduceChunks<VEC_T>(n, identity, [in, identity, &reduceOp](std::size_t begin, std::size_t end) {
+            return ALGORITHMS::reduceToVector<VEC_T>(in + begin, end - begin, identity, reduceOp);
+        }, reduceOp, pool);
+        return ALGORITHMS::horizontal(t0, reduceOp);
+    }
+
+    // Sum of 'n' elements. Per-thread vector sums are added and reduced with HADD.
+    template<typename VEC_T>
+    typename SIMDTraits<VEC_T>::SCALAR_T reduce(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        ThreadPool & pool = ThreadPool::global())
+    {
+        typedef typename SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+        auto add = [](VEC_T const & a, VEC_T const & b) { return a + b; };
+        VEC_T t0 = reduceChunks<VEC_T>(n, SCALAR_T(0), [in, &add](std::size_t begin, std::size_t end) {
+            return ALGORITHMS::reduceToVector<VEC_T>(in + begin, end - begin, SCALAR_T(0), add);
+        }, add, pool);
+        return t0.hadd();
+    }
+
+    // reduceOp(transformOp(in[0]), transformOp(in[1]), ...)
+    template<typename VEC_T, typename REDUCE_OP, typename UNARY_OP>
+    typename SIMDTraits<VEC_T>::SCALAR_T transform_reduce(
+        typename SIMDTraits<VEC_T>::SCALAR_T const * in,
+        std::size_t n,
+        typename SIMDTraits<VEC_T>::SCALAR_T identity,
+        REDUCE_OP const & reduceOp,
+        UNARY_OP const & transformOp,
+        ThreadPool & pool = ThreadPool::global())
+    {
+        VEC_T t0 = reduceChunks<VEC_T>(n, identity, [in, identity, &reduceOp, &transformOp](std::size_t begin, std::size_t end) {
+            return ALGORITHMS::transformReduceToVector<VEC_T>(in + begin, end - begin, identity, reduceOp, transformOp);
+        }, reduceOp, pool);
+        return ALGORITHMS::horizontal(t0, reduceOp);
+    }
+
+}
+}
+}
+
+#endif
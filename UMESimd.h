@@ -88,6 +88,48 @@
 
 #define UME_FUNC_ATTRIB UME_FORCE_INLINE UME_ENV_FUNC_ATTRIB
 
+// Software prefetch hints. Levels follow the _MM_HINT_* constants:
+//   T0  - into all cache levels,
+//   T1  - into L2 and outer cache levels,
+//   T2  - into outer cache levels,
+//   NTA - into a cache close to the processor, minimizing pollution of outer levels,
+//   W   - into all cache levels, in exclusive state, ahead of a write.
+// Prefetching an invalid address does not fault.
+#if defined(__NVCC__) && defined(__CUDA_ARCH__)
+#define UME_PREFETCH_T0(p)  ((void)(p))
+#define UME_PREFETCH_T1(p)  ((void)(p))
+#define UME_PREFETCH_T2(p)  ((void)(p))
+#define UME_PREFETCH_NTA(p) ((void)(p))
+#define UME_PREFETCH_W(p)   ((void)(p))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define UME_PREFETCH_T0(p)  _mm_prefetch((char const *)(p), _MM_HINT_T0)
+#define UME_PREFETCH_T1(p)  _mm_prefetch((char const *)(p), _MM_HINT_T1)
+#define UME_PREFETCH_T2(p)  _mm_prefetch((char const *)(p), _MM_HINT_T2)
+#define UME_PREFETCH_NTA(p) _mm_prefetch((char const *)(p), _MM_HINT_NTA)
+#define UME_PREFETCH_W(p)   _m_prefetchw((void const *)(p))
+#elif defined(__GNUC__) && defined(__SSE__)
+#include <xmmintrin.h>
+#define UME_PREFETCH_T0(p)  _mm_prefetch((char const *)(p), _MM_HINT_T0)
+#define UME_PREFETCH_T1(p)  _mm_prefetch((char const *)(p), _MM_HINT_T1)
+#define UME_PREFETCH_T2(p)  _mm_prefetch((char const *)(p), _MM_HINT_T2)
+#define UME_PREFETCH_NTA(p) _mm_prefetch((char const *)(p), _MM_HINT_NTA)
+// PREFETCHW is emitted with -mprfchw (or a -march implying it), PREFETCHT0 otherwise.
+#define UME_PREFETCH_W(p)   __builtin_prefetch((void const *)(p), 1, 3)
+#elif defined(__GNUC__)
+#define UME_PREFETCH_T0(p)  __builtin_prefetch((void const *)(p), 0, 3)
+#define UME_PREFETCH_T1(p)  __builtin_prefetch((void const *)(p), 0, 2)
+#define UME_PREFETCH_T2(p)  __builtin_prefetch((void const *)(p), 0, 1)
+#define UME_PREFETCH_NTA(p) __builtin_prefetch((void const *)(p), 0, 0)
+#define UME_PREFETCH_W(p)   __builtin_prefetch((void const *)(p), 1, 3)
+#else
+#define UME_PREFETCH_T0(p)  ((void)(p))
+#define UME_PREFETCH_T1(p)  ((void)(p))
+#define UME_PREFETCH_T2(p)  ((void)(p))
+#define UME_PREFETCH_NTA(p) ((void)(p))
+#define UME_PREFETCH_W(p)   ((void)(p))
+#endif
+
 
 namespace UME {
 namespace SIMD {
@@ -114,6 +156,8 @@ namespace SIMD {
         #include "plugins/UMESimdPluginAVX2.h"
     #elif defined __AVX__
         #include "plugins/UMESimdPluginAVX.h"
+    #elif defined __SSE2__
+        #include "plugins/UMESimdPluginSSE.h"
     #elif defined (__aarch64__) || defined (__arm__)
         #include "plugins/UMESimdPluginARM.h"
     #elif defined (__ALTIVEC__)
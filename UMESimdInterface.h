@@ -42,6 +42,14 @@ namespace UME
 {
 namespace SIMD
 {
+namespace FUNCTIONS
+{
+    // Defined in UMESimdInterfaceFunctions.h. Plugins specialize it for vectors
+    // that can precompute a division.
+    template<typename VEC_T>
+    class Divisor;
+}
+
     // **********************************************************************
     // *
     // *  Declaration of IndexVectorInterface class
@@ -158,6 +166,48 @@ namespace SIMD
         uint64_t m0;
         uint64_t m1;
     };
+
+    // **********************************************************************
+    // *
+    // *  Declaration of MaskLaneRange class
+    // *
+    // *    Range of indices of the set bits of a mask bit representation,
+    // *    in increasing order. Used for iterating over active lanes:
+    // *
+    // *      for (uint32_t i : mask.activeLanes()) { ... }
+    // *
+    // **********************************************************************
+    class MaskLaneRange {
+    public:
+        class iterator {
+        public:
+            UME_FUNC_ATTRIB explicit iterator(uint64_t bits) : mBits(bits) {}
+
+            UME_FUNC_ATTRIB uint32_t operator* () const {
+                return SCALAR_EMULATION::lowestSetBit(mBits);
+            }
+
+            UME_FUNC_ATTRIB iterator & operator++ () {
+                mBits &= mBits - 1;
+                return *this;
+            }
+
+            UME_FUNC_ATTRIB bool operator!= (iterator const & b) const {
+                return mBits != b.mBits;
+            }
+
+        private:
+            uint64_t mBits;
+        };
+
+        UME_FUNC_ATTRIB explicit MaskLaneRange(uint64_t bits) : mBits(bits) {}
+
+        UME_FUNC_ATTRIB iterator begin() const { return iterator(mBits); }
+        UME_FUNC_ATTRIB iterator end() const { return iterator(0); }
+
+    private:
+        uint64_t mBits;
+    };
     
     // **********************************************************************
     // *
@@ -497,6 +547,40 @@ namespace SIMD
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::isExact<DERIVED_MASK_TYPE>(static_cast<DERIVED_MASK_TYPE const &>(*this), DERIVED_MASK_TYPE(b));
         }
+
+        // TOBITS - bit i of the result is set if element i is set (masks of
+        //          up to 64 elements)
+        UME_FUNC_ATTRIB uint64_t toBits() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::maskToBits<DERIVED_MASK_TYPE>(static_cast<DERIVED_MASK_TYPE const &>(*this));
+        }
+
+        // FROMBITS - element i is set if bit i of 'bits' is set, bits above
+        //            length() are ignored (masks of up to 64 elements)
+        static UME_FUNC_ATTRIB DERIVED_MASK_TYPE fromBits(uint64_t bits) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::maskFromBits<DERIVED_MASK_TYPE>(bits);
+        }
+
+        // COUNT - number of set elements
+        UME_FUNC_ATTRIB uint32_t count() const {
+            return SCALAR_EMULATION::ActiveLanes<DERIVED_MASK_TYPE>::count(static_cast<DERIVED_MASK_TYPE const &>(*this));
+        }
+
+        // FIRSTACTIVE - index of the first set element, length() if no element is set
+        UME_FUNC_ATTRIB uint32_t firstActive() const {
+            return SCALAR_EMULATION::ActiveLanes<DERIVED_MASK_TYPE>::first(static_cast<DERIVED_MASK_TYPE const &>(*this));
+        }
+
+        // LASTACTIVE - index of the last set element, length() if no element is set
+        UME_FUNC_ATTRIB uint32_t lastActive() const {
+            return SCALAR_EMULATION::ActiveLanes<DERIVED_MASK_TYPE>::last(static_cast<DERIVED_MASK_TYPE const &>(*this));
+        }
+
+        // ACTIVELANES - range of indices of set elements (masks of up to 64 elements)
+        UME_FUNC_ATTRIB MaskLaneRange activeLanes() const {
+            return MaskLaneRange(static_cast<DERIVED_MASK_TYPE const &>(*this).toBits());
+        }
     };
 
     // **********************************************************************
@@ -852,25 +936,30 @@ namespace SIMD
         // ONE-VEC
         static DERIVED_VEC_TYPE one() { return DERIVED_VEC_TYPE(SCALAR_TYPE(1)); }
 
-#include "utilities/ignore_warnings_push.h"
-#include "utilities/ignore_warnings_unused_parameter.h"
-
         // PREFETCH0
         static UME_FUNC_ATTRIB void prefetch0(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            UME_PREFETCH_T0(p);
         }
 
         // PREFETCH1
         static UME_FUNC_ATTRIB void prefetch1(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            UME_PREFETCH_T1(p);
         }
 
         // PREFETCH2
         static UME_FUNC_ATTRIB void prefetch2(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            UME_PREFETCH_T2(p);
         }
 
-#include "utilities/ignore_warnings_pop.h"
+        // PREFETCHNTA
+        static UME_FUNC_ATTRIB void prefetchnta(SCALAR_TYPE const *p) {
+            UME_PREFETCH_NTA(p);
+        }
+
+        // PREFETCHW
+        static UME_FUNC_ATTRIB void prefetchw(SCALAR_TYPE const *p) {
+            UME_PREFETCH_W(p);
+        }
 
         // ASSIGNV
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE & assign (DERIVED_VEC_TYPE const & src) {
@@ -914,6 +1003,30 @@ namespace SIMD
             return SCALAR_EMULATION::load<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), p);
         }
 
+        // LOADTAIL
+        // Load the first 'count' elements and zero the rest. Memory past
+        // p[count-1] is never accessed, so this is safe for array remainders.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE & loadTail (SCALAR_TYPE const * p, uint32_t count) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::loadTail<DERIVED_VEC_TYPE, SCALAR_TYPE> (static_cast<DERIVED_VEC_TYPE &>(*this), p, count);
+        }
+
+        // LOADINTERLEAVED
+        // Load an array of structures with 2, 3 or 4 members into one vector per
+        // member: element 'i' of 'vj' is read from p[K*i + j].
+        static UME_FUNC_ATTRIB void loadInterleaved (SCALAR_TYPE const * p, DERIVED_VEC_TYPE & v0, DERIVED_VEC_TYPE & v1) {
+            UME_EMULATION_WARNING();
+            SCALAR_EMULATION::loadInterleaved<DERIVED_VEC_TYPE, SCALAR_TYPE> (p, v0, v1);
+        }
+        static UME_FUNC_ATTRIB void loadInterleaved (SCALAR_TYPE const * p, DERIVED_VEC_TYPE & v0, DERIVED_VEC_TYPE & v1, DERIVED_VEC_TYPE & v2) {
+            UME_EMULATION_WARNING();
+            SCALAR_EMULATION::loadInterleaved<DERIVED_VEC_TYPE, SCALAR_TYPE> (p, v0, v1, v2);
+        }
+        static UME_FUNC_ATTRIB void loadInterleaved (SCALAR_TYPE const * p, DERIVED_VEC_TYPE & v0, DERIVED_VEC_TYPE & v1, DERIVED_VEC_TYPE & v2, DERIVED_VEC_TYPE & v3) {
+            UME_EMULATION_WARNING();
+            SCALAR_EMULATION::loadInterleaved<DERIVED_VEC_TYPE, SCALAR_TYPE> (p, v0, v1, v2, v3);
+        }
+
         // LOADA
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE & loada (SCALAR_TYPE const * p) {
             UME_EMULATION_WARNING();
@@ -950,6 +1063,53 @@ namespace SIMD
             return SCALAR_EMULATION::store<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), p);
         }
 
+        // STORETAIL
+        // Store the first 'count' elements. Memory past p[count-1] is never accessed.
+        UME_FUNC_ATTRIB SCALAR_TYPE* storeTail (SCALAR_TYPE* p, uint32_t count) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::storeTail<DERIVED_VEC_TYPE, SCALAR_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), p, count);
+        }
+
+        // COMPRESS
+        // Move the elements selected by 'mask' to the lowest elements, keeping
+        // their order. Remaining elements are set to zero.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE compress (MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::compress<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // COMPRESSSTORE
+        // Store the elements selected by 'mask' contiguously starting at p[0].
+        // Returns the number of elements written, memory past it is never accessed.
+        UME_FUNC_ATTRIB uint32_t compressStore (MASK_TYPE const & mask, SCALAR_TYPE* p) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::compressStore<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), p);
+        }
+
+        // EXPAND
+        // Inverse of COMPRESSSTORE: the elements selected by 'mask' are loaded from
+        // consecutive p[0], p[1], ..., remaining elements are left unchanged.
+        // Returns the number of elements read.
+        UME_FUNC_ATTRIB uint32_t expand (MASK_TYPE const & mask, SCALAR_TYPE const * p) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::expand<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), p);
+        }
+
+        // STOREINTERLEAVED
+        // Inverse of LOADINTERLEAVED: element 'i' of 'vj' is written to p[K*i + j].
+        static UME_FUNC_ATTRIB SCALAR_TYPE* storeInterleaved (SCALAR_TYPE* p, DERIVED_VEC_TYPE const & v0, DERIVED_VEC_TYPE const & v1) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::storeInterleaved<DERIVED_VEC_TYPE, SCALAR_TYPE> (p, v0, v1);
+        }
+        static UME_FUNC_ATTRIB SCALAR_TYPE* storeInterleaved (SCALAR_TYPE* p, DERIVED_VEC_TYPE const & v0, DERIVED_VEC_TYPE const & v1, DERIVED_VEC_TYPE const & v2) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::storeInterleaved<DERIVED_VEC_TYPE, SCALAR_TYPE> (p, v0, v1, v2);
+        }
+        static UME_FUNC_ATTRIB SCALAR_TYPE* storeInterleaved (SCALAR_TYPE* p, DERIVED_VEC_TYPE const & v0, DERIVED_VEC_TYPE const & v1, DERIVED_VEC_TYPE const & v2, DERIVED_VEC_TYPE const & v3) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::storeInterleaved<DERIVED_VEC_TYPE, SCALAR_TYPE> (p, v0, v1, v2, v3);
+        }
+
         // STOREA
         UME_FUNC_ATTRIB SCALAR_TYPE* storea (SCALAR_TYPE* p) const {
             UME_EMULATION_WARNING();
@@ -974,6 +1134,17 @@ namespace SIMD
             return SCALAR_EMULATION::store<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), p);
         }
 
+        // TRANSPOSE
+        // Transpose a square matrix of VEC_LEN vectors in place: afterwards
+        // element 'j' of vector 'i' holds what was element 'i' of vector 'j'.
+        template<typename... VEC_TYPES>
+        static UME_FUNC_ATTRIB void transpose (DERIVED_VEC_TYPE & v0, VEC_TYPES & ... v) {
+            static_assert(sizeof...(VEC_TYPES) + 1 == VEC_LEN, "transpose() expects as many vectors as vector length");
+            UME_EMULATION_WARNING();
+            DERIVED_VEC_TYPE * t0[VEC_LEN] = { &v0, &v... };
+            SCALAR_EMULATION::transpose<DERIVED_VEC_TYPE, SCALAR_TYPE> (t0);
+        }
+
         // EXTRACT
         // This method should be provided for all derived classes and cannot be defined
         // as generic.
@@ -1128,6 +1299,20 @@ namespace SIMD
             return SCALAR_EMULATION::sortDescending<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // SORTAKV - sort ascending, and permute 'payload' the same way as the keys
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sorta(PAYLOAD_VEC_TYPE & payload) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortAscending<DERIVED_VEC_TYPE, SCALAR_TYPE, PAYLOAD_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), payload);
+        }
+
+        // SORTDKV - sort descending, and permute 'payload' the same way as the keys
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sortd(PAYLOAD_VEC_TYPE & payload) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortDescending<DERIVED_VEC_TYPE, SCALAR_TYPE, PAYLOAD_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), payload);
+        }
+
         // ADDV
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE add (DERIVED_VEC_TYPE const & b) const {
             UME_EMULATION_WARNING();
@@ -1869,6 +2054,30 @@ namespace SIMD
             return SCALAR_EMULATION::MATH::fsubmul<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b, c);
         }
 
+        // FNMADDV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE fnmadd(DERIVED_VEC_TYPE const & b, DERIVED_VEC_TYPE const & c) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::fnmadd<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b, c);
+        }
+
+        // MFNMADDV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE fnmadd(MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b, DERIVED_VEC_TYPE const & c) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::fnmadd<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b, c);
+        }
+
+        // FNMSUBV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE fnmsub(DERIVED_VEC_TYPE const & b, DERIVED_VEC_TYPE const & c) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::fnmsub<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b, c);
+        }
+
+        // MFNMSUBV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE fnmsub(MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b, DERIVED_VEC_TYPE const & c) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::fnmsub<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b, c);
+        }
+
         // ******************************************************************
         // * Additional math functions
         // ******************************************************************
@@ -2625,6 +2834,31 @@ namespace SIMD
         UME_FUNC_ATTRIB SCALAR_TYPE*  scatter (MASK_TYPE const & mask, SCALAR_TYPE* baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::scatter<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), baseAddr, indices);
+        }
+
+        // PERMUTEV
+        // Element 'i' of the result is element 'indices[i]' of this vector. Only
+        // the lowest log2(length()) bits of each index are used.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE permute (DERIVED_UINT_VEC_TYPE const & indices) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::permute<DERIVED_VEC_TYPE, DERIVED_UINT_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), indices);
+        }
+
+        // MPERMUTEV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE permute (MASK_TYPE const & mask, DERIVED_UINT_VEC_TYPE const & indices) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::permute<DERIVED_VEC_TYPE, DERIVED_UINT_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), indices);
+        }
+
+        // PERMUTE2V
+        // Permutation of the 2*length() elements of this vector followed by 'b':
+        // indices lower than length() select elements of this vector, the
+        // following ones select elements of 'b'. Only the lowest
+        // log2(2*length()) bits of each index are used. A small table held in
+        // two vectors can be accessed this way instead of using GATHERV.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE permute2 (DERIVED_VEC_TYPE const & b, DERIVED_UINT_VEC_TYPE const & indices) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::permute2<DERIVED_VEC_TYPE, DERIVED_UINT_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b, indices);
         }       
     };
     
@@ -3084,6 +3318,30 @@ namespace SIMD
         UME_FUNC_ATTRIB DERIVED_UINT_VEC_TYPE operator- (SCALAR_UINT_TYPE b) const {
             return this->sub(b);
         }
+
+        // CONFLICT
+        // Bit 'j' of element 'i' is set if 'j < i' and element 'j' is equal to element 'i'.
+        UME_FUNC_ATTRIB DERIVED_UINT_VEC_TYPE conflict() const {
+            static_assert(VEC_LEN <= 8 * sizeof(SCALAR_UINT_TYPE), "CONFLICT: vector length exceeds the number of bits in an element.");
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::conflict<DERIVED_UINT_VEC_TYPE, SCALAR_UINT_TYPE>(static_cast<DERIVED_UINT_VEC_TYPE const &>(*this));
+        }
+
+        // LOOKUP16
+        // Element 'i' of the result is table[e & 15], where 'e' is element 'i'
+        // of this vector. 'table' holds 16 elements.
+        UME_FUNC_ATTRIB DERIVED_UINT_VEC_TYPE lookup16(SCALAR_UINT_TYPE const * table) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::lookup<DERIVED_UINT_VEC_TYPE, SCALAR_UINT_TYPE, 16>(static_cast<DERIVED_UINT_VEC_TYPE const &>(*this), table);
+        }
+
+        // LOOKUP32
+        // Element 'i' of the result is table[e & 31], where 'e' is element 'i'
+        // of this vector. 'table' holds 32 elements.
+        UME_FUNC_ATTRIB DERIVED_UINT_VEC_TYPE lookup32(SCALAR_UINT_TYPE const * table) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::lookup<DERIVED_UINT_VEC_TYPE, SCALAR_UINT_TYPE, 32>(static_cast<DERIVED_UINT_VEC_TYPE const &>(*this), table);
+        }
     };
 
     // ***************************************************************************
@@ -3301,30 +3559,49 @@ namespace SIMD
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::MATH::rsqrtAssign<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this));
         }
+
+        // RCPE - reciprocal estimate with at least rcpeBits() correct bits.
+        //        Plugins replace it with a hardware estimate.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE rcpe () const {
+            return DERIVED_VEC_TYPE(SCALAR_FLOAT_TYPE(1.0)).div(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        UME_FUNC_ATTRIB static constexpr int rcpeBits () {
+            return std::numeric_limits<SCALAR_FLOAT_TYPE>::digits;
+        }
+
+        // RSQRTE - reciprocal square root estimate with at least rsqrteBits() correct bits.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE rsqrte () const {
+            return DERIVED_VEC_TYPE(SCALAR_FLOAT_TYPE(1.0)).div(static_cast<DERIVED_VEC_TYPE const &>(*this).sqrt());
+        }
+
+        UME_FUNC_ATTRIB static constexpr int rsqrteBits () {
+            return std::numeric_limits<SCALAR_FLOAT_TYPE>::digits;
+        }
         
         // POWV
-        // Disabled, see Issue #10
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (DERIVED_VEC_TYPE const & b) const {
-        //    return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        // }
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
-        // MPOWV    
-        // Disabled, see Issue #10    
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b) const {
-        //    return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        // MPOWV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // POWS
-        // Disabled, see Issue #10
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (SCALAR_FLOAT_TYPE b) const {
-        //    return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (SCALAR_FLOAT_TYPE b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // MPOWS
-        // Disabled, see Issue #10
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, SCALAR_FLOAT_TYPE b) const {
-        //    return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, SCALAR_FLOAT_TYPE b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // ROUND
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE round () const {
@@ -3434,6 +3711,18 @@ namespace SIMD
             return SCALAR_EMULATION::MATH::exp<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // EXP2
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE exp2 () const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::exp2<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MEXP2
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE exp2 (MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::exp2<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // LOG
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE log() const {
             UME_EMULATION_WARNING();
@@ -3446,12 +3735,24 @@ namespace SIMD
             return SCALAR_EMULATION::MATH::log10<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // MLOG10
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE log10(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::log10<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // LOG2
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE log2() const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::MATH::log2<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // MLOG2
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE log2(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::log2<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // SIN
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE sin () const {
             UME_EMULATION_WARNING();
@@ -3520,6 +3821,12 @@ namespace SIMD
             return SCALAR_EMULATION::MATH::atan<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // MATAN
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE atan(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::atan<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // ATAN2
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE atan2(DERIVED_VEC_TYPE const & b) const {
             UME_EMULATION_WARNING();
@@ -151,6 +151,26 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T div(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src1, VEC_T const & src2) { return src2.rcp(mask, src1); }
 
+    // Division of many vectors by the same scalar. Construct once outside of the loop:
+    //
+    //     UME::SIMD::FUNCTIONS::Divisor<SIMD4_64u> d(7);
+    //     for (...) { SIMD4_64u q = d.divide(x); ... }
+    //
+    // Plugins specialize it for vectors that divide by a precomputed reciprocal
+    // (e.g. 64-bit integers with AVX2), so that the reciprocal is computed only once.
+    // Otherwise it calls DIVS/MDIVS.
+    template<typename VEC_T>
+    class Divisor {
+    private:
+        typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T mDivisor;
+
+    public:
+        inline explicit Divisor(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T d) : mDivisor(d) {}
+
+        inline VEC_T divide(VEC_T const & src) const { return src.div(mDivisor); }
+        inline VEC_T divide(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src) const { return src.div(mask, mDivisor); }
+    };
+
     // REMV
     template<typename VEC_T>
     inline VEC_T rem(VEC_T const & src1, VEC_T const & src2) { return src1.rem(src2); }
@@ -184,6 +204,20 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T rcp(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src2) { return src1.rcp(mask, src2); }
 
+    // RCP with at least BITS correct bits (floating point only), see
+    // UME::SIMD::VECTOR_EMULATION::rcpRefined for the accuracy of each plugin.
+    template<int BITS, typename VEC_T>
+    inline VEC_T rcp(VEC_T const & src1) {
+        return UME::SIMD::VECTOR_EMULATION::rcpRefined<BITS, VEC_T, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T>(src1);
+    }
+    // MRCP with at least BITS correct bits
+    template<int BITS, typename VEC_T>
+    inline VEC_T rcp(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) {
+        VEC_T t0 = src1;
+        t0.assign(mask, rcp<BITS>(src1));
+        return t0;
+    }
+
     // CMPEQV
     template<typename VEC_T>
     inline typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T cmpeq(VEC_T const & src1, VEC_T const & src2) { return src1.cmpeq(src2); }
@@ -258,6 +292,17 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline bool unique(VEC_T const & src1) { return src1.unique(); }
 
+    // CONFLICT
+    template<typename VEC_T>
+    inline VEC_T conflict(VEC_T const & src1) { return src1.conflict(); }
+
+    // LOOKUP16
+    template<typename VEC_T>
+    inline VEC_T lookup16(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * table) { return src1.lookup16(table); }
+    // LOOKUP32
+    template<typename VEC_T>
+    inline VEC_T lookup32(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * table) { return src1.lookup32(table); }
+
     // HADD
     template<typename VEC_T>
     inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T hadd(VEC_T const & src1) { return src1.hadd(); }
@@ -318,6 +363,22 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T fsubmul(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2, VEC_T const & src3) { return src1.fsubmul(mask, src2, src3); }
 
+    // FNMADDV
+    template<typename VEC_T>
+    inline VEC_T fnmadd(VEC_T const & src1, VEC_T const & src2, VEC_T const & src3) { return src1.fnmadd(src2, src3); }
+
+    // MFNMADDV
+    template<typename VEC_T>
+    inline VEC_T fnmadd(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2, VEC_T const & src3) { return src1.fnmadd(mask, src2, src3); }
+
+    // FNMSUBV
+    template<typename VEC_T>
+    inline VEC_T fnmsub(VEC_T const & src1, VEC_T const & src2, VEC_T const & src3) { return src1.fnmsub(src2, src3); }
+
+    // MFNMSUBV
+    template<typename VEC_T>
+    inline VEC_T fnmsub(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2, VEC_T const & src3) { return src1.fnmsub(mask, src2, src3); }
+
     // MAXV
     template<typename VEC_T>
     inline VEC_T max(VEC_T const & src1, VEC_T const & src2) { return src1.max(src2); }
@@ -487,6 +548,35 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T hbxor(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.hbxor(mask); }
 
+    // LOADINTERLEAVED
+    template<typename VEC_T>
+    inline void loadInterleaved(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * p, VEC_T & v0, VEC_T & v1) { VEC_T::loadInterleaved(p, v0, v1); }
+    template<typename VEC_T>
+    inline void loadInterleaved(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * p, VEC_T & v0, VEC_T & v1, VEC_T & v2) { VEC_T::loadInterleaved(p, v0, v1, v2); }
+    template<typename VEC_T>
+    inline void loadInterleaved(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * p, VEC_T & v0, VEC_T & v1, VEC_T & v2, VEC_T & v3) { VEC_T::loadInterleaved(p, v0, v1, v2, v3); }
+    // STOREINTERLEAVED
+    template<typename VEC_T>
+    inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* storeInterleaved(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* p, VEC_T const & v0, VEC_T const & v1) { return VEC_T::storeInterleaved(p, v0, v1); }
+    template<typename VEC_T>
+    inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* storeInterleaved(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* p, VEC_T const & v0, VEC_T const & v1, VEC_T const & v2) { return VEC_T::storeInterleaved(p, v0, v1, v2); }
+    template<typename VEC_T>
+    inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* storeInterleaved(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* p, VEC_T const & v0, VEC_T const & v1, VEC_T const & v2, VEC_T const & v3) { return VEC_T::storeInterleaved(p, v0, v1, v2, v3); }
+
+    // COMPRESS
+    template<typename VEC_T>
+    inline VEC_T compress(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.compress(mask); }
+    // COMPRESSSTORE
+    template<typename VEC_T>
+    inline uint32_t compressStore(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* p) { return src1.compressStore(mask, p); }
+    // EXPAND
+    template<typename VEC_T>
+    inline uint32_t expand(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T & dst, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * p) { return dst.expand(mask, p); }
+
+    // TRANSPOSE
+    template<typename VEC_T, typename... VEC_TYPES>
+    inline void transpose(VEC_T & v0, VEC_TYPES & ... v) { VEC_T::transpose(v0, v...); }
+
     // GATHERS
     template<typename VEC_T>
     inline VEC_T & gather(
@@ -568,6 +658,116 @@ namespace FUNCTIONS
         return src1.scatter(mask, baseAddr, indices);
     }
 
+    // PERMUTEV
+    template<typename VEC_T>
+    inline VEC_T permute(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & indices) { return src1.permute(indices); }
+    // MPERMUTEV
+    template<typename VEC_T>
+    inline VEC_T permute(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & indices) { return src1.permute(mask, indices); }
+    // PERMUTE2V
+    template<typename VEC_T>
+    inline VEC_T permute2(VEC_T const & src1, VEC_T const & src2, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & indices) { return src1.permute2(src2, indices); }
+
+    // SCATTERADDV
+    // Equivalent of: for (i = 0; i < VEC_LEN; i++) baseAddr[indices[i]] += values[i];
+    // Repeated indices are handled in rounds: a round updates every element
+    // whose earlier duplicates have already been updated, so that no address
+    // is gathered and scattered twice within a round.
+    template<typename VEC_T>
+    inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* scatterAdd(
+        typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* baseAddr,
+        typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & indices,
+        VEC_T const & values)
+    {
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_UINT_T SCALAR_UINT_T;
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T MASK_T;
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T UINT_VEC_T;
+
+        UINT_VEC_T t0 = indices.conflict();
+        MASK_T pending = t0.cmpne(SCALAR_UINT_T(0));
+        if (!pending.hlor()) {
+            // No repeated indices: single unmasked update.
+            VEC_T t1(SCALAR_T(0));
+            t1.gather(baseAddr, indices);
+            t1.adda(values);
+            t1.scatter(baseAddr, indices);
+            return baseAddr;
+        }
+        pending = MASK_T(true);
+        while (true) {
+            MASK_T ready = t0.cmpeq(SCALAR_UINT_T(0)).land(pending);
+            VEC_T t1(SCALAR_T(0));
+            t1.gather(ready, baseAddr, indices);
+            t1.adda(values);
+            t1.scatter(ready, baseAddr, indices);
+            pending.lxora(ready);
+            if (!pending.hlor()) break;
+            // Clear the lowest conflict bit: it belongs to an element already updated.
+            t0.banda(t0.sub(SCALAR_UINT_T(1)));
+        }
+        return baseAddr;
+    }
+
+    // MSCATTERADDV
+    // Equivalent of: for (i = 0; i < VEC_LEN; i++) if (mask[i]) baseAddr[indices[i]] += values[i];
+    // Memory at indices of inactive elements is not accessed.
+    template<typename VEC_T>
+    inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* scatterAdd(
+        typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask,
+        typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T* baseAddr,
+        typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & indices,
+        VEC_T const & values)
+    {
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_UINT_T SCALAR_UINT_T;
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T MASK_T;
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T UINT_VEC_T;
+
+        // Same rounds as SCATTERADDV. Conflicts with inactive elements only
+        // delay an element by a round.
+        UINT_VEC_T t0 = indices.conflict();
+        MASK_T pending = mask;
+        while (pending.hlor()) {
+            MASK_T ready = t0.cmpeq(SCALAR_UINT_T(0)).land(pending);
+            if (ready.hlor()) {
+                // Some plugins read all elements in masked gathers. Elements
+                // outside of 'ready' use the index of the first ready element.
+                UINT_VEC_T t2 = UINT_VEC_T(indices.extract(ready.firstActive())).blend(ready, indices);
+                VEC_T t1(SCALAR_T(0));
+                t1.gather(ready, baseAddr, t2);
+                t1.adda(values);
+                t1.scatter(ready, baseAddr, t2);
+                pending.lxora(ready);
+            }
+            t0.banda(t0.sub(SCALAR_UINT_T(1)));
+        }
+        return baseAddr;
+    }
+
+    // SCATTERINCV
+    // Equivalent of: for (i = 0; i < VEC_LEN; i++) baseAddr[indices[i]]++;
+    template<typename UINT_VEC_T>
+    inline typename UME::SIMD::SIMDTraits<UINT_VEC_T>::SCALAR_T* scatterInc(
+        typename UME::SIMD::SIMDTraits<UINT_VEC_T>::SCALAR_T* baseAddr,
+        UINT_VEC_T const & indices)
+    {
+        typedef typename UME::SIMD::SIMDTraits<UINT_VEC_T>::SCALAR_T SCALAR_T;
+        return scatterAdd(baseAddr, indices, UINT_VEC_T(SCALAR_T(1)));
+    }
+
+    // MSCATTERINCV
+    // Equivalent of: for (i = 0; i < VEC_LEN; i++) if (mask[i]) baseAddr[indices[i]]++;
+    template<typename UINT_VEC_T>
+    inline typename UME::SIMD::SIMDTraits<UINT_VEC_T>::SCALAR_T* scatterInc(
+        typename UME::SIMD::SIMDTraits<UINT_VEC_T>::MASK_T const & mask,
+        typename UME::SIMD::SIMDTraits<UINT_VEC_T>::SCALAR_T* baseAddr,
+        UINT_VEC_T const & indices)
+    {
+        typedef typename UME::SIMD::SIMDTraits<UINT_VEC_T>::SCALAR_T SCALAR_T;
+        return scatterAdd(mask, baseAddr, indices, UINT_VEC_T(SCALAR_T(1)));
+    }
+
     // LSHV
     template<typename VEC_T>
     VEC_T lsh(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & src2) { return src1.lsh(src2); }
@@ -718,6 +918,31 @@ namespace FUNCTIONS
     // MRSQRT
     template<typename VEC_T>
     VEC_T rsqrt(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.rsqrt(mask); }
+    // RSQRT with at least BITS correct bits
+    template<int BITS, typename VEC_T>
+    inline VEC_T rsqrt(VEC_T const & src1) {
+        return UME::SIMD::VECTOR_EMULATION::rsqrtRefined<BITS, VEC_T, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T>(src1);
+    }
+    // MRSQRT with at least BITS correct bits
+    template<int BITS, typename VEC_T>
+    inline VEC_T rsqrt(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) {
+        VEC_T t0 = src1;
+        t0.assign(mask, rsqrt<BITS>(src1));
+        return t0;
+    }
+
+    // POWV
+    template<typename VEC_T>
+    VEC_T pow(VEC_T const & src1, VEC_T const & src2) { return src1.pow(src2); }
+    // MPOWV
+    template<typename VEC_T>
+    VEC_T pow(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2) { return src1.pow(mask, src2); }
+    // POWS
+    template<typename VEC_T>
+    VEC_T pow(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src2) { return src1.pow(src2); }
+    // MPOWS
+    template<typename VEC_T>
+    VEC_T pow(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src2) { return src1.pow(mask, src2); }
 
     // ROUND
     template<typename VEC_T>
@@ -780,6 +1005,13 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T exp(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.exp(mask); }
 
+    // EXP2
+    template<typename VEC_T>
+    inline VEC_T exp2(VEC_T const & src1) { return src1.exp2(); }
+    // MEXP2
+    template<typename VEC_T>
+    inline VEC_T exp2(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.exp2(mask); }
+
     // LOG
     template<typename VEC_T>
     inline VEC_T log(VEC_T const & src1) { return src1.log(); }
@@ -843,6 +1075,86 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T atan(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.atan(mask); }
 
+    // ATAN2
+    template<typename VEC_T>
+    inline VEC_T atan2(VEC_T const & src1, VEC_T const & src2) { return src1.atan2(src2); }
+
+    // Transcendental functions with selectable accuracy, see UME::SIMD::Precision.
+    //   exp<UME::SIMD::Precision::Default>(x) is the same as exp(x).
+
+    // EXP
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T exp(VEC_T const & src1) {
+        typedef UME::SIMD::SIMDTraits<VEC_T> TRAITS_T;
+        return UME::SIMD::VECTOR_EMULATION::PrecisionTier<P, typename TRAITS_T::SCALAR_T>::template exp<VEC_T, typename TRAITS_T::UINT_VEC_T, typename TRAITS_T::INT_VEC_T, typename TRAITS_T::MASK_T>(src1);
+    }
+    // MEXP
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T exp(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) {
+        VEC_T t0 = src1;
+        t0.assign(mask, exp<P>(src1));
+        return t0;
+    }
+
+    // LOG
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T log(VEC_T const & src1) {
+        typedef UME::SIMD::SIMDTraits<VEC_T> TRAITS_T;
+        return UME::SIMD::VECTOR_EMULATION::PrecisionTier<P, typename TRAITS_T::SCALAR_T>::template log<VEC_T, typename TRAITS_T::UINT_VEC_T, typename TRAITS_T::INT_VEC_T, typename TRAITS_T::MASK_T>(src1);
+    }
+    // MLOG
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T log(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) {
+        VEC_T t0 = src1;
+        t0.assign(mask, log<P>(src1));
+        return t0;
+    }
+
+    // SIN
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T sin(VEC_T const & src1) {
+        typedef UME::SIMD::SIMDTraits<VEC_T> TRAITS_T;
+        return UME::SIMD::VECTOR_EMULATION::PrecisionTier<P, typename TRAITS_T::SCALAR_T>::template sin<VEC_T, typename TRAITS_T::UINT_VEC_T, typename TRAITS_T::INT_VEC_T, typename TRAITS_T::MASK_T>(src1);
+    }
+    // MSIN
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T sin(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) {
+        VEC_T t0 = src1;
+        t0.assign(mask, sin<P>(src1));
+        return t0;
+    }
+
+    // COS
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T cos(VEC_T const & src1) {
+        typedef UME::SIMD::SIMDTraits<VEC_T> TRAITS_T;
+        return UME::SIMD::VECTOR_EMULATION::PrecisionTier<P, typename TRAITS_T::SCALAR_T>::template cos<VEC_T, typename TRAITS_T::UINT_VEC_T, typename TRAITS_T::INT_VEC_T, typename TRAITS_T::MASK_T>(src1);
+    }
+    // MCOS
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T cos(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) {
+        VEC_T t0 = src1;
+        t0.assign(mask, cos<P>(src1));
+        return t0;
+    }
+
+    // SINCOS
+    template<UME::SIMD::Precision P, typename VEC_T>
+    void sincos(VEC_T const & src1, VEC_T & dst1, VEC_T & dst2) {
+        typedef UME::SIMD::SIMDTraits<VEC_T> TRAITS_T;
+        UME::SIMD::VECTOR_EMULATION::PrecisionTier<P, typename TRAITS_T::SCALAR_T>::template sincos<VEC_T, typename TRAITS_T::UINT_VEC_T, typename TRAITS_T::INT_VEC_T, typename TRAITS_T::MASK_T>(src1, dst1, dst2);
+    }
+    // MSINCOS
+    template<UME::SIMD::Precision P, typename VEC_T>
+    void sincos(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T & dst1, VEC_T & dst2) {
+        VEC_T t0, t1;
+        sincos<P>(src1, t0, t1);
+        dst1 = src1;
+        dst2 = src1;
+        dst1.assign(mask, t0);
+        dst2.assign(mask, t1);
+    }
+
 }
 }
 }
@@ -36,6 +36,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <utility>
 //#define UME_SIMD_SHOW_EMULATION_WARNINGS
 #ifdef UME_SIMD_SHOW_EMULATION_WARNINGS
 namespace UME
@@ -158,6 +160,44 @@ namespace SCALAR_EMULATION
         return dst;
     }
 
+    // LOADTAIL
+    // Only the first 'count' elements are read. Remaining elements are set to zero.
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE & loadTail(VEC_TYPE & dst, SCALAR_TYPE const * p, uint32_t count) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            dst.insert(i, (i < count) ? p[i] : SCALAR_TYPE(0));
+        }
+        return dst;
+    }
+
+    // LOADINTERLEAVED
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB void loadInterleaved(SCALAR_TYPE const * p, VEC_TYPE & v0, VEC_TYPE & v1) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            v0.insert(i, p[2*i]);
+            v1.insert(i, p[2*i + 1]);
+        }
+    }
+
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB void loadInterleaved(SCALAR_TYPE const * p, VEC_TYPE & v0, VEC_TYPE & v1, VEC_TYPE & v2) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            v0.insert(i, p[3*i]);
+            v1.insert(i, p[3*i + 1]);
+            v2.insert(i, p[3*i + 2]);
+        }
+    }
+
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB void loadInterleaved(SCALAR_TYPE const * p, VEC_TYPE & v0, VEC_TYPE & v1, VEC_TYPE & v2, VEC_TYPE & v3) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            v0.insert(i, p[4*i]);
+            v1.insert(i, p[4*i + 1]);
+            v2.insert(i, p[4*i + 2]);
+            v3.insert(i, p[4*i + 3]);
+        }
+    }
+
     // LOADA
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE & loadAligned(VEC_TYPE & dst, SCALAR_TYPE const * p) {
@@ -192,6 +232,79 @@ namespace SCALAR_EMULATION
         return p;
     }
 
+    // STORETAIL
+    // Only the first 'count' elements are written.
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB SCALAR_TYPE* storeTail(VEC_TYPE const & src, SCALAR_TYPE * p, uint32_t count) {
+        for (uint32_t i = 0; i < count && i < VEC_TYPE::length(); i++)
+        {
+            p[i] = src[i];
+        }
+        return p;
+    }
+
+    // COMPRESS
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE compress(MASK_TYPE const & mask, VEC_TYPE const & src) {
+        VEC_TYPE retval(SCALAR_TYPE(0));
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) retval.insert(j++, src[i]);
+        }
+        return retval;
+    }
+
+    // COMPRESSSTORE
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FUNC_ATTRIB uint32_t compressStore(MASK_TYPE const & mask, VEC_TYPE const & src, SCALAR_TYPE * p) {
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) p[j++] = src[i];
+        }
+        return j;
+    }
+
+    // EXPAND
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FUNC_ATTRIB uint32_t expand(MASK_TYPE const & mask, VEC_TYPE & dst, SCALAR_TYPE const * p) {
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) dst.insert(i, p[j++]);
+        }
+        return j;
+    }
+
+    // STOREINTERLEAVED
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB SCALAR_TYPE* storeInterleaved(SCALAR_TYPE * p, VEC_TYPE const & v0, VEC_TYPE const & v1) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            p[2*i] = v0[i];
+            p[2*i + 1] = v1[i];
+        }
+        return p;
+    }
+
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB SCALAR_TYPE* storeInterleaved(SCALAR_TYPE * p, VEC_TYPE const & v0, VEC_TYPE const & v1, VEC_TYPE const & v2) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            p[3*i] = v0[i];
+            p[3*i + 1] = v1[i];
+            p[3*i + 2] = v2[i];
+        }
+        return p;
+    }
+
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB SCALAR_TYPE* storeInterleaved(SCALAR_TYPE * p, VEC_TYPE const & v0, VEC_TYPE const & v1, VEC_TYPE const & v2, VEC_TYPE const & v3) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            p[4*i] = v0[i];
+            p[4*i + 1] = v1[i];
+            p[4*i + 2] = v2[i];
+            p[4*i + 3] = v3[i];
+        }
+        return p;
+    }
+
     // STOREA
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FUNC_ATTRIB SCALAR_TYPE* storeAligned(VEC_TYPE const & src, SCALAR_TYPE *p) {
@@ -206,6 +319,20 @@ namespace SCALAR_EMULATION
         return store<MASK_TYPE, VEC_TYPE, SCALAR_TYPE>(mask, src, p);
     }
     
+    // TRANSPOSE
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB void transpose(VEC_TYPE * const * v) {
+        SCALAR_TYPE raw[VEC_TYPE::length()][VEC_TYPE::length()];
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            v[i]->store(raw[i]);
+        }
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            for (uint32_t j = 0; j < VEC_TYPE::length(); j++) {
+                v[i]->insert(j, raw[j][i]);
+            }
+        }
+    }
+
     // GATHERU
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE & gatheru(VEC_TYPE & dst, SCALAR_TYPE const * base, uint32_t stride) {
@@ -2077,6 +2204,36 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // CONFLICT
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE conflict(VEC_TYPE const & a) {
+        VEC_TYPE retval;
+        SCALAR_TYPE raw_a[VEC_TYPE::length()];
+        SCALAR_TYPE raw_retval[VEC_TYPE::length()];
+
+        a.store(raw_a);
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            SCALAR_TYPE t0 = 0;
+            for (uint32_t j = 0; j < i; j++) {
+                if (raw_a[j] == raw_a[i]) t0 |= SCALAR_TYPE(SCALAR_TYPE(1) << j);
+            }
+            raw_retval[i] = t0;
+        }
+        retval.load(raw_retval);
+        return retval;
+    }
+
+    // LOOKUP16, LOOKUP32
+    // Only the lowest log2(TABLE_LEN) bits of each index are used.
+    template<typename VEC_TYPE, typename SCALAR_TYPE, uint32_t TABLE_LEN>
+    UME_FUNC_ATTRIB VEC_TYPE lookup(VEC_TYPE const & indices, SCALAR_TYPE const * table) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, table[uint32_t(indices[i]) & (TABLE_LEN - 1)]);
+        }
+        return retval;
+    }
+
     // ANDV
     template<typename VEC_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE binaryAnd(VEC_TYPE const & a, VEC_TYPE const & b) {
@@ -2537,6 +2694,40 @@ namespace SCALAR_EMULATION
         return a;
     }
 
+    // PERMUTEV
+    // Only the lowest log2(length()) bits of each index are used.
+    template<typename VEC_TYPE, typename UINT_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE permute(VEC_TYPE const & a, UINT_VEC_TYPE const & indices) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, a[uint32_t(indices[i]) & (VEC_TYPE::length() - 1)]);
+        }
+        return retval;
+    }
+
+    // MPERMUTEV
+    template<typename VEC_TYPE, typename UINT_VEC_TYPE, typename MASK_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE permute(MASK_TYPE const & mask, VEC_TYPE const & a, UINT_VEC_TYPE const & indices) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, mask[i] ? a[uint32_t(indices[i]) & (VEC_TYPE::length() - 1)] : a[i]);
+        }
+        return retval;
+    }
+
+    // PERMUTE2V
+    // Index bit log2(length()) selects 'b', lower bits select the element.
+    template<typename VEC_TYPE, typename UINT_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE permute2(VEC_TYPE const & a, VEC_TYPE const & b, UINT_VEC_TYPE const & indices) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            uint32_t t0 = uint32_t(indices[i]);
+            uint32_t t1 = t0 & (VEC_TYPE::length() - 1);
+            retval.insert(i, (t0 & VEC_TYPE::length()) ? b[t1] : a[t1]);
+        }
+        return retval;
+    }
+
     // SORTA
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE sortAscending(VEC_TYPE const & a) {
@@ -2575,6 +2766,48 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // SORTAKV
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename PAYLOAD_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE sortAscending(VEC_TYPE const & a, PAYLOAD_VEC_TYPE & payload) {
+        const uint32_t VEC_LEN = VEC_TYPE::length();
+        std::array<std::pair<SCALAR_TYPE, uint32_t>, VEC_LEN> temp;
+        PAYLOAD_VEC_TYPE tempPayload(payload);
+        VEC_TYPE retval;
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            temp[i] = std::make_pair(SCALAR_TYPE(a.extract(i)), i);
+        }
+
+        std::sort(temp.begin(), temp.end());
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, temp[i].first);
+            payload.insert(i, tempPayload.extract(temp[i].second));
+        }
+        return retval;
+    }
+
+    // SORTDKV
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename PAYLOAD_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE sortDescending(VEC_TYPE const & a, PAYLOAD_VEC_TYPE & payload) {
+        const uint32_t VEC_LEN = VEC_TYPE::length();
+        std::array<std::pair<SCALAR_TYPE, uint32_t>, VEC_LEN> temp;
+        PAYLOAD_VEC_TYPE tempPayload(payload);
+        VEC_TYPE retval;
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            temp[i] = std::make_pair(SCALAR_TYPE(a.extract(i)), i);
+        }
+
+        std::sort(temp.begin(), temp.end());
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, temp[VEC_LEN - i - 1].first);
+            payload.insert(i, tempPayload.extract(temp[VEC_LEN - i - 1].second));
+        }
+        return retval;
+    }
+
     // HADD
     template<typename SCALAR_TYPE, typename VEC_TYPE>
     UME_FUNC_ATTRIB SCALAR_TYPE reduceAdd(VEC_TYPE const & a) {
@@ -2685,6 +2918,105 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // Number of set bits
+    UME_FUNC_ATTRIB uint32_t bitCount(uint64_t a) {
+#if defined(__GNUC__)
+        return uint32_t(__builtin_popcountll((unsigned long long)a));
+#else
+        uint32_t retval = 0;
+        for (; a != 0; a &= a - 1) retval++;
+        return retval;
+#endif
+    }
+
+    // Index of the lowest set bit, 'a' has to be non-zero
+    UME_FUNC_ATTRIB uint32_t lowestSetBit(uint64_t a) {
+#if defined(__GNUC__)
+        return uint32_t(__builtin_ctzll((unsigned long long)a));
+#else
+        uint32_t retval = 0;
+        while ((a & 1) == 0) { a >>= 1; retval++; }
+        return retval;
+#endif
+    }
+
+    // Index of the highest set bit, 'a' has to be non-zero
+    UME_FUNC_ATTRIB uint32_t highestSetBit(uint64_t a) {
+#if defined(__GNUC__)
+        return uint32_t(63 - __builtin_clzll((unsigned long long)a));
+#else
+        uint32_t retval = 0;
+        while ((a >>= 1) != 0) retval++;
+        return retval;
+#endif
+    }
+
+    // TOBITS
+    template<typename MASK_TYPE>
+    UME_FUNC_ATTRIB uint64_t maskToBits(MASK_TYPE const & a) {
+        static_assert(MASK_TYPE::length() <= 64, "Bit representation is only available for masks of up to 64 elements.");
+        uint64_t retval = 0;
+        for (uint32_t i = 0; i < MASK_TYPE::length(); i++) {
+            if (a[i] == true) retval |= (uint64_t(1) << i);
+        }
+        return retval;
+    }
+
+    // FROMBITS
+    template<typename MASK_TYPE>
+    UME_FUNC_ATTRIB MASK_TYPE maskFromBits(uint64_t bits) {
+        static_assert(MASK_TYPE::length() <= 64, "Bit representation is only available for masks of up to 64 elements.");
+        MASK_TYPE retval;
+        for (uint32_t i = 0; i < MASK_TYPE::length(); i++) {
+            retval.insert(i, ((bits >> i) & 1) != 0);
+        }
+        return retval;
+    }
+
+    // COUNT, FIRSTACTIVE, LASTACTIVE. Masks of up to 64 elements use their
+    // bit representation, longer masks are scanned element by element.
+    template<typename MASK_TYPE, bool HAS_BITS = (MASK_TYPE::length() <= 64)>
+    struct ActiveLanes {
+        static UME_FUNC_ATTRIB uint32_t count(MASK_TYPE const & a) {
+            return bitCount(a.toBits());
+        }
+
+        static UME_FUNC_ATTRIB uint32_t first(MASK_TYPE const & a) {
+            uint64_t t0 = a.toBits();
+            return (t0 == 0) ? MASK_TYPE::length() : lowestSetBit(t0);
+        }
+
+        static UME_FUNC_ATTRIB uint32_t last(MASK_TYPE const & a) {
+            uint64_t t0 = a.toBits();
+            return (t0 == 0) ? MASK_TYPE::length() : highestSetBit(t0);
+        }
+    };
+
+    template<typename MASK_TYPE>
+    struct ActiveLanes<MASK_TYPE, false> {
+        static UME_FUNC_ATTRIB uint32_t count(MASK_TYPE const & a) {
+            uint32_t retval = 0;
+            for (uint32_t i = 0; i < MASK_TYPE::length(); i++) {
+                if (a[i] == true) retval++;
+            }
+            return retval;
+        }
+
+        static UME_FUNC_ATTRIB uint32_t first(MASK_TYPE const & a) {
+            for (uint32_t i = 0; i < MASK_TYPE::length(); i++) {
+                if (a[i] == true) return i;
+            }
+            return MASK_TYPE::length();
+        }
+
+        static UME_FUNC_ATTRIB uint32_t last(MASK_TYPE const & a) {
+            for (uint32_t i = MASK_TYPE::length(); i > 0; i--) {
+                if (a[i - 1] == true) return i - 1;
+            }
+            return MASK_TYPE::length();
+        }
+    };
+
     // HBAND
     template<typename SCALAR_TYPE, typename VEC_TYPE>
     UME_FUNC_ATTRIB SCALAR_TYPE reduceBinaryAnd(VEC_TYPE const & a) {
@@ -3414,12 +3746,33 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // Fused operations on single elements. With hardware FMA floating-point
+        // elements are rounded once, as in the plugin implementations.
+        template<typename SCALAR_TYPE>
+        UME_FUNC_ATTRIB SCALAR_TYPE fmuladdElement(SCALAR_TYPE a, SCALAR_TYPE b, SCALAR_TYPE c) { return (a * b) + c; }
+        template<typename SCALAR_TYPE>
+        UME_FUNC_ATTRIB SCALAR_TYPE fmulsubElement(SCALAR_TYPE a, SCALAR_TYPE b, SCALAR_TYPE c) { return (a * b) - c; }
+        template<typename SCALAR_TYPE>
+        UME_FUNC_ATTRIB SCALAR_TYPE fnmaddElement(SCALAR_TYPE a, SCALAR_TYPE b, SCALAR_TYPE c) { return c - (a * b); }
+        template<typename SCALAR_TYPE>
+        UME_FUNC_ATTRIB SCALAR_TYPE fnmsubElement(SCALAR_TYPE a, SCALAR_TYPE b, SCALAR_TYPE c) { return -(a * b) - c; }
+#if defined(__FMA__)
+        UME_FUNC_ATTRIB float fmuladdElement(float a, float b, float c) { return std::fma(a, b, c); }
+        UME_FUNC_ATTRIB double fmuladdElement(double a, double b, double c) { return std::fma(a, b, c); }
+        UME_FUNC_ATTRIB float fmulsubElement(float a, float b, float c) { return std::fma(a, b, -c); }
+        UME_FUNC_ATTRIB double fmulsubElement(double a, double b, double c) { return std::fma(a, b, -c); }
+        UME_FUNC_ATTRIB float fnmaddElement(float a, float b, float c) { return std::fma(-a, b, c); }
+        UME_FUNC_ATTRIB double fnmaddElement(double a, double b, double c) { return std::fma(-a, b, c); }
+        UME_FUNC_ATTRIB float fnmsubElement(float a, float b, float c) { return std::fma(-a, b, -c); }
+        UME_FUNC_ATTRIB double fnmsubElement(double a, double b, double c) { return std::fma(-a, b, -c); }
+#endif
+
         // FMULADDV
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE fmuladd(VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
             VEC_TYPE retval;
             for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-                retval.insert(i, (a[i] * b[i]) + c[i]);
+                retval.insert(i, fmuladdElement(a[i], b[i], c[i]));
             }
             return retval;
         }
@@ -3429,7 +3782,7 @@ namespace SCALAR_EMULATION
         UME_FUNC_ATTRIB VEC_TYPE fmuladd(MASK_TYPE const & mask, VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
             VEC_TYPE retval;
             for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-                if (mask[i] == true) retval.insert(i, (a[i] * b[i]) + c[i]);
+                if (mask[i] == true) retval.insert(i, fmuladdElement(a[i], b[i], c[i]));
                 else retval.insert(i, a[i]);
             }
             return retval;
@@ -3461,7 +3814,7 @@ namespace SCALAR_EMULATION
         UME_FUNC_ATTRIB VEC_TYPE fmulsub(VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
             VEC_TYPE retval;
             for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-                retval.insert(i, (a[i] * b[i]) - c[i]);
+                retval.insert(i, fmulsubElement(a[i], b[i], c[i]));
             }
             return retval;
         }
@@ -3471,7 +3824,7 @@ namespace SCALAR_EMULATION
         UME_FUNC_ATTRIB VEC_TYPE fmulsub(MASK_TYPE const & mask, VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
             VEC_TYPE retval;
             for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-                if (mask[i] == true) retval.insert(i, (a[i] * b[i]) - c[i]);
+                if (mask[i] == true) retval.insert(i, fmulsubElement(a[i], b[i], c[i]));
                 else retval.insert(i, a[i]);
             }
             return retval;
@@ -3498,6 +3851,48 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // FNMADDV
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE fnmadd(VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, fnmaddElement(a[i], b[i], c[i]));
+            }
+            return retval;
+        }
+
+        // MFNMADDV
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE fnmadd(MASK_TYPE const & mask, VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                if (mask[i] == true) retval.insert(i, fnmaddElement(a[i], b[i], c[i]));
+                else retval.insert(i, a[i]);
+            }
+            return retval;
+        }
+
+        // FNMSUBV
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE fnmsub(VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, fnmsubElement(a[i], b[i], c[i]));
+            }
+            return retval;
+        }
+
+        // MFNMSUBV
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE fnmsub(MASK_TYPE const & mask, VEC_TYPE const & a, VEC_TYPE const & b, VEC_TYPE const & c) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                if (mask[i] == true) retval.insert(i, fnmsubElement(a[i], b[i], c[i]));
+                else retval.insert(i, a[i]);
+            }
+            return retval;
+        }
+
         // ISFIN
         template<typename VEC_TYPE, typename MASK_TYPE>
         UME_FUNC_ATTRIB MASK_TYPE isfin(VEC_TYPE const & a) {
@@ -3608,6 +4003,26 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // EXP2
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE exp2(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::exp2(a[i]));
+            }
+            return retval;
+        }
+
+        // MEXP2
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE exp2(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::exp2(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
         // SIN
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE sin(VEC_TYPE const & a) {
@@ -3700,6 +4115,16 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MATAN
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE atan(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::atan(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
         // ATAN2
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE atan2(VEC_TYPE const & a, VEC_TYPE const & b) {
@@ -3730,6 +4155,16 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MLOG10
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE log10(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::log10(a.extract(i)) : a.extract(i));
+            }
+            return retval;
+        }
+
         // LOG2
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE log2(VEC_TYPE const & a) {
@@ -3740,6 +4175,16 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MLOG2
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE log2(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::log2(a.extract(i)) : a.extract(i));
+            }
+            return retval;
+        }
+
     } // UME::SIMD::SCALAR_EMULATION::MATH
 } // namespace UME::SIMD::SCALAR_EMULATION
 
@@ -31,6 +31,10 @@
 #ifndef UME_SIMD_VECTOR_EMULATION_H_
 #define UME_SIMD_VECTOR_EMULATION_H_
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+
 #include "UMEInline.h"
 #include "UMEBasicTypes.h"
 
@@ -38,6 +42,19 @@ namespace UME
 {
 namespace SIMD
 {
+    // Accuracy tiers of the vector transcendental functions, selected at compile
+    // time, e.g. UME::SIMD::FUNCTIONS::exp<UME::SIMD::Precision::Fast>(x).
+    //   Fast    - lower degree polynomials, relative error below 1e-5 (float)
+    //             and 1e-10 (double). Like the default sin() and cos(), float
+    //             sin and cos lose accuracy next to their zeros for |x| > 100.
+    //   Default - the member functions: exp(), log(), sin(), cos() and sincos().
+    //   Strict  - error below 1 ulp.
+    enum class Precision {
+        Fast,
+        Default,
+        Strict
+    };
+
     //   All functions in this namespace will have one purpose: emulation of single function in different backends.
     //   While scalar emulation is already handling primitive cases, there exists a need for emulation of more
     //   complex functions, and still benefit from vectorization. Functions present in this namespace are non-specialized
@@ -69,26 +86,21 @@ namespace SIMD
 
             x -= z * C1F;
             x -= z * C2F;
-            const UINT_VEC_T n = UINT_VEC_T ( z );
+            const UINT_VEC_T n = UINT_VEC_T ( z + 127.0f );
 
             const FLOAT_VEC_T x2 = x * x;
 
-            z = x*PX1expf;
-            z += PX2expf;
-            z *= x;
-            z += PX3expf;
-            z *= x;
-            z += PX4expf;
-            z *= x;
-            z += PX5expf;
-            z *= x;
-            z += PX6expf;
+            z = x.fmuladd(FLOAT_VEC_T(PX1expf), FLOAT_VEC_T(PX2expf));
+            z = z.fmuladd(x, FLOAT_VEC_T(PX3expf));
+            z = z.fmuladd(x, FLOAT_VEC_T(PX4expf));
+            z = z.fmuladd(x, FLOAT_VEC_T(PX5expf));
+            z = z.fmuladd(x, FLOAT_VEC_T(PX6expf));
             z *= x2;
             z += x + 1.0f;
 
             /* multiply by power of 2 */
             alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
-            ((n + 0x7f) << 23).store((uint32_t*)&raw[0]);
+            (n << 23).store((uint32_t*)&raw[0]);
             FLOAT_VEC_T z_0(raw);
             z *= z_0;
 
@@ -97,11 +109,51 @@ namespace SIMD
 
             return z;
         }
-        // EXP - double precision version
+        // POW2 - single precision helper
+        //   Builds 2^n for integral 'n' in [-126, 127] directly in the exponent field.
+        //   Adding 1.5*2^23 leaves 'n' in the low mantissa bits, see pow2d().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T pow2f(FLOAT_VEC_T const & n) {
+            alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
+            alignas(FLOAT_VEC_T::alignment()) uint32_t rawBits[FLOAT_VEC_T::length()];
+
+            (n + 12582912.0f).storea(raw);
+            std::memcpy(rawBits, raw, sizeof(raw));
+            UINT_VEC_T bits;
+            bits.loada(rawBits);
+            ((bits + 127) << 23).storea(rawBits);
+            std::memcpy(raw, rawBits, sizeof(raw));
+
+            FLOAT_VEC_T t0;
+            t0.loada(raw);
+            return t0;
+        }
+        // POW2 - double precision helper
+        //   Builds 2^n for integral 'n' in [-1022, 1023] directly in the exponent field.
+        //   Adding 1.5*2^52 leaves 'n' in the low mantissa bits, so no double->int64
+        //   conversion is needed (AVX and AVX2 have no instruction for it).
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T pow2d(FLOAT_VEC_T const & n) {
+            alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
+            alignas(FLOAT_VEC_T::alignment()) uint64_t rawBits[FLOAT_VEC_T::length()];
+
+            (n + 6755399441055744.0).storea(raw);
+            std::memcpy(rawBits, raw, sizeof(raw));
+            UINT_VEC_T bits;
+            bits.loada(rawBits);
+            ((bits + 1023) << 52).storea(rawBits);
+            std::memcpy(raw, rawBits, sizeof(raw));
 
+            FLOAT_VEC_T t0;
+            t0.loada(raw);
+            return t0;
+        }
+
+        // EXP - double precision version
         template<typename FLOAT_VEC_T, typename UINT_VEC_T>
         inline FLOAT_VEC_T expd(FLOAT_VEC_T const & initial_x) {
-            const double EXP_LIMIT = 708;
+            const double MAXLOG = 7.09782712893383996843E2;  // log(DBL_MAX)
+            const double MINLOG = -7.45133219101941108420E2; // log(2^-1075)
 
             const double PX1exp = 1.26177193074810590878E-4;
             const double PX2exp = 3.02994407707441961300E-2;
@@ -114,45 +166,37 @@ namespace SIMD
             const double LOG2E = 1.4426950408889634073599; // 1/log(2)
 
             FLOAT_VEC_T x = initial_x;
-            FLOAT_VEC_T px = ( LOG2E * x +0.5 ).floor();
+            const FLOAT_VEC_T n = (LOG2E * x + 0.5).floor();
 
-            x -= px * 6.93145751953125E-1;
-            x -= px * 1.42860682030941723212E-6;
-
-            const UINT_VEC_T n = UINT_VEC_T ( x );
+            x -= n * 6.93145751953125E-1;
+            x -= n * 1.42860682030941723212E-6;
 
             const FLOAT_VEC_T xx = x * x;
 
             // px = x * P(x**2).
-            px = PX1exp;
-            px *= xx;
-            px += PX2exp;
-            px *= xx;
-            px += PX3exp;
+            FLOAT_VEC_T px(PX1exp);
+            px = px.fmuladd(xx, FLOAT_VEC_T(PX2exp));
+            px = px.fmuladd(xx, FLOAT_VEC_T(PX3exp));
             px *= x;
 
             // Evaluate Q(x**2).
             FLOAT_VEC_T qx(QX1exp);
-            qx *= xx;
-            qx += QX2exp;
-            qx *= xx;
-            qx += QX3exp;
-            qx *= xx;
-            qx += QX4exp;
+            qx = qx.fmuladd(xx, FLOAT_VEC_T(QX2exp));
+            qx = qx.fmuladd(xx, FLOAT_VEC_T(QX3exp));
+            qx = qx.fmuladd(xx, FLOAT_VEC_T(QX4exp));
 
             // e**x = 1 + 2x P(x**2)/( Q(x**2) - P(x**2) )
             x = px / (qx - px);
             x = 1.0 + 2.0 * x;
 
-            /* multiply by power of 2 */
-            alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
-            ((n + 1023) << 52).store((uint64_t*)&raw[0]);
-            UINT_VEC_T x_0((uint64_t*)raw);
-
-            x *= x_0;
+            // Multiply by 2^n in two steps, so that neither factor leaves the
+            // normal range for results between MINLOG and MAXLOG.
+            const FLOAT_VEC_T n1 = (n * 0.5).floor();
+            x *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n1);
+            x *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n - n1);
 
-            x[initial_x > EXP_LIMIT] = std::numeric_limits<double>::infinity();
-            x[initial_x < -EXP_LIMIT] =0.;
+            x[initial_x > MAXLOG] = std::numeric_limits<double>::infinity();
+            x[initial_x < MINLOG] = 0.0;
 
             return x;
         }
@@ -172,105 +216,199 @@ namespace SIMD
             t0.assign(mask, t1);
             return t0;
         }
-        // LOG - single precision
+        // EXP2 - single precision helper
+        //   2^x for x in [-0.5, 0.5].
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T exp2fPoly(FLOAT_VEC_T const & x) {
+            FLOAT_VEC_T px(1.535336188319500E-4f);
+            px = px.fmuladd(x, FLOAT_VEC_T(1.339887440266574E-3f));
+            px = px.fmuladd(x, FLOAT_VEC_T(9.618437357674640E-3f));
+            px = px.fmuladd(x, FLOAT_VEC_T(5.550332471162809E-2f));
+            px = px.fmuladd(x, FLOAT_VEC_T(2.402264791363012E-1f));
+            px = px.fmuladd(x, FLOAT_VEC_T(6.931472028550421E-1f));
+            px = px.fmuladd(x, FLOAT_VEC_T(1.0f));
+            return px;
+        }
+        // EXP2 - double precision helper
+        //   2^x for x in [-0.5, 0.5].
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T exp2dPoly(FLOAT_VEC_T const & initial_x) {
+            const double PX1exp2 = 2.30933477057345225087E-2;
+            const double PX2exp2 = 2.02020656693165307700E1;
+            const double PX3exp2 = 1.51390680115615096133E3;
+            const double QX1exp2 = 2.33184211722314911771E2;
+            const double QX2exp2 = 4.36821166879210612817E3;
+
+            const FLOAT_VEC_T xx = initial_x * initial_x;
+
+            // px = x * P(x**2).
+            FLOAT_VEC_T px(PX1exp2);
+            px = px.fmuladd(xx, FLOAT_VEC_T(PX2exp2));
+            px = px.fmuladd(xx, FLOAT_VEC_T(PX3exp2));
+            px *= initial_x;
+
+            // Evaluate Q(x**2).
+            FLOAT_VEC_T qx = xx;
+            qx += QX1exp2;
+            qx = qx.fmuladd(xx, FLOAT_VEC_T(QX2exp2));
+
+            // 2**x = 1 + 2x P(x**2)/( Q(x**2) - x P(x**2) )
+            FLOAT_VEC_T x = px / (qx - px);
+            x = 1.0 + 2.0 * x;
+            return x;
+        }
+        // EXP2 - single precision version
         template<typename FLOAT_VEC_T, typename UINT_VEC_T>
-        inline FLOAT_VEC_T logf(FLOAT_VEC_T const & initial_x) {
-            const float MAXNUMF = 3.4028234663852885981170418348451692544e38f;
-            const float LOGF_UPPER_LIMIT = MAXNUMF;
-            const float LOGF_LOWER_LIMIT = 0;
-            const float PX1logf = 7.0376836292E-2f;
-            const float PX2logf	= -1.1514610310E-1f;
-            const float PX3logf	= 1.1676998740E-1f;
-            const float PX4logf	= -1.2420140846E-1f;
-            const float PX5logf	= 1.4249322787E-1f;
-            const float PX6logf	= -1.6668057665E-1f;
-            const float PX7logf	= 2.0000714765E-1f;
-            const float PX8logf	= -2.4999993993E-1f;
-            const float PX9logf	= 3.3333331174E-1f;
+        inline FLOAT_VEC_T exp2f(FLOAT_VEC_T const & initial_x) {
+            const float MAXL2F = 128.0f;
+            const float MINL2F = -150.0f;
+
+            const FLOAT_VEC_T n = (initial_x + 0.5f).floor();
+            FLOAT_VEC_T x = exp2fPoly(initial_x - n);
+
+            // Two step scaling, see expd().
+            const FLOAT_VEC_T n1 = (n * 0.5f).floor();
+            x *= pow2f<FLOAT_VEC_T, UINT_VEC_T>(n1);
+            x *= pow2f<FLOAT_VEC_T, UINT_VEC_T>(n - n1);
+
+            x[initial_x >= MAXL2F] = std::numeric_limits<float>::infinity();
+            x[initial_x < MINL2F] = 0.0f;
+
+            return x;
+        }
+        // EXP2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T exp2d(FLOAT_VEC_T const & initial_x) {
+            const double MAXL2 = 1024.0;
+            const double MINL2 = -1075.0;
+
+            const FLOAT_VEC_T n = (initial_x + 0.5).floor();
+            FLOAT_VEC_T x = exp2dPoly(initial_x - n);
+
+            // Two step scaling, see expd().
+            const FLOAT_VEC_T n1 = (n * 0.5).floor();
+            x *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n1);
+            x *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n - n1);
+
+            x[initial_x >= MAXL2] = std::numeric_limits<double>::infinity();
+            x[initial_x < MINL2] = 0.0;
+
+            return x;
+        }
+        // MEXP2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T exp2f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = exp2f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MEXP2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T exp2d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = exp2d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // LOG - single precision helper
+        //   Splits 'initial_x' into the exponent 'fe' and 'x' = m - 1, with the mantissa
+        //   'm' in [sqrt(0.5), sqrt(2)). The exponent is read from the bit pattern without
+        //   a float to integer conversion, see logdReduce().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE void logfReduce(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T & x, FLOAT_VEC_T & fe) {
+            const float MINNORMF = 1.17549435E-38f; // FLT_MIN
             const float SQRTHF = 0.707106781186547524f;
 
-            FLOAT_VEC_T fe;
-            //x = details::getMantExponentf( x, fe);
-            ///////////////
+            // Subnormal inputs are scaled by 2^25 into the normal range.
+            FLOAT_VEC_T x0 = initial_x;
+            x0[initial_x < MINNORMF] *= 33554432.0f;
+
+            /* separate mantissa from exponent */
             alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
-            initial_x.storea(raw);
+            alignas(FLOAT_VEC_T::alignment()) uint32_t rawBits[FLOAT_VEC_T::length()];
+            x0.storea(raw);
+            std::memcpy(rawBits, raw, sizeof(raw));
             UINT_VEC_T n;
-            n.loada((uint32_t*)&raw[0]);
-            UINT_VEC_T e = (n >> 23)-127;
-            fe = FLOAT_VEC_T(e);
+            n.loada(rawBits);
+
+            // Biased exponent placed in the low mantissa bits of 2^23, see pow2f().
+            const uint32_t p223f = 0x4B000000; // sp2uint32(2^23)
+            UINT_VEC_T e = n >> 23;
+            e |= p223f;
+            e.storea(rawBits);
+            std::memcpy(raw, rawBits, sizeof(raw));
+            fe.loada(raw);
+            fe -= 8388735.0f; // 2^23 + 127
+            fe[initial_x < MINNORMF] -= 25.0f;
 
             // fractional part
-            const uint32_t p05f = 0x3f000000; // //sp2uint32(0.5);
+            const uint32_t p05f = 0x3f000000; // sp2uint32(0.5);
             n.banda(0x807fffff);// ~0x7f800000;
             n |= p05f;
 
-            n.storea((uint32_t*)&raw[0]);
-            FLOAT_VEC_T x;
+            n.storea(rawBits);
+            std::memcpy(raw, rawBits, sizeof(raw));
             x.loada(raw);
-            //////////////
 
-            fe.postinc(x > SQRTHF);
+            fe.adda(x > SQRTHF, 1.0f);
             x.adda(x <= SQRTHF, x);
             x -= 1.0f;
+        }
+        // LOG - single precision helper
+        //   log(1+x) = x - 0.5x^2 + x^3 P(x). Returns x^3 P(x).
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T logfPoly(FLOAT_VEC_T const & x, FLOAT_VEC_T const & x2) {
+            const float PX1logf = 7.0376836292E-2f;
+            const float PX2logf = -1.1514610310E-1f;
+            const float PX3logf = 1.1676998740E-1f;
+            const float PX4logf = -1.2420140846E-1f;
+            const float PX5logf = 1.4249322787E-1f;
+            const float PX6logf = -1.6668057665E-1f;
+            const float PX7logf = 2.0000714765E-1f;
+            const float PX8logf = -2.4999993993E-1f;
+            const float PX9logf = 3.3333331174E-1f;
 
-            const FLOAT_VEC_T x2 = x*x;
-
-            //FLOAT_VEC_T res = details::get_log_poly(x);
             FLOAT_VEC_T res = x*PX1logf;
             res += PX2logf;
-            res *= x;
-            res += PX3logf;
-            res *= x;
-            res += PX4logf;
-            res *= x;
-            res += PX5logf;
-            res *= x;
-            res += PX6logf;
-            res *= x;
-            res += PX7logf;
-            res *= x;
-            res += PX8logf;
-            res *= x;
-            res += PX9logf;
+            res = res.fmuladd(x, FLOAT_VEC_T(PX3logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX4logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX5logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX6logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX7logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX8logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX9logf));
 
             res *= x2*x;
-
-            res += -2.12194440e-4f * fe;
-            res +=  -0.5f * x2;
-
-            res= x + res;
-
-            res += 0.693359375f * fe;
-
-            res[initial_x > LOGF_UPPER_LIMIT] = std::numeric_limits<float>::infinity();
-            res[initial_x < LOGF_LOWER_LIMIT] = -std::numeric_limits<float>::quiet_NaN();
-
             return res;
         }
-        // LOG - double precision
+        // LOG - double precision helper
+        //   Same as logfReduce(), subnormals are scaled by 2^54.
         template<typename FLOAT_VEC_T, typename UINT_VEC_T>
-        inline FLOAT_VEC_T logd(FLOAT_VEC_T const & initial_x) {
-            const double LOG_UPPER_LIMIT = 1e307;
-            const double LOG_LOWER_LIMIT = 0;
-
+        UME_FORCE_INLINE void logdReduce(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T & x, FLOAT_VEC_T & fe) {
+            const double MINNORM = 2.2250738585072013831E-308; // DBL_MIN
             const double SQRTH = 0.70710678118654752440;
 
+            // Subnormal inputs are scaled by 2^54 into the normal range.
+            FLOAT_VEC_T x0 = initial_x;
+            x0[initial_x < MINNORM] *= 18014398509481984.0;
+
             /* separate mantissa from exponent */
-            FLOAT_VEC_T fe;
-            //x = details::getMantExponent(x,fe);
-            ///////
             alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
-            initial_x.storea(raw);
+            alignas(FLOAT_VEC_T::alignment()) uint64_t rawBits[FLOAT_VEC_T::length()];
+            x0.storea(raw);
+            std::memcpy(rawBits, raw, sizeof(raw));
             UINT_VEC_T n;
-            n.loada((uint64_t*)&raw[0]);
-
-            // Shift to the right up to the beginning of the exponent.
-            // Then with a mask, cut off the sign bit
-            UINT_VEC_T le = (n >> 52);
+            n.loada(rawBits);
 
-            // chop the head of the number: an int contains more than 11 bits (32)
-            UINT_VEC_T e = le;
-            fe = e-1023;
+            // Biased exponent placed in the low mantissa bits of 2^52, see pow2d().
+            UINT_VEC_T e = n >> 52;
+            e |= 0x4330000000000000ULL;
+            e.storea(rawBits);
+            std::memcpy(raw, rawBits, sizeof(raw));
+            fe.loada(raw);
+            fe -= 4503599627371519.0; // 2^52 + 1023
+            fe[initial_x < MINNORM] -= 54.0;
 
             // This puts to 11 zeroes the exponent
             n.banda(0x800FFFFFFFFFFFFFULL);
@@ -279,19 +417,20 @@ namespace SIMD
             const uint64_t p05 = 0x3FE0000000000000ULL; //dp2uint64(0.5);
             n |= p05;
 
-            n.storea((uint64_t*)&raw[0]);
-            FLOAT_VEC_T x;
-            x.loada(&raw[0]);
+            n.storea(rawBits);
+            std::memcpy(raw, rawBits, sizeof(raw));
+            x.loada(raw);
 
-            ///////
             // blending
-            fe.postinc(x > SQRTH);
+            fe.adda(x > SQRTH, 1.0);
             x.adda(x <= SQRTH, x);
             x -= 1.0;
-
+        }
+        // LOG - double precision helper
+        //   log(1+x) = x - 0.5x^2 + x^3 P(x)/Q(x). Returns x^3 P(x)/Q(x).
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T logdPoly(FLOAT_VEC_T const & x, FLOAT_VEC_T const & x2) {
             /* rational form */
-            //FLOAT_VEC_T px =  details::get_log_px(x);
-            //////
             const double PX1log = 1.01875663804580931796E-4;
             const double PX2log = 4.97494994976747001425E-1;
             const double PX3log = 4.70579119878881725854E0;
@@ -300,27 +439,16 @@ namespace SIMD
             const double PX6log = 7.70838733755885391666E0;
 
             FLOAT_VEC_T px(PX1log);
-            px *= x;
-            px += PX2log;
-            px *= x;
-            px += PX3log;
-            px *= x;
-            px += PX4log;
-            px *= x;
-            px += PX5log;
-            px *= x;
-            px += PX6log;
-
-            /////
+            px = px.fmuladd(x, FLOAT_VEC_T(PX2log));
+            px = px.fmuladd(x, FLOAT_VEC_T(PX3log));
+            px = px.fmuladd(x, FLOAT_VEC_T(PX4log));
+            px = px.fmuladd(x, FLOAT_VEC_T(PX5log));
+            px = px.fmuladd(x, FLOAT_VEC_T(PX6log));
 
             //for the final formula
-            const FLOAT_VEC_T x2 = x*x;
             px *= x;
             px *= x2;
 
-            //const FLOAT_VEC_T qx = details::get_log_qx(x);
-            //////
-
             const double QX1log = 1.12873587189167450590E1;
             const double QX2log = 4.52279145837532221105E1;
             const double QX3log = 8.29875266912776603211E1;
@@ -337,9 +465,46 @@ namespace SIMD
             qx += QX4log;
             qx *=x;
             qx += QX5log;
-            /////
 
-            FLOAT_VEC_T res = px / qx ;
+            return px / qx;
+        }
+        // LOG - special values shared by all logarithms
+        template<typename FLOAT_VEC_T, typename SCALAR_T>
+        UME_FORCE_INLINE void logSpecial(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T & res) {
+            // (x - x) is 0 for finite inputs and NaN otherwise, so NaN inputs propagate.
+            res += initial_x - initial_x;
+
+            res[initial_x > std::numeric_limits<SCALAR_T>::max()] = std::numeric_limits<SCALAR_T>::infinity();
+            res[initial_x == SCALAR_T(0)] = -std::numeric_limits<SCALAR_T>::infinity();
+            res[initial_x < SCALAR_T(0)] = std::numeric_limits<SCALAR_T>::quiet_NaN();
+        }
+        // LOG - single precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logf(FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T x, fe;
+            logfReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T res = logfPoly(x, x2);
+
+            res += -2.12194440e-4f * fe;
+            res +=  -0.5f * x2;
+
+            res= x + res;
+
+            res += 0.693359375f * fe;
+
+            logSpecial<FLOAT_VEC_T, float>(initial_x, res);
+            return res;
+        }
+        // LOG - double precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logd(FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T x, fe;
+            logdReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T res = logdPoly(x, x2);
 
             res -= fe * 2.121944400546905827679e-4;
             res -= 0.5 * x2  ;
@@ -347,11 +512,8 @@ namespace SIMD
             res = x + res;
             res += fe * 0.693359375;
 
-            res[initial_x > LOG_UPPER_LIMIT] = std::numeric_limits<double>::infinity();
-            res[initial_x < LOG_LOWER_LIMIT] = -std::numeric_limits<double>::quiet_NaN();
-
+            logSpecial<FLOAT_VEC_T, double>(initial_x, res);
             return res;
-
         }
         // MLOG - single precision version
         template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
@@ -369,9 +531,146 @@ namespace SIMD
             t0.assign(mask, t1);
             return t0;
         }
-    
-        // LOG2
-        // LOG10
+
+        // LOG2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log2f(FLOAT_VEC_T const & initial_x) {
+            const float LOG2EAF = 0.44269504088896340735992f; // log2(e) - 1
+
+            FLOAT_VEC_T x, fe;
+            logfReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T y = logfPoly(x, x2);
+            y -= 0.5f * x2;
+
+            // Multiply log(1+x) by log2(e) in the order of size of the terms.
+            FLOAT_VEC_T res = y * LOG2EAF;
+            res += x * LOG2EAF;
+            res += y;
+            res += x;
+            res += fe;
+
+            logSpecial<FLOAT_VEC_T, float>(initial_x, res);
+            return res;
+        }
+        // LOG2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log2d(FLOAT_VEC_T const & initial_x) {
+            const double LOG2EA = 4.4269504088896340735992E-1; // log2(e) - 1
+
+            FLOAT_VEC_T x, fe;
+            logdReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T y = logdPoly(x, x2);
+            y -= 0.5 * x2;
+
+            // Multiply log(1+x) by log2(e) in the order of size of the terms.
+            FLOAT_VEC_T res = y * LOG2EA;
+            res += x * LOG2EA;
+            res += y;
+            res += x;
+            res += fe;
+
+            logSpecial<FLOAT_VEC_T, double>(initial_x, res);
+            return res;
+        }
+        // MLOG2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log2f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log2d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // LOG10 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log10f(FLOAT_VEC_T const & initial_x) {
+            // log10(2) and log10(e) split into a short leading part and a remainder
+            const float L102AF = 3.0078125E-1f;
+            const float L102BF = 2.48745663981195213739E-4f;
+            const float L10EAF = 4.3359375E-1f;
+            const float L10EBF = 7.00731903251827651129E-4f;
+
+            FLOAT_VEC_T x, fe;
+            logfReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T y = logfPoly(x, x2);
+            y -= 0.5f * x2;
+
+            // Accumulate the terms in the order of size.
+            FLOAT_VEC_T res = (x + y) * L10EBF;
+            res += y * L10EAF;
+            res += x * L10EAF;
+            res += fe * L102BF;
+            res += fe * L102AF;
+
+            logSpecial<FLOAT_VEC_T, float>(initial_x, res);
+            return res;
+        }
+        // LOG10 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log10d(FLOAT_VEC_T const & initial_x) {
+            // log10(2) and log10(e) split into a short leading part and a remainder
+            const double L102A = 3.0078125E-1;
+            const double L102B = 2.48745663981195213739E-4;
+            const double L10EA = 4.3359375E-1;
+            const double L10EB = 7.00731903251827651129E-4;
+
+            FLOAT_VEC_T x, fe;
+            logdReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T y = logdPoly(x, x2);
+            y -= 0.5 * x2;
+
+            // Accumulate the terms in the order of size.
+            FLOAT_VEC_T res = (x + y) * L10EB;
+            res += y * L10EA;
+            res += x * L10EA;
+            res += fe * L102B;
+            res += fe * L102A;
+
+            logSpecial<FLOAT_VEC_T, double>(initial_x, res);
+            return res;
+        }
+        // MLOG10 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log10f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG10 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log10d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // Lanes selected by 'mask' are recomputed with a scalar function. Used for
+        // arguments outside of the range in which a vector kernel is accurate.
+        template<typename FLOAT_VEC_T, typename MASK_T, typename SCALAR_FUNC_T>
+        UME_FORCE_INLINE void scalarFallback(MASK_T mask, FLOAT_VEC_T const & x, FLOAT_VEC_T & y, SCALAR_FUNC_T func) {
+            if (mask.hlor()) {
+                for (uint32_t i = 0; i < FLOAT_VEC_T::length(); i++) {
+                    if (mask.extract(i)) y.insert(i, func(x.extract(i)));
+                }
+            }
+        }
 
         // SIN - single precision version
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
@@ -380,6 +679,7 @@ namespace SIMD
             FLOAT_VEC_T s;
 
             const float ONEOPIO4F = 4.0f / (3.1415927f);
+            const float LOSSTHF = 8192.0f; // above this the reduction loses too many bits
 
             const float DP1F = (float)0.78515625;
             const float DP2F = (float)2.4187564849853515625e-4;
@@ -429,119 +729,97 @@ namespace SIMD
             MASK_T mask_xx = (xx < 0);
             ls.assign(mask_xx, -ls);
 
+            MASK_T mask_large = (x_pos > LOSSTHF);
+            scalarFallback(mask_large, xx, ls, [](float a) { return std::sin(a); });
+
             s = ls;
             return s;
         }
 
-        // SIN - double precision version
+        // MSIN - single precision version
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        inline FLOAT_VEC_T sind(FLOAT_VEC_T const & xx)
-        {
-            FLOAT_VEC_T s, c;
-            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+        UME_FORCE_INLINE FLOAT_VEC_T sinf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = sinf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
 
-            const double C1sin = 1.58962301576546568060E-10;
-            const double C2sin = -2.50507477628578072866E-8;
-            const double C3sin = 2.75573136213857245213E-6;
-            const double C4sin = -1.98412698295895385996E-4;
-            const double C5sin = 8.33333333332211858878E-3;
-            const double C6sin = -1.66666666666666307295E-1;
+        // COS - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T cosf(FLOAT_VEC_T const & xx)
+        {
+            FLOAT_VEC_T c;
 
-            const double C1cos = -1.13585365213876817300E-11;
-            const double C2cos = 2.08757008419747316778E-9;
-            const double C3cos = -2.75573141792967388112E-7;
-            const double C4cos = 2.48015872888517045348E-5;
-            const double C5cos = -1.38888888888730564116E-3;
-            const double C6cos = 4.16666666666665929218E-2;
+            const float ONEOPIO4F = 4.0f / (3.1415927f);
+            const float LOSSTHF = 8192.0f; // above this the reduction loses too many bits
 
-            const double DP1D = 7.853981554508209228515625E-1;
-            const double DP2D = 7.94662735614792836714E-9;
-            const double DP3D = 3.06161699786838294307E-17;
+            const float DP1F = (float)0.78515625;
+            const float DP2F = (float)2.4187564849853515625e-4;
+            const float DP3F = (float)3.77489497744594108e-8;
 
             INT_VEC_T j;
 
-            FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
+            /* make argument positive */
+            FLOAT_VEC_T x_pos = xx.abs();
+
+            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
+
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-            // Extended precision modular arithmetic
-            x = ((x - y * DP1D) - y * DP2D) - y * DP3D;
 
-            const FLOAT_VEC_T signS = (j & 4);
+            // Extended precision modular arithmetic
+            const FLOAT_VEC_T x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
 
+            INT_VEC_T signS = (j & 4);
             j -= 2;
 
-            const FLOAT_VEC_T signC = (j & 4);
-            const FLOAT_VEC_T poly = j & 2;
-
-            FLOAT_VEC_T zz = x * x;
+            const INT_VEC_T signC = (j & 4);
+            const INT_VEC_T poly = j & 2;
 
-            FLOAT_VEC_T px1(C1sin);
-            px1 *= zz;
-            px1 += C2sin;
-            px1 *= zz;
-            px1 += C3sin;
-            px1 *= zz;
-            px1 += C4sin;
-            px1 *= zz;
-            px1 += C5sin;
-            px1 *= zz;
-            px1 += C6sin;
-            s = x + x * zz *px1;
+            FLOAT_VEC_T ls, lc;
 
-            FLOAT_VEC_T px2(C1cos);
-            px2 *= zz;
-            px2 += C2cos;
-            px2 *= zz;
-            px2 += C3cos;
-            px2 *= zz;
-            px2 += C4cos;
-            px2 *= zz;
-            px2 += C5cos;
-            px2 *= zz;
-            px2 += C6cos;
-            c = 1.0 - zz * .5 + zz * zz * px2;
+            FLOAT_VEC_T z = x * x;
 
-            //swap
-            MASK_T maskPoly = (poly == 0);
+            ls = (((-1.9515295891E-4f * z
+                + 8.3321608736E-3f) * z
+                - 1.6666654611E-1f) * z * x)
+                + x;
 
-            const FLOAT_VEC_T tmp = c;
-            s.assign(maskPoly, tmp);
+            lc = ((2.443315711809948E-005f * z
+                - 1.388731625493765E-003f) * z
+                + 4.166664568298827E-002f) * z * z
+                - 0.5f * z + 1.0f;
 
-            MASK_T maskSignS = (signS != 0);
-            s.nega(maskSignS);
+            //swap
+            MASK_T mask_poly = (poly == 0);
+            lc.assign(mask_poly, ls);
 
-            MASK_T maskXX = (xx < 0);
-            s.nega(maskXX);
+            MASK_T mask_signC = (signC == 0);
+            lc.assign(mask_signC, -lc);
 
-            return s;
-        }
+            MASK_T mask_large = (x_pos > LOSSTHF);
+            scalarFallback(mask_large, xx, lc, [](float a) { return std::cos(a); });
 
-        // MSIN - single precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        UME_FORCE_INLINE FLOAT_VEC_T sinf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
-            FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = sinf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
-            t0.assign(mask, t1);
-            return t0;
+            c = lc;
+            return c;
         }
 
-        // MSIN - double precision version
+        // MCOS - single precision version
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        UME_FORCE_INLINE FLOAT_VEC_T sind(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+        UME_FORCE_INLINE FLOAT_VEC_T cosf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
             FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = sind<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T t1 = cosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
             t0.assign(mask, t1);
             return t0;
         }
 
-        // COS - single precision version
+        // SINCOS - single precision version
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        inline FLOAT_VEC_T cosf(FLOAT_VEC_T const & xx)
+        inline void sincosf(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T &c)
         {
-            FLOAT_VEC_T c;
-
             const float ONEOPIO4F = 4.0f / (3.1415927f);
+            const float LOSSTHF = 8192.0f; // above this the reduction loses too many bits
 
             const float DP1F = (float)0.78515625;
             const float DP2F = (float)2.4187564849853515625e-4;
@@ -582,22 +860,45 @@ namespace SIMD
 
             //swap
             MASK_T mask_poly = (poly == 0);
+            const FLOAT_VEC_T tmp = lc;
             lc.assign(mask_poly, ls);
+            ls.assign(mask_poly, tmp);
 
             MASK_T mask_signC = (signC == 0);
             lc.assign(mask_signC, -lc);
 
+            MASK_T mask_signS = (signS != 0);
+            ls.assign(mask_signS, -ls);
+
+            MASK_T mask_xx = (xx < 0);
+            ls.assign(mask_xx, -ls);
+
+            MASK_T mask_large = (x_pos > LOSSTHF);
+            scalarFallback(mask_large, xx, ls, [](float a) { return std::sin(a); });
+            scalarFallback(mask_large, xx, lc, [](float a) { return std::cos(a); });
+
             c = lc;
-            return c;
+            s = ls;
         }
 
-        // COS - double precision version
+        // MSINCOS - single precision version
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        inline FLOAT_VEC_T cosd(FLOAT_VEC_T const & xx)
-        {
-            FLOAT_VEC_T s, c;
+        UME_FORCE_INLINE void sincosf(MASK_T const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            FLOAT_VEC_T masked_s, masked_c;
+            s = xx;
+            c = xx;
+            sincosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, masked_s, masked_c);
+            s.assign(mask, masked_s);
+            c.assign(mask, masked_c);
+        }
 
+        // SINCOS - double precision version
+        //   Octant selection is done on integral doubles rather than on an int64
+        //   vector: AVX and AVX2 cannot convert between double and int64 natively.
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline void sincosd(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
             const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+            const double LOSSTH = 1.073741824e9; // above this the reduction loses all bits
 
             const double C1sin = 1.58962301576546568060E-10;
             const double C2sin = -2.50507477628578072866E-8;
@@ -613,149 +914,1239 @@ namespace SIMD
             const double C5cos = -1.38888888888730564116E-3;
             const double C6cos = 4.16666666666665929218E-2;
 
-            const double DP1D = 7.853981554508209228515625E-1;
-            const double DP2D = 7.94662735614792836714E-9;
-            const double DP3D = 3.06161699786838294307E-17;
+            // PI/4 split so that y * DP1D and y * DP2D are exact for y < 2^30
+            const double DP1D = 7.85398125648498535156E-1;
+            const double DP2D = 3.77489470793079817668E-8;
+            const double DP3D = 2.69515142907905952645E-15;
 
-            INT_VEC_T j;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            // j = (int(x/PIO4) + 1) & ~1, kept in floating point
+            const FLOAT_VEC_T y = (((ONEOPIO4 * x_pos).floor() + 1.0) * 0.5).floor() * 2.0;
+            // octant: one of 0, 2, 4, 6
+            const FLOAT_VEC_T q = y - (y * 0.125).floor() * 8.0;
 
-            FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
             // Extended precision modular arithmetic
-            x = ((x - y * DP1D) - y * DP2D) - y * DP3D;
-
-            const FLOAT_VEC_T signS = (j & 4);
-
-            j -= 2;
-
-            const FLOAT_VEC_T signC = (j & 4);
-            const FLOAT_VEC_T poly = j & 2;
+            const FLOAT_VEC_T x = ((x_pos - y * DP1D) - y * DP2D) - y * DP3D;
 
             FLOAT_VEC_T zz = x * x;
 
             FLOAT_VEC_T px1(C1sin);
-            px1 *= zz;
-            px1 += C2sin;
-            px1 *= zz;
-            px1 += C3sin;
-            px1 *= zz;
-            px1 += C4sin;
-            px1 *= zz;
-            px1 += C5sin;
-            px1 *= zz;
-            px1 += C6sin;
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C2sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C3sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C4sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C5sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C6sin));
             s = x + x * zz *px1;
 
             FLOAT_VEC_T px2(C1cos);
-            px2 *= zz;
-            px2 += C2cos;
-            px2 *= zz;
-            px2 += C3cos;
-            px2 *= zz;
-            px2 += C4cos;
-            px2 *= zz;
-            px2 += C5cos;
-            px2 *= zz;
-            px2 += C6cos;
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C2cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C3cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C4cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C5cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C6cos));
             c = 1.0 - zz * .5 + zz * zz * px2;
 
             //swap
-            MASK_T maskPoly = (poly == 0);
+            MASK_T maskPoly = ((q - 4.0).abs() == 2.0);  // q == 2 or q == 6
 
+            const FLOAT_VEC_T tmp = c;
             c.assign(maskPoly, s);
+            s.assign(maskPoly, tmp);
 
-            MASK_T maskSignC = (signC == 0);
-            c.nega(maskSignC);
+            MASK_T maskSignC = ((q - 3.0).abs() == 1.0); // q == 2 or q == 4
+            c.assign(maskSignC, -c);
 
-            return c;
+            MASK_T maskSignS = (q >= 4.0);               // q == 4 or q == 6
+            s.assign(maskSignS, -s);
+
+            MASK_T maskXX = (xx < 0.0);
+            s.assign(maskXX, -s);
+
+            MASK_T maskLarge = (x_pos > LOSSTH);
+            scalarFallback(maskLarge, xx, s, [](double a) { return std::sin(a); });
+            scalarFallback(maskLarge, xx, c, [](double a) { return std::cos(a); });
         }
 
-        // MCOS - single precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        UME_FORCE_INLINE FLOAT_VEC_T cosf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+        // SIN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sind(FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T s, c;
+            sincosd<FLOAT_VEC_T, MASK_T>(xx, s, c);
+            return s;
+        }
+
+        // MSIN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sind(MASK_T const & mask, FLOAT_VEC_T const & xx) {
             FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = cosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T t1 = sind<FLOAT_VEC_T, MASK_T>(xx);
             t0.assign(mask, t1);
             return t0;
         }
 
+        // COS - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T cosd(FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T s, c;
+            sincosd<FLOAT_VEC_T, MASK_T>(xx, s, c);
+            return c;
+        }
+
         // MCOS - double precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename MASK_T>
         UME_FORCE_INLINE FLOAT_VEC_T cosd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
             FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = cosd<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T t1 = cosd<FLOAT_VEC_T, MASK_T>(xx);
             t0.assign(mask, t1);
             return t0;
         }
 
-        // SINCOS - single precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        inline void sincosf(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T &c)
-        {
+        // MSINCOS - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosd(MASK_T const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T masked_s, masked_c;
+            sincosd<FLOAT_VEC_T, MASK_T>(t0, masked_s, masked_c);
+            s = t0;
+            s.assign(mask, masked_s);
+            c = t0;
+            c.assign(mask, masked_c);
+        }
+
+        // TAN/CTAN - single precision helper
+        //   Same octant selection as sincosd(). 'cot' selects the cotangent.
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T tancotf(FLOAT_VEC_T const & xx, bool cot) {
             const float ONEOPIO4F = 4.0f / (3.1415927f);
+            const float LOSSTHF = 8192.0f; // above this the reduction loses too many bits
 
             const float DP1F = (float)0.78515625;
             const float DP2F = (float)2.4187564849853515625e-4;
             const float DP3F = (float)3.77489497744594108e-8;
 
-            INT_VEC_T j;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            // j = (int(x/PIO4) + 1) & ~1, kept in floating point
+            const FLOAT_VEC_T y = (((ONEOPIO4F * x_pos).floor() + 1.0f) * 0.5f).floor() * 2.0f;
+            // quadrant: one of 0, 2
+            const FLOAT_VEC_T q = y - (y * 0.25f).floor() * 4.0f;
 
-            /* make argument positive */
-            FLOAT_VEC_T x_pos = xx.abs();
+            // Extended precision modular arithmetic
+            const FLOAT_VEC_T x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
 
-            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
+            const FLOAT_VEC_T zz = x * x;
+
+            FLOAT_VEC_T t(9.38540185543E-3f);
+            t = t.fmuladd(zz, FLOAT_VEC_T(3.11992232697E-3f));
+            t = t.fmuladd(zz, FLOAT_VEC_T(2.44301354525E-2f));
+            t = t.fmuladd(zz, FLOAT_VEC_T(5.34112807005E-2f));
+            t = t.fmuladd(zz, FLOAT_VEC_T(1.33387994085E-1f));
+            t = t.fmuladd(zz, FLOAT_VEC_T(3.33331568548E-1f));
+            t *= zz * x;
+            t += x;
+
+            const FLOAT_VEC_T one(1.0f);
+            MASK_T maskQ = (q == 2.0f);
+            if (cot) {
+                t.assign(!maskQ, one / t);
+                t.assign(maskQ, -t);
+            }
+            else {
+                t.assign(maskQ, -(one / t));
+            }
+
+            MASK_T maskXX = (xx < 0.0f);
+            t.assign(maskXX, -t);
+
+            // keep the sign of zero
+            MASK_T maskZero = (xx == 0.0f);
+            if (cot) t.assign(maskZero, one / xx);
+            else     t.assign(maskZero, xx);
+
+            MASK_T maskLarge = (x_pos > LOSSTHF);
+            if (cot) scalarFallback(maskLarge, xx, t, [](float a) { return 1.0f / std::tan(a); });
+            else     scalarFallback(maskLarge, xx, t, [](float a) { return std::tan(a); });
+
+            return t;
+        }
+        // TAN/CTAN - double precision helper
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T tancotd(FLOAT_VEC_T const & xx, bool cot) {
+            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+            const double LOSSTH = 1.073741824e9; // above this the reduction loses all bits
+
+            const double PX1tan = -1.30936939181383777646E4;
+            const double PX2tan = 1.15351664838587416140E6;
+            const double PX3tan = -1.79565251976484877988E7;
+            const double QX1tan = 1.36812963470692954678E4;
+            const double QX2tan = -1.32089234440210967447E6;
+            const double QX3tan = 2.50083801823357915839E7;
+            const double QX4tan = -5.38695755929454629881E7;
+
+            // PI/4 split, see sincosd()
+            const double DP1D = 7.85398125648498535156E-1;
+            const double DP2D = 3.77489470793079817668E-8;
+            const double DP3D = 2.69515142907905952645E-15;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            // j = (int(x/PIO4) + 1) & ~1, kept in floating point
+            const FLOAT_VEC_T y = (((ONEOPIO4 * x_pos).floor() + 1.0) * 0.5).floor() * 2.0;
+            // quadrant: one of 0, 2
+            const FLOAT_VEC_T q = y - (y * 0.25).floor() * 4.0;
+
+            // Extended precision modular arithmetic
+            const FLOAT_VEC_T x = ((x_pos - y * DP1D) - y * DP2D) - y * DP3D;
+
+            const FLOAT_VEC_T zz = x * x;
+
+            FLOAT_VEC_T px(PX1tan);
+            px = px.fmuladd(zz, FLOAT_VEC_T(PX2tan));
+            px = px.fmuladd(zz, FLOAT_VEC_T(PX3tan));
+
+            FLOAT_VEC_T qx = zz;
+            qx += QX1tan;
+            qx = qx.fmuladd(zz, FLOAT_VEC_T(QX2tan));
+            qx = qx.fmuladd(zz, FLOAT_VEC_T(QX3tan));
+            qx = qx.fmuladd(zz, FLOAT_VEC_T(QX4tan));
+
+            // tan(x) = x + x^3 P(x^2)/Q(x^2)
+            FLOAT_VEC_T t = x + x * (zz * px / qx);
+
+            const FLOAT_VEC_T one(1.0);
+            MASK_T maskQ = (q == 2.0);
+            if (cot) {
+                t.assign(!maskQ, one / t);
+                t.assign(maskQ, -t);
+            }
+            else {
+                t.assign(maskQ, -(one / t));
+            }
+
+            MASK_T maskXX = (xx < 0.0);
+            t.assign(maskXX, -t);
+
+            // keep the sign of zero
+            MASK_T maskZero = (xx == 0.0);
+            if (cot) t.assign(maskZero, one / xx);
+            else     t.assign(maskZero, xx);
+
+            MASK_T maskLarge = (x_pos > LOSSTH);
+            if (cot) scalarFallback(maskLarge, xx, t, [](double a) { return 1.0 / std::tan(a); });
+            else     scalarFallback(maskLarge, xx, t, [](double a) { return std::tan(a); });
+
+            return t;
+        }
+        // TAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanf(FLOAT_VEC_T const & xx) {
+            return tancotf<FLOAT_VEC_T, MASK_T>(xx, false);
+        }
+        // TAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tand(FLOAT_VEC_T const & xx) {
+            return tancotd<FLOAT_VEC_T, MASK_T>(xx, false);
+        }
+        // MTAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tancotf<FLOAT_VEC_T, MASK_T>(xx, false);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MTAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tancotd<FLOAT_VEC_T, MASK_T>(xx, false);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // CTAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctanf(FLOAT_VEC_T const & xx) {
+            return tancotf<FLOAT_VEC_T, MASK_T>(xx, true);
+        }
+        // CTAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctand(FLOAT_VEC_T const & xx) {
+            return tancotd<FLOAT_VEC_T, MASK_T>(xx, true);
+        }
+        // MCTAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tancotf<FLOAT_VEC_T, MASK_T>(xx, true);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MCTAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tancotd<FLOAT_VEC_T, MASK_T>(xx, true);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // ATAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T atanf(FLOAT_VEC_T const & xx) {
+            const float T3P8F = 2.414213562373095f;  // tan(3*PI/8)
+            const float TP8F = 0.4142135623730950f;  // tan(PI/8)
+            const float PIO2F = 1.5707963267948966192f;
+            const float PIO4F = 0.7853981633974483096f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // Range reduction, done with a single division:
+            //   x > tan(3*PI/8):          atan(x) = PI/2 + atan(-1/x)
+            //   x > tan(PI/8):            atan(x) = PI/4 + atan((x-1)/(x+1))
+            MASK_T maskBig = (x_pos > T3P8F);
+            MASK_T maskMid = (x_pos > TP8F) & !maskBig;
+
+            FLOAT_VEC_T num = x_pos;
+            FLOAT_VEC_T den(1.0f);
+            FLOAT_VEC_T y(0.0f);
+            num.assign(maskBig, -1.0f);
+            den.assign(maskBig, x_pos);
+            y.assign(maskBig, PIO2F);
+            num.assign(maskMid, x_pos - 1.0f);
+            den.assign(maskMid, x_pos + 1.0f);
+            y.assign(maskMid, PIO4F);
+
+            const FLOAT_VEC_T x = num / den;
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T t(8.05374449538e-2f);
+            t = t.fmuladd(z, FLOAT_VEC_T(-1.38776856032E-1f));
+            t = t.fmuladd(z, FLOAT_VEC_T(1.99777106478E-1f));
+            t = t.fmuladd(z, FLOAT_VEC_T(-3.33329491539E-1f));
+            t *= z * x;
+            t += x;
+
+            y += t;
+
+            MASK_T maskXX = (xx < 0.0f);
+            y.assign(maskXX, -y);
+            // keep the sign of zero
+            y.assign(xx == 0.0f, xx);
+
+            return y;
+        }
+        // ATAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T atand(FLOAT_VEC_T const & xx) {
+            const double T3P8 = 2.41421356237309504880; // tan(3*PI/8)
+            const double PIO2 = 1.57079632679489661923;
+            const double PIO4 = 7.85398163397448309616E-1;
+            const double MOREBITS = 6.123233995736765886130E-17; // PIO2 - (double)PIO2
+
+            const double PX1atan = -8.750608600031904122785E-1;
+            const double PX2atan = -1.615753718733365076637E1;
+            const double PX3atan = -7.500855792314704667340E1;
+            const double PX4atan = -1.228866684490136173410E2;
+            const double PX5atan = -6.485021904942025371773E1;
+            const double QX1atan = 2.485846490142306297962E1;
+            const double QX2atan = 1.650270098316988542046E2;
+            const double QX3atan = 4.328810604912902668951E2;
+            const double QX4atan = 4.853903996359136964868E2;
+            const double QX5atan = 1.945506571482613964425E2;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // Range reduction, see atanf().
+            MASK_T maskBig = (x_pos > T3P8);
+            MASK_T maskMid = (x_pos > 0.66) & !maskBig;
+
+            FLOAT_VEC_T num = x_pos;
+            FLOAT_VEC_T den(1.0);
+            FLOAT_VEC_T y(0.0);
+            FLOAT_VEC_T more(0.0);
+            num.assign(maskBig, -1.0);
+            den.assign(maskBig, x_pos);
+            y.assign(maskBig, PIO2);
+            more.assign(maskBig, MOREBITS);
+            num.assign(maskMid, x_pos - 1.0);
+            den.assign(maskMid, x_pos + 1.0);
+            y.assign(maskMid, PIO4);
+            more.assign(maskMid, 0.5 * MOREBITS);
+
+            const FLOAT_VEC_T x = num / den;
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(PX1atan);
+            px = px.fmuladd(z, FLOAT_VEC_T(PX2atan));
+            px = px.fmuladd(z, FLOAT_VEC_T(PX3atan));
+            px = px.fmuladd(z, FLOAT_VEC_T(PX4atan));
+            px = px.fmuladd(z, FLOAT_VEC_T(PX5atan));
+
+            FLOAT_VEC_T qx = z;
+            qx += QX1atan;
+            qx = qx.fmuladd(z, FLOAT_VEC_T(QX2atan));
+            qx = qx.fmuladd(z, FLOAT_VEC_T(QX3atan));
+            qx = qx.fmuladd(z, FLOAT_VEC_T(QX4atan));
+            qx = qx.fmuladd(z, FLOAT_VEC_T(QX5atan));
+
+            // atan(x) = x + x^3 P(x^2)/Q(x^2)
+            FLOAT_VEC_T t = x * (z * px / qx) + x;
+            t += more;
+
+            y += t;
+
+            MASK_T maskXX = (xx < 0.0);
+            y.assign(maskXX, -y);
+            // keep the sign of zero
+            y.assign(xx == 0.0, xx);
+
+            return y;
+        }
+        // MATAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = atanf<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MATAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = atand<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // ATAN2 - quadrant correction shared by both precisions
+        //   'res' holds atan(y/x) on input. Follows std::atan2 for signed zeros
+        //   and infinities.
+        template<typename FLOAT_VEC_T, typename SCALAR_T, typename MASK_T>
+        UME_FORCE_INLINE void atan2Quadrant(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x, FLOAT_VEC_T & res) {
+            const SCALAR_T PI = SCALAR_T(3.14159265358979323846);
+            const SCALAR_T PIO4 = SCALAR_T(7.85398163397448309616E-1);
+            const SCALAR_T INF = std::numeric_limits<SCALAR_T>::infinity();
+
+            const FLOAT_VEC_T one(SCALAR_T(1));
+            // sign bits, including the sign of zero
+            MASK_T xNeg = (x < SCALAR_T(0)) | ((x == SCALAR_T(0)) & ((one / x) < SCALAR_T(0)));
+            MASK_T yNeg = (y < SCALAR_T(0)) | ((y == SCALAR_T(0)) & ((one / y) < SCALAR_T(0)));
+
+            // y/x is NaN when both are zero, or both are infinite
+            res.assign((x == SCALAR_T(0)) & (y == SCALAR_T(0)), y);
+            MASK_T bothInf = (x.abs() == INF) & (y.abs() == INF);
+            res.assign(bothInf, PIO4);
+            res.assign(bothInf & (xNeg ^ yNeg), -PIO4);
+
+            res.adda(xNeg & !yNeg, PI);
+            res.suba(xNeg & yNeg, PI);
+        }
+        // ATAN2 - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atan2f(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x) {
+            FLOAT_VEC_T res = atanf<FLOAT_VEC_T, MASK_T>(y / x);
+            atan2Quadrant<FLOAT_VEC_T, float, MASK_T>(y, x, res);
+            return res;
+        }
+        // ATAN2 - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atan2d(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x) {
+            FLOAT_VEC_T res = atand<FLOAT_VEC_T, MASK_T>(y / x);
+            atan2Quadrant<FLOAT_VEC_T, double, MASK_T>(y, x, res);
+            return res;
+        }
+
+        // Leading part of 'a': the bits cleared by 'mask' are dropped. The split
+        // works on the bit pattern, since a compiler contracting 'a * 4097 - a'
+        // into an FMA breaks the usual Veltkamp split.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename SCALAR_T, typename UINT_T>
+        UME_FORCE_INLINE FLOAT_VEC_T splitHigh(FLOAT_VEC_T const & a, UINT_T mask) {
+            alignas(FLOAT_VEC_T::alignment()) SCALAR_T raw[FLOAT_VEC_T::length()];
+            alignas(FLOAT_VEC_T::alignment()) UINT_T rawBits[FLOAT_VEC_T::length()];
+            a.storea(raw);
+            std::memcpy(rawBits, raw, sizeof(raw));
+            UINT_VEC_T n;
+            n.loada(rawBits);
+            n.banda(mask);
+            n.storea(rawBits);
+            std::memcpy(raw, rawBits, sizeof(raw));
+            FLOAT_VEC_T t0;
+            t0.loada(raw);
+            return t0;
+        }
+        // Exact product: a * b == hi + lo (Dekker). 'mask' keeps the upper half
+        // of the mantissa: 0xFFFFF000 for float, 0xFFFFFFFFF8000000 for double.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename SCALAR_T, typename UINT_T>
+        UME_FORCE_INLINE void twoProd(FLOAT_VEC_T const & a, FLOAT_VEC_T const & b, UINT_T mask, FLOAT_VEC_T & hi, FLOAT_VEC_T & lo) {
+            const FLOAT_VEC_T ah = splitHigh<FLOAT_VEC_T, UINT_VEC_T, SCALAR_T>(a, mask);
+            const FLOAT_VEC_T al = a - ah;
+            const FLOAT_VEC_T bh = splitHigh<FLOAT_VEC_T, UINT_VEC_T, SCALAR_T>(b, mask);
+            const FLOAT_VEC_T bl = b - bh;
+            hi = a * b;
+            lo = ((ah * bh - hi) + ah * bl + al * bh) + al * bl;
+        }
+        // Exact sum: a + b == hi + lo (Knuth).
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE void twoSum(FLOAT_VEC_T const & a, FLOAT_VEC_T const & b, FLOAT_VEC_T & hi, FLOAT_VEC_T & lo) {
+            hi = a + b;
+            const FLOAT_VEC_T t0 = hi - a;
+            lo = (a - (hi - t0)) + (b - t0);
+        }
+
+        // POW - special values shared by both precisions
+        //   'res' holds 2^(y*log2|x|) on input, 'w' is y*log2|x|. Between 'maxw - 1'
+        //   and 'maxw', and between 'minw' and 'minw + 1', the scaling in powf() and
+        //   powd() overflows and underflows by itself.
+        template<typename FLOAT_VEC_T, typename SCALAR_T, typename MASK_T>
+        UME_FORCE_INLINE void powSpecial(FLOAT_VEC_T const & x, FLOAT_VEC_T const & y, FLOAT_VEC_T const & w, SCALAR_T maxw, SCALAR_T minw, FLOAT_VEC_T & res) {
+            const SCALAR_T INF = std::numeric_limits<SCALAR_T>::infinity();
+
+            res[w >= maxw] = INF;
+            res[w < minw] = SCALAR_T(0);
+
+            // Odd integral exponents keep the sign of x, including -0 and -inf.
+            const FLOAT_VEC_T one(SCALAR_T(1));
+            const FLOAT_VEC_T yHalf = y * SCALAR_T(0.5);
+            MASK_T yInt = (y.floor() == y);
+            MASK_T yNotInt = !yInt; // also set for NaN
+            MASK_T yOdd = yInt & (yHalf.floor() != yHalf);
+            MASK_T xNeg = (x < SCALAR_T(0)) | ((x == SCALAR_T(0)) & ((one / x) < SCALAR_T(0)));
+            res.assign(xNeg & yOdd, res * SCALAR_T(-1)); // -res would lose the sign of zero
+
+            // Finite negative x with non-integral y has no real result.
+            res[(x < SCALAR_T(0)) & (x > -INF) & yNotInt] = std::numeric_limits<SCALAR_T>::quiet_NaN();
+
+            res[(x == SCALAR_T(-1)) & yInt & !yOdd] = SCALAR_T(1);
+            res[x == SCALAR_T(1)] = SCALAR_T(1);
+            res[y == SCALAR_T(0)] = SCALAR_T(1);
+        }
+        // POW - single precision version
+        //   x^y = 2^(y*log2(x)). log2(x) is carried as a float pair, so that the
+        //   error of the product does not grow with its magnitude.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T powf(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T const & initial_y) {
+            const uint32_t SPLITF = 0xFFFFF000;
+            const float LOG2EAF = 1.44269502162933349609375f;  // log2(e), leading part
+            const float LOG2EBF = 1.925963033500011079e-8f;    // log2(e), remainder
+            const float MAXWF = 129.0f;
+            const float MINWF = -151.0f;
+
+            const FLOAT_VEC_T ax = initial_x.abs();
+            FLOAT_VEC_T x, fe;
+            logfReduce<FLOAT_VEC_T, UINT_VEC_T>(ax, x, fe);
+
+            // log(1+x) = 2 atanh(u), u = x/(x+2), |u| < 0.172. The leading 2u
+            // is kept as a float pair and the series is accurate to 2^-32.
+            FLOAT_VEC_T d, dlo;
+            twoSum(x, FLOAT_VEC_T(2.0f), d, dlo);
+            const FLOAT_VEC_T u = x / d;
+            FLOAT_VEC_T ud, udlo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, float>(u, d, SPLITF, ud, udlo);
+            const FLOAT_VEC_T ulo = (((x - ud) - udlo) - u * dlo) / d;
+
+            const FLOAT_VEC_T u2 = u * u;
+            FLOAT_VEC_T t(7.6923076923076923E-2f);
+            t = t.fmuladd(u2, FLOAT_VEC_T(9.0909090909090909E-2f));
+            t = t.fmuladd(u2, FLOAT_VEC_T(1.1111111111111111E-1f));
+            t = t.fmuladd(u2, FLOAT_VEC_T(1.4285714285714286E-1f));
+            t = t.fmuladd(u2, FLOAT_VEC_T(2.0E-1f));
+            t = t.fmuladd(u2, FLOAT_VEC_T(3.3333333333333333E-1f));
+            t *= u2 * u;
+
+            // The series, with its first order correction for 'ulo', is folded
+            // into the low part and renormalised.
+            FLOAT_VEC_T s, slo;
+            twoSum(u * 2.0f, (ulo + ulo * u2 + t) * 2.0f, s, slo);
+
+            // log2(x) = fe + log(1+x) * log2(e)
+            const FLOAT_VEC_T log2eA(LOG2EAF);
+            FLOAT_VEC_T p, plo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, float>(s, log2eA, SPLITF, p, plo);
+            plo += s * LOG2EBF + slo * LOG2EAF;
+            FLOAT_VEC_T l0, l0lo;
+            twoSum(fe, p, l0, l0lo);
+            l0lo += plo;
+            FLOAT_VEC_T l, llo;
+            twoSum(l0, l0lo, l, llo);
+
+            // NaN inputs propagate, log2 of zero and infinity
+            l += ax - ax;
+            l[ax == 0.0f] = -std::numeric_limits<float>::infinity();
+            l[ax == std::numeric_limits<float>::infinity()] = std::numeric_limits<float>::infinity();
+            llo[ax == 0.0f] = 0.0f;
+            llo[ax == std::numeric_limits<float>::infinity()] = 0.0f;
+
+            // w = y * log2(x)
+            FLOAT_VEC_T w, wlo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, float>(initial_y, l, SPLITF, w, wlo);
+            wlo += initial_y * llo;
+            wlo[w.abs() == std::numeric_limits<float>::infinity()] = 0.0f;
+
+            const FLOAT_VEC_T n = ((w + wlo) + 0.5f).floor();
+            FLOAT_VEC_T res = exp2fPoly((w - n) + wlo);
+
+            // Two step scaling, see expd().
+            const FLOAT_VEC_T n1 = (n * 0.5f).floor();
+            res *= pow2f<FLOAT_VEC_T, UINT_VEC_T>(n1);
+            res *= pow2f<FLOAT_VEC_T, UINT_VEC_T>(n - n1);
+
+            powSpecial<FLOAT_VEC_T, float, MASK_T>(initial_x, initial_y, w + wlo, MAXWF, MINWF, res);
+            return res;
+        }
+        // POW - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T powd(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T const & initial_y) {
+            const uint64_t SPLIT = 0xFFFFFFFFF8000000ULL;
+            const double LOG2EA = 1.4426950408889634;        // log2(e), leading part
+            const double LOG2EB = 2.0355273740931033e-17;    // log2(e), remainder
+            const double MAXW = 1025.0;
+            const double MINW = -1076.0;
+
+            const FLOAT_VEC_T ax = initial_x.abs();
+            FLOAT_VEC_T x, fe;
+            logdReduce<FLOAT_VEC_T, UINT_VEC_T>(ax, x, fe);
+
+            // log(1+x) = 2 atanh(u), u = x/(x+2), |u| < 0.172. The leading 2u
+            // is kept as a double pair and the series is accurate to 2^-62.
+            FLOAT_VEC_T d, dlo;
+            twoSum(x, FLOAT_VEC_T(2.0), d, dlo);
+            const FLOAT_VEC_T u = x / d;
+            FLOAT_VEC_T ud, udlo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, double>(u, d, SPLIT, ud, udlo);
+            const FLOAT_VEC_T ulo = (((x - ud) - udlo) - u * dlo) / d;
+
+            const FLOAT_VEC_T u2 = u * u;
+            FLOAT_VEC_T t(4.3478260869565217E-2);
+            t = t.fmuladd(u2, FLOAT_VEC_T(4.7619047619047619E-2));
+            t = t.fmuladd(u2, FLOAT_VEC_T(5.2631578947368421E-2));
+            t = t.fmuladd(u2, FLOAT_VEC_T(5.8823529411764706E-2));
+            t = t.fmuladd(u2, FLOAT_VEC_T(6.6666666666666667E-2));
+            t = t.fmuladd(u2, FLOAT_VEC_T(7.6923076923076923E-2));
+            t = t.fmuladd(u2, FLOAT_VEC_T(9.0909090909090909E-2));
+            t = t.fmuladd(u2, FLOAT_VEC_T(1.1111111111111111E-1));
+            t = t.fmuladd(u2, FLOAT_VEC_T(1.4285714285714286E-1));
+            t = t.fmuladd(u2, FLOAT_VEC_T(2.0E-1));
+            t = t.fmuladd(u2, FLOAT_VEC_T(3.3333333333333333E-1));
+            t *= u2 * u;
+
+            // The series, with its first order correction for 'ulo', is folded
+            // into the low part and renormalised.
+            FLOAT_VEC_T s, slo;
+            twoSum(u * 2.0, (ulo + ulo * u2 + t) * 2.0, s, slo);
+
+            // log2(x) = fe + log(1+x) * log2(e)
+            const FLOAT_VEC_T log2eA(LOG2EA);
+            FLOAT_VEC_T p, plo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, double>(s, log2eA, SPLIT, p, plo);
+            plo += s * LOG2EB + slo * LOG2EA;
+            FLOAT_VEC_T l0, l0lo;
+            twoSum(fe, p, l0, l0lo);
+            l0lo += plo;
+            FLOAT_VEC_T l, llo;
+            twoSum(l0, l0lo, l, llo);
+
+            // NaN inputs propagate, log2 of zero and infinity
+            l += ax - ax;
+            l[ax == 0.0] = -std::numeric_limits<double>::infinity();
+            l[ax == std::numeric_limits<double>::infinity()] = std::numeric_limits<double>::infinity();
+            llo[ax == 0.0] = 0.0;
+            llo[ax == std::numeric_limits<double>::infinity()] = 0.0;
+
+            // w = y * log2(x)
+            FLOAT_VEC_T w, wlo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, double>(initial_y, l, SPLIT, w, wlo);
+            wlo += initial_y * llo;
+            wlo[w.abs() == std::numeric_limits<double>::infinity()] = 0.0;
+
+            const FLOAT_VEC_T n = ((w + wlo) + 0.5).floor();
+            FLOAT_VEC_T res = exp2dPoly((w - n) + wlo);
+
+            // Two step scaling, see expd().
+            const FLOAT_VEC_T n1 = (n * 0.5).floor();
+            res *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n1);
+            res *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n - n1);
+
+            powSpecial<FLOAT_VEC_T, double, MASK_T>(initial_x, initial_y, w + wlo, MAXW, MINW, res);
+            return res;
+        }
+        // MPOW - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powf(MASK_T const & mask, FLOAT_VEC_T const & initial_x, FLOAT_VEC_T const & initial_y) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = powf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(initial_x, initial_y);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MPOW - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powd(MASK_T const & mask, FLOAT_VEC_T const & initial_x, FLOAT_VEC_T const & initial_y) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = powd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(initial_x, initial_y);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // ***************************************************************************
+        // *
+        // *    Accuracy tiers of EXP, LOG, SIN and COS, see UME::SIMD::Precision.
+        // *    Precision::Default maps to the member functions; the kernels below
+        // *    implement Precision::Fast and Precision::Strict.
+        // *
+        // ***************************************************************************
+
+        // EXP - single precision, Precision::Fast
+        //   e^x = 2^(x*log2(e)) with a single rounding in the reduction and a degree 4
+        //   polynomial for 2^f, f in [-0.5, 0.5]. Results below 2^-125 are flushed to zero.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expfFast(FLOAT_VEC_T const & initial_x) {
+            const float MAXLOGF = 88.72283905206835f;
+            const float LOG2EF = 1.44269504088896341f;
+
+            const float PX1exp2f = 9.782912210e-3f;
+            const float PX2exp2f = 5.597688258e-2f;
+            const float PX3exp2f = 2.402071059e-1f;
+            const float PX4exp2f = 6.931136250e-1f;
+
+            const FLOAT_VEC_T t = initial_x * LOG2EF;
+            const FLOAT_VEC_T n = (t + 0.5f).floor();
+            const FLOAT_VEC_T f = t - n;
+
+            FLOAT_VEC_T px(PX1exp2f);
+            px = px.fmuladd(f, FLOAT_VEC_T(PX2exp2f));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX3exp2f));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX4exp2f));
+            px = px.fmuladd(f, FLOAT_VEC_T(1.0f));
+
+            // 2 * 2^(n-1) keeps the exponent field in range for n = 128.
+            FLOAT_VEC_T x = (px + px) * pow2f<FLOAT_VEC_T, UINT_VEC_T>(n - 1.0f);
+
+            x[initial_x > MAXLOGF] = std::numeric_limits<float>::infinity();
+            x[n < -125.0f] = 0.0f;
+
+            return x;
+        }
+        // EXP - single precision, Precision::Strict
+        //   The reduced argument is carried as a pair and 1 + r is added exactly, so
+        //   that only the final addition rounds.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expfStrict(FLOAT_VEC_T const & initial_x) {
+            const float MAXLOGF = 88.72283905206835f;
+            const float MINLOGF = -103.972077083991796f; // log(2^-150)
+            const float LOG2EF = 1.44269504088896341f;
+
+            // log(2) = C1 + C2 + C3, n * C1 and n * C2 are exact
+            const float C1F = 0.693359375f;
+            const float C2F = -2.1219626069e-4f;
+            const float C3F = 1.8206359753e-9f;
+
+            const float PX1expf = 1.9875691500E-4f;
+            const float PX2expf = 1.3981999507E-3f;
+            const float PX3expf = 8.3334519073E-3f;
+            const float PX4expf = 4.1665795894E-2f;
+            const float PX5expf = 1.6666665459E-1f;
+            const float PX6expf = 5.0000001201E-1f;
+
+            const FLOAT_VEC_T n = (LOG2EF * initial_x + 0.5f).floor();
+
+            FLOAT_VEC_T r, rlo;
+            twoSum(initial_x - n * C1F, n * (-C2F), r, rlo);
+            rlo -= n * C3F;
+
+            FLOAT_VEC_T px(PX1expf);
+            px = px.fmuladd(r, FLOAT_VEC_T(PX2expf));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX3expf));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX4expf));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX5expf));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX6expf));
+            px *= r * r;
+            px += rlo + rlo * r;
+
+            const FLOAT_VEC_T hi = 1.0f + r;
+            const FLOAT_VEC_T lo = (1.0f - hi) + r;
+            FLOAT_VEC_T x = hi + (lo + px);
+
+            // Two step scaling, see expd().
+            const FLOAT_VEC_T n1 = (n * 0.5f).floor();
+            x *= pow2f<FLOAT_VEC_T, UINT_VEC_T>(n1);
+            x *= pow2f<FLOAT_VEC_T, UINT_VEC_T>(n - n1);
+
+            x[initial_x > MAXLOGF] = std::numeric_limits<float>::infinity();
+            x[initial_x < MINLOGF] = 0.0f;
+
+            return x;
+        }
+        // EXP - double precision, Precision::Fast
+        //   Same as expfFast(), with a degree 8 polynomial. Results below 2^-1021 are
+        //   flushed to zero.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expdFast(FLOAT_VEC_T const & initial_x) {
+            const double MAXLOG = 7.09782712893383996843E2;
+            const double LOG2E = 1.4426950408889634073599;
+
+            const double PX1exp2 = 1.32596462502704511833E-6;
+            const double PX2exp2 = 1.53164615749106073934E-5;
+            const double PX3exp2 = 1.54034365095814470854E-4;
+            const double PX4exp2 = 1.33334226470835175669E-3;
+            const double PX5exp2 = 9.61812918357997023722E-3;
+            const double PX6exp2 = 5.55041097610503922355E-2;
+            const double PX7exp2 = 2.40226506957374408291E-1;
+            const double PX8exp2 = 6.93147180535028550885E-1;
+
+            const FLOAT_VEC_T t = initial_x * LOG2E;
+            const FLOAT_VEC_T n = (t + 0.5).floor();
+            const FLOAT_VEC_T f = t - n;
+
+            FLOAT_VEC_T px(PX1exp2);
+            px = px.fmuladd(f, FLOAT_VEC_T(PX2exp2));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX3exp2));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX4exp2));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX5exp2));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX6exp2));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX7exp2));
+            px = px.fmuladd(f, FLOAT_VEC_T(PX8exp2));
+            px = px.fmuladd(f, FLOAT_VEC_T(1.0));
+
+            // 2 * 2^(n-1) keeps the exponent field in range for n = 1024.
+            FLOAT_VEC_T x = (px + px) * pow2d<FLOAT_VEC_T, UINT_VEC_T>(n - 1.0);
+
+            x[initial_x > MAXLOG] = std::numeric_limits<double>::infinity();
+            x[n < -1021.0] = 0.0;
+
+            return x;
+        }
+        // EXP - double precision, Precision::Strict
+        //   Same as expfStrict(). The polynomial replaces the rational form of expd(),
+        //   so that its error stays in the low part.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expdStrict(FLOAT_VEC_T const & initial_x) {
+            const double MAXLOG = 7.09782712893383996843E2;
+            const double MINLOG = -7.45133219101941108420E2;
+            const double LOG2E = 1.4426950408889634073599;
+
+            // log(2) = C1 + C2 + C3, n * C1 and n * C2 are exact
+            const double C1 = 6.93145751953125E-1;
+            const double C2 = 1.4286068203092119E-6;
+            const double C3 = 2.0538208177030216E-19;
+
+            const double PX1exp = 2.08266355968375981481E-9;
+            const double PX2exp = 2.51120248496326414313E-8;
+            const double PX3exp = 2.75575817478412417573E-7;
+            const double PX4exp = 2.75572348956633566438E-6;
+            const double PX5exp = 2.48015869268530139116E-5;
+            const double PX6exp = 1.98412698963507539568E-4;
+            const double PX7exp = 1.38888888891154486417E-3;
+            const double PX8exp = 8.33333333331704763369E-3;
+            const double PX9exp = 4.16666666666660953644E-2;
+            const double PX10exp = 1.66666666666666823948E-1;
+            const double PX11exp = 5.0E-1;
+
+            const FLOAT_VEC_T n = (LOG2E * initial_x + 0.5).floor();
+
+            FLOAT_VEC_T r, rlo;
+            twoSum(initial_x - n * C1, n * (-C2), r, rlo);
+            rlo -= n * C3;
+
+            FLOAT_VEC_T px(PX1exp);
+            px = px.fmuladd(r, FLOAT_VEC_T(PX2exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX3exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX4exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX5exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX6exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX7exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX8exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX9exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX10exp));
+            px = px.fmuladd(r, FLOAT_VEC_T(PX11exp));
+            px *= r * r;
+            px += rlo + rlo * r;
+
+            const FLOAT_VEC_T hi = 1.0 + r;
+            const FLOAT_VEC_T lo = (1.0 - hi) + r;
+            FLOAT_VEC_T x = hi + (lo + px);
+
+            // Two step scaling, see expd().
+            const FLOAT_VEC_T n1 = (n * 0.5).floor();
+            x *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n1);
+            x *= pow2d<FLOAT_VEC_T, UINT_VEC_T>(n - n1);
+
+            x[initial_x > MAXLOG] = std::numeric_limits<double>::infinity();
+            x[initial_x < MINLOG] = 0.0;
+
+            return x;
+        }
+
+        // LOG - single precision, Precision::Fast
+        //   log(1+x) = x - 0.5x^2 + x^3 P(x) with a degree 4 polynomial.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logfFast(FLOAT_VEC_T const & initial_x) {
+            const float LN2F = 0.693147180559945309f;
+
+            const float PX1logf = 1.178189963e-1f;
+            const float PX2logf = -1.840718985e-1f;
+            const float PX3logf = 2.044218779e-1f;
+            const float PX4logf = -2.494383305e-1f;
+            const float PX5logf = 3.332086205e-1f;
+
+            FLOAT_VEC_T x, fe;
+            logfReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T res(PX1logf);
+            res = res.fmuladd(x, FLOAT_VEC_T(PX2logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX3logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX4logf));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX5logf));
+            res *= x2*x;
+
+            res -= 0.5f * x2;
+            res += x;
+            res += fe * LN2F;
+
+            logSpecial<FLOAT_VEC_T, float>(initial_x, res);
+            return res;
+        }
+        // LOG - single precision, Precision::Strict
+        //   The leading terms fe*log(2) + x - 0.5x^2 are summed exactly, so that only
+        //   the polynomial and the final addition round.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logfStrict(FLOAT_VEC_T const & initial_x) {
+            const uint32_t SPLITF = 0xFFFFF000;
+            const float C1F = 0.693359375f;
+            const float C2F = -2.12194440e-4f;
+
+            FLOAT_VEC_T x, fe;
+            logfReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            FLOAT_VEC_T x2, x2lo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, float>(x, x, SPLITF, x2, x2lo);
+            const FLOAT_VEC_T t = logfPoly(x, x2);
+
+            FLOAT_VEC_T s1, e1, s2, e2;
+            twoSum(x, x2 * (-0.5f), s1, e1);
+            twoSum(fe * C1F, s1, s2, e2);
+
+            FLOAT_VEC_T res = s2 + (((e1 + e2) - 0.5f * x2lo) + (t + fe * C2F));
+
+            logSpecial<FLOAT_VEC_T, float>(initial_x, res);
+            return res;
+        }
+        // LOG - double precision, Precision::Fast
+        //   Same as logfFast(), with a degree 10 polynomial instead of the rational
+        //   form of logd().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logdFast(FLOAT_VEC_T const & initial_x) {
+            const double LN2 = 0.693147180559945309417232121458;
+
+            const double PX1log = 5.38677874449810523139E-2;
+            const double PX2log = -9.86308215710788027675E-2;
+            const double PX3log = 9.98848403961777597804E-2;
+            const double PX4log = -9.92453668231434854574E-2;
+            const double PX5log = 1.10147894018257544446E-1;
+            const double PX6log = -1.24982872863809352237E-1;
+            const double PX7log = 1.42901745975325816795E-1;
+            const double PX8log = -1.66668550710735774434E-1;
+            const double PX9log = 1.99999112499857412129E-1;
+            const double PX10log = -2.49999970763326140322E-1;
+            const double PX11log = 3.33333338924151290072E-1;
+
+            FLOAT_VEC_T x, fe;
+            logdReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T res(PX1log);
+            res = res.fmuladd(x, FLOAT_VEC_T(PX2log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX3log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX4log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX5log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX6log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX7log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX8log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX9log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX10log));
+            res = res.fmuladd(x, FLOAT_VEC_T(PX11log));
+            res *= x2*x;
+
+            res -= 0.5 * x2;
+            res += x;
+            res += fe * LN2;
+
+            logSpecial<FLOAT_VEC_T, double>(initial_x, res);
+            return res;
+        }
+        // LOG - double precision, Precision::Strict
+        //   Same as logfStrict().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logdStrict(FLOAT_VEC_T const & initial_x) {
+            const uint64_t SPLIT = 0xFFFFFFFFF8000000ULL;
+            const double C1 = 0.693359375;
+            const double C2 = -2.121944400546905827679e-4;
+
+            FLOAT_VEC_T x, fe;
+            logdReduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            FLOAT_VEC_T x2, x2lo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, double>(x, x, SPLIT, x2, x2lo);
+            const FLOAT_VEC_T t = logdPoly(x, x2);
+
+            FLOAT_VEC_T s1, e1, s2, e2;
+            twoSum(x, x2 * (-0.5), s1, e1);
+            twoSum(fe * C1, s1, s2, e2);
+
+            FLOAT_VEC_T res = s2 + (((e1 + e2) - 0.5 * x2lo) + (t + fe * C2));
+
+            logSpecial<FLOAT_VEC_T, double>(initial_x, res);
+            return res;
+        }
+
+        // SINCOS - octant selection shared by the accuracy tiers
+        //   Same as in sincosd(): 'y' is (int(x/PIO4) + 1) & ~1 and 'q' is y mod 8,
+        //   both kept in floating point.
+        template<typename FLOAT_VEC_T, typename SCALAR_T>
+        UME_FORCE_INLINE void sincosOctant(FLOAT_VEC_T const & x_pos, FLOAT_VEC_T & y, FLOAT_VEC_T & q) {
+            const SCALAR_T ONEOPIO4 = SCALAR_T(1.27323954473516268615);
+            y = (((ONEOPIO4 * x_pos).floor() + SCALAR_T(1)) * SCALAR_T(0.5)).floor() * SCALAR_T(2);
+            q = y - (y * SCALAR_T(0.125)).floor() * SCALAR_T(8);
+        }
+        // SINCOS - 's' and 'c' of the reduced argument are swapped and negated
+        //   according to the octant 'q'.
+        template<typename FLOAT_VEC_T, typename SCALAR_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosSelect(FLOAT_VEC_T const & xx, FLOAT_VEC_T const & q, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            MASK_T maskPoly = ((q - SCALAR_T(4)).abs() == SCALAR_T(2));  // q == 2 or q == 6
+
+            const FLOAT_VEC_T tmp = c;
+            c.assign(maskPoly, s);
+            s.assign(maskPoly, tmp);
+
+            MASK_T maskSignC = ((q - SCALAR_T(3)).abs() == SCALAR_T(1)); // q == 2 or q == 4
+            c.assign(maskSignC, -c);
+
+            MASK_T maskSignS = (q >= SCALAR_T(4));                       // q == 4 or q == 6
+            s.assign(maskSignS, -s);
+
+            MASK_T maskXX = (xx < SCALAR_T(0));
+            s.assign(maskXX, -s);
+        }
+        // SIN/COS/SINCOS - single precision, Precision::Fast
+        //   Degree 5 and 6 polynomials for sine and cosine of the reduced argument.
+        //   The octant 'j' is computed in the integer domain, as in sincosf().
+        template<typename FLOAT_VEC_T, typename INT_VEC_T>
+        UME_FORCE_INLINE void sincosfFastReduce(FLOAT_VEC_T const & x_pos, FLOAT_VEC_T & x, FLOAT_VEC_T & zz, INT_VEC_T & j) {
+            const float ONEOPIO4F = 4.0f / (3.1415927f);
+
+            const float DP1F = 0.78515625f;
+            const float DP2F = 2.4187564849853515625e-4f;
+            const float DP3F = 3.77489497744594108e-8f;
 
+            j = INT_VEC_T(ONEOPIO4F * x_pos);
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
 
             // Extended precision modular arithmetic
-            const FLOAT_VEC_T x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
+            x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
+            zz = x * x;
+        }
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sinfFastPoly(FLOAT_VEC_T const & x, FLOAT_VEC_T const & zz) {
+            return x + x * zz * (8.163281716e-3f * zz - 1.666339040e-1f);
+        }
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T cosfFastPoly(FLOAT_VEC_T const & zz) {
+            return 1.0f - zz * 0.5f + zz * zz * (-1.366123208e-3f * zz + 4.166199639e-2f);
+        }
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T sinfFast(FLOAT_VEC_T const & xx) {
+            const float LOSSTHF = 8192.0f; // above this the reduction loses too many bits
 
-            INT_VEC_T signS = (j & 4);
+            const FLOAT_VEC_T x_pos = xx.abs();
+            FLOAT_VEC_T x, zz;
+            INT_VEC_T j;
+            sincosfFastReduce(x_pos, x, zz, j);
+
+            FLOAT_VEC_T ls = sinfFastPoly(x, zz);
+            const INT_VEC_T signS = (j & 4);
             j -= 2;
+            MASK_T maskPoly = ((j & 2) == 0);
+            ls.assign(maskPoly, cosfFastPoly(zz));
 
-            const INT_VEC_T signC = (j & 4);
-            const INT_VEC_T poly = j & 2;
+            MASK_T maskSign = (signS != 0) ^ (xx < 0.0f);
+            ls.assign(maskSign, -ls);
 
-            FLOAT_VEC_T ls, lc;
+            MASK_T maskLarge = (x_pos > LOSSTHF);
+            scalarFallback(maskLarge, xx, ls, [](float a) { return std::sin(a); });
+            return ls;
+        }
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T cosfFast(FLOAT_VEC_T const & xx) {
+            const float LOSSTHF = 8192.0f;
 
-            FLOAT_VEC_T z = x * x;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            FLOAT_VEC_T x, zz;
+            INT_VEC_T j;
+            sincosfFastReduce(x_pos, x, zz, j);
 
-            ls = (((-1.9515295891E-4f * z
-                + 8.3321608736E-3f) * z
-                - 1.6666654611E-1f) * z * x)
-                + x;
+            FLOAT_VEC_T lc = cosfFastPoly(zz);
+            j -= 2;
+            MASK_T maskPoly = ((j & 2) == 0);
+            lc.assign(maskPoly, sinfFastPoly(x, zz));
 
-            lc = ((2.443315711809948E-005f * z
-                - 1.388731625493765E-003f) * z
-                + 4.166664568298827E-002f) * z * z
-                - 0.5f * z + 1.0f;
+            MASK_T maskSignC = ((j & 4) == 0);
+            lc.assign(maskSignC, -lc);
 
-            //swap
-            MASK_T mask_poly = (poly == 0);
+            MASK_T maskLarge = (x_pos > LOSSTHF);
+            scalarFallback(maskLarge, xx, lc, [](float a) { return std::cos(a); });
+            return lc;
+        }
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline void sincosfFast(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            const float LOSSTHF = 8192.0f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            FLOAT_VEC_T x, zz;
+            INT_VEC_T j;
+            sincosfFastReduce(x_pos, x, zz, j);
+
+            FLOAT_VEC_T ls = sinfFastPoly(x, zz);
+            FLOAT_VEC_T lc = cosfFastPoly(zz);
+
+            const INT_VEC_T signS = (j & 4);
+            j -= 2;
+            MASK_T maskPoly = ((j & 2) == 0);
             const FLOAT_VEC_T tmp = lc;
-            lc.assign(mask_poly, ls);
-            ls.assign(mask_poly, tmp);
+            lc.assign(maskPoly, ls);
+            ls.assign(maskPoly, tmp);
 
-            MASK_T mask_signC = (signC == 0);
-            lc.assign(mask_signC, -lc);
+            MASK_T maskSignC = ((j & 4) == 0);
+            lc.assign(maskSignC, -lc);
 
-            MASK_T mask_signS = (signS != 0);
-            ls.assign(mask_signS, -ls);
+            MASK_T maskSignS = (signS != 0) ^ (xx < 0.0f);
+            ls.assign(maskSignS, -ls);
 
-            MASK_T mask_xx = (xx < 0);
-            ls.assign(mask_xx, -ls);
+            MASK_T maskLarge = (x_pos > LOSSTHF);
+            scalarFallback(maskLarge, xx, ls, [](float a) { return std::sin(a); });
+            scalarFallback(maskLarge, xx, lc, [](float a) { return std::cos(a); });
 
-            c = lc;
             s = ls;
+            c = lc;
         }
+        // SINCOS - single precision, Precision::Strict
+        //   PI/4 is split in five parts and the reduced argument is carried as a
+        //   pair. Arguments falling too close to a multiple of PI/4 for the split to
+        //   be accurate are recomputed with the scalar functions.
+        //   All products entering twoSum() are exact, so the result does not depend
+        //   on whether the compiler contracts them into FMAs.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline void sincosfStrict(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            const uint32_t SPLITF = 0xFFFFF000;
+            const float LOSSTHF = 8192.0f;
+            const float MINREDF = 1.9073486328125e-6f; // 2^-19
+
+            // y * DP1F ... y * DP4F are exact for y < 2^14
+            const float DP1F = 0.78515625f;
+            const float DP2F = 2.4199485778808593750e-4f;
+            const float DP3F = -8.1490725278854370117e-8f;
+            const float DP4F = 3.0411229090532287955e-11f;
+            const float DP5F = -2.5726557318392177798e-14f;
+
+            const float C1sinf = 2.718121550e-6f;
+            const float C2sinf = -1.983931288e-4f;
+            const float C3sinf = 8.333329111e-3f;
+            const float C4sinf = -1.666666716e-1f;
+
+            const float C1cosf = 2.443315711809948E-005f;
+            const float C2cosf = -1.388731625493765E-003f;
+            const float C3cosf = 4.166664568298827E-002f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            FLOAT_VEC_T y, q;
+            sincosOctant<FLOAT_VEC_T, float>(x_pos, y, q);
+
+            FLOAT_VEC_T x, xlo, t, tlo;
+            twoSum((x_pos - y * DP1F) - y * DP2F, y * (-DP3F), t, tlo);
+            twoSum(t, y * (-DP4F), x, xlo);
+            xlo += tlo - y * DP5F;
+
+            FLOAT_VEC_T zz, zzlo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, float>(x, x, SPLITF, zz, zzlo);
+            zzlo += 2.0f * x * xlo;
+
+            FLOAT_VEC_T ps(C1sinf);
+            ps = ps.fmuladd(zz, FLOAT_VEC_T(C2sinf));
+            ps = ps.fmuladd(zz, FLOAT_VEC_T(C3sinf));
+            ps = ps.fmuladd(zz, FLOAT_VEC_T(C4sinf));
+            s = x + ((xlo - 0.5f * xlo * zz) + x * zz * ps);
+
+            FLOAT_VEC_T pc(C1cosf);
+            pc = pc.fmuladd(zz, FLOAT_VEC_T(C2cosf));
+            pc = pc.fmuladd(zz, FLOAT_VEC_T(C3cosf));
+            const FLOAT_VEC_T hi = 1.0f - 0.5f * zz;
+            const FLOAT_VEC_T lo = (1.0f - hi) - 0.5f * zz;
+            c = hi + ((lo - 0.5f * zzlo) + zz * zz * pc);
+
+            sincosSelect<FLOAT_VEC_T, float, MASK_T>(xx, q, s, c);
+
+            MASK_T maskLarge = (x_pos > LOSSTHF) | ((x.abs() < MINREDF) & (y != 0.0f));
+            scalarFallback(maskLarge, xx, s, [](float a) { return std::sin(a); });
+            scalarFallback(maskLarge, xx, c, [](float a) { return std::cos(a); });
+        }
+        // SINCOS - double precision, Precision::Fast
+        //   Degree 9 and 8 polynomials instead of 13 and 12 in sincosd().
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline void sincosdFast(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            const double LOSSTH = 1.073741824e9; // above this the reduction loses all bits
+
+            const double DP1D = 7.85398125648498535156E-1;
+            const double DP2D = 3.77489470793079817668E-8;
+            const double DP3D = 2.69515142907905952645E-15;
+
+            const double C1sin = 2.71812162812909668112E-6;
+            const double C2sin = -1.98393122695256511525E-4;
+            const double C3sin = 8.33332930484280767769E-3;
+            const double C4sin = -1.66666666407970481822E-1;
+
+            const double C1cos = -2.72371674528493747449E-7;
+            const double C2cos = 2.47999116694351388369E-5;
+            const double C3cos = -1.38888855474829635978E-3;
+            const double C4cos = 4.16666666479347455598E-2;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            FLOAT_VEC_T y, q;
+            sincosOctant<FLOAT_VEC_T, double>(x_pos, y, q);
 
-        // SINCOS - double precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
-        inline void sincosd(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
-            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+            // Extended precision modular arithmetic
+            const FLOAT_VEC_T x = ((x_pos - y * DP1D) - y * DP2D) - y * DP3D;
+            const FLOAT_VEC_T zz = x * x;
+
+            FLOAT_VEC_T px1(C1sin);
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C2sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C3sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C4sin));
+            s = x + x * zz * px1;
+
+            FLOAT_VEC_T px2(C1cos);
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C2cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C3cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C4cos));
+            c = 1.0 - zz * 0.5 + zz * zz * px2;
+
+            sincosSelect<FLOAT_VEC_T, double, MASK_T>(xx, q, s, c);
+
+            MASK_T maskLarge = (x_pos > LOSSTH);
+            scalarFallback(maskLarge, xx, s, [](double a) { return std::sin(a); });
+            scalarFallback(maskLarge, xx, c, [](double a) { return std::cos(a); });
+        }
+        // SINCOS - double precision, Precision::Strict
+        //   Same as sincosfStrict().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline void sincosdStrict(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            const uint64_t SPLIT = 0xFFFFFFFFF8000000ULL;
+            const double LOSSTH = 1.073741824e9;
+            const double MINRED = 8.8817841970012523e-16; // 2^-50
+
+            // y * DP1D ... y * DP4D are exact for y < 2^31
+            const double DP1D = 7.853982448577880859375E-1;
+            const double DP2D = -8.1460342471473268233239650726E-8;
+            const double DP3D = 2.6951512649788823827723405202E-15;
+            const double DP4D = 1.6410018341217013059776975444E-22;
+            const double DP5D = -6.2684951034662496005931662984E-30;
 
             const double C1sin = 1.58962301576546568060E-10;
             const double C2sin = -2.50507477628578072866E-8;
@@ -771,97 +2162,210 @@ namespace SIMD
             const double C5cos = -1.38888888888730564116E-3;
             const double C6cos = 4.16666666666665929218E-2;
 
-            const double DP1D = 7.853981554508209228515625E-1;
-            const double DP2D = 7.94662735614792836714E-9;
-            const double DP3D = 3.06161699786838294307E-17;
-
-            INT_VEC_T j;
-
-            FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-            // Extended precision modular arithmetic
-            x = ((x - y * DP1D) - y * DP2D) - y * DP3D;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            FLOAT_VEC_T y, q;
+            sincosOctant<FLOAT_VEC_T, double>(x_pos, y, q);
 
-            const FLOAT_VEC_T signS = (j & 4);
+            FLOAT_VEC_T x, xlo, t, tlo;
+            twoSum((x_pos - y * DP1D) - y * DP2D, y * (-DP3D), t, tlo);
+            twoSum(t, y * (-DP4D), x, xlo);
+            xlo += tlo - y * DP5D;
 
-            j -= 2;
-
-            const FLOAT_VEC_T signC = (j & 4);
-            const FLOAT_VEC_T poly = j & 2;
-
-            FLOAT_VEC_T zz = x * x;
+            FLOAT_VEC_T zz, zzlo;
+            twoProd<FLOAT_VEC_T, UINT_VEC_T, double>(x, x, SPLIT, zz, zzlo);
+            zzlo += 2.0 * x * xlo;
 
             FLOAT_VEC_T px1(C1sin);
-            px1 *= zz;
-            px1 += C2sin;
-            px1 *= zz;
-            px1 += C3sin;
-            px1 *= zz;
-            px1 += C4sin;
-            px1 *= zz;
-            px1 += C5sin;
-            px1 *= zz;
-            px1 += C6sin;
-            s = x + x * zz *px1;
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C2sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C3sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C4sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C5sin));
+            px1 = px1.fmuladd(zz, FLOAT_VEC_T(C6sin));
+            s = x + ((xlo - 0.5 * xlo * zz) + x * zz * px1);
 
             FLOAT_VEC_T px2(C1cos);
-            px2 *= zz;
-            px2 += C2cos;
-            px2 *= zz;
-            px2 += C3cos;
-            px2 *= zz;
-            px2 += C4cos;
-            px2 *= zz;
-            px2 += C5cos;
-            px2 *= zz;
-            px2 += C6cos;
-            c = 1.0 - zz * .5 + zz * zz * px2;
-
-            //swap
-            MASK_T maskPoly = (poly == 0);
-
-            const FLOAT_VEC_T tmp = c;
-            c.assign(maskPoly, s);
-            s.assign(maskPoly, tmp);
-
-            MASK_T maskSignC = (signC == 0);
-            c.nega(maskSignC);
-
-            MASK_T maskSignS = (signS != 0);
-            s.nega(maskSignS);
-
-            MASK_T maskXX = (xx < 0);
-            s.nega(maskXX);
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C2cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C3cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C4cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C5cos));
+            px2 = px2.fmuladd(zz, FLOAT_VEC_T(C6cos));
+            const FLOAT_VEC_T hi = 1.0 - 0.5 * zz;
+            const FLOAT_VEC_T lo = (1.0 - hi) - 0.5 * zz;
+            c = hi + ((lo - 0.5 * zzlo) + zz * zz * px2);
+
+            sincosSelect<FLOAT_VEC_T, double, MASK_T>(xx, q, s, c);
+
+            MASK_T maskLarge = (x_pos > LOSSTH) | ((x.abs() < MINRED) & (y != 0.0));
+            scalarFallback(maskLarge, xx, s, [](double a) { return std::sin(a); });
+            scalarFallback(maskLarge, xx, c, [](double a) { return std::cos(a); });
         }
 
-        // MSINCOS - single precision version
-        template<typename FLOAT_VEC_T, typename MASK_TYPE>
-        UME_FORCE_INLINE void sincosf(MASK_TYPE const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
-            FLOAT_VEC_T masked_s, masked_c;
-            s = xx;
-            c = xx;
-            sincosf<FLOAT_VEC_T>(xx, masked_s, masked_c);
-            s.assign(mask, masked_s);
-            c.assign(mask, masked_c);
+        // Kernels of each accuracy tier, selected at compile time by the
+        // UME::SIMD::FUNCTIONS overloads taking a Precision argument.
+        template<Precision PRECISION, typename SCALAR_T>
+        struct PrecisionTier;
+
+        template<typename SCALAR_T>
+        struct PrecisionTier<Precision::Default, SCALAR_T> {
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T exp(FLOAT_VEC_T const & x) { return x.exp(); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T log(FLOAT_VEC_T const & x) { return x.log(); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T sin(FLOAT_VEC_T const & x) { return x.sin(); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T cos(FLOAT_VEC_T const & x) { return x.cos(); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE void sincos(FLOAT_VEC_T const & x, FLOAT_VEC_T & s, FLOAT_VEC_T & c) { x.sincos(s, c); }
+        };
+        template<>
+        struct PrecisionTier<Precision::Fast, float> {
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T exp(FLOAT_VEC_T const & x) { return expfFast<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T log(FLOAT_VEC_T const & x) { return logfFast<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T sin(FLOAT_VEC_T const & x) {
+                return sinfFast<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x);
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T cos(FLOAT_VEC_T const & x) {
+                return cosfFast<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x);
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE void sincos(FLOAT_VEC_T const & x, FLOAT_VEC_T & s, FLOAT_VEC_T & c) { sincosfFast<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x, s, c); }
+        };
+        template<>
+        struct PrecisionTier<Precision::Fast, double> {
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T exp(FLOAT_VEC_T const & x) { return expdFast<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T log(FLOAT_VEC_T const & x) { return logdFast<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T sin(FLOAT_VEC_T const & x) {
+                FLOAT_VEC_T s, c;
+                sincosdFast<FLOAT_VEC_T, MASK_T>(x, s, c);
+                return s;
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T cos(FLOAT_VEC_T const & x) {
+                FLOAT_VEC_T s, c;
+                sincosdFast<FLOAT_VEC_T, MASK_T>(x, s, c);
+                return c;
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE void sincos(FLOAT_VEC_T const & x, FLOAT_VEC_T & s, FLOAT_VEC_T & c) { sincosdFast<FLOAT_VEC_T, MASK_T>(x, s, c); }
+        };
+        template<>
+        struct PrecisionTier<Precision::Strict, float> {
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T exp(FLOAT_VEC_T const & x) { return expfStrict<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T log(FLOAT_VEC_T const & x) { return logfStrict<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T sin(FLOAT_VEC_T const & x) {
+                FLOAT_VEC_T s, c;
+                sincosfStrict<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, s, c);
+                return s;
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T cos(FLOAT_VEC_T const & x) {
+                FLOAT_VEC_T s, c;
+                sincosfStrict<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, s, c);
+                return c;
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE void sincos(FLOAT_VEC_T const & x, FLOAT_VEC_T & s, FLOAT_VEC_T & c) { sincosfStrict<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, s, c); }
+        };
+        template<>
+        struct PrecisionTier<Precision::Strict, double> {
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T exp(FLOAT_VEC_T const & x) { return expdStrict<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T log(FLOAT_VEC_T const & x) { return logdStrict<FLOAT_VEC_T, UINT_VEC_T>(x); }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T sin(FLOAT_VEC_T const & x) {
+                FLOAT_VEC_T s, c;
+                sincosdStrict<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, s, c);
+                return s;
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE FLOAT_VEC_T cos(FLOAT_VEC_T const & x) {
+                FLOAT_VEC_T s, c;
+                sincosdStrict<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, s, c);
+                return c;
+            }
+            template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename INT_VEC_T, typename MASK_T>
+            static UME_FORCE_INLINE void sincos(FLOAT_VEC_T const & x, FLOAT_VEC_T & s, FLOAT_VEC_T & c) { sincosdStrict<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, s, c); }
+        };
+
+        // *****************************************************************
+        // *    Reciprocal and reciprocal square root with selectable accuracy,
+        // *    UME::SIMD::FUNCTIONS::rcp<BITS>(x) and rsqrt<BITS>(x). The result
+        // *    has at least BITS correct bits (max. relative error 2^-BITS).
+        // *    The estimate (RCPE, RSQRTE) is refined with as many Newton-Raphson
+        // *    steps as needed, each step doubling the number of correct bits
+        // *    less two bits for rounding:
+        // *      SSE/AVX/AVX2 float:  estimate 11 bits (max. error 1.5*2^-12),
+        // *                           one step 20 bits, two steps 22 bits.
+        // *      AVX512 float/double: estimate 14 bits (max. error 2^-14),
+        // *                           one step 26 bits, two steps 50 bits,
+        // *                           three steps 51 bits.
+        // *      other:               division, full precision.
+        // *    Above 22 (float) or 51 (double) bits the result is computed with
+        // *    division and square root (max. error 1 ulp). Refined results
+        // *    require finite, non-zero arguments with normal results: zero
+        // *    and infinity give NaN.
+        // *****************************************************************
+
+        // Number of Newton-Raphson steps refining an estimate with
+        // 'estimateBits' correct bits to at least 'bits' correct bits, or -1
+        // if more than 'maxBits' are requested.
+        constexpr int refinementSteps(int estimateBits, int bits, int maxBits) {
+            return (estimateBits >= bits) ? 0 :
+                   (bits > maxBits || estimateBits < 3) ? -1 :
+                   1 + refinementSteps(2 * estimateBits - 2, bits, maxBits);
         }
 
-        // MSINCOS - double precision version
-        template<typename FLOAT_VEC_T, typename MASK_TYPE>
-        UME_FORCE_INLINE void sincosd(MASK_TYPE const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
-            FLOAT_VEC_T masked_s, masked_c;
-            s = xx;
-            c = xx;
-            sincosd<FLOAT_VEC_T>(xx, masked_s, masked_c);
-            s.assign(mask, masked_s);
-            c.assign(mask, masked_c);
+        template<int BITS, typename FLOAT_VEC_T, typename SCALAR_T>
+        UME_FORCE_INLINE FLOAT_VEC_T rcpRefined(FLOAT_VEC_T const & a) {
+            static_assert(BITS > 0 && BITS <= std::numeric_limits<SCALAR_T>::digits,
+                "Number of correct bits exceeds the precision of the type.");
+            const int STEPS = refinementSteps(FLOAT_VEC_T::rcpeBits(), BITS, std::numeric_limits<SCALAR_T>::digits - 2);
+            if (STEPS < 0) {
+                return FLOAT_VEC_T(SCALAR_T(1.0)).div(a);
+            }
+
+            const FLOAT_VEC_T ONE(SCALAR_T(1.0));
+            const FLOAT_VEC_T negA = a.neg();
+            FLOAT_VEC_T x = a.rcpe();
+            for (int i = 0; i < STEPS; i++) {
+                // x = x + x * (1 - a*x)
+                FLOAT_VEC_T e = negA.fmuladd(x, ONE);
+                x = x.fmuladd(e, x);
+            }
+            return x;
         }
 
-        // TAN
-        // MTAN
-        // CTAN
-        // MCTAN
+        template<int BITS, typename FLOAT_VEC_T, typename SCALAR_T>
+        UME_FORCE_INLINE FLOAT_VEC_T rsqrtRefined(FLOAT_VEC_T const & a) {
+            static_assert(BITS > 0 && BITS <= std::numeric_limits<SCALAR_T>::digits,
+                "Number of correct bits exceeds the precision of the type.");
+            const int STEPS = refinementSteps(FLOAT_VEC_T::rsqrteBits(), BITS, std::numeric_limits<SCALAR_T>::digits - 2);
+            if (STEPS < 0) {
+                return FLOAT_VEC_T(SCALAR_T(1.0)).div(a.sqrt());
+            }
+
+            const FLOAT_VEC_T HALF(SCALAR_T(0.5));
+            const FLOAT_VEC_T negHalfA = a.mul(SCALAR_T(-0.5));
+            FLOAT_VEC_T y = a.rsqrte();
+            for (int i = 0; i < STEPS; i++) {
+                // y = y + y * (1 - a*y*y) / 2
+                FLOAT_VEC_T e = negHalfA.mul(y).fmuladd(y, HALF);
+                y = y.fmuladd(e, y);
+            }
+            return y;
+        }
     }
 }
 }
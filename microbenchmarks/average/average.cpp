@@ -42,6 +42,7 @@
 
 //#define UME_SIMD_SHOW_EMULATION_WARNINGS 1
 #include "../../UMESimd.h"
+#include "../../UMEAlgorithms.h"
 
 #include "../utilities/TimingStatistics.h"
 
@@ -489,14 +490,68 @@ TIMING_RES test_UME_SIMD()
     return end - start;
 }
 
+// Same computation as test_UME_SIMD, using array-level reduction. Peeling, remainder and
+// final reduction are handled by the library.
+template<typename FLOAT_VEC_TYPE>
+TIMING_RES test_UME_SIMD_reduce()
+{
+    typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_TYPE>::SCALAR_T FLOAT_T;
+
+    const int ALIGNMENT = FLOAT_VEC_TYPE::alignment();
+
+    unsigned long long start, end;    // Time measurements
+
+    FLOAT_T *x;
+
+    x = (FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(FLOAT_T), ALIGNMENT);
+
+    // Initialize arrays with random data
+    for(int i = 0; i < ARRAY_SIZE; i++)
+    {
+        // Generate random numbers in range (0.0;1000.0)
+        x[i] = static_cast <FLOAT_T> (rand()) / static_cast <FLOAT_T> (RAND_MAX/1000);
+    }
+
+    volatile FLOAT_T avg = 0.0f;
+
+    start = get_timestamp();
+
+    FLOAT_T sum = UME::SIMD::reduce<FLOAT_VEC_TYPE>(x, ARRAY_SIZE);
+    avg = sum/(FLOAT_T)ARRAY_SIZE;
+
+    end = get_timestamp();
+
+    // Verify the result is correct
+    FLOAT_T test_sum = 0.0f;
+    FLOAT_T test_avg = 0.0f;
+    for(int i = 0; i < ARRAY_SIZE; i++)
+    {
+        test_sum += x[i];
+    }
+
+    test_avg = test_sum/(FLOAT_T)ARRAY_SIZE;
+    FLOAT_T normalized_res = avg/test_avg;
+    FLOAT_T err_margin = 0.001f;
+    if(    normalized_res > (1.0f + err_margin)
+        || normalized_res < (1.0f - err_margin) )
+    {
+            std::cout << "Result invalid: " << avg << " expected: " << test_avg << std::endl;
+    }
+
+    UME::DynamicMemory::AlignedFree(x);
+
+    return end - start;
+}
+
 template<typename VEC_T>
-void benchmarkUMESIMD( std::string const & resultPrefix, int iterations, TimingStatistics & reference)
+void benchmarkUMESIMD( std::string const & resultPrefix, int iterations, TimingStatistics & reference,
+                       TIMING_RES (*test)() = test_UME_SIMD<VEC_T>)
 {
     TimingStatistics stats;
 
     for (int i = 0; i < iterations; i++)
     {
-        unsigned long long elapsed = test_UME_SIMD<VEC_T>();
+        unsigned long long elapsed = test();
         stats.update(elapsed);
     }
 
@@ -607,5 +662,10 @@ int main()
     benchmarkUMESIMD<UME::SIMD::SIMD8_64f>("SIMD code(8x64f) :", ITERATIONS, stats_scalar_f);
     benchmarkUMESIMD<UME::SIMD::SIMD16_64f>("SIMD code(16x64f) :", ITERATIONS, stats_scalar_f);
 
+    benchmarkUMESIMD<UME::SIMD::SIMD8_32f>("SIMD reduce(8x32f) :", ITERATIONS, stats_scalar_f, test_UME_SIMD_reduce<UME::SIMD::SIMD8_32f>);
+    benchmarkUMESIMD<UME::SIMD::SIMD16_32f>("SIMD reduce(16x32f) :", ITERATIONS, stats_scalar_f, test_UME_SIMD_reduce<UME::SIMD::SIMD16_32f>);
+    benchmarkUMESIMD<UME::SIMD::SIMD4_64f>("SIMD reduce(4x64f) :", ITERATIONS, stats_scalar_f, test_UME_SIMD_reduce<UME::SIMD::SIMD4_64f>);
+    benchmarkUMESIMD<UME::SIMD::SIMD8_64f>("SIMD reduce(8x64f) :", ITERATIONS, stats_scalar_f, test_UME_SIMD_reduce<UME::SIMD::SIMD8_64f>);
+
     return 0;
 }
@@ -0,0 +1,135 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+// Effect of allocation policies (UME::AllocationPolicy) on memory-bound kernels.
+//
+// For every policy two 1 GiB arrays are allocated and initialized in parallel (first touch),
+// then two kernels from the 'average' and 'polynomial' microbenchmarks are run on the whole
+// arrays:
+//   - average:    sum of x[i] (read only),
+//   - polynomial: y[i] = 16th degree polynomial of x[i] (read x, write y).
+// Reported are the time of allocation with first touch and the bandwidth of both kernels.
+//
+// Usage: bandwidth [size in MiB (default 1024)] [NUMA node mask (default 0x1)]
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+#include "../../UMESimd.h"
+#include "../../UMEParallel.h"
+#include "../utilities/TimingStatistics.h"
+
+typedef UME::SIMD::SIMDVec<float, 8> VEC_T;
+
+struct Results {
+    double firstTouch;   // ns
+    double average;      // GB/s
+    double polynomial;   // GB/s
+};
+
+Results run(UME::AllocationPolicy const & policy, std::size_t n, int iterations) {
+    Results r;
+    float a[17];
+    for (int i = 0; i < 17; i++) a[i] = 1.0f / float(i + 1);
+
+    unsigned long long start = get_timestamp();
+    float* x = (float*)UME::DynamicMemory::AlignedMalloc(n * sizeof(float), VEC_T::alignment(), policy);
+    float* y = (float*)UME::DynamicMemory::AlignedMalloc(n * sizeof(float), VEC_T::alignment(), policy);
+    if (x == nullptr || y == nullptr) {
+        std::cout << "Allocation failed\n";
+        std::exit(1);
+    }
+    UME::SIMD::PARALLEL::first_touch<VEC_T>(x, n, 0.5f);
+    UME::SIMD::PARALLEL::first_touch<VEC_T>(y, n, 0.0f);
+    r.firstTouch = double(get_timestamp() - start);
+
+    TimingStatistics statsAverage, statsPolynomial;
+    volatile float avg = 0.0f;
+    for (int i = 0; i < iterations; i++) {
+        start = get_timestamp();
+        avg = UME::SIMD::PARALLEL::reduce<VEC_T>(x, n) / float(n);
+        statsAverage.update(get_timestamp() - start);
+
+        start = get_timestamp();
+        UME::SIMD::PARALLEL::transform<VEC_T>(x, y, n, [&a](VEC_T const & t) {
+            // Estrin's scheme, as in the 'polynomial' benchmark.
+            VEC_T t2 = t * t, t4 = t2 * t2, t8 = t4 * t4, t16 = t8 * t8;
+            return (a[0] + a[1] * t) + t2 * (a[2] + a[3] * t)
+                + t4 * (a[4] + a[5] * t + t2 * (a[6] + a[7] * t))
+                + t8 * (a[8] + a[9] * t + t2 * (a[10] + a[11] * t) + t4 * (a[12] + a[13] * t + t2 * (a[14] + a[15] * t)))
+                + t16 * a[16];
+        });
+        statsPolynomial.update(get_timestamp() - start);
+    }
+    (void)avg;
+
+    r.average = double(n * sizeof(float)) / statsAverage.getAverage();
+    r.polynomial = double(2 * n * sizeof(float)) / statsPolynomial.getAverage();
+
+    UME::DynamicMemory::AlignedFree(x, n * sizeof(float), policy);
+    UME::DynamicMemory::AlignedFree(y, n * sizeof(float), policy);
+    return r;
+}
+
+int main(int argc, char** argv) {
+    const int ITERATIONS = 10;
+    std::size_t mib = argc > 1 ? std::strtoull(argv[1], nullptr, 0) : 1024;
+    uint64_t nodes = argc > 2 ? std::strtoull(argv[2], nullptr, 0) : 0x1;
+    std::size_t n = mib * 1024 * 1024 / sizeof(float);
+
+    UME::AllocationPolicy hugeInterleave = UME::AllocationPolicy::interleave(nodes);
+    hugeInterleave.hugePages = true;
+
+    struct { const char* name; UME::AllocationPolicy policy; } policies[] = {
+        { "default (4 KiB pages)", UME::AllocationPolicy() },
+        { "2 MiB aligned",         UME::AllocationPolicy() },
+        { "huge pages",            UME::AllocationPolicy::huge() },
+        { "NUMA bind",             UME::AllocationPolicy::bind(nodes) },
+        { "NUMA interleave",       UME::AllocationPolicy::interleave(nodes) },
+        { "huge + interleave",     hugeInterleave }
+    };
+    policies[1].policy.hugeAlign = true;
+
+    std::cout << "Arrays of " << mib << " MiB, " << UME::SIMD::PARALLEL::ThreadPool::global().size()
+        << " threads, " << ITERATIONS << " iterations.\n"
+        "first touch: allocation and parallel initialization of both arrays.\n"
+        "Bandwidth in GB/s.\n\n";
+    std::cout << std::left << std::setw(24) << "policy"
+        << std::right << std::setw(18) << "first touch [ms]"
+        << std::setw(12) << "average" << std::setw(14) << "polynomial" << std::endl;
+    for (auto const & p : policies) {
+        Results r = run(p.policy, n, ITERATIONS);
+        std::cout << std::left << std::setw(24) << p.name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(18) << r.firstTouch * 1e-6
+            << std::setw(12) << r.average << std::setw(14) << r.polynomial << std::endl;
+    }
+    return 0;
+}
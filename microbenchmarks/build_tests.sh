@@ -19,6 +19,26 @@ fi
 rm *.out
 cd ..
 
+RESULT="bandwidth_$1_$2_$3.txt"
+cd bandwidth
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
+RESULT="division_$1_$2_$3.txt"
+cd division
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
 RESULT="explog_$1_$2_$3.txt"
 cd explog
 make $COMPILER $ISA $BUILD
@@ -71,6 +91,26 @@ rm *.out
 rm *.bmp
 cd ..
 
+RESULT="mathfun_$1_$2_$3.txt"
+cd mathfun
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
+RESULT="precision_$1_$2_$3.txt"
+cd precision
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
 #this benchmark is not complete yet!
 #RESULT="matmul_$1_$2_$3.txt"
 #cd matmul
@@ -39,6 +39,7 @@
 
 //#define UME_SIMD_SHOW_EMULATION_WARNINGS 1
 #include "../../UMESimd.h"
+#include "../../UMEAlgorithms.h"
 #include "../utilities/TimingStatistics.h"
 
 const int INPUT_SIZE = 1000000; // Number of data samples
@@ -120,12 +121,15 @@ inline void test_UME_SIMD_float_recursive_helper<UME::SIMD::SIMD1_32f, UME::SIMD
     hist[bin]++;
 }
 
-template<typename FLOAT_VEC_T>
+// With SCATTER_INC set, collisions are resolved by FUNCTIONS::scatterInc using
+// CONFLICT instead of splitting the index vector.
+template<typename FLOAT_VEC_T, bool SCATTER_INC>
 TIMING_RES test_UME_SIMD()
 {
     typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_T>::SCALAR_T   FLOAT_T;
     typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_T>::INT_VEC_T  INT_VEC_T;
     typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_T>::UINT_VEC_T UINT_VEC_T;
+    typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_T>::MASK_T     MASK_T;
 
     const uint32_t VEC_LEN = FLOAT_VEC_T::length();
     const int ALIGNMENT = FLOAT_VEC_T::alignment();
@@ -165,8 +169,6 @@ TIMING_RES test_UME_SIMD()
         INT_VEC_T t1;
         UINT_VEC_T index_vec;
 
-        unsigned int bin;
-
         start = get_timestamp();
 
         for (uint32_t i = 0; i < PEEL_COUNT; i++) {
@@ -176,13 +178,19 @@ TIMING_RES test_UME_SIMD()
             t1 = t0.trunc();
             index_vec.assign(UINT_VEC_T(t1));
             // Perform histogram update
-            test_UME_SIMD_float_recursive_helper<FLOAT_VEC_T, UINT_VEC_T>(index_vec, hist);
+            if (SCATTER_INC) UME::SIMD::FUNCTIONS::scatterInc(hist, index_vec);
+            else test_UME_SIMD_float_recursive_helper<FLOAT_VEC_T, UINT_VEC_T>(index_vec, hist);
         }
         
-        // Calculate reminder elements using scalar code
-        for (uint32_t i = 0; i < REM_COUNT; i++) {
-            bin = (unsigned int)((FLOAT_T(HIST_SIZE) / static_cast<FLOAT_T>(1000)) * data[PEEL_COUNT*VEC_LEN + i]);
-            hist[bin]++;
+        // Calculate reminder elements using a tail load. Only the first
+        // REM_COUNT bins are updated.
+        if (REM_COUNT > 0) {
+            MASK_T tail_mask = UME::SIMD::ALGORITHMS::tailMask<FLOAT_VEC_T>(REM_COUNT);
+            data_vec.loadTail(&data[PEEL_COUNT*VEC_LEN], REM_COUNT);
+            t0 = data_vec.mul(coeff_vec);
+            t1 = t0.trunc();
+            index_vec.assign(UINT_VEC_T(t1));
+            UME::SIMD::FUNCTIONS::scatterInc(tail_mask, hist, index_vec);
         }
 
         end = get_timestamp();
@@ -207,14 +215,14 @@ TIMING_RES test_UME_SIMD()
     return end - start;
 }
 
-template<typename VEC_T>
+template<typename VEC_T, bool SCATTER_INC>
 void benchmarkUMESIMD(std::string const & resultPrefix, int iterations, TimingStatistics & reference)
 {
     TimingStatistics stats;
 
     for (int i = 0; i < iterations; i++)
     {
-        unsigned long long elapsed = test_UME_SIMD<VEC_T>();
+        unsigned long long elapsed = test_UME_SIMD<VEC_T, SCATTER_INC>();
         stats.update(elapsed);
     }
 
@@ -241,7 +249,9 @@ int main()
         "SIMD versions use following operations: \n"
         "float 32b: LOADA, MULV, TRUNC\n"
         "int   32b:  ITOU\n"
-        "uint  32b:  ASSIGNV, UNIQUE, GATHERV, SCATTERV, PREFINC, UNPACK\n\n";
+        "uint  32b:  ASSIGNV, UNIQUE, GATHERV, SCATTERV, PREFINC, UNPACK\n"
+        "uint  32b (scatterInc):  ASSIGNV, CONFLICT, MGATHERV, ADDS, MSCATTERV\n"
+        "remainder: LOADTAIL, MSCATTERINCV\n\n";
 
     for (int i = 0; i < ITERATIONS; i++)
     {
@@ -255,12 +265,19 @@ int main()
         << " (speedup: 1.0x)"
         << std::endl;
 
-    benchmarkUMESIMD<UME::SIMD::SIMD1_32f>("SIMD code (1x32f): ", ITERATIONS, stats_scalar_f);
-    benchmarkUMESIMD<UME::SIMD::SIMD2_32f>("SIMD code (2x32f): ", ITERATIONS, stats_scalar_f);
-    benchmarkUMESIMD<UME::SIMD::SIMD4_32f>("SIMD code (4x32f): ", ITERATIONS, stats_scalar_f);
-    benchmarkUMESIMD<UME::SIMD::SIMD8_32f>("SIMD code (8x32f): ", ITERATIONS, stats_scalar_f);
-    benchmarkUMESIMD<UME::SIMD::SIMD16_32f>("SIMD code (16x32f): ", ITERATIONS, stats_scalar_f);
-    benchmarkUMESIMD<UME::SIMD::SIMD32_32f>("SIMD code (32x32f): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD1_32f, false>("SIMD code (1x32f): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD2_32f, false>("SIMD code (2x32f): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD4_32f, false>("SIMD code (4x32f): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD8_32f, false>("SIMD code (8x32f): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD16_32f, false>("SIMD code (16x32f): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD32_32f, false>("SIMD code (32x32f): ", ITERATIONS, stats_scalar_f);
+
+    benchmarkUMESIMD<UME::SIMD::SIMD1_32f, true>("SIMD code (1x32f, scatterInc): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD2_32f, true>("SIMD code (2x32f, scatterInc): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD4_32f, true>("SIMD code (4x32f, scatterInc): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD8_32f, true>("SIMD code (8x32f, scatterInc): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD16_32f, true>("SIMD code (16x32f, scatterInc): ", ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD<UME::SIMD::SIMD32_32f, true>("SIMD code (32x32f, scatterInc): ", ITERATIONS, stats_scalar_f);
 
     return 0;
 }
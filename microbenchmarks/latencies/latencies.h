@@ -1444,6 +1444,8 @@ DEFINE_VEC_VEC_VEC_TEST_TEMPLATE(FMULADDV, fmuladd);
 DEFINE_VEC_VEC_VEC_TEST_TEMPLATE(FMULSUBV, fmulsub);
 DEFINE_VEC_VEC_VEC_TEST_TEMPLATE(FADDMULV, faddmul);
 DEFINE_VEC_VEC_VEC_TEST_TEMPLATE(FSUBMULV, fsubmul);
+DEFINE_VEC_VEC_VEC_TEST_TEMPLATE(FNMADDV, fnmadd);
+DEFINE_VEC_VEC_VEC_TEST_TEMPLATE(FNMSUBV, fnmsub);
 
 // vec0 = vec1.<INSTR>(mask, vec2, vec3)
 //      Base interface operations
@@ -1451,6 +1453,8 @@ DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFMULADDV, fmuladd);
 DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFMULSUBV, fmulsub);
 DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFADDMULV, faddmul);
 DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFSUBMULV, fsubmul);
+DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFNMADDV, fnmadd);
+DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFNMSUBV, fnmsub);
 
 #define STRINGIFY(x) #x
 #define TOSTRING(x) STRINGIFY(x)
@@ -1563,6 +1567,10 @@ DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFSUBMULV, fsubmul);
     CALL_TEST(MFADDMULV, vecname); \
     CALL_TEST(FSUBMULV, vecname); \
     CALL_TEST(MFSUBMULV, vecname); \
+    CALL_TEST(FNMADDV, vecname); \
+    CALL_TEST(MFNMADDV, vecname); \
+    CALL_TEST(FNMSUBV, vecname); \
+    CALL_TEST(MFNMSUBV, vecname); \
     CALL_TEST(MAXV, vecname); \
     CALL_TEST(MMAXV, vecname); \
     CALL_TEST(MAXS, vecname); \
@@ -85,7 +85,7 @@ void mandel_umesimd(
             VEC_T ymm10 = VEC_T(SCALAR_T(0));  // zero out iteration counter (ymm0 is just a dummy)
             VEC_T ymm11 = ymm10, ymm12 = ymm10;        // set initial xi=0, yi=0
 
-            unsigned int test = 0;
+            uint64_t test = 0;
             int iter = 0;
             do
             {
@@ -95,7 +95,7 @@ void mandel_umesimd(
 
                 MASK_T mask = ymm15 < ymm5;        // xi*xi+yi*yi < 4 in each slot
                                                                        // now ymm15 has all 1s in the non overflowed locations
-                test = mask.hlor();      // lower 8 bits are comparisons
+                test = mask.toBits();    // lower VEC_LEN bits are comparisons
                 VEC_T ymm16 = VEC_T(SCALAR_T(0)); 
                 ymm16.assign(mask, ymm4); // get 1.0f or 0.0f in each field as counters
                 ymm10 = ymm10 + ymm16;        // counters for each pixel iteration
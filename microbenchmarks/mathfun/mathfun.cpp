@@ -0,0 +1,157 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include <random>
+#include <iomanip>
+
+#include "../../UMESimd.h"
+#include "../utilities/TimingStatistics.h"
+
+using namespace UME::SIMD;
+
+// Definitions required for benchmarking kernels.
+template<typename SCALAR_FLOAT_T>
+SCALAR_FLOAT_T HUGE_VALUE() {
+    return SCALAR_FLOAT_T(0.0);
+}
+
+template<>
+float HUGE_VALUE<float>() {
+    return HUGE_VALF;
+}
+
+template<>
+double HUGE_VALUE<double>() {
+    return HUGE_VAL;
+}
+
+template<typename SCALAR_FLOAT_T>
+SCALAR_FLOAT_T NEXT_AFTER(SCALAR_FLOAT_T from, SCALAR_FLOAT_T to) {
+    return std::nextafter(from, to);
+}
+
+template<>
+float NEXT_AFTER(float from, float to) {
+    return std::nextafterf(from, to);
+}
+
+template<>
+double NEXT_AFTER(double from, double to) {
+    return std::nextafter(from, to);
+}
+
+template<typename SCALAR_FLOAT_T>
+struct benchmark_results {
+    unsigned long long elapsedTime;
+    SCALAR_FLOAT_T error_ulp;
+};
+
+enum MathFunction { TAN, ATAN, ATAN2, POW, LOG2, LOG10, EXP2, FUNCTION_COUNT };
+
+const char * FUNCTION_NAMES[FUNCTION_COUNT] = { "TAN", "ATAN", "ATAN2", "POW", "LOG2", "LOG10", "EXP2" };
+
+template<typename SCALAR_FLOAT_T>
+struct MathfunResults {
+    TimingStatistics time[FUNCTION_COUNT];
+    SCALAR_FLOAT_T max_err[FUNCTION_COUNT];
+
+    MathfunResults() {
+        for (int i = 0; i < FUNCTION_COUNT; i++) max_err[i] = 0;
+    }
+
+    void update(MathFunction f, benchmark_results<SCALAR_FLOAT_T> const & res) {
+        time[f].update(res.elapsedTime);
+        if (max_err[f] < res.error_ulp) max_err[f] = res.error_ulp;
+    }
+
+    void print(std::string const & resultPrefix, MathfunResults<float> & reference) {
+        std::cout << resultPrefix.c_str() << "\n";
+        for (int i = 0; i < FUNCTION_COUNT; i++) {
+            std::cout << "    " << std::left << std::setw(7) << FUNCTION_NAMES[i] << std::right
+                << "time: " << (unsigned long long)time[i].getAverage()
+                << ", dev: " << (unsigned long long)time[i].getStdDev()
+                << " (speedup: " << time[i].calculateSpeedup(reference.time[i]) << ") "
+                << "  Error(ulp): " << max_err[i] << "\n";
+        }
+        std::cout << std::flush;
+    }
+};
+
+#include "mathfun.h"
+#include "mathfun_scalar.h"
+#include "mathfun_ume.h"
+
+int main()
+{
+    const int ITERATIONS = 100;
+    const int ARRAY_SIZE = 10240;
+
+    MathfunResults<float> stats_scalar_f;
+    MathfunResults<double> stats_scalar_d;
+
+    std::cout << "The result is amount of time it takes to calculate tan, atan, atan2, pow, log2, log10 and exp2 of: " << ARRAY_SIZE << " elements.\n"
+        "All timing results in nanoseconds. \n"
+        "Speedup calculated with scalar single precision floating point result as reference.\n"
+        "Error is the maximum error in ulp, measured against a long double reference.\n"
+        "SIMD version uses following operations: \n"
+        " TAN, ATAN, ATAN2, POWV, LOG2, LOG10, EXP2\n\n";
+
+    // ----------------------------------------
+    // Benchmark using single precision.
+    // ----------------------------------------
+
+    // 1. Benchmark using std:: functions. This version will be used as reference.
+    benchmarkScalar<float>("Scalar code (float): ", ITERATIONS, ARRAY_SIZE, stats_scalar_f, stats_scalar_f);
+
+    // 2. Benchmark using UME::SIMD functions.
+    benchmarkUMESIMD<float, 1>("SIMD code(1x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<float, 2>("SIMD code(2x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<float, 4>("SIMD code(4x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<float, 8>("SIMD code(8x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<float, 16>("SIMD code(16x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<float, 32>("SIMD code(32x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+
+    // ----------------------------------------
+    // Benchmark using double precision.
+    // Scalar float used as a reference.
+    // ----------------------------------------
+
+    // 3. Benchmark using std:: functions.
+    benchmarkScalar<double>("Scalar code (double): ", ITERATIONS, ARRAY_SIZE, stats_scalar_d, stats_scalar_f);
+
+    // 4. Benchmark using UME::SIMD functions.
+    benchmarkUMESIMD<double, 1>("SIMD code(1x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<double, 2>("SIMD code(2x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<double, 4>("SIMD code(4x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<double, 8>("SIMD code(8x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD<double, 16>("SIMD code(16x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef PRECISION_H_
+#define PRECISION_H_
+
+#include <cmath>
+#include <random>
+
+// Every benchmarked function is described by an 'operation' structure:
+//   - 'name' is used when printing results,
+//   - 'generate' fills the input array with arguments in the function's
+//     useful range,
+//   - 'scalar' and 'simd' compute the result using std:: and UME::SIMD,
+//     'simd' takes the accuracy tier as template parameter,
+//   - 'reference' computes the result in extended precision.
+
+template<typename SCALAR_FLOAT_T>
+UME_NEVER_INLINE void generate_uniform(int N, SCALAR_FLOAT_T * in, SCALAR_FLOAT_T lo, SCALAR_FLOAT_T hi) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(lo, hi);
+
+    for (int i = 0; i < N; i++) {
+        in[i] = dist(gen);
+    }
+}
+
+// Values distributed uniformly in the exponent: 2^lo .. 2^hi.
+template<typename SCALAR_FLOAT_T>
+UME_NEVER_INLINE void generate_exponential(int N, SCALAR_FLOAT_T * in, SCALAR_FLOAT_T lo, SCALAR_FLOAT_T hi) {
+    generate_uniform<SCALAR_FLOAT_T>(N, in, lo, hi);
+
+    for (int i = 0; i < N; i++) {
+        in[i] = std::exp2(in[i]);
+    }
+}
+
+// Limits keeping the arguments and results in the normal range.
+template<typename SCALAR_FLOAT_T>
+inline SCALAR_FLOAT_T EXPONENT_LIMIT() { return SCALAR_FLOAT_T(0.0); }
+template<> inline float EXPONENT_LIMIT<float>() { return 120.0f; }
+template<> inline double EXPONENT_LIMIT<double>() { return 1000.0; }
+
+struct ExpOp {
+    static const char * name() { return "EXP"; }
+    template<typename SCALAR_FLOAT_T>
+    static void generate(int N, SCALAR_FLOAT_T * inA) {
+        // exp(x) = 2^(x * log2(e)), so that the result stays below 2^EXPONENT_LIMIT
+        SCALAR_FLOAT_T limit = EXPONENT_LIMIT<SCALAR_FLOAT_T>() * SCALAR_FLOAT_T(0.69314718);
+        generate_uniform<SCALAR_FLOAT_T>(N, inA, -limit, limit);
+    }
+    template<typename SCALAR_FLOAT_T>
+    static SCALAR_FLOAT_T scalar(SCALAR_FLOAT_T a) { return std::exp(a); }
+    template<Precision PRECISION, typename VEC_T>
+    static VEC_T simd(VEC_T const & a) { return FUNCTIONS::exp<PRECISION>(a); }
+    static long double reference(long double a) { return expl(a); }
+};
+
+struct LogOp {
+    static const char * name() { return "LOG"; }
+    template<typename SCALAR_FLOAT_T>
+    static void generate(int N, SCALAR_FLOAT_T * inA) {
+        SCALAR_FLOAT_T limit = EXPONENT_LIMIT<SCALAR_FLOAT_T>();
+        generate_exponential<SCALAR_FLOAT_T>(N, inA, -limit, limit);
+    }
+    template<typename SCALAR_FLOAT_T>
+    static SCALAR_FLOAT_T scalar(SCALAR_FLOAT_T a) { return std::log(a); }
+    template<Precision PRECISION, typename VEC_T>
+    static VEC_T simd(VEC_T const & a) { return FUNCTIONS::log<PRECISION>(a); }
+    static long double reference(long double a) { return logl(a); }
+};
+
+struct SinOp {
+    static const char * name() { return "SIN"; }
+    template<typename SCALAR_FLOAT_T>
+    static void generate(int N, SCALAR_FLOAT_T * inA) {
+        generate_uniform<SCALAR_FLOAT_T>(N, inA, SCALAR_FLOAT_T(-100.0), SCALAR_FLOAT_T(100.0));
+    }
+    template<typename SCALAR_FLOAT_T>
+    static SCALAR_FLOAT_T scalar(SCALAR_FLOAT_T a) { return std::sin(a); }
+    template<Precision PRECISION, typename VEC_T>
+    static VEC_T simd(VEC_T const & a) { return FUNCTIONS::sin<PRECISION>(a); }
+    static long double reference(long double a) { return sinl(a); }
+};
+
+struct CosOp {
+    static const char * name() { return "COS"; }
+    template<typename SCALAR_FLOAT_T>
+    static void generate(int N, SCALAR_FLOAT_T * inA) {
+        generate_uniform<SCALAR_FLOAT_T>(N, inA, SCALAR_FLOAT_T(-100.0), SCALAR_FLOAT_T(100.0));
+    }
+    template<typename SCALAR_FLOAT_T>
+    static SCALAR_FLOAT_T scalar(SCALAR_FLOAT_T a) { return std::cos(a); }
+    template<Precision PRECISION, typename VEC_T>
+    static VEC_T simd(VEC_T const & a) { return FUNCTIONS::cos<PRECISION>(a); }
+    static long double reference(long double a) { return cosl(a); }
+};
+
+// Error of 'value' in units in the last place of the correctly rounded result.
+template<typename SCALAR_FLOAT_T>
+SCALAR_FLOAT_T error_ulp(SCALAR_FLOAT_T value, long double reference) {
+    SCALAR_FLOAT_T rounded = SCALAR_FLOAT_T(reference);
+    if (value == rounded) return SCALAR_FLOAT_T(0.0);
+    if (std::isnan(value) || std::isnan(rounded) || std::isinf(value) || std::isinf(rounded)) {
+        return std::numeric_limits<SCALAR_FLOAT_T>::infinity();
+    }
+    SCALAR_FLOAT_T ulp = std::abs(NEXT_AFTER(rounded, HUGE_VALUE<SCALAR_FLOAT_T>()) - rounded);
+    return SCALAR_FLOAT_T(std::abs((long double)value - reference) / (long double)ulp);
+}
+
+template<typename SCALAR_FLOAT_T, typename OP>
+SCALAR_FLOAT_T max_error_ulp(int N, SCALAR_FLOAT_T const * inA, SCALAR_FLOAT_T const * values) {
+    SCALAR_FLOAT_T max_err = 0;
+    for (int i = 0; i < N; i++) {
+        SCALAR_FLOAT_T err = error_ulp<SCALAR_FLOAT_T>(values[i], OP::reference(inA[i]));
+        if (max_err < err) max_err = err;
+    }
+    return max_err;
+}
+
+#endif
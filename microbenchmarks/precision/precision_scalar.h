@@ -0,0 +1,80 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef PRECISION_SCALAR_H_
+#define PRECISION_SCALAR_H_
+
+#include "precision.h"
+
+// Kernel for benchmarking using std:: function calls.
+template<typename SCALAR_FLOAT_T, typename OP>
+UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_scalar(const int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T* inputA = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* values = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+
+    OP::template generate<SCALAR_FLOAT_T>(LEN, inputA);
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = OP::template scalar<SCALAR_FLOAT_T>(inputA[i]);
+    }
+
+    end = get_timestamp();
+
+    benchmark_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = max_error_ulp<SCALAR_FLOAT_T, OP>(LEN, inputA, values);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+template<typename SCALAR_FLOAT_T>
+void benchmarkScalar(std::string resultPrefix, int iterations, int array_size, PrecisionResults<SCALAR_FLOAT_T> & result, PrecisionResults<float> & reference)
+{
+    for (int i = 0; i < iterations; i++)
+    {
+        result.update(EXP, test_scalar<SCALAR_FLOAT_T, ExpOp>(array_size));
+        result.update(LOG, test_scalar<SCALAR_FLOAT_T, LogOp>(array_size));
+        result.update(SIN, test_scalar<SCALAR_FLOAT_T, SinOp>(array_size));
+        result.update(COS, test_scalar<SCALAR_FLOAT_T, CosOp>(array_size));
+    }
+
+    result.print(resultPrefix, reference);
+}
+
+#endif
@@ -0,0 +1,97 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef PRECISION_UME_H_
+#define PRECISION_UME_H_
+
+#include "precision_scalar.h"
+
+// Kernel for benchmarking using UME::SIMD functions of a given accuracy tier.
+template<typename SCALAR_FLOAT_T, int VEC_LEN, Precision PRECISION, typename OP>
+UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_ume(const int ARRAY_SIZE)
+{
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> a, y;
+
+    unsigned long long start, end;    // Time measurements
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T* inputA = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* values = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+
+    OP::template generate<SCALAR_FLOAT_T>(LEN, inputA);
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i += VEC_LEN) {
+        a.load(&inputA[i]);
+
+        y = OP::template simd<PRECISION>(a);
+
+        y.store(&values[i]);
+    }
+
+    end = get_timestamp();
+
+    benchmark_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = max_error_ulp<SCALAR_FLOAT_T, OP>(LEN, inputA, values);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+template<typename SCALAR_FLOAT_T, int VEC_LEN, Precision PRECISION>
+void benchmarkUMESIMD(std::string resultPrefix, int iterations, int array_size, PrecisionResults<float> & reference)
+{
+    PrecisionResults<SCALAR_FLOAT_T> result;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        result.update(EXP, test_ume<SCALAR_FLOAT_T, VEC_LEN, PRECISION, ExpOp>(array_size));
+        result.update(LOG, test_ume<SCALAR_FLOAT_T, VEC_LEN, PRECISION, LogOp>(array_size));
+        result.update(SIN, test_ume<SCALAR_FLOAT_T, VEC_LEN, PRECISION, SinOp>(array_size));
+        result.update(COS, test_ume<SCALAR_FLOAT_T, VEC_LEN, PRECISION, CosOp>(array_size));
+    }
+
+    result.print(resultPrefix, reference);
+}
+
+// All accuracy tiers for one vector length.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+void benchmarkUMESIMDTiers(std::string resultPrefix, int iterations, int array_size, PrecisionResults<float> & reference)
+{
+    benchmarkUMESIMD<SCALAR_FLOAT_T, VEC_LEN, Precision::Fast>(resultPrefix + "Fast: ", iterations, array_size, reference);
+    benchmarkUMESIMD<SCALAR_FLOAT_T, VEC_LEN, Precision::Default>(resultPrefix + "Default: ", iterations, array_size, reference);
+    benchmarkUMESIMD<SCALAR_FLOAT_T, VEC_LEN, Precision::Strict>(resultPrefix + "Strict: ", iterations, array_size, reference);
+}
+
+#endif
@@ -16,6 +16,20 @@ for i in *.out; do "./$i" > "../$RESULT"; done
 rm *.out
 cd ..
 
+RESULT="bandwidth_$1_$2_$3.txt"
+cd bandwidth
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
+RESULT="division_$1_$2_$3.txt"
+cd division
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
 RESULT="explog_$1_$2_$3.txt"
 cd explog
 make $COMPILER $ISA $BUILD
@@ -53,6 +67,20 @@ rm *.out
 rm *.bmp
 cd ..
 
+RESULT="mathfun_$1_$2_$3.txt"
+cd mathfun
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
+RESULT="precision_$1_$2_$3.txt"
+cd precision
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
 #this benchmark is not complete yet!
 #RESULT="matmul_$1_$2_$3.txt"
 #cd matmul
@@ -54,10 +54,10 @@ namespace SIMD
     template<> struct SuggestedVecLen<float> { static const int value = 1; };
     template<> struct SuggestedVecLen<double> { static const int value = 1; };
 #else
-    template<> struct SuggestedVecLen<uint8_t> { static const int value = 1; };
-    template<> struct SuggestedVecLen<int8_t> { static const int value = 1; };
-    template<> struct SuggestedVecLen<uint16_t> { static const int value = 1; };
-    template<> struct SuggestedVecLen<int16_t> { static const int value = 1; };
+    template<> struct SuggestedVecLen<uint8_t> { static const int value = 32; };
+    template<> struct SuggestedVecLen<int8_t> { static const int value = 32; };
+    template<> struct SuggestedVecLen<uint16_t> { static const int value = 16; };
+    template<> struct SuggestedVecLen<int16_t> { static const int value = 16; };
     template<> struct SuggestedVecLen<uint32_t> { static const int value = 8; };
     template<> struct SuggestedVecLen<int32_t> { static const int value = 8; };
     template<> struct SuggestedVecLen<uint64_t> { static const int value = 4; };
@@ -74,6 +74,10 @@ namespace SIMD
 
     // Forward declarations of template specializations.
     // Only fully specialized classes should be listed here.
+    template<> class SIMDVec_u<uint8_t, 32>;
+
+    template<> class SIMDVec_u<uint16_t, 16>;
+
     template<> class SIMDVec_u<uint32_t, 1>;
     template<> class SIMDVec_u<uint32_t, 2>;
     template<> class SIMDVec_u<uint32_t, 4>;
@@ -87,6 +91,10 @@ namespace SIMD
     //template<> class SIMDVec_u<uint64_t, 8>;
     //template<> class SIMDVec_u<uint64_t, 16>;
     
+    template<> class SIMDVec_i<int8_t, 32>;
+
+    template<> class SIMDVec_i<int16_t, 16>;
+
     template<> class SIMDVec_i<int32_t, 1>;
     template<> class SIMDVec_i<int32_t, 2>;
     template<> class SIMDVec_i<int32_t, 4>;
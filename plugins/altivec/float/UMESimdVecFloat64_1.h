@@ -149,6 +149,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         //(Memory access)
         // LOAD
@@ -172,6 +172,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const *p) {
@@ -170,6 +170,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const *p) {
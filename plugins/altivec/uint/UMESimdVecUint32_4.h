@@ -161,6 +161,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const *p) {
@@ -47,7 +47,7 @@ namespace SIMD {
             SIMDVec_u<uint64_t, 2>,
             SIMDVec_i<int64_t, 2>,
             double,
-            1,
+            2,
             uint64_t,
             int64_t,
             SIMDVecMask<2>,
@@ -167,6 +167,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -1202,28 +1204,28 @@ namespace SIMD {
         // MLOG10
         // SIN
         //UME_FORCE_INLINE SIMDVec_f sin() const {
-        //    return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+        //    return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<2>>(*this);
         //}
         // MSIN
         //UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<2> const & mask) //const {
-        //    return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        //    return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
         //}
         // COS
         //UME_FORCE_INLINE SIMDVec_f cos() const {
-        //    return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+        //    return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<2>>(*this);
         //}
         // MCOS
         //UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<2> const & mask) //const {
-        //    return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        //    return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
         //}
         // SINCOS
         //UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
-        //    VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this, sinvec, cosvec);
+        //    VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<2>>(*this, sinvec, cosvec);
         //}
         // MSINCOS
         //UME_FORCE_INLINE void sincos(SIMDVecMask<2> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
-        //    sinvec = VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
-        //    cosvec = VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        //    sinvec = VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        //    cosvec = VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
         //}
         // TAN
         // MTAN
@@ -442,8 +442,16 @@ namespace SIMD {
     }
 
     inline SIMDVec_f<float, 8>::operator SIMDVec_u<uint32_t, 8>() const {
-        __m256i t0 = _mm256_cvtps_epi32(mVec);
-        return SIMDVec_u<uint32_t, 8>(t0);
+        // C++: Truncation is default rounding mode for floating-integer conversion.
+        // Values of 2^31 and above are brought into the signed range before the
+        // conversion, and the top bit is restored afterwards.
+        __m256 t0 = _mm256_set1_ps(2147483648.0f);
+        __m256 t1 = _mm256_cmp_ps(mVec, t0, _CMP_GE_OQ);
+        __m256 t2 = _mm256_sub_ps(mVec, _mm256_and_ps(t1, t0));
+        __m256i t3 = _mm256_cvttps_epi32(t2);
+        __m256 t4 = _mm256_and_ps(t1, _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000)));
+        __m256 t5 = _mm256_xor_ps(_mm256_castsi256_ps(t3), t4);
+        return SIMDVec_u<uint32_t, 8>(_mm256_castps_si256(t5));
     }
 
     inline SIMDVec_f<float, 16>::operator SIMDVec_u<uint32_t, 16>() const {
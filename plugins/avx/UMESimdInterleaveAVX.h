@@ -0,0 +1,344 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_INTERLEAVE_AVX_H_
+#define UME_SIMD_INTERLEAVE_AVX_H_
+
+#include <immintrin.h>
+
+#include "../../UMEInline.h"
+
+// Interleaved (array of structures) loads and stores.
+//
+// deinterleaveK() takes K registers loaded from consecutive memory holding
+// structures of K elements each, and returns one register per structure
+// member. interleaveK() is the inverse operation. Only in-register shuffles
+// are used, so that memory is accessed with full-width contiguous loads and
+// stores.
+//
+// transposeNxN() transposes a matrix of N registers with N elements each in
+// place: after the call register 'i' holds element 'i' of every input register.
+
+namespace UME {
+namespace SIMD {
+namespace AVX {
+
+    // 128-bit, single precision
+
+    UME_FORCE_INLINE void deinterleave2(__m128 const & a, __m128 const & b, __m128 & x, __m128 & y) {
+        x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    UME_FORCE_INLINE void interleave2(__m128 const & x, __m128 const & y, __m128 & a, __m128 & b) {
+        a = _mm_unpacklo_ps(x, y);
+        b = _mm_unpackhi_ps(x, y);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m128 const & a, __m128 const & b, __m128 const & c, __m128 & x, __m128 & y, __m128 & z) {
+        // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+        __m128 t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+        __m128 t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+        __m128 t2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+        __m128 t3 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+        x = _mm_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(t3, c, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    UME_FORCE_INLINE void interleave3(__m128 const & x, __m128 const & y, __m128 const & z, __m128 & a, __m128 & b, __m128 & c) {
+        __m128 t0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 t1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+        __m128 t2 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 t3 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+        __m128 t4 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+        __m128 t5 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+        a = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+        b = _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+        c = _mm_shuffle_ps(t4, t5, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    // 4x4 transpose: de-interleaving and interleaving are the same operation.
+    UME_FORCE_INLINE void deinterleave4(__m128 const & a, __m128 const & b, __m128 const & c, __m128 const & d,
+                                        __m128 & x, __m128 & y, __m128 & z, __m128 & w) {
+        __m128 t0 = _mm_unpacklo_ps(a, b);
+        __m128 t1 = _mm_unpacklo_ps(c, d);
+        __m128 t2 = _mm_unpackhi_ps(a, b);
+        __m128 t3 = _mm_unpackhi_ps(c, d);
+        x = _mm_movelh_ps(t0, t1);
+        y = _mm_movehl_ps(t1, t0);
+        z = _mm_movelh_ps(t2, t3);
+        w = _mm_movehl_ps(t3, t2);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m128 const & x, __m128 const & y, __m128 const & z, __m128 const & w,
+                                      __m128 & a, __m128 & b, __m128 & c, __m128 & d) {
+        deinterleave4(x, y, z, w, a, b, c, d);
+    }
+
+    // 128-bit, double precision
+
+    UME_FORCE_INLINE void deinterleave2(__m128d const & a, __m128d const & b, __m128d & x, __m128d & y) {
+        x = _mm_unpacklo_pd(a, b);
+        y = _mm_unpackhi_pd(a, b);
+    }
+
+    UME_FORCE_INLINE void interleave2(__m128d const & x, __m128d const & y, __m128d & a, __m128d & b) {
+        a = _mm_unpacklo_pd(x, y);
+        b = _mm_unpackhi_pd(x, y);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m128d const & a, __m128d const & b, __m128d const & c, __m128d & x, __m128d & y, __m128d & z) {
+        // a = x0 y0, b = z0 x1, c = y1 z1
+        x = _mm_shuffle_pd(a, b, 0x2);
+        y = _mm_shuffle_pd(a, c, 0x1);
+        z = _mm_shuffle_pd(b, c, 0x2);
+    }
+
+    UME_FORCE_INLINE void interleave3(__m128d const & x, __m128d const & y, __m128d const & z, __m128d & a, __m128d & b, __m128d & c) {
+        a = _mm_shuffle_pd(x, y, 0x0);
+        b = _mm_shuffle_pd(z, x, 0x2);
+        c = _mm_shuffle_pd(y, z, 0x3);
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m128d const & a, __m128d const & b, __m128d const & c, __m128d const & d,
+                                        __m128d & x, __m128d & y, __m128d & z, __m128d & w) {
+        // a = x0 y0, b = z0 w0, c = x1 y1, d = z1 w1
+        x = _mm_unpacklo_pd(a, c);
+        y = _mm_unpackhi_pd(a, c);
+        z = _mm_unpacklo_pd(b, d);
+        w = _mm_unpackhi_pd(b, d);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m128d const & x, __m128d const & y, __m128d const & z, __m128d const & w,
+                                      __m128d & a, __m128d & b, __m128d & c, __m128d & d) {
+        a = _mm_unpacklo_pd(x, y);
+        b = _mm_unpacklo_pd(z, w);
+        c = _mm_unpackhi_pd(x, y);
+        d = _mm_unpackhi_pd(z, w);
+    }
+
+    // 256-bit, single precision. The 128-bit halves are first regrouped so that
+    // the low half holds the first and the high half the second group of four
+    // structures, which then go through the 128-bit shuffles in both halves.
+
+    UME_FORCE_INLINE void deinterleave2(__m256 const & a, __m256 const & b, __m256 & x, __m256 & y) {
+        __m256 t0 = _mm256_permute2f128_ps(a, b, 0x20);
+        __m256 t1 = _mm256_permute2f128_ps(a, b, 0x31);
+        x = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+        y = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    UME_FORCE_INLINE void interleave2(__m256 const & x, __m256 const & y, __m256 & a, __m256 & b) {
+        __m256 t0 = _mm256_unpacklo_ps(x, y);
+        __m256 t1 = _mm256_unpackhi_ps(x, y);
+        a = _mm256_permute2f128_ps(t0, t1, 0x20);
+        b = _mm256_permute2f128_ps(t0, t1, 0x31);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m256 const & a, __m256 const & b, __m256 const & c, __m256 & x, __m256 & y, __m256 & z) {
+        __m256 t0 = _mm256_permute2f128_ps(a, b, 0x30);
+        __m256 t1 = _mm256_permute2f128_ps(a, c, 0x21);
+        __m256 t2 = _mm256_permute2f128_ps(b, c, 0x30);
+        __m256 t3 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(1, 1, 2, 2));
+        __m256 t4 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 1, 1));
+        __m256 t5 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 2, 3, 3));
+        __m256 t6 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 1, 2, 2));
+        x = _mm256_shuffle_ps(t0, t3, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(t4, t5, _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm256_shuffle_ps(t6, t2, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    UME_FORCE_INLINE void interleave3(__m256 const & x, __m256 const & y, __m256 const & z, __m256 & a, __m256 & b, __m256 & c) {
+        __m256 t0 = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+        __m256 t1 = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+        __m256 t2 = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+        __m256 t3 = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+        __m256 t4 = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+        __m256 t5 = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+        __m256 t6 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 t7 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 t8 = _mm256_shuffle_ps(t4, t5, _MM_SHUFFLE(2, 0, 2, 0));
+        a = _mm256_permute2f128_ps(t6, t7, 0x20);
+        b = _mm256_permute2f128_ps(t8, t6, 0x30);
+        c = _mm256_permute2f128_ps(t7, t8, 0x31);
+    }
+
+    // Transpose the 4x4 blocks held in each 128-bit half separately.
+    UME_FORCE_INLINE void transposeLanes4x4(__m256 & r0, __m256 & r1, __m256 & r2, __m256 & r3) {
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m256 const & a, __m256 const & b, __m256 const & c, __m256 const & d,
+                                        __m256 & x, __m256 & y, __m256 & z, __m256 & w) {
+        x = _mm256_permute2f128_ps(a, c, 0x20);
+        y = _mm256_permute2f128_ps(a, c, 0x31);
+        z = _mm256_permute2f128_ps(b, d, 0x20);
+        w = _mm256_permute2f128_ps(b, d, 0x31);
+        transposeLanes4x4(x, y, z, w);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m256 const & x, __m256 const & y, __m256 const & z, __m256 const & w,
+                                      __m256 & a, __m256 & b, __m256 & c, __m256 & d) {
+        __m256 t0 = x, t1 = y, t2 = z, t3 = w;
+        transposeLanes4x4(t0, t1, t2, t3);
+        a = _mm256_permute2f128_ps(t0, t1, 0x20);
+        b = _mm256_permute2f128_ps(t2, t3, 0x20);
+        c = _mm256_permute2f128_ps(t0, t1, 0x31);
+        d = _mm256_permute2f128_ps(t2, t3, 0x31);
+    }
+
+    // 256-bit, double precision
+
+    UME_FORCE_INLINE void deinterleave2(__m256d const & a, __m256d const & b, __m256d & x, __m256d & y) {
+        __m256d t0 = _mm256_permute2f128_pd(a, b, 0x20);
+        __m256d t1 = _mm256_permute2f128_pd(a, b, 0x31);
+        x = _mm256_unpacklo_pd(t0, t1);
+        y = _mm256_unpackhi_pd(t0, t1);
+    }
+
+    UME_FORCE_INLINE void interleave2(__m256d const & x, __m256d const & y, __m256d & a, __m256d & b) {
+        __m256d t0 = _mm256_unpacklo_pd(x, y);
+        __m256d t1 = _mm256_unpackhi_pd(x, y);
+        a = _mm256_permute2f128_pd(t0, t1, 0x20);
+        b = _mm256_permute2f128_pd(t0, t1, 0x31);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m256d const & a, __m256d const & b, __m256d const & c, __m256d & x, __m256d & y, __m256d & z) {
+        __m256d t0 = _mm256_permute2f128_pd(a, b, 0x30);
+        __m256d t1 = _mm256_permute2f128_pd(a, c, 0x21);
+        __m256d t2 = _mm256_permute2f128_pd(b, c, 0x30);
+        x = _mm256_shuffle_pd(t0, t1, 0xA);
+        y = _mm256_shuffle_pd(t0, t2, 0x5);
+        z = _mm256_shuffle_pd(t1, t2, 0xA);
+    }
+
+    UME_FORCE_INLINE void interleave3(__m256d const & x, __m256d const & y, __m256d const & z, __m256d & a, __m256d & b, __m256d & c) {
+        __m256d t0 = _mm256_shuffle_pd(x, y, 0x0);
+        __m256d t1 = _mm256_shuffle_pd(z, x, 0xA);
+        __m256d t2 = _mm256_shuffle_pd(y, z, 0xF);
+        a = _mm256_permute2f128_pd(t0, t1, 0x20);
+        b = _mm256_permute2f128_pd(t2, t0, 0x30);
+        c = _mm256_permute2f128_pd(t1, t2, 0x31);
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m256d const & a, __m256d const & b, __m256d const & c, __m256d const & d,
+                                        __m256d & x, __m256d & y, __m256d & z, __m256d & w) {
+        __m256d t0 = _mm256_permute2f128_pd(a, c, 0x20);
+        __m256d t1 = _mm256_permute2f128_pd(b, d, 0x20);
+        __m256d t2 = _mm256_permute2f128_pd(a, c, 0x31);
+        __m256d t3 = _mm256_permute2f128_pd(b, d, 0x31);
+        x = _mm256_unpacklo_pd(t0, t1);
+        y = _mm256_unpackhi_pd(t0, t1);
+        z = _mm256_unpacklo_pd(t2, t3);
+        w = _mm256_unpackhi_pd(t2, t3);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m256d const & x, __m256d const & y, __m256d const & z, __m256d const & w,
+                                      __m256d & a, __m256d & b, __m256d & c, __m256d & d) {
+        __m256d t0 = _mm256_unpacklo_pd(x, y);
+        __m256d t1 = _mm256_unpackhi_pd(x, y);
+        __m256d t2 = _mm256_unpacklo_pd(z, w);
+        __m256d t3 = _mm256_unpackhi_pd(z, w);
+        a = _mm256_permute2f128_pd(t0, t2, 0x20);
+        b = _mm256_permute2f128_pd(t1, t3, 0x20);
+        c = _mm256_permute2f128_pd(t0, t2, 0x31);
+        d = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+    // Matrix transpose
+
+    UME_FORCE_INLINE void transpose4x4(__m128 & r0, __m128 & r1, __m128 & r2, __m128 & r3) {
+        __m128 t0 = _mm_unpacklo_ps(r0, r1);
+        __m128 t1 = _mm_unpacklo_ps(r2, r3);
+        __m128 t2 = _mm_unpackhi_ps(r0, r1);
+        __m128 t3 = _mm_unpackhi_ps(r2, r3);
+        r0 = _mm_movelh_ps(t0, t1);
+        r1 = _mm_movehl_ps(t1, t0);
+        r2 = _mm_movelh_ps(t2, t3);
+        r3 = _mm_movehl_ps(t3, t2);
+    }
+
+    UME_FORCE_INLINE void transpose2x2(__m128d & r0, __m128d & r1) {
+        __m128d t0 = _mm_unpacklo_pd(r0, r1);
+        r1 = _mm_unpackhi_pd(r0, r1);
+        r0 = t0;
+    }
+
+    UME_FORCE_INLINE void transpose8x8(__m256 & r0, __m256 & r1, __m256 & r2, __m256 & r3, __m256 & r4, __m256 & r5, __m256 & r6, __m256 & r7) {
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+        __m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44);
+        __m256 u1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+        __m256 u2 = _mm256_shuffle_ps(t1, t3, 0x44);
+        __m256 u3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+        __m256 u4 = _mm256_shuffle_ps(t4, t6, 0x44);
+        __m256 u5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+        __m256 u6 = _mm256_shuffle_ps(t5, t7, 0x44);
+        __m256 u7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+        r0 = _mm256_permute2f128_ps(u0, u4, 0x20);
+        r4 = _mm256_permute2f128_ps(u0, u4, 0x31);
+        r1 = _mm256_permute2f128_ps(u1, u5, 0x20);
+        r5 = _mm256_permute2f128_ps(u1, u5, 0x31);
+        r2 = _mm256_permute2f128_ps(u2, u6, 0x20);
+        r6 = _mm256_permute2f128_ps(u2, u6, 0x31);
+        r3 = _mm256_permute2f128_ps(u3, u7, 0x20);
+        r7 = _mm256_permute2f128_ps(u3, u7, 0x31);
+    }
+
+    UME_FORCE_INLINE void transpose4x4(__m256d & r0, __m256d & r1, __m256d & r2, __m256d & r3) {
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+        r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+        r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+        r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+}
+}
+}
+
+#endif
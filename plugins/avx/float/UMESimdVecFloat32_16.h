@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
+#include "../UMESimdInterleaveAVX.h"
 
 namespace UME {
 namespace SIMD {
@@ -187,6 +189,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -196,12 +200,49 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            mVec[0] = _mm256_maskload_ps(p, t1);
+            mVec[1] = _mm256_maskload_ps(p + 8, t2);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 16 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                AVX::deinterleave2(t1, t2, v0.mVec[i], v1.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 24 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                AVX::deinterleave3(t1, t2, t3, v0.mVec[i], v1.mVec[i], v2.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 32 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                __m256 t4 = _mm256_loadu_ps(t0 + 24);
+                AVX::deinterleave4(t1, t2, t3, t4, v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i]);
+            }
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec[0] = _mm256_load_ps(p);
@@ -210,9 +251,9 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t1 = _mm256_load_ps(p + 8);
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
@@ -224,12 +265,51 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE float* store(SIMDVecMask<16> const & mask, float * p) const {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
-            __m256 t2 = _mm256_blendv_ps(t0, mVec[0], _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t3 = _mm256_blendv_ps(t1, mVec[1], _mm256_castsi256_ps(mask.mMask[1]));
-            _mm256_storeu_ps(p, t2);
-            _mm256_storeu_ps(p + 8, t3);
+            _mm256_maskstore_ps(p, mask.mMask[0], mVec[0]);
+            _mm256_maskstore_ps(p + 8, mask.mMask[1], mVec[1]);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            _mm256_maskstore_ps(p, t1, mVec[0]);
+            _mm256_maskstore_ps(p + 8, t2, mVec[1]);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 16 * i;
+                __m256 t1, t2;
+                AVX::interleave2(v0.mVec[i], v1.mVec[i], t1, t2);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 24 * i;
+                __m256 t1, t2, t3;
+                AVX::interleave3(v0.mVec[i], v1.mVec[i], v2.mVec[i], t1, t2, t3);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 32 * i;
+                __m256 t1, t2, t3, t4;
+                AVX::interleave4(v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i], t1, t2, t3, t4);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+                _mm256_storeu_ps(t0 + 24, t4);
+            }
             return p;
         }
         // STOREA
@@ -250,6 +330,51 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            AVX::sortNetwork16<float, false>(t0, t1);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            __m256 t2 = _mm256_castsi256_ps(payload.mVecLo);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVecHi);
+            AVX::sortNetwork16<float, false>(t0, t1, t2, t3);
+            payload.mVecLo = _mm256_castps_si256(t2);
+            payload.mVecHi = _mm256_castps_si256(t3);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            AVX::sortNetwork16<float, true>(t0, t1);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            __m256 t2 = _mm256_castsi256_ps(payload.mVecLo);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVecHi);
+            AVX::sortNetwork16<float, true>(t0, t1, t2, t3);
+            payload.mVecLo = _mm256_castps_si256(t2);
+            payload.mVecHi = _mm256_castps_si256(t3);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_add_ps(this->mVec[0], b.mVec[0]);
@@ -498,6 +623,24 @@ namespace SIMD {
             __m256i m1 = _mm256_castps_si256(t1);
             return SIMDVecMask<16>(m0, m1);
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            __m256 t0 = _mm256_rcp_ps(mVec[0]);
+            __m256 t1 = _mm256_rcp_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 11;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            __m256 t0 = _mm256_rsqrt_ps(mVec[0]);
+            __m256 t1 = _mm256_rsqrt_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 11;
+        }
         UME_FORCE_INLINE SIMDVecMask<16> operator< (SIMDVec_f const & b) const {
             return cmplt(b);
         }
@@ -739,6 +882,22 @@ namespace SIMD {
         // MPOWV     - Masked power (exponents in vector)
         // POWS      - Power (exponent in scalar)
         // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -793,12 +952,60 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<16> const & mask) const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG
         // MLOG
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<16>>(*this, b);
+        }
         // SIN       - Sine
         // MSIN      - Masked sine
         // COS       - Cosine
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX.h"
 
 #define BLEND(a_256, b_256, mask_256i) _mm256_blendv_ps(a_256, b_256, _mm256_castsi256_ps(mask_256i))
 
@@ -218,20 +219,11 @@ namespace SIMD {
             return *this;
         }
 
-        // PREFETCH0  
-        static UME_FORCE_INLINE void prefetch0(float *p) {
-            _mm_prefetch((const char *)p, _MM_HINT_T0);
-        }
-
+        // PREFETCH0
         // PREFETCH1
-        static UME_FORCE_INLINE void prefetch1(float *p) {
-            _mm_prefetch((const char *)p, _MM_HINT_T1);
-        }
-
         // PREFETCH2
-        static UME_FORCE_INLINE void prefetch2(float *p) {
-            _mm_prefetch((const char *)p, _MM_HINT_T2);
-        }
+        // PREFETCHNTA
+        // PREFETCHW
 
         //(Memory access)
         // LOAD
@@ -244,16 +236,57 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<32> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
-            __m256 t2 = _mm256_loadu_ps(p + 16);
-            __m256 t3 = _mm256_loadu_ps(p + 24);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
+            __m256 t2 = _mm256_maskload_ps(p + 16, mask.mMask[2]);
+            __m256 t3 = _mm256_maskload_ps(p + 24, mask.mMask[3]);
+            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_castsi256_ps(mask.mMask[2]));
+            mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_castsi256_ps(mask.mMask[3]));
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            __m256i t3 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(16.0f, 17.0f, 18.0f, 19.0f, 20.0f, 21.0f, 22.0f, 23.0f), t0, _CMP_LT_OQ));
+            __m256i t4 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(24.0f, 25.0f, 26.0f, 27.0f, 28.0f, 29.0f, 30.0f, 31.0f), t0, _CMP_LT_OQ));
+            mVec[0] = _mm256_maskload_ps(p, t1);
+            mVec[1] = _mm256_maskload_ps(p + 8, t2);
+            mVec[2] = _mm256_maskload_ps(p + 16, t3);
+            mVec[3] = _mm256_maskload_ps(p + 24, t4);
             return *this;
         }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            for (int i = 0; i < 4; i++) {
+                float const * t0 = p + 16 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                AVX::deinterleave2(t1, t2, v0.mVec[i], v1.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            for (int i = 0; i < 4; i++) {
+                float const * t0 = p + 24 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                AVX::deinterleave3(t1, t2, t3, v0.mVec[i], v1.mVec[i], v2.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            for (int i = 0; i < 4; i++) {
+                float const * t0 = p + 32 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                __m256 t4 = _mm256_loadu_ps(t0 + 24);
+                AVX::deinterleave4(t1, t2, t3, t4, v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i]);
+            }
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec[0] = _mm256_load_ps(p);
@@ -265,14 +298,14 @@ namespace SIMD {
 
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<32> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
-            __m256 t1 = _mm256_load_ps(p + 8);
-            __m256 t2 = _mm256_load_ps(p + 16);
-            __m256 t3 = _mm256_load_ps(p + 24);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
+            __m256 t2 = _mm256_maskload_ps(p + 16, mask.mMask[2]);
+            __m256 t3 = _mm256_maskload_ps(p + 24, mask.mMask[3]);
+            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_castsi256_ps(mask.mMask[2]));
+            mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_castsi256_ps(mask.mMask[3]));
             return *this;
         }
         // STORE
@@ -285,18 +318,57 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE float* store(SIMDVecMask<32> const & mask, float* p) const {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
-            __m256 t2 = _mm256_loadu_ps(p + 16);
-            __m256 t3 = _mm256_loadu_ps(p + 24);
-            __m256 t4 = _mm256_blendv_ps(t0, mVec[0], _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(t1, mVec[1], _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(t2, mVec[2], _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(t3, mVec[3], _mm256_cvtepi32_ps(mask.mMask[3]));
-            _mm256_storeu_ps(p, t4);
-            _mm256_storeu_ps(p + 8, t5);
-            _mm256_storeu_ps(p + 16, t6);
-            _mm256_storeu_ps(p + 24, t7);
+            _mm256_maskstore_ps(p, mask.mMask[0], mVec[0]);
+            _mm256_maskstore_ps(p + 8, mask.mMask[1], mVec[1]);
+            _mm256_maskstore_ps(p + 16, mask.mMask[2], mVec[2]);
+            _mm256_maskstore_ps(p + 24, mask.mMask[3], mVec[3]);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            __m256i t3 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(16.0f, 17.0f, 18.0f, 19.0f, 20.0f, 21.0f, 22.0f, 23.0f), t0, _CMP_LT_OQ));
+            __m256i t4 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(24.0f, 25.0f, 26.0f, 27.0f, 28.0f, 29.0f, 30.0f, 31.0f), t0, _CMP_LT_OQ));
+            _mm256_maskstore_ps(p, t1, mVec[0]);
+            _mm256_maskstore_ps(p + 8, t2, mVec[1]);
+            _mm256_maskstore_ps(p + 16, t3, mVec[2]);
+            _mm256_maskstore_ps(p + 24, t4, mVec[3]);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            for (int i = 0; i < 4; i++) {
+                float * t0 = p + 16 * i;
+                __m256 t1, t2;
+                AVX::interleave2(v0.mVec[i], v1.mVec[i], t1, t2);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            for (int i = 0; i < 4; i++) {
+                float * t0 = p + 24 * i;
+                __m256 t1, t2, t3;
+                AVX::interleave3(v0.mVec[i], v1.mVec[i], v2.mVec[i], t1, t2, t3);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            for (int i = 0; i < 4; i++) {
+                float * t0 = p + 32 * i;
+                __m256 t1, t2, t3, t4;
+                AVX::interleave4(v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i], t1, t2, t3, t4);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+                _mm256_storeu_ps(t0 + 24, t4);
+            }
             return p;
         }
         // STOREA
@@ -309,18 +381,10 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE float* storea(SIMDVecMask<32> const & mask, float* p) const {
-            __m256 t0 = _mm256_load_ps(p);
-            __m256 t1 = _mm256_load_ps(p + 8);
-            __m256 t2 = _mm256_load_ps(p + 16);
-            __m256 t3 = _mm256_load_ps(p + 24);
-            __m256 t4 = _mm256_blendv_ps(t0, mVec[0], _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(t1, mVec[1], _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(t2, mVec[2], _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(t3, mVec[3], _mm256_cvtepi32_ps(mask.mMask[3]));
-            _mm256_storeu_ps(p, t4);
-            _mm256_storeu_ps(p + 8, t5);
-            _mm256_storeu_ps(p + 16, t6);
-            _mm256_storeu_ps(p + 24, t7);
+            _mm256_maskstore_ps(p, mask.mMask[0], mVec[0]);
+            _mm256_maskstore_ps(p + 8, mask.mMask[1], mVec[1]);
+            _mm256_maskstore_ps(p + 16, mask.mMask[2], mVec[2]);
+            _mm256_maskstore_ps(p + 24, mask.mMask[3], mVec[3]);
             return p;
         }
 
@@ -773,6 +837,22 @@ namespace SIMD {
         // MPOWV     - Masked power (exponents in vector)
         // POWS      - Power (exponent in scalar)
         // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -815,12 +895,60 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<32> const & mask) const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // LOG
         // MLOG
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<32>>(*this, b);
+        }
         // SIN       - Sine
         // MSIN      - Masked sine
         // COS       - Cosine
@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
+#include "../UMESimdInterleaveAVX.h"
 
 #define BLEND(a, b, mask) _mm_blendv_ps(a, b, _mm_castsi128_ps(mask))
 
@@ -159,6 +161,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -167,10 +171,35 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, float const * p) {
-            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t0 = _mm_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            mVec = _mm_maskload_ps(p, t0);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            AVX::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            __m128 t2 = _mm_loadu_ps(p + 8);
+            AVX::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            __m128 t2 = _mm_loadu_ps(p + 8);
+            __m128 t3 = _mm_loadu_ps(p + 12);
+            AVX::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec = _mm_load_ps(p);
@@ -178,7 +207,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, float const * p) {
-            __m128 t0 = _mm_load_ps(p);
+            __m128 t0 = _mm_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -192,6 +221,41 @@ namespace SIMD {
             _mm_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            _mm_maskstore_ps(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m128 t0, t1;
+            AVX::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m128 t0, t1, t2;
+            AVX::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            _mm_storeu_ps(p + 8, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m128 t0, t1, t2, t3;
+            AVX::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            _mm_storeu_ps(p + 8, t2);
+            _mm_storeu_ps(p + 12, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            AVX::transpose4x4(v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float * p) const {
             _mm_store_ps(p, mVec);
@@ -208,6 +272,41 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m128 t0 = AVX::sortNetwork4<float, false>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX::sortNetwork4<float, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m128 t0 = AVX::sortNetwork4<float, true>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX::sortNetwork4<float, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
@@ -617,6 +716,20 @@ namespace SIMD {
             mVec = BLEND(mVec, t2, mask.mMask);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            return SIMDVec_f(_mm_rcp_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 11;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            return SIMDVec_f(_mm_rsqrt_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 11;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_f const & b) const {
             __m128i m0 = _mm_castps_si128(_mm_cmpeq_ps(mVec, b.mVec));
@@ -1102,9 +1215,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m128 t0 = _mm_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -1166,20 +1291,64 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<4> const & mask) const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
         // MLOG
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // SIN
         // MSIN
         // COS
         // MCOS
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 2> const & a, SIMDVec_f<float, 2> const & b) {
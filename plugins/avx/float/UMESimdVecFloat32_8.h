@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
+#include "../UMESimdInterleaveAVX.h"
 
 #define BLEND(a_256, b_256, mask_256i) _mm256_blendv_ps(a_256, b_256, _mm256_castsi256_ps(mask_256i))
 
@@ -160,6 +162,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -168,10 +172,35 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m256i t0 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(float(count)), _CMP_LT_OQ));
+            mVec = _mm256_maskload_ps(p, t0);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            AVX::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t2 = _mm256_loadu_ps(p + 16);
+            AVX::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t2 = _mm256_loadu_ps(p + 16);
+            __m256 t3 = _mm256_loadu_ps(p + 24);
+            AVX::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec = _mm256_load_ps(p);
@@ -179,7 +208,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -193,6 +222,41 @@ namespace SIMD {
             _mm256_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m256i t0 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(float(count)), _CMP_LT_OQ));
+            _mm256_maskstore_ps(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m256 t0, t1;
+            AVX::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m256 t0, t1, t2;
+            AVX::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            _mm256_storeu_ps(p + 16, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m256 t0, t1, t2, t3;
+            AVX::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            _mm256_storeu_ps(p + 16, t2);
+            _mm256_storeu_ps(p + 24, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3, SIMDVec_f & v4, SIMDVec_f & v5, SIMDVec_f & v6, SIMDVec_f & v7) {
+            AVX::transpose8x8(v0.mVec, v1.mVec, v2.mVec, v3.mVec, v4.mVec, v5.mVec, v6.mVec, v7.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float* p) const {
             _mm256_store_ps(p, mVec);
@@ -203,12 +267,57 @@ namespace SIMD {
             _mm256_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float* p) const {
+            _mm256_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<8> const & mask, float* p) const {
+            // There is no masked streaming store.
+            return storea(mask, p);
+        }
 
         // BLENDV
         // BLENDS
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m256 t0 = AVX::sortNetwork8<float, false>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = mVec;
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX::sortNetwork8<float, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m256 t0 = AVX::sortNetwork8<float, true>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = mVec;
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX::sortNetwork8<float, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_add_ps(mVec, b.mVec);
@@ -604,6 +713,20 @@ namespace SIMD {
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            return SIMDVec_f(_mm256_rcp_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 11;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            return SIMDVec_f(_mm256_rsqrt_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 11;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_f const & b) const {
             __m256 m0 = _mm256_cmp_ps(mVec, b.mVec, 0);
@@ -740,16 +863,14 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            /* alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-            for (unsigned int j = i + 1; j < 8; j++) {
-            if (raw[i] == raw[j]) {
-            return false;
-            }
-            }
-            }*/
-            return true;
+            // Rotations by 1 to 4 elements compare every pair of elements.
+            __m256 t0 = _mm256_permute2f128_ps(mVec, mVec, 0x01);
+            __m256 t1 = _mm256_blend_ps(_mm256_permute_ps(mVec, 0x39), _mm256_permute_ps(t0, 0x39), 0x88);
+            __m256 t2 = _mm256_blend_ps(_mm256_permute_ps(mVec, 0x4E), _mm256_permute_ps(t0, 0x4E), 0xCC);
+            __m256 t3 = _mm256_blend_ps(_mm256_permute_ps(mVec, 0x93), _mm256_permute_ps(t0, 0x93), 0xEE);
+            __m256 t4 = _mm256_or_ps(_mm256_cmp_ps(mVec, t0, _CMP_EQ_OQ), _mm256_cmp_ps(mVec, t1, _CMP_EQ_OQ));
+            __m256 t5 = _mm256_or_ps(_mm256_cmp_ps(mVec, t2, _CMP_EQ_OQ), _mm256_cmp_ps(mVec, t3, _CMP_EQ_OQ));
+            return _mm256_movemask_ps(_mm256_or_ps(t4, t5)) == 0;
         }
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1171,9 +1292,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1235,12 +1368,32 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<8> const & mask) const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG
         // MLOG
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         UME_FORCE_INLINE SIMDVec_f sin() const {
 #if defined(UME_USE_SVML)
             __m256 t0 = _mm256_sin_ps(mVec);
@@ -1302,9 +1455,33 @@ namespace SIMD {
 #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX.h"
 
 #define BLEND(a_256d, b_256d, mask_128i) \
                 _mm256_blendv_pd( \
@@ -77,6 +78,7 @@ namespace SIMD {
         friend class SIMDVec_i<int64_t, 4>;
 
         friend class SIMDVec_f<double, 8>;
+        friend class SIMDVec_f<double, 16>;
     private:
         __m256d mVec;
 
@@ -192,11 +194,36 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
             __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
+            __m256d t0 = _mm256_maskload_pd(p, _mm256_castpd_si256(mask_pd));
             mVec = _mm256_blendv_pd(mVec, t0, mask_pd);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(double const * p, uint32_t count) {
+            __m256i t0 = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_setr_pd(0.0, 1.0, 2.0, 3.0), _mm256_set1_pd(double(count)), _CMP_LT_OQ));
+            mVec = _mm256_maskload_pd(p, t0);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            AVX::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            __m256d t2 = _mm256_loadu_pd(p + 8);
+            AVX::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            __m256d t2 = _mm256_loadu_pd(p + 8);
+            __m256d t3 = _mm256_loadu_pd(p + 12);
+            AVX::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
             mVec = _mm256_load_pd(p);
@@ -204,8 +231,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_load_pd(p);
             __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
+            __m256d t0 = _mm256_maskload_pd(p, _mm256_castpd_si256(mask_pd));
             mVec = _mm256_blendv_pd(mVec, t0, mask_pd);
             return *this;
         }
@@ -216,11 +243,45 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<4> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m256d t1 = _mm256_blendv_pd(t0, mVec, _mm256_cvtepi32_pd(mask.mMask));
-            _mm256_storeu_pd(p, t1);
+            __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
+            _mm256_maskstore_pd(p, _mm256_castpd_si256(mask_pd), mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE double* storeTail(double* p, uint32_t count) const {
+            __m256i t0 = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_setr_pd(0.0, 1.0, 2.0, 3.0), _mm256_set1_pd(double(count)), _CMP_LT_OQ));
+            _mm256_maskstore_pd(p, t0, mVec);
             return p;
         }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m256d t0, t1;
+            AVX::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m256d t0, t1, t2;
+            AVX::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            _mm256_storeu_pd(p + 8, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m256d t0, t1, t2, t3;
+            AVX::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            _mm256_storeu_pd(p + 8, t2);
+            _mm256_storeu_pd(p + 12, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            AVX::transpose4x4(v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE double* storea(double* p) const {
             _mm256_store_pd(p, mVec);
@@ -979,6 +1040,22 @@ namespace SIMD {
         // MPOWV     - Masked power (exponents in vector)
         // POWS      - Power (exponent in scalar)
         // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -992,8 +1069,17 @@ namespace SIMD {
         }
         // TRUNC     - Truncate to integer (returns Signed integer vector)
         // MTRUNC    - Masked truncate to integer (returns Signed integer vector)
-        // FLOOR     - Floor
-        // MFLOOR    - Masked floor
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<4> const & mask) const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
         // ISFIN     - Is finite
@@ -1011,16 +1097,90 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<4> const & mask) const {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG10
-        // SIN       - Sine
-        // MSIN      - Masked sine
-        // COS       - Cosine
-        // MCOS      - Masked cosine
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<4>>(*this, sinvec, cosvec);
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
         // TAN       - Tangent
         // MTAN      - Masked tangent
         // CTAN      - Cotangent
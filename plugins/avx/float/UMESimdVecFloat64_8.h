@@ -33,6 +33,7 @@
 
 #include <type_traits>
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX.h"
 #include <immintrin.h>
 
 #define BLEND_LO(a_256d, b_256d, mask_256i) \
@@ -221,14 +222,52 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m128i t1 = _mm256_extractf128_si256(mask.mMask, 0);
-            mVec[0] = _mm256_blendv_pd(mVec[0], t0, _mm256_cvtepi32_pd(t1));
-            __m256d t2 = _mm256_loadu_pd(p + 4);
-            __m128i t3 = _mm256_extractf128_si256(mask.mMask, 1);
-            mVec[1] = _mm256_blendv_pd(mVec[1], t2, _mm256_cvtepi32_pd(t3));
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)));
+            __m256i t1 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)));
+            __m256d t2 = _mm256_maskload_pd(p, t0);
+            __m256d t3 = _mm256_maskload_pd(p + 4, t1);
+            mVec[0] = _mm256_blendv_pd(mVec[0], t2, _mm256_castsi256_pd(t0));
+            mVec[1] = _mm256_blendv_pd(mVec[1], t3, _mm256_castsi256_pd(t1));
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(double const * p, uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 0)));
+            __m256i t3 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 1)));
+            mVec[0] = _mm256_maskload_pd(p, t2);
+            mVec[1] = _mm256_maskload_pd(p + 4, t3);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            for (int i = 0; i < 2; i++) {
+                double const * t0 = p + 8 * i;
+                __m256d t1 = _mm256_loadu_pd(t0);
+                __m256d t2 = _mm256_loadu_pd(t0 + 4);
+                AVX::deinterleave2(t1, t2, v0.mVec[i], v1.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            for (int i = 0; i < 2; i++) {
+                double const * t0 = p + 12 * i;
+                __m256d t1 = _mm256_loadu_pd(t0);
+                __m256d t2 = _mm256_loadu_pd(t0 + 4);
+                __m256d t3 = _mm256_loadu_pd(t0 + 8);
+                AVX::deinterleave3(t1, t2, t3, v0.mVec[i], v1.mVec[i], v2.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            for (int i = 0; i < 2; i++) {
+                double const * t0 = p + 16 * i;
+                __m256d t1 = _mm256_loadu_pd(t0);
+                __m256d t2 = _mm256_loadu_pd(t0 + 4);
+                __m256d t3 = _mm256_loadu_pd(t0 + 8);
+                __m256d t4 = _mm256_loadu_pd(t0 + 12);
+                AVX::deinterleave4(t1, t2, t3, t4, v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i]);
+            }
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
             mVec[0] = _mm256_load_pd(p);
@@ -237,16 +276,12 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<8> const & mask, double const * p) {
-            __m256d t0 = _mm256_load_pd(p);
-            __m256d t1 = _mm256_load_pd(p + 4);
-
-            __m128i t2 = _mm256_extractf128_si256(mask.mMask, 0);
-            __m128i t3 = _mm256_extractf128_si256(mask.mMask, 1);
-
-            __m256d mask_pd_lo = _mm256_cvtepi32_pd(t2);
-            __m256d mask_pd_hi = _mm256_cvtepi32_pd(t3);
-            mVec[0] = _mm256_blendv_pd(mVec[0], t0, mask_pd_lo);
-            mVec[1] = _mm256_blendv_pd(mVec[1], t1, mask_pd_hi);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)));
+            __m256i t1 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)));
+            __m256d t2 = _mm256_maskload_pd(p, t0);
+            __m256d t3 = _mm256_maskload_pd(p + 4, t1);
+            mVec[0] = _mm256_blendv_pd(mVec[0], t2, _mm256_castsi256_pd(t0));
+            mVec[1] = _mm256_blendv_pd(mVec[1], t3, _mm256_castsi256_pd(t1));
             return *this;
         }
         // STORE
@@ -257,14 +292,54 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<8> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m128i t1 = _mm256_extractf128_si256(mask.mMask, 0);
-            __m256d t2 = _mm256_blendv_pd(t0, mVec[0], _mm256_cvtepi32_pd(t1));
-            _mm256_storeu_pd(p, t2);
-            __m256d t3 = _mm256_loadu_pd(p + 4);
-            __m128i t4 = _mm256_extractf128_si256(mask.mMask, 1);
-            __m256d t5 = _mm256_blendv_pd(t3, mVec[1], _mm256_cvtepi32_pd(t4));
-            _mm256_storeu_pd(p + 4, t5);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)));
+            __m256i t1 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)));
+            _mm256_maskstore_pd(p, t0, mVec[0]);
+            _mm256_maskstore_pd(p + 4, t1, mVec[1]);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE double* storeTail(double* p, uint32_t count) const {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 0)));
+            __m256i t3 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 1)));
+            _mm256_maskstore_pd(p, t2, mVec[0]);
+            _mm256_maskstore_pd(p + 4, t3, mVec[1]);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            for (int i = 0; i < 2; i++) {
+                double * t0 = p + 8 * i;
+                __m256d t1, t2;
+                AVX::interleave2(v0.mVec[i], v1.mVec[i], t1, t2);
+                _mm256_storeu_pd(t0, t1);
+                _mm256_storeu_pd(t0 + 4, t2);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            for (int i = 0; i < 2; i++) {
+                double * t0 = p + 12 * i;
+                __m256d t1, t2, t3;
+                AVX::interleave3(v0.mVec[i], v1.mVec[i], v2.mVec[i], t1, t2, t3);
+                _mm256_storeu_pd(t0, t1);
+                _mm256_storeu_pd(t0 + 4, t2);
+                _mm256_storeu_pd(t0 + 8, t3);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            for (int i = 0; i < 2; i++) {
+                double * t0 = p + 16 * i;
+                __m256d t1, t2, t3, t4;
+                AVX::interleave4(v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i], t1, t2, t3, t4);
+                _mm256_storeu_pd(t0, t1);
+                _mm256_storeu_pd(t0 + 4, t2);
+                _mm256_storeu_pd(t0 + 8, t3);
+                _mm256_storeu_pd(t0 + 12, t4);
+            }
             return p;
         }
         // STOREA
@@ -831,6 +906,34 @@ namespace SIMD {
         // MPOWV     - Masked power (exponents in vector)
         // POWS      - Power (exponent in scalar)
         // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).pow(SIMDVec_f<double, 4>(b.mVec[0])).mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).pow(SIMDVec_f<double, 4>(b.mVec[1])).mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).pow(SIMDVec_f<double, 4>(b.mVec[0])).mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).pow(SIMDVec_f<double, 4>(b.mVec[1])).mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).pow(b).mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).pow(b).mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, double b) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).pow(b).mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).pow(b).mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -847,8 +950,20 @@ namespace SIMD {
         }
         // TRUNC     - Truncate to integer (returns Signed integer vector)
         // MTRUNC    - Masked truncate to integer (returns Signed integer vector)
-        // FLOOR     - Floor
-        // MFLOOR    - Masked floor
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m256d t0 = _mm256_floor_pd(mVec[0]);
+            __m256d t1 = _mm256_floor_pd(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = _mm256_floor_pd(mVec[0]);
+            __m256d t1 = _mm256_floor_pd(mVec[1]);
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
         // ISFIN     - Is finite
@@ -860,22 +975,174 @@ namespace SIMD {
         // ISZEROSUB - Is zero or subnormal
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).exp().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).exp().mVec;
+            return SIMDVec_f(t0, t1);
         }
         // MEXP
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<8> const & mask) const {
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).exp().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).exp().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).exp2().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).exp2().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).exp2().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).exp2().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log2().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log2().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log2().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log2().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log10().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log10().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MLOG10
-        // SIN       - Sine
-        // MSIN      - Masked sine
-        // COS       - Cosine
-        // MCOS      - Masked cosine
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log10().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log10().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).sin().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).sin().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).sin().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).sin().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).cos().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).cos().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).cos().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).cos().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<double, 4> s0, c0, s1, c1;
+            SIMDVec_f<double, 4>(mVec[0]).sincos(s0, c0);
+            SIMDVec_f<double, 4>(mVec[1]).sincos(s1, c1);
+            sinvec.mVec[0] = s0.mVec;
+            sinvec.mVec[1] = s1.mVec;
+            cosvec.mVec[0] = c0.mVec;
+            cosvec.mVec[1] = c1.mVec;
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<8> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<double, 4> s0, c0, s1, c1;
+            SIMDVec_f<double, 4>(mVec[0]).sincos(s0, c0);
+            SIMDVec_f<double, 4>(mVec[1]).sincos(s1, c1);
+            __m256d t0 = BLEND_LO(mVec[0], s0.mVec, mask.mMask);
+            __m256d t1 = BLEND_HI(mVec[1], s1.mVec, mask.mMask);
+            __m256d t2 = BLEND_LO(mVec[0], c0.mVec, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], c1.mVec, mask.mMask);
+            sinvec.mVec[0] = t0;
+            sinvec.mVec[1] = t1;
+            cosvec.mVec[0] = t2;
+            cosvec.mVec[1] = t3;
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).tan().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).tan().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).tan().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).tan().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).ctan().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).ctan().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).ctan().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).ctan().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).atan().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).atan().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).atan().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).atan().mVec;
+            __m256d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).atan2(SIMDVec_f<double, 4>(b.mVec[0])).mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).atan2(SIMDVec_f<double, 4>(b.mVec[1])).mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // TAN       - Tangent
         // MTAN      - Masked tangent
         // CTAN      - Cotangent
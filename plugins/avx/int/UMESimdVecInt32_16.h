@@ -33,6 +33,7 @@
 
 #include <type_traits>
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
 #include <immintrin.h>
 
 
@@ -177,12 +178,21 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            mVec[0] = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, t1));
+            mVec[1] = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), t2));
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec[0] = _mm256_load_si256((__m256i *)p);
@@ -191,8 +201,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -205,12 +215,17 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<16> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_storeu_si256((__m256i*)p, t1);
-            _mm256_storeu_si256((__m256i*)(p + 8), t3);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            _mm256_maskstore_ps((float *)p, t1, _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), t2, _mm256_castsi256_ps(mVec[1]));
             return p;
         }
         // STOREA
@@ -221,15 +236,65 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<16> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_store_si256((__m256i*)p, t1);
-            _mm256_store_si256((__m256i*)(p + 8), t3);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
             return p;
         }
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            AVX::sortNetwork16<int32_t, false>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t2, t3);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVecLo);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVecHi);
+            AVX::sortNetwork16<int32_t, false>(t0, t1, t2, t3);
+            payload.mVecLo = _mm256_castps_si256(t2);
+            payload.mVecHi = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t4, t5);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            AVX::sortNetwork16<int32_t, true>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t2, t3);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVecLo);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVecHi);
+            AVX::sortNetwork16<int32_t, true>(t0, t1, t2, t3);
+            payload.mVecLo = _mm256_castps_si256(t2);
+            payload.mVecHi = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t4, t5);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+
         // ABS
         SIMDVec_i abs() const {
             __m128i a_low = _mm256_extractf128_si256(mVec[0], 0);
@@ -205,16 +205,29 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<32> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
+            __m256i t2 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 16), mask.mMask[2]));
+            __m256i t3 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 24), mask.mMask[3]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 16));
             mVec[2] = BLEND(mVec[2], t2, mask.mMask[2]);
-            __m256i t3 = _mm256_loadu_si256((__m256i*)(p + 24));
             mVec[3] = BLEND(mVec[3], t3, mask.mMask[3]);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            __m256i t3 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(16.0f, 17.0f, 18.0f, 19.0f, 20.0f, 21.0f, 22.0f, 23.0f), t0, _CMP_LT_OQ));
+            __m256i t4 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(24.0f, 25.0f, 26.0f, 27.0f, 28.0f, 29.0f, 30.0f, 31.0f), t0, _CMP_LT_OQ));
+            mVec[0] = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, t1));
+            mVec[1] = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), t2));
+            mVec[2] = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 16), t3));
+            mVec[3] = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 24), t4));
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec[0] = _mm256_load_si256((__m256i *)p);
@@ -225,13 +238,13 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<32> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
+            __m256i t2 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 16), mask.mMask[2]));
+            __m256i t3 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 24), mask.mMask[3]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 16));
             mVec[2] = BLEND(mVec[2], t2, mask.mMask[2]);
-            __m256i t3 = _mm256_load_si256((__m256i*)(p + 24));
             mVec[3] = BLEND(mVec[3], t3, mask.mMask[3]);
             return *this;
         }
@@ -245,18 +258,23 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<32> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            _mm256_storeu_si256((__m256i*)p, t1);
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_storeu_si256((__m256i*)(p + 8), t3);
-            __m256i t4 = _mm256_loadu_si256((__m256i*)(p + 16));
-            __m256i t5 = BLEND(t4, mVec[2], mask.mMask[2]);
-            _mm256_storeu_si256((__m256i*)(p + 16), t5);
-            __m256i t6 = _mm256_loadu_si256((__m256i*)(p + 24));
-            __m256i t7 = BLEND(t6, mVec[3], mask.mMask[3]);
-            _mm256_storeu_si256((__m256i*)(p + 24), t7);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
+            _mm256_maskstore_ps((float *)(p + 16), mask.mMask[2], _mm256_castsi256_ps(mVec[2]));
+            _mm256_maskstore_ps((float *)(p + 24), mask.mMask[3], _mm256_castsi256_ps(mVec[3]));
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f), t0, _CMP_LT_OQ));
+            __m256i t3 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(16.0f, 17.0f, 18.0f, 19.0f, 20.0f, 21.0f, 22.0f, 23.0f), t0, _CMP_LT_OQ));
+            __m256i t4 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(24.0f, 25.0f, 26.0f, 27.0f, 28.0f, 29.0f, 30.0f, 31.0f), t0, _CMP_LT_OQ));
+            _mm256_maskstore_ps((float *)p, t1, _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), t2, _mm256_castsi256_ps(mVec[1]));
+            _mm256_maskstore_ps((float *)(p + 16), t3, _mm256_castsi256_ps(mVec[2]));
+            _mm256_maskstore_ps((float *)(p + 24), t4, _mm256_castsi256_ps(mVec[3]));
             return p;
         }
         // STOREA
@@ -269,18 +287,10 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<32> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            _mm256_store_si256((__m256i*)p, t1);
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_store_si256((__m256i*)(p + 8), t3);
-            __m256i t4 = _mm256_load_si256((__m256i*)(p + 16));
-            __m256i t5 = BLEND(t4, mVec[2], mask.mMask[2]);
-            _mm256_store_si256((__m256i*)(p + 16), t5);
-            __m256i t6 = _mm256_load_si256((__m256i*)(p + 24));
-            __m256i t7 = BLEND(t6, mVec[3], mask.mMask[3]);
-            _mm256_store_si256((__m256i*)(p + 24), t7);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
+            _mm256_maskstore_ps((float *)(p + 16), mask.mMask[2], _mm256_castsi256_ps(mVec[2]));
+            _mm256_maskstore_ps((float *)(p + 24), mask.mMask[3], _mm256_castsi256_ps(mVec[3]));
             return p;
         }
 
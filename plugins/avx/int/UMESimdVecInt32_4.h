@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
 
 namespace UME {
 namespace SIMD {
@@ -161,6 +162,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -169,10 +172,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int32_t const * p) {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            mVec = _mm_castps_si128(_mm_maskload_ps((float const *)p, t0));
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec = _mm_load_si128((__m128i*)p);
@@ -180,7 +189,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<4> const & mask, int32_t const * p) {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -191,9 +200,13 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<4> const & mask, int32_t * p) const {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_storeu_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            _mm_maskstore_ps((float *)p, t0, _mm_castsi128_ps(mVec));
             return p;
         }
         // STOREA
@@ -203,9 +216,7 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<4> const & mask, int32_t * p) const {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_store_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
             return p;
         }
 
@@ -225,35 +236,40 @@ namespace SIMD {
 
         // SORTA
         UME_FORCE_INLINE SIMDVec_i sorta() {
-            __m128i t0 = _mm_shuffle_epi32(mVec, 0xB1); // permute BADC
-            __m128i t1 = _mm_min_epi32(mVec, t0);
-            __m128i t2 = _mm_max_epi32(mVec, t0);
-            __m128i t3 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t1), _mm_castsi128_ps(t2), 0x06));
-            __m128i t4 = _mm_shuffle_epi32(t3, 0x4E);   // permute CDAB
-            __m128i t5 = _mm_min_epi32(t3, t4);
-            __m128i t6 = _mm_max_epi32(t3, t4);
-            __m128i t7 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t5), _mm_castsi128_ps(t6), 0x0C));
-            __m128i t8 = _mm_shuffle_epi32(t7, 0xB1); // permute BADC
-            __m128i t9 = _mm_min_epi32(t7, t8);
-            __m128i t10 = _mm_max_epi32(t7, t8);
-            __m128i t11 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t9), _mm_castsi128_ps(t10), 0x0A));
-            return SIMDVec_i(t11);
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX::sortNetwork4<int32_t, false>(t0);
+            return SIMDVec_i(_mm_castps_si128(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX::sortNetwork4<int32_t, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_i(_mm_castps_si128(t0));
         }
         // SORTD
         UME_FORCE_INLINE SIMDVec_i sortd() {
-            __m128i t0 = _mm_shuffle_epi32(mVec, 0xB1); // permute BADC
-            __m128i t1 = _mm_min_epi32(mVec, t0);
-            __m128i t2 = _mm_max_epi32(mVec, t0);
-            __m128i t3 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t2), _mm_castsi128_ps(t1), 0x06));
-            __m128i t4 = _mm_shuffle_epi32(t3, 0x4E);   // permute CDAB
-            __m128i t5 = _mm_min_epi32(t3, t4);
-            __m128i t6 = _mm_max_epi32(t3, t4);
-            __m128i t7 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t6), _mm_castsi128_ps(t5), 0x0C));
-            __m128i t8 = _mm_shuffle_epi32(t7, 0xB1); // permute BADC
-            __m128i t9 = _mm_min_epi32(t7, t8);
-            __m128i t10 = _mm_max_epi32(t7, t8);
-            __m128i t11 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t10), _mm_castsi128_ps(t9), 0x0A));
-            return SIMDVec_i(t11);
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX::sortNetwork4<int32_t, true>(t0);
+            return SIMDVec_i(_mm_castps_si128(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX::sortNetwork4<int32_t, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_i(_mm_castps_si128(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
         }
 
         // ADDV
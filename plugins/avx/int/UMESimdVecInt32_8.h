@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
 
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_castps_si256( \
                                         _mm256_blendv_ps( \
@@ -270,6 +271,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -278,10 +281,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(float(count)), _CMP_LT_OQ));
+            mVec = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, t0));
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec = _mm256_load_si256((__m256i *)p);
@@ -289,7 +298,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -300,9 +309,13 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<8> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*)p, t1);
+            _mm256_maskstore_ps((float *)p, mask.mMask, _mm256_castsi256_ps(mVec));
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(float(count)), _CMP_LT_OQ));
+            _mm256_maskstore_ps((float *)p, t0, _mm256_castsi256_ps(mVec));
             return p;
         }
         // STOREA
@@ -312,9 +325,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<8> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i*)p, t1);
+            _mm256_maskstore_ps((float *)p, mask.mMask, _mm256_castsi256_ps(mVec));
             return p;
         }
         // BLENDV
@@ -322,6 +333,43 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX::sortNetwork8<int32_t, false>(t0);
+            return SIMDVec_i(_mm256_castps_si256(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX::sortNetwork8<int32_t, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_i(_mm256_castps_si256(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX::sortNetwork8<int32_t, true>(t0);
+            return SIMDVec_i(_mm256_castps_si256(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX::sortNetwork8<int32_t, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_i(_mm256_castps_si256(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, _mm_add_epi32);
@@ -289,6 +289,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -297,8 +299,15 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            mVec = BLEND(mVec, t0, mask.mMask);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask));
+            __m256i t1 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, t0));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int64_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_setr_pd(0.0, 1.0, 2.0, 3.0), _mm256_set1_pd(double(count)), _CMP_LT_OQ));
+            mVec = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, t0));
             return *this;
         }
         // LOADA
@@ -308,8 +317,9 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            mVec = BLEND(mVec, t0, mask.mMask);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask));
+            __m256i t1 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, t0));
+            mVec = BLEND(mVec, t1, mask.mMask);
             return *this;
         }
         // STORE
@@ -319,9 +329,14 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*) p, t1);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask));
+            _mm256_maskstore_pd((double *)p, t0, _mm256_castsi256_pd(mVec));
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int64_t * storeTail(int64_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_setr_pd(0.0, 1.0, 2.0, 3.0), _mm256_set1_pd(double(count)), _CMP_LT_OQ));
+            _mm256_maskstore_pd((double *)p, t0, _mm256_castsi256_pd(mVec));
             return p;
         }
         // STOREA
@@ -331,9 +346,8 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i*) p, t1);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask));
+            _mm256_maskstore_pd((double *)p, t0, _mm256_castsi256_pd(mVec));
             return p;
         }
 
@@ -217,6 +217,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -226,12 +228,22 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 4));
-
-            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
-            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
-
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)));
+            __m256i t1 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)));
+            __m256i t2 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, t0));
+            __m256i t3 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)(p + 4), t1));
+            mVec[0] = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(mVec[0]), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t0)));
+            mVec[1] = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(mVec[1]), _mm256_castsi256_pd(t3), _mm256_castsi256_pd(t1)));
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int64_t const * p, uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 0)));
+            __m256i t3 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 1)));
+            mVec[0] = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, t2));
+            mVec[1] = _mm256_castpd_si256(_mm256_maskload_pd((double const *)(p + 4), t3));
             return *this;
         }
         // LOADA
@@ -242,10 +254,12 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
-            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)));
+            __m256i t1 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)));
+            __m256i t2 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, t0));
+            __m256i t3 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)(p + 4), t1));
+            mVec[0] = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(mVec[0]), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t0)));
+            mVec[1] = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(mVec[1]), _mm256_castsi256_pd(t3), _mm256_castsi256_pd(t1)));
             return *this;
         }
         // STORE
@@ -256,12 +270,20 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<8> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = BLEND_LO(t0, mVec[0], mask.mMask);
-            __m256i t3 = BLEND_HI(t1, mVec[1], mask.mMask);
-            _mm256_storeu_si256((__m256i*) p, t2);
-            _mm256_storeu_si256((__m256i*) (p + 4), t3);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)));
+            __m256i t1 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)));
+            _mm256_maskstore_pd((double *)p, t0, _mm256_castsi256_pd(mVec[0]));
+            _mm256_maskstore_pd((double *)(p + 4), t1, _mm256_castsi256_pd(mVec[1]));
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int64_t * storeTail(int64_t * p, uint32_t count) const {
+            __m256 t0 = _mm256_set1_ps(float(count));
+            __m256i t1 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), t0, _CMP_LT_OQ));
+            __m256i t2 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 0)));
+            __m256i t3 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(t1, 1)));
+            _mm256_maskstore_pd((double *)p, t2, _mm256_castsi256_pd(mVec[0]));
+            _mm256_maskstore_pd((double *)(p + 4), t3, _mm256_castsi256_pd(mVec[1]));
             return p;
         }
         // STOREA
@@ -272,12 +294,10 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<8> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = BLEND_LO(t0, mVec[0], mask.mMask);
-            __m256i t3 = BLEND_HI(t1, mVec[1], mask.mMask);
-            _mm256_store_si256((__m256i*) p, t2);
-            _mm256_store_si256((__m256i*) (p + 4), t3);
+            __m256i t0 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)));
+            __m256i t1 = _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)));
+            _mm256_maskstore_pd((double *)p, t0, _mm256_castsi256_pd(mVec[0]));
+            _mm256_maskstore_pd((double *)(p + 4), t1, _mm256_castsi256_pd(mVec[1]));
             return p;
         }
 
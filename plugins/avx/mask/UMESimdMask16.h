@@ -317,6 +317,23 @@ namespace SIMD {
             int t1 = _mm256_testz_si256(mMask[1], mMask[1]);
             return (t0 == 0) | (t1 == 0);
         }
+        // TOBITS
+        inline uint64_t toBits() const {
+            uint64_t t0 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[0])));
+            uint64_t t1 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[1])));
+            return t0 | (t1 << 8);
+        }
+        // FROMBITS
+        static inline SIMDVecMask fromBits(uint64_t bits) {
+            __m128i t0 = _mm_set_epi32(0x8, 0x4, 0x2, 0x1);
+            __m128i t1_lo = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits >> 0)), t0), t0);
+            __m128i t1_hi = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits >> 4)), t0), t0);
+            __m256i t1 = _mm256_insertf128_si256(_mm256_castsi128_si256(t1_lo), t1_hi, 1);
+            __m128i t2_lo = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits >> 8)), t0), t0);
+            __m128i t2_hi = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits >> 12)), t0), t0);
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2_lo), t2_hi, 1);
+            return SIMDVecMask(t1, t2);
+        }
     };
 }
 }
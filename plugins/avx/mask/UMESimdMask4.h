@@ -304,6 +304,16 @@ namespace SIMD {
             _mm_store_si128((__m128i*)raw, mMask);
             return (raw[0] ^ raw[1] ^ raw[2] ^ raw[3]) != 0;
         }
+        // TOBITS
+        inline uint64_t toBits() const {
+            return uint64_t(_mm_movemask_ps(_mm_castsi128_ps(mMask)));
+        }
+        // FROMBITS
+        static inline SIMDVecMask fromBits(uint64_t bits) {
+            __m128i t0 = _mm_set_epi32(0x8, 0x4, 0x2, 0x1);
+            __m128i t1 = _mm_and_si128(_mm_set1_epi32(int32_t(bits)), t0);
+            return SIMDVecMask(_mm_cmpeq_epi32(t1, t0));
+        }
     };
 
 }
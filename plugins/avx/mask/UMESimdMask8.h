@@ -253,6 +253,18 @@ namespace SIMD {
             _mm256_store_si256((__m256i*)raw, mMask);
             return (raw[0] ^ raw[1] ^ raw[2] ^ raw[3] ^ raw[4] ^ raw[5] ^ raw[6] ^ raw[7]) == TRUE_VAL();
         }
+        // TOBITS
+        inline uint64_t toBits() const {
+            return uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask)));
+        }
+        // FROMBITS
+        static inline SIMDVecMask fromBits(uint64_t bits) {
+            __m128i t0 = _mm_set_epi32(0x8, 0x4, 0x2, 0x1);
+            __m128i t1_lo = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits >> 0)), t0), t0);
+            __m128i t1_hi = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits >> 4)), t0), t0);
+            __m256i t1 = _mm256_insertf128_si256(_mm256_castsi128_si256(t1_lo), t1_hi, 1);
+            return SIMDVecMask(t1);
+        }
     };
 }
 }
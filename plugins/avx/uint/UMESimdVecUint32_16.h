@@ -33,6 +33,7 @@
 
 #include <type_traits>
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
 #include <immintrin.h>
 
 namespace UME {
@@ -165,6 +166,83 @@ namespace SIMD {
         }
         // MASSIGNS
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVecLo);
+            __m256 t1 = _mm256_castsi256_ps(mVecHi);
+            AVX::sortNetwork16<uint32_t, false>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t2, t3);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVecLo);
+            __m256 t1 = _mm256_castsi256_ps(mVecHi);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVecLo);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVecHi);
+            AVX::sortNetwork16<uint32_t, false>(t0, t1, t2, t3);
+            payload.mVecLo = _mm256_castps_si256(t2);
+            payload.mVecHi = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t4, t5);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVecLo);
+            __m256 t1 = _mm256_castsi256_ps(mVecHi);
+            AVX::sortNetwork16<uint32_t, true>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t2, t3);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVecLo);
+            __m256 t1 = _mm256_castsi256_ps(mVecHi);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVecLo);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVecHi);
+            AVX::sortNetwork16<uint32_t, true>(t0, t1, t2, t3);
+            payload.mVecLo = _mm256_castps_si256(t2);
+            payload.mVecHi = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t4, t5);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m128i t0[4] = {
+                _mm256_castsi256_si128(mVecLo), _mm256_extractf128_si256(mVecLo, 1),
+                _mm256_castsi256_si128(mVecHi), _mm256_extractf128_si256(mVecHi, 1) };
+            __m128i t1[4] = {
+                _mm_setzero_si128(), _mm_setzero_si128(),
+                _mm_setzero_si128(), _mm_setzero_si128() };
+            // Compare with a broadcast of lane 'j' and set bit 'j' in the lanes above it.
+            for (int j = 0; j < 15; j++) {
+                __m128i t2 = _mm_set1_epi32(j);
+                __m128i t3 = _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(t0[j >> 2]), t2));
+                __m128i t4 = _mm_set1_epi32(1 << j);
+                for (int k = 0; k < 4; k++) {
+                    __m128i t5 = _mm_set_epi32(4*k + 3, 4*k + 2, 4*k + 1, 4*k);
+                    __m128i t6 = _mm_and_si128(_mm_cmpeq_epi32(t0[k], t3), _mm_cmpgt_epi32(t5, t2));
+                    t1[k] = _mm_or_si128(t1[k], _mm_and_si128(t6, t4));
+                }
+            }
+            __m256i t7 = _mm256_insertf128_si256(_mm256_castsi128_si256(t1[0]), t1[1], 1);
+            __m256i t8 = _mm256_insertf128_si256(_mm256_castsi128_si256(t1[2]), t1[3], 1);
+            return SIMDVec_u(t7, t8);
+        }
         // PROMOTE
         UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 16>() const;
         // DEGRADE
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
 
 namespace UME {
 namespace SIMD {
@@ -159,6 +160,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
             mVec = _mm_loadu_si128((__m128i*)p);
@@ -166,10 +169,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint32_t const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            mVec = _mm_castps_si128(_mm_maskload_ps((float const *)p, t0));
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
             mVec = _mm_load_si128((__m128i*)p);
@@ -177,7 +186,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -188,9 +197,13 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE uint32_t * store(SIMDVecMask<4> const & mask, uint32_t * p) const {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_storeu_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE uint32_t * storeTail(uint32_t * p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            _mm_maskstore_ps((float *)p, t0, _mm_castsi128_ps(mVec));
             return p;
         }
         // STOREA
@@ -200,9 +213,7 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE uint32_t * storea(SIMDVecMask<4> const & mask, uint32_t * p) const {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_store_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
             return p;
         }
         // BLENDV
@@ -218,6 +229,43 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX::sortNetwork4<uint32_t, false>(t0);
+            return SIMDVec_u(_mm_castps_si128(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX::sortNetwork4<uint32_t, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_u(_mm_castps_si128(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX::sortNetwork4<uint32_t, true>(t0);
+            return SIMDVec_u(_mm_castps_si128(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX::sortNetwork4<uint32_t, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_u(_mm_castps_si128(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -684,6 +732,17 @@ namespace SIMD {
             }
             return true;
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m128i t0 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0x00));
+            __m128i t1 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0x55));
+            __m128i t2 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0xAA));
+            __m128i t3 = _mm_and_si128(t0, _mm_set_epi32(1, 1, 1, 0));
+            __m128i t4 = _mm_and_si128(t1, _mm_set_epi32(2, 2, 0, 0));
+            __m128i t5 = _mm_and_si128(t2, _mm_set_epi32(4, 0, 0, 0));
+            __m128i t6 = _mm_or_si128(t3, _mm_or_si128(t4, t5));
+            return SIMDVec_u(t6);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
             alignas(16) uint32_t raw[4];
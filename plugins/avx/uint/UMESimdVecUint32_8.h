@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX.h"
 
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_castps_si256( \
                                         _mm256_blendv_ps( \
@@ -269,6 +270,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
@@ -277,10 +280,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<8> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint32_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(float(count)), _CMP_LT_OQ));
+            mVec = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, t0));
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
             mVec = _mm256_load_si256((__m256i *)p);
@@ -288,12 +297,18 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<8> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
         // STORE
         // MSTORE
+        // STORETAIL
+        UME_FORCE_INLINE uint32_t * storeTail(uint32_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(float(count)), _CMP_LT_OQ));
+            _mm256_maskstore_ps((float *)p, t0, _mm256_castsi256_ps(mVec));
+            return p;
+        }
         // STOREA
         /*UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
             _mm256_store_si256((__m256i*)addrAligned, mVec);
@@ -305,6 +320,43 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX::sortNetwork8<uint32_t, false>(t0);
+            return SIMDVec_u(_mm256_castps_si256(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX::sortNetwork8<uint32_t, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_u(_mm256_castps_si256(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX::sortNetwork8<uint32_t, true>(t0);
+            return SIMDVec_u(_mm256_castps_si256(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX::sortNetwork8<uint32_t, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_u(_mm256_castps_si256(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, _mm_add_epi32);
@@ -897,6 +949,27 @@ namespace SIMD {
             }
             return true;
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m128i t0 = _mm256_castsi256_si128(mVec);
+            __m128i t1 = _mm256_extractf128_si256(mVec, 1);
+            __m128i t2 = _mm_setzero_si128();
+            __m128i t3 = _mm_setzero_si128();
+            __m128i t4 = _mm_set_epi32(3, 2, 1, 0);
+            __m128i t5 = _mm_set_epi32(7, 6, 5, 4);
+            // Compare with a broadcast of lane 'j' and set bit 'j' in the lanes above it.
+            for (int j = 0; j < 7; j++) {
+                __m128i t6 = _mm_set1_epi32(j);
+                __m128i t7 = _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(j < 4 ? t0 : t1), t6));
+                __m128i t8 = _mm_set1_epi32(1 << j);
+                __m128i t9 = _mm_and_si128(_mm_cmpeq_epi32(t0, t7), _mm_cmpgt_epi32(t4, t6));
+                __m128i t10 = _mm_and_si128(_mm_cmpeq_epi32(t1, t7), _mm_cmpgt_epi32(t5, t6));
+                t2 = _mm_or_si128(t2, _mm_and_si128(t9, t8));
+                t3 = _mm_or_si128(t3, _mm_and_si128(t10, t8));
+            }
+            __m256i t11 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVec_u(t11);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
             __m128i t0 = _mm_set1_epi32(0);
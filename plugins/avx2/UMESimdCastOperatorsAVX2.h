@@ -34,6 +34,7 @@
 #include "UMESimdVecUintAVX2.h"
 #include "UMESimdVecIntAVX2.h"
 #include "UMESimdVecFloatAVX2.h"
+#include "UMESimdIntrinsicsAVX2.h"
 
 namespace UME {
 namespace SIMD {
@@ -67,9 +68,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_u<uint8_t, 32>>(*this);
+        return SIMDVec_i<int8_t, 32>(mVec);
     }
 
     template<>
@@ -102,9 +102,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_u<uint16_t, 16>>(*this);
+        return SIMDVec_i<int16_t, 16>(mVec);
     }
 
     template<>
@@ -215,7 +214,8 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint64_t, 4>::operator SIMDVec_f<double, 4>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_f<double, 4>, double, SIMDVec_u<uint64_t, 4>>(*this);
+        __m256d t0 = AVX2::cvtepu64_pd(mVec);
+        return SIMDVec_f<double, 4>(t0);
     }
 
     template<>
@@ -254,9 +254,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_i<int8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_i<int8_t, 32>>(*this);
+        return SIMDVec_u<uint8_t, 32>(mVec);
     }
 
     template<>
@@ -289,9 +288,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_i<int16_t, 16>>(*this);
+        return SIMDVec_u<uint16_t, 16>(mVec);
     }
 
     template<>
@@ -358,7 +356,8 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 4>::operator SIMDVec_f<float, 4>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_f<float, 4>, float, SIMDVec_i<int32_t, 4>>(*this);
+        __m128 t0 = _mm_cvtepi32_ps(mVec);
+        return SIMDVec_f<float, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 8>::operator SIMDVec_f<float, 8>() const {
@@ -383,25 +382,13 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_i<int64_t, 4>::operator SIMDVec_f<double, 4>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_f<double, 4>, double, SIMDVec_i<int64_t, 4>>(*this);
+        __m256d t0 = AVX2::cvtepi64_pd(mVec);
+        return SIMDVec_f<double, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int64_t, 8>::operator SIMDVec_f<double, 8>() const {
-        alignas(32) int64_t raw_i[8];
-        alignas(32) double raw_d[8];
-
-        _mm256_store_si256((__m256i*)raw_i, mVec[0]);
-        _mm256_store_si256((__m256i*)(raw_i + 4), mVec[1]);
-        raw_d[0] = (double)raw_i[0];
-        raw_d[1] = (double)raw_i[1];
-        raw_d[2] = (double)raw_i[2];
-        raw_d[3] = (double)raw_i[3];
-        __m256d t0 = _mm256_load_pd(raw_d);
-        raw_d[4] = (double)raw_i[4];
-        raw_d[5] = (double)raw_i[5];
-        raw_d[6] = (double)raw_i[6];
-        raw_d[7] = (double)raw_i[7];
-        __m256d t1 = _mm256_load_pd(raw_d + 4);
+        __m256d t0 = AVX2::cvtepi64_pd(mVec[0]);
+        __m256d t1 = AVX2::cvtepi64_pd(mVec[1]);
         return SIMDVec_f<double, 8>(t0, t1);
     }
 
@@ -459,7 +446,9 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_f<double, 4>::operator SIMDVec_u<uint64_t, 4>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_u<uint64_t, 4>, uint64_t, SIMDVec_f<double, 4>>(*this);
+        // C++: Truncation is default rounding mode for floating-integer conversion.
+        __m256i t0 = AVX2::cvttpd_epu64(mVec);
+        return SIMDVec_u<uint64_t, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<double, 8>::operator SIMDVec_u<uint64_t, 8>() const {
@@ -480,7 +469,7 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 4>::operator SIMDVec_i<int32_t, 4>() const {
-        __m128i t0 = _mm_cvtps_epi32(mVec);
+        __m128i t0 = _mm_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 4>(t0);
     }
 
@@ -525,33 +514,14 @@ namespace SIMD {
 
     UME_FORCE_INLINE SIMDVec_f<double, 4>::operator SIMDVec_i<int64_t, 4>() const {
         // C++: Truncation is default rounding mode for floating-integer conversion.
-        alignas(32) double raw_64f[4];
-        alignas(32) int64_t raw_64i[4];
-        _mm256_store_pd(raw_64f, mVec);
-        raw_64i[0] = int64_t(raw_64f[0]);
-        raw_64i[1] = int64_t(raw_64f[1]);
-        raw_64i[2] = int64_t(raw_64f[2]);
-        raw_64i[3] = int64_t(raw_64f[3]);
-        __m256i t0 = _mm256_load_si256((__m256i *)raw_64i);
+        __m256i t0 = AVX2::cvttpd_epi64(mVec);
         return SIMDVec_i<int64_t, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<double, 8>::operator SIMDVec_i<int64_t, 8>() const {
         // C++: Truncation is default rounding mode for floating-integer conversion.
-        alignas(32) double raw_64f[8];
-        alignas(32) int64_t raw_64i[8];
-        _mm256_store_pd(raw_64f, mVec[0]);
-        raw_64i[0] = int64_t(raw_64f[0]);
-        raw_64i[1] = int64_t(raw_64f[1]);
-        raw_64i[2] = int64_t(raw_64f[2]);
-        raw_64i[3] = int64_t(raw_64f[3]);
-        _mm256_store_pd(raw_64f + 4, mVec[1]);
-        raw_64i[4] = int64_t(raw_64f[4]);
-        raw_64i[5] = int64_t(raw_64f[5]);
-        raw_64i[6] = int64_t(raw_64f[6]);
-        raw_64i[7] = int64_t(raw_64f[7]);
-        __m256i t0 = _mm256_load_si256((__m256i *)raw_64i);
-        __m256i t1 = _mm256_load_si256((__m256i *)(raw_64i + 4));
+        __m256i t0 = AVX2::cvttpd_epi64(mVec[0]);
+        __m256i t1 = AVX2::cvttpd_epi64(mVec[1]);
         return SIMDVec_i<int64_t, 8>(t0, t1);
     }
 
@@ -612,9 +582,11 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_u<uint8_t, 32>>(*this);
+        alignas(32) uint16_t raw[32];
+        _mm256_store_si256((__m256i*)raw, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(mVec)));
+        _mm256_store_si256((__m256i*)(raw + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(mVec, 1)));
+        return SIMDVec_u<uint16_t, 32>(raw);
     }
 
     template<>
@@ -642,9 +614,11 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 8>, uint32_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 16>, uint32_t, SIMDVec_u<uint16_t, 16>>(*this);
+        alignas(32) uint32_t raw[16];
+        _mm256_store_si256((__m256i*)raw, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(mVec)));
+        _mm256_store_si256((__m256i*)(raw + 8), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 1)));
+        return SIMDVec_u<uint32_t, 16>(raw);
     }
 
     template<>
@@ -697,9 +671,11 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_i<int8_t, 32>>(*this);
+        alignas(32) int16_t raw[32];
+        _mm256_store_si256((__m256i*)raw, _mm256_cvtepi8_epi16(_mm256_castsi256_si128(mVec)));
+        _mm256_store_si256((__m256i*)(raw + 16), _mm256_cvtepi8_epi16(_mm256_extracti128_si256(mVec, 1)));
+        return SIMDVec_i<int16_t, 32>(raw);
     }
 
     template<>
@@ -727,9 +703,11 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 8>, int32_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 16>, int32_t, SIMDVec_i<int16_t, 16>>(*this);
+        alignas(32) int32_t raw[16];
+        _mm256_store_si256((__m256i*)raw, _mm256_cvtepi16_epi32(_mm256_castsi256_si128(mVec)));
+        _mm256_store_si256((__m256i*)(raw + 8), _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 1)));
+        return SIMDVec_i<int32_t, 16>(raw);
     }
 
     template<>
@@ -797,9 +775,13 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_u<uint16_t, 16>>(*this);
+        alignas(16) uint8_t raw[16];
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(0x00FF));
+        __m256i t1 = _mm256_packus_epi16(t0, t0);
+        __m256i t2 = _mm256_permute4x64_epi64(t1, 0x08);
+        _mm_store_si128((__m128i*)raw, _mm256_castsi256_si128(t2));
+        return SIMDVec_u<uint8_t, 16>(raw);
     }
 
     template<>
@@ -878,9 +860,13 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_i<int16_t, 16>>(*this);
+        alignas(16) int8_t raw[16];
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(0x00FF));
+        __m256i t1 = _mm256_packus_epi16(t0, t0);
+        __m256i t2 = _mm256_permute4x64_epi64(t1, 0x08);
+        _mm_store_si128((__m128i*)raw, _mm256_castsi256_si128(t2));
+        return SIMDVec_i<int8_t, 16>(raw);
     }
 
     template<>
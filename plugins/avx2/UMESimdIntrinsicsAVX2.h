@@ -0,0 +1,238 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_INTRINSICS_AVX2_H_
+#define UME_SIMD_INTRINSICS_AVX2_H_
+
+#include <cstdint>
+#include <immintrin.h>
+
+#include "../../UMEInline.h"
+
+// 64-bit integer operations that AVX2 does not provide as single instructions
+// (they only appear with AVX512DQ/VL), built from 32-bit multiplies, shifts
+// and floating-point bit manipulation.
+
+namespace UME {
+namespace SIMD {
+namespace AVX2 {
+
+    UME_FORCE_INLINE __m256i set1_epi64(uint64_t x) {
+#if defined (_MSC_VER) && !defined (__x86_64__)
+        int lo = int(x & 0x00000000FFFFFFFF);
+        int hi = int((x & 0xFFFFFFFF00000000) >> 32);
+        return _mm256_setr_epi32(lo, hi, lo, hi, lo, hi, lo, hi);
+#else
+        return _mm256_set1_epi64x((long long)x);
+#endif
+    }
+
+    // Low 64 bits of the products. The result is the same for signed and unsigned elements.
+    UME_FORCE_INLINE __m256i mullo_epi64(__m256i const & a, __m256i const & b) {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+        return _mm256_mullo_epi64(a, b);
+#else
+        // a * b = lo(a)*lo(b) + ((hi(a)*lo(b) + lo(a)*hi(b)) << 32)  (mod 2^64)
+        __m256i t0 = _mm256_mul_epu32(a, b);
+        __m256i t1 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+        __m256i t2 = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+        __m256i t3 = _mm256_slli_epi64(_mm256_add_epi64(t1, t2), 32);
+        return _mm256_add_epi64(t0, t3);
+#endif
+    }
+
+    // High 64 bits of the unsigned 128-bit products.
+    UME_FORCE_INLINE __m256i mulhi_epu64(__m256i const & a, __m256i const & b) {
+        __m256i lo_mask = set1_epi64(0x00000000FFFFFFFF);
+        __m256i a_hi = _mm256_srli_epi64(a, 32);
+        __m256i b_hi = _mm256_srli_epi64(b, 32);
+        __m256i t0 = _mm256_mul_epu32(a, b);
+        __m256i t1 = _mm256_mul_epu32(a_hi, b);
+        __m256i t2 = _mm256_mul_epu32(a, b_hi);
+        __m256i t3 = _mm256_mul_epu32(a_hi, b_hi);
+        // Middle 32-bit column plus the carry out of the low one. Three 32-bit terms cannot overflow 64 bits.
+        __m256i t4 = _mm256_add_epi64(_mm256_srli_epi64(t0, 32), _mm256_and_si256(t1, lo_mask));
+        t4 = _mm256_add_epi64(t4, _mm256_and_si256(t2, lo_mask));
+        __m256i t5 = _mm256_add_epi64(t3, _mm256_srli_epi64(t1, 32));
+        t5 = _mm256_add_epi64(t5, _mm256_srli_epi64(t2, 32));
+        return _mm256_add_epi64(t5, _mm256_srli_epi64(t4, 32));
+    }
+
+    // Division of unsigned 64-bit elements by an invariant divisor 'd > 0' using
+    // a multiplication by a precomputed reciprocal (T. Granlund, P. L. Montgomery,
+    // "Division by Invariant Integers using Multiplication", 1994, figure 4.1):
+    //     t = mulhi(m, n),  q = (t + ((n - t) >> sh1)) >> sh2
+    // The result is exact for all dividends. DIVS constructs it on every call;
+    // FUNCTIONS::Divisor keeps it when dividing many vectors by the same value.
+    class DivisorU64 {
+    private:
+        __m256i mMagic;
+        __m128i mShift1;
+        __m128i mShift2;
+
+        // floor(hi * 2^64 / d), 'hi < d'
+        static UME_FORCE_INLINE uint64_t div128(uint64_t hi, uint64_t d) {
+#if defined(__SIZEOF_INT128__)
+            // __extension__ keeps -pedantic builds free of the ISO C++ '__int128' warning.
+            __extension__ typedef unsigned __int128 uint128_t;
+            return uint64_t((uint128_t(hi) << 64) / d);
+#else
+            uint64_t r = hi;
+            uint64_t q = 0;
+            for (int i = 0; i < 64; i++) {
+                uint64_t carry = r >> 63;
+                r <<= 1;
+                q <<= 1;
+                if (carry || r >= d) {
+                    r -= d;
+                    q |= 1;
+                }
+            }
+            return q;
+#endif
+        }
+
+        // ceil(log2(d))
+        static UME_FORCE_INLINE int ceil_log2(uint64_t d) {
+            if (d <= 1) return 0;
+#if defined(__GNUC__)
+            return 64 - __builtin_clzll(d - 1);
+#else
+            int l = 0;
+            for (uint64_t t = d - 1; t != 0; t >>= 1) l++;
+            return l;
+#endif
+        }
+
+    public:
+        UME_FORCE_INLINE explicit DivisorU64(uint64_t d) {
+            int l = ceil_log2(d);
+            // 2^l - d, wrapping to 2^64 - d for l == 64
+            uint64_t t0 = (l < 64 ? (uint64_t(1) << l) : 0) - d;
+            mMagic = set1_epi64(div128(t0, d) + 1);
+            mShift1 = _mm_cvtsi32_si128(l < 1 ? l : 1);
+            mShift2 = _mm_cvtsi32_si128(l > 1 ? l - 1 : 0);
+        }
+
+        UME_FORCE_INLINE __m256i divide(__m256i const & n) const {
+            __m256i t0 = mulhi_epu64(mMagic, n);
+            __m256i t1 = _mm256_srl_epi64(_mm256_sub_epi64(n, t0), mShift1);
+            return _mm256_srl_epi64(_mm256_add_epi64(t0, t1), mShift2);
+        }
+    };
+
+    // Signed variant: divides magnitudes and restores the sign, truncating towards zero
+    // as C++ integer division does.
+    class DivisorI64 {
+    private:
+        DivisorU64 mDivisor;
+        __m256i mSign;
+
+    public:
+        UME_FORCE_INLINE explicit DivisorI64(int64_t d) :
+            mDivisor(d < 0 ? uint64_t(0) - uint64_t(d) : uint64_t(d)),
+            mSign(set1_epi64(d < 0 ? ~uint64_t(0) : 0)) {}
+
+        UME_FORCE_INLINE __m256i divide(__m256i const & n) const {
+            __m256i s = _mm256_cmpgt_epi64(_mm256_setzero_si256(), n);
+            __m256i t0 = _mm256_sub_epi64(_mm256_xor_si256(n, s), s);
+            __m256i t1 = mDivisor.divide(t0);
+            __m256i t2 = _mm256_xor_si256(s, mSign);
+            return _mm256_sub_epi64(_mm256_xor_si256(t1, t2), t2);
+        }
+    };
+
+    // Exact, correctly rounded 64-bit integer to double conversions. The integer is split
+    // into 32-bit halves which are placed in the mantissas of 2^52 and 2^84, so that a
+    // subtraction and an addition of doubles reassemble the value with a single rounding.
+    UME_FORCE_INLINE __m256d cvtepu64_pd(__m256i const & x) {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+        return _mm256_cvtepu64_pd(x);
+#else
+        __m256i t0 = _mm256_blend_epi32(set1_epi64(0x4330000000000000), x, 0x55);              // 2^52 + lo
+        __m256i t1 = _mm256_xor_si256(_mm256_srli_epi64(x, 32), set1_epi64(0x4530000000000000)); // 2^84 + hi * 2^32
+        __m256d t2 = _mm256_sub_pd(_mm256_castsi256_pd(t1), _mm256_castsi256_pd(set1_epi64(0x4530000000100000)));
+        return _mm256_add_pd(t2, _mm256_castsi256_pd(t0));
+#endif
+    }
+
+    UME_FORCE_INLINE __m256d cvtepi64_pd(__m256i const & x) {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+        return _mm256_cvtepi64_pd(x);
+#else
+        // Same as above, with the high half biased by 2^31 to make it non-negative.
+        __m256i t0 = _mm256_blend_epi32(set1_epi64(0x4330000000000000), x, 0x55);
+        __m256i t1 = _mm256_xor_si256(_mm256_srli_epi64(x, 32), set1_epi64(0x4530000080000000));
+        __m256d t2 = _mm256_sub_pd(_mm256_castsi256_pd(t1), _mm256_castsi256_pd(set1_epi64(0x4530000080100000)));
+        return _mm256_add_pd(t2, _mm256_castsi256_pd(t0));
+#endif
+    }
+
+    // Double to 64-bit integer conversions truncating towards zero. The magnitude is
+    // obtained by shifting the mantissa by the unbiased exponent; variable shifts by
+    // 64 or more (including "negative" counts) produce zero. Results for values
+    // outside of the destination range are unspecified.
+    UME_FORCE_INLINE __m256i cvttpd_epu64(__m256d const & x) {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+        return _mm256_cvttpd_epu64(x);
+#else
+        __m256i t0 = _mm256_castpd_si256(x);
+        __m256i t1 = _mm256_and_si256(_mm256_srli_epi64(t0, 52), set1_epi64(0x7FF));
+        __m256i e = _mm256_sub_epi64(t1, set1_epi64(1075));
+        __m256i m = _mm256_or_si256(
+            _mm256_and_si256(t0, set1_epi64(0x000FFFFFFFFFFFFF)),
+            set1_epi64(0x0010000000000000));
+        __m256i t2 = _mm256_sllv_epi64(m, e);
+        __m256i t3 = _mm256_srlv_epi64(m, _mm256_sub_epi64(_mm256_setzero_si256(), e));
+        return _mm256_or_si256(t2, t3);
+#endif
+    }
+
+    UME_FORCE_INLINE __m256i cvttpd_epi64(__m256d const & x) {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+        return _mm256_cvttpd_epi64(x);
+#else
+        __m256i t0 = _mm256_castpd_si256(x);
+        // The magnitude path ignores the sign bit.
+        __m256i t1 = cvttpd_epu64(x);
+        __m256i s = _mm256_cmpgt_epi64(_mm256_setzero_si256(), t0);
+        __m256i t2 = _mm256_sub_epi64(_mm256_xor_si256(t1, s), s);
+        // Like CVTTSD2SI, return 0x8000000000000000 for |x| >= 2^63, infinities and NaNs.
+        __m256i t3 = _mm256_and_si256(_mm256_srli_epi64(t0, 52), set1_epi64(0x7FF));
+        __m256i overflow = _mm256_cmpgt_epi64(t3, set1_epi64(1023 + 62));
+        return _mm256_blendv_epi8(t2, set1_epi64(0x8000000000000000), overflow);
+#endif
+    }
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,60 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_PERMUTE_AVX2_H_
+#define UME_SIMD_PERMUTE_AVX2_H_
+
+#include <cstdint>
+#include <immintrin.h>
+
+#include "../../UMEInline.h"
+
+// Run-time permutations of 64-bit elements. AVX2 only permutes 32-bit
+// elements across 128-bit lanes (VPERMD/VPERMPS), so 64-bit indices are
+// converted into pairs of 32-bit indices.
+
+namespace UME {
+namespace SIMD {
+namespace AVX2 {
+
+    // 32-bit element indices (2k, 2k+1) for each 64-bit element index 'k'.
+    // Only the lowest 2 bits of 'k' are used.
+    UME_FORCE_INLINE __m256i permutationIndices64(__m256i const & indices) {
+        __m256i t0 = _mm256_slli_epi64(indices, 1);
+        // Copy the low half of each 64-bit element to the high half.
+        __m256i t1 = _mm256_shuffle_epi32(t0, 0xA0);
+        return _mm256_add_epi32(t1, _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+    }
+
+}
+}
+}
+
+#endif
@@ -47,6 +47,10 @@
 // ********************************************************************************************
 // SIGNED INTEGER VECTOR SPECIALIZATIONS
 // ********************************************************************************************
+#include "int/UMESimdVecInt8_32.h"
+
+#include "int/UMESimdVecInt16_16.h"
+
 #include "int/UMESimdVecInt32_1.h"
 #include "int/UMESimdVecInt32_2.h"
 #include "int/UMESimdVecInt32_4.h"
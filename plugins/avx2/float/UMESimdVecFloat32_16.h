@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
+#include "../UMESimdInterleaveAVX2.h"
 
 #define BLEND(a_256, b_256, mask_256i) _mm256_blendv_ps(a_256, b_256, _mm256_castsi256_ps(mask_256i))
 
@@ -183,6 +185,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -192,12 +196,49 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            mVec[0] = _mm256_maskload_ps(p, t1);
+            mVec[1] = _mm256_maskload_ps(p + 8, t2);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 16 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                AVX2::deinterleave2(t1, t2, v0.mVec[i], v1.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 24 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                AVX2::deinterleave3(t1, t2, t3, v0.mVec[i], v1.mVec[i], v2.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 32 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                __m256 t4 = _mm256_loadu_ps(t0 + 24);
+                AVX2::deinterleave4(t1, t2, t3, t4, v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i]);
+            }
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec[0] = _mm256_load_ps(p);
@@ -206,10 +247,10 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
-            __m256 t1 = _mm256_load_ps(p + 8);
-            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
-            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
+            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
         // SLOAD
@@ -243,6 +284,49 @@ namespace SIMD {
             _mm256_maskstore_ps((p + 8), mask.mMask[1], mVec[1]);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            _mm256_maskstore_ps(p, t1, mVec[0]);
+            _mm256_maskstore_ps(p + 8, t2, mVec[1]);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 16 * i;
+                __m256 t1, t2;
+                AVX2::interleave2(v0.mVec[i], v1.mVec[i], t1, t2);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 24 * i;
+                __m256 t1, t2, t3;
+                AVX2::interleave3(v0.mVec[i], v1.mVec[i], v2.mVec[i], t1, t2, t3);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 32 * i;
+                __m256 t1, t2, t3, t4;
+                AVX2::interleave4(v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i], t1, t2, t3, t4);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+                _mm256_storeu_ps(t0 + 24, t4);
+            }
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float* p) const {
             _mm256_store_ps(p, mVec[0]);
@@ -289,6 +373,51 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            AVX2::sortNetwork16<float, false>(t0, t1);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            __m256 t2 = _mm256_castsi256_ps(payload.mVec[0]);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVec[1]);
+            AVX2::sortNetwork16<float, false>(t0, t1, t2, t3);
+            payload.mVec[0] = _mm256_castps_si256(t2);
+            payload.mVec[1] = _mm256_castps_si256(t3);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            AVX2::sortNetwork16<float, true>(t0, t1);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = mVec[0];
+            __m256 t1 = mVec[1];
+            __m256 t2 = _mm256_castsi256_ps(payload.mVec[0]);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVec[1]);
+            AVX2::sortNetwork16<float, true>(t0, t1, t2, t3);
+            payload.mVec[0] = _mm256_castps_si256(t2);
+            payload.mVec[1] = _mm256_castps_si256(t3);
+            return SIMDVec_f(t0, t1);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_add_ps(mVec[0], b.mVec[0]);
@@ -775,6 +904,24 @@ namespace SIMD {
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            __m256 t0 = _mm256_rcp_ps(mVec[0]);
+            __m256 t1 = _mm256_rcp_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 11;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            __m256 t0 = _mm256_rsqrt_ps(mVec[0]);
+            __m256 t1 = _mm256_rsqrt_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 11;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<16> cmpeq(SIMDVec_f const & b) const {
             __m256 m0 = _mm256_cmp_ps(mVec[0], b.mVec[0], 0);
@@ -944,16 +1091,22 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            /* alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-            for (unsigned int j = i + 1; j < 8; j++) {
-            if (raw[i] == raw[j]) {
-            return false;
-            }
+            // Rotations by 1 to 4 elements compare the pairs within each half,
+            // and all 8 rotations of the upper half compare the pairs across halves.
+            __m256i t0 = _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1);
+            __m256 t1 = _mm256_cmp_ps(mVec[0], mVec[1], _CMP_EQ_OQ);
+            __m256 t2 = mVec[0];
+            __m256 t3 = mVec[1];
+            for (int i = 1; i < 8; i++) {
+                t2 = _mm256_permutevar8x32_ps(t2, t0);
+                t3 = _mm256_permutevar8x32_ps(t3, t0);
+                t1 = _mm256_or_ps(t1, _mm256_cmp_ps(mVec[0], t3, _CMP_EQ_OQ));
+                if (i <= 4) {
+                    t1 = _mm256_or_ps(t1, _mm256_cmp_ps(mVec[0], t2, _CMP_EQ_OQ));
+                    t1 = _mm256_or_ps(t1, _mm256_cmp_ps(mVec[1], t3, _CMP_EQ_OQ));
+                }
             }
-            }*/
-            return true;
+            return _mm256_movemask_ps(t1) == 0;
         }
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1069,7 +1222,7 @@ namespace SIMD {
         }
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
+#if defined(__FMA__)
             __m256 t0 = _mm256_fmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
             __m256 t1 = _mm256_fmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
 #else
@@ -1080,70 +1233,116 @@ namespace SIMD {
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
+#if defined(__FMA__)
             __m256 t0 = _mm256_fmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
             __m256 t1 = _mm256_fmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
 #else
             __m256 t0 = _mm256_add_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
             __m256 t1 = _mm256_add_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
 #endif
-            __m256 t2 = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
             return SIMDVec_f(t2, t3);
         }
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_mul_ps(mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_sub_ps(t0, c.mVec[0]);
-            __m256 t2 = _mm256_mul_ps(mVec[1], b.mVec[1]);
-            __m256 t3 = _mm256_sub_ps(t2, c.mVec[1]);
-            return SIMDVec_f(t1, t3);
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+#else
+            __m256 t0 = _mm256_sub_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_sub_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+#endif
+            return SIMDVec_f(t0, t1);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_mul_ps(mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_sub_ps(t0, c.mVec[0]);
-            __m256 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
-            __m256 t3 = _mm256_mul_ps(mVec[1], b.mVec[1]);
-            __m256 t4 = _mm256_sub_ps(t3, c.mVec[1]);
-            __m256 t5 = BLEND(mVec[1], t4, mask.mMask[1]);
-            return SIMDVec_f(t2, t5);
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+#else
+            __m256 t0 = _mm256_sub_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_sub_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+#endif
+            __m256 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
+            return SIMDVec_f(t2, t3);
         }
         // FADDMULV
         UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_add_ps(mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec[0]);
-            __m256 t2 = _mm256_add_ps(mVec[1], b.mVec[1]);
-            __m256 t3 = _mm256_mul_ps(t2, c.mVec[1]);
-            return SIMDVec_f(t1, t3);
+            __m256 t0 = _mm256_mul_ps(_mm256_add_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_add_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            return SIMDVec_f(t0, t1);
         }
         // MFADDMULV
         UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_add_ps(mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec[0]);
-            __m256 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
-            __m256 t3 = _mm256_add_ps(mVec[1], b.mVec[1]);
-            __m256 t4 = _mm256_mul_ps(t3, c.mVec[1]);
-            __m256 t5 = BLEND(mVec[1], t4, mask.mMask[1]);
-            return SIMDVec_f(t2, t5);
+            __m256 t0 = _mm256_mul_ps(_mm256_add_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_add_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
+            return SIMDVec_f(t2, t3);
         }
         // FSUBMULV
         UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_sub_ps(mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec[0]);
-            __m256 t2 = _mm256_sub_ps(mVec[1], b.mVec[1]);
-            __m256 t3 = _mm256_mul_ps(t2, c.mVec[1]);
-            return SIMDVec_f(t1, t3);
+            __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            return SIMDVec_f(t0, t1);
         }
         // MFSUBMULV
         UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_sub_ps(mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec[0]);
-            __m256 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
-            __m256 t3 = _mm256_sub_ps(mVec[1], b.mVec[1]);
-            __m256 t4 = _mm256_mul_ps(t3, c.mVec[1]);
-            __m256 t5 = BLEND(mVec[1], t4, mask.mMask[1]);
-            return SIMDVec_f(t2, t5);
+            __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
+            return SIMDVec_f(t2, t3);
+        }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
+#else
+            __m256 t0 = _mm256_sub_ps(c.mVec[0], _mm256_mul_ps(mVec[0], b.mVec[0]));
+            __m256 t1 = _mm256_sub_ps(c.mVec[1], _mm256_mul_ps(mVec[1], b.mVec[1]));
+#endif
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
+#else
+            __m256 t0 = _mm256_sub_ps(c.mVec[0], _mm256_mul_ps(mVec[0], b.mVec[0]));
+            __m256 t1 = _mm256_sub_ps(c.mVec[1], _mm256_mul_ps(mVec[1], b.mVec[1]));
+#endif
+            __m256 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
+            return SIMDVec_f(t2, t3);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+#else
+            __m256 t0 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]), _mm256_set1_ps(-0.0f));
+            __m256 t1 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]), _mm256_set1_ps(-0.0f));
+#endif
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+#else
+            __m256 t0 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]), _mm256_set1_ps(-0.0f));
+            __m256 t1 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]), _mm256_set1_ps(-0.0f));
+#endif
+            __m256 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
+            return SIMDVec_f(t2, t3);
         }
 
         // MAXV
@@ -1574,9 +1773,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1655,20 +1866,64 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<16> const & mask) const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG
         // MLOG
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // SIN
         // MSIN
         // COS
         // MCOS
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<16>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 8> const & a, SIMDVec_f<float, 8> const & b) {
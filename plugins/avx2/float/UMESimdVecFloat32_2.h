@@ -180,6 +180,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -829,26 +831,46 @@ namespace SIMD {
 
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = std::fma(mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = std::fma(mVec[1], b.mVec[1], c.mVec[1]);
+#else
             float t0 = mVec[0] * b.mVec[0] + c.mVec[0];
             float t1 = mVec[1] * b.mVec[1] + c.mVec[1];
+#endif
             return SIMDVec_f(t0, t1);
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = (mask.mMask[0] == true) ? std::fma(mVec[0], b.mVec[0], c.mVec[0]) : mVec[0];
+            float t1 = (mask.mMask[1] == true) ? std::fma(mVec[1], b.mVec[1], c.mVec[1]) : mVec[1];
+#else
             float t0 = (mask.mMask[0] == true) ? (mVec[0] * b.mVec[0] + c.mVec[0]) : mVec[0];
             float t1 = (mask.mMask[1] == true) ? (mVec[1] * b.mVec[1] + c.mVec[1]) : mVec[1];
+#endif
             return SIMDVec_f(t0, t1);
         }
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = std::fma(mVec[0], b.mVec[0], -c.mVec[0]);
+            float t1 = std::fma(mVec[1], b.mVec[1], -c.mVec[1]);
+#else
             float t0 = mVec[0] * b.mVec[0] - c.mVec[0];
             float t1 = mVec[1] * b.mVec[1] - c.mVec[1];
+#endif
             return SIMDVec_f(t0, t1);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = (mask.mMask[0] == true) ? std::fma(mVec[0], b.mVec[0], -c.mVec[0]) : mVec[0];
+            float t1 = (mask.mMask[1] == true) ? std::fma(mVec[1], b.mVec[1], -c.mVec[1]) : mVec[1];
+#else
             float t0 = (mask.mMask[0] == true) ? (mVec[0] * b.mVec[0] - c.mVec[0]) : mVec[0];
             float t1 = (mask.mMask[1] == true) ? (mVec[1] * b.mVec[1] - c.mVec[1]) : mVec[1];
+#endif
             return SIMDVec_f(t0, t1);
         }
         // FADDMULV
@@ -875,6 +897,50 @@ namespace SIMD {
             float t1 = (mask.mMask[1] == true) ? ((mVec[1] - b.mVec[1]) * c.mVec[1]) : mVec[1];
             return SIMDVec_f(t0, t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = std::fma(-mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = std::fma(-mVec[1], b.mVec[1], c.mVec[1]);
+#else
+            float t0 = c.mVec[0] - mVec[0] * b.mVec[0];
+            float t1 = c.mVec[1] - mVec[1] * b.mVec[1];
+#endif
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = (mask.mMask[0] == true) ? std::fma(-mVec[0], b.mVec[0], c.mVec[0]) : mVec[0];
+            float t1 = (mask.mMask[1] == true) ? std::fma(-mVec[1], b.mVec[1], c.mVec[1]) : mVec[1];
+#else
+            float t0 = (mask.mMask[0] == true) ? (c.mVec[0] - mVec[0] * b.mVec[0]) : mVec[0];
+            float t1 = (mask.mMask[1] == true) ? (c.mVec[1] - mVec[1] * b.mVec[1]) : mVec[1];
+#endif
+            return SIMDVec_f(t0, t1);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = std::fma(-mVec[0], b.mVec[0], -c.mVec[0]);
+            float t1 = std::fma(-mVec[1], b.mVec[1], -c.mVec[1]);
+#else
+            float t0 = -(mVec[0] * b.mVec[0]) - c.mVec[0];
+            float t1 = -(mVec[1] * b.mVec[1]) - c.mVec[1];
+#endif
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            float t0 = (mask.mMask[0] == true) ? std::fma(-mVec[0], b.mVec[0], -c.mVec[0]) : mVec[0];
+            float t1 = (mask.mMask[1] == true) ? std::fma(-mVec[1], b.mVec[1], -c.mVec[1]) : mVec[1];
+#else
+            float t0 = (mask.mMask[0] == true) ? (-(mVec[0] * b.mVec[0]) - c.mVec[0]) : mVec[0];
+            float t1 = (mask.mMask[1] == true) ? (-(mVec[1] * b.mVec[1]) - c.mVec[1]) : mVec[1];
+#endif
+            return SIMDVec_f(t0, t1);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX2.h"
 
 #define BLEND(a_256, b_256, mask_256i) _mm256_blendv_ps(a_256, b_256, _mm256_castsi256_ps(mask_256i))
 
@@ -219,6 +220,8 @@ namespace SIMD {
         // PREFETCH0  
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         //(Memory access)
         // LOAD
@@ -231,16 +234,57 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<32> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
-            __m256 t2 = _mm256_loadu_ps(p + 16);
-            __m256 t3 = _mm256_loadu_ps(p + 24);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
+            __m256 t2 = _mm256_maskload_ps(p + 16, mask.mMask[2]);
+            __m256 t3 = _mm256_maskload_ps(p + 24, mask.mMask[3]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_castsi256_ps(mask.mMask[2]));
             mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_castsi256_ps(mask.mMask[3]));
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            __m256i t3 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(16, 17, 18, 19, 20, 21, 22, 23));
+            __m256i t4 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(24, 25, 26, 27, 28, 29, 30, 31));
+            mVec[0] = _mm256_maskload_ps(p, t1);
+            mVec[1] = _mm256_maskload_ps(p + 8, t2);
+            mVec[2] = _mm256_maskload_ps(p + 16, t3);
+            mVec[3] = _mm256_maskload_ps(p + 24, t4);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            for (int i = 0; i < 4; i++) {
+                float const * t0 = p + 16 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                AVX2::deinterleave2(t1, t2, v0.mVec[i], v1.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            for (int i = 0; i < 4; i++) {
+                float const * t0 = p + 24 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                AVX2::deinterleave3(t1, t2, t3, v0.mVec[i], v1.mVec[i], v2.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            for (int i = 0; i < 4; i++) {
+                float const * t0 = p + 32 * i;
+                __m256 t1 = _mm256_loadu_ps(t0);
+                __m256 t2 = _mm256_loadu_ps(t0 + 8);
+                __m256 t3 = _mm256_loadu_ps(t0 + 16);
+                __m256 t4 = _mm256_loadu_ps(t0 + 24);
+                AVX2::deinterleave4(t1, t2, t3, t4, v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i]);
+            }
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec[0] = _mm256_load_ps(p);
@@ -252,10 +296,10 @@ namespace SIMD {
 
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<32> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
-            __m256 t1 = _mm256_load_ps(p + 8);
-            __m256 t2 = _mm256_load_ps(p + 16);
-            __m256 t3 = _mm256_load_ps(p + 24);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
+            __m256 t2 = _mm256_maskload_ps(p + 16, mask.mMask[2]);
+            __m256 t3 = _mm256_maskload_ps(p + 24, mask.mMask[3]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_castsi256_ps(mask.mMask[2]));
@@ -278,6 +322,53 @@ namespace SIMD {
             _mm256_maskstore_ps((p + 24), mask.mMask[3], mVec[3]);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            __m256i t3 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(16, 17, 18, 19, 20, 21, 22, 23));
+            __m256i t4 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(24, 25, 26, 27, 28, 29, 30, 31));
+            _mm256_maskstore_ps(p, t1, mVec[0]);
+            _mm256_maskstore_ps(p + 8, t2, mVec[1]);
+            _mm256_maskstore_ps(p + 16, t3, mVec[2]);
+            _mm256_maskstore_ps(p + 24, t4, mVec[3]);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            for (int i = 0; i < 4; i++) {
+                float * t0 = p + 16 * i;
+                __m256 t1, t2;
+                AVX2::interleave2(v0.mVec[i], v1.mVec[i], t1, t2);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            for (int i = 0; i < 4; i++) {
+                float * t0 = p + 24 * i;
+                __m256 t1, t2, t3;
+                AVX2::interleave3(v0.mVec[i], v1.mVec[i], v2.mVec[i], t1, t2, t3);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            for (int i = 0; i < 4; i++) {
+                float * t0 = p + 32 * i;
+                __m256 t1, t2, t3, t4;
+                AVX2::interleave4(v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i], t1, t2, t3, t4);
+                _mm256_storeu_ps(t0, t1);
+                _mm256_storeu_ps(t0 + 8, t2);
+                _mm256_storeu_ps(t0 + 16, t3);
+                _mm256_storeu_ps(t0 + 24, t4);
+            }
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float* p) const {
             _mm256_store_ps(p, mVec[0]);
@@ -757,6 +848,28 @@ namespace SIMD {
             mVec[3] = BLEND(mVec[3], t3, mask.mMask[3]);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            __m256 t0 = _mm256_rcp_ps(mVec[0]);
+            __m256 t1 = _mm256_rcp_ps(mVec[1]);
+            __m256 t2 = _mm256_rcp_ps(mVec[2]);
+            __m256 t3 = _mm256_rcp_ps(mVec[3]);
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 11;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            __m256 t0 = _mm256_rsqrt_ps(mVec[0]);
+            __m256 t1 = _mm256_rsqrt_ps(mVec[1]);
+            __m256 t2 = _mm256_rsqrt_ps(mVec[2]);
+            __m256 t3 = _mm256_rsqrt_ps(mVec[3]);
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 11;
+        }
 
         //(Comparison operations)
         // CMPEQV - Element-wise 'equal' with vector
@@ -849,7 +962,7 @@ namespace SIMD {
         //(Fused arithmetics)
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
+#if defined(__FMA__)
             __m256 t0 = _mm256_fmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
             __m256 t1 = _mm256_fmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
             __m256 t2 = _mm256_fmadd_ps(mVec[2], b.mVec[2], c.mVec[2]);
@@ -864,7 +977,7 @@ namespace SIMD {
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
+#if defined(__FMA__)
             __m256 t0 = _mm256_fmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
             __m256 t1 = _mm256_fmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
             __m256 t2 = _mm256_fmadd_ps(mVec[2], b.mVec[2], c.mVec[2]);
@@ -875,18 +988,154 @@ namespace SIMD {
             __m256 t2 = _mm256_add_ps(_mm256_mul_ps(mVec[2], b.mVec[2]), c.mVec[2]);
             __m256 t3 = _mm256_add_ps(_mm256_mul_ps(mVec[3], b.mVec[3]), c.mVec[3]);
 #endif
-            __m256 t4 = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t4 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t5 = BLEND(mVec[1], t1, mask.mMask[1]);
+            __m256 t6 = BLEND(mVec[2], t2, mask.mMask[2]);
+            __m256 t7 = BLEND(mVec[3], t3, mask.mMask[3]);
+            return SIMDVec_f(t4, t5, t6, t7);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            __m256 t2 = _mm256_fmsub_ps(mVec[2], b.mVec[2], c.mVec[2]);
+            __m256 t3 = _mm256_fmsub_ps(mVec[3], b.mVec[3], c.mVec[3]);
+#else
+            __m256 t0 = _mm256_sub_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_sub_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = _mm256_sub_ps(_mm256_mul_ps(mVec[2], b.mVec[2]), c.mVec[2]);
+            __m256 t3 = _mm256_sub_ps(_mm256_mul_ps(mVec[3], b.mVec[3]), c.mVec[3]);
+#endif
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            __m256 t2 = _mm256_fmsub_ps(mVec[2], b.mVec[2], c.mVec[2]);
+            __m256 t3 = _mm256_fmsub_ps(mVec[3], b.mVec[3], c.mVec[3]);
+#else
+            __m256 t0 = _mm256_sub_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_sub_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = _mm256_sub_ps(_mm256_mul_ps(mVec[2], b.mVec[2]), c.mVec[2]);
+            __m256 t3 = _mm256_sub_ps(_mm256_mul_ps(mVec[3], b.mVec[3]), c.mVec[3]);
+#endif
+            __m256 t4 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t5 = BLEND(mVec[1], t1, mask.mMask[1]);
+            __m256 t6 = BLEND(mVec[2], t2, mask.mMask[2]);
+            __m256 t7 = BLEND(mVec[3], t3, mask.mMask[3]);
+            return SIMDVec_f(t4, t5, t6, t7);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256 t0 = _mm256_mul_ps(_mm256_add_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_add_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = _mm256_mul_ps(_mm256_add_ps(mVec[2], b.mVec[2]), c.mVec[2]);
+            __m256 t3 = _mm256_mul_ps(_mm256_add_ps(mVec[3], b.mVec[3]), c.mVec[3]);
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256 t0 = _mm256_mul_ps(_mm256_add_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_add_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = _mm256_mul_ps(_mm256_add_ps(mVec[2], b.mVec[2]), c.mVec[2]);
+            __m256 t3 = _mm256_mul_ps(_mm256_add_ps(mVec[3], b.mVec[3]), c.mVec[3]);
+            __m256 t4 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t5 = BLEND(mVec[1], t1, mask.mMask[1]);
+            __m256 t6 = BLEND(mVec[2], t2, mask.mMask[2]);
+            __m256 t7 = BLEND(mVec[3], t3, mask.mMask[3]);
+            return SIMDVec_f(t4, t5, t6, t7);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = _mm256_mul_ps(_mm256_sub_ps(mVec[2], b.mVec[2]), c.mVec[2]);
+            __m256 t3 = _mm256_mul_ps(_mm256_sub_ps(mVec[3], b.mVec[3]), c.mVec[3]);
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+            __m256 t2 = _mm256_mul_ps(_mm256_sub_ps(mVec[2], b.mVec[2]), c.mVec[2]);
+            __m256 t3 = _mm256_mul_ps(_mm256_sub_ps(mVec[3], b.mVec[3]), c.mVec[3]);
+            __m256 t4 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t5 = BLEND(mVec[1], t1, mask.mMask[1]);
+            __m256 t6 = BLEND(mVec[2], t2, mask.mMask[2]);
+            __m256 t7 = BLEND(mVec[3], t3, mask.mMask[3]);
+            return SIMDVec_f(t4, t5, t6, t7);
+        }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            __m256 t2 = _mm256_fnmadd_ps(mVec[2], b.mVec[2], c.mVec[2]);
+            __m256 t3 = _mm256_fnmadd_ps(mVec[3], b.mVec[3], c.mVec[3]);
+#else
+            __m256 t0 = _mm256_sub_ps(c.mVec[0], _mm256_mul_ps(mVec[0], b.mVec[0]));
+            __m256 t1 = _mm256_sub_ps(c.mVec[1], _mm256_mul_ps(mVec[1], b.mVec[1]));
+            __m256 t2 = _mm256_sub_ps(c.mVec[2], _mm256_mul_ps(mVec[2], b.mVec[2]));
+            __m256 t3 = _mm256_sub_ps(c.mVec[3], _mm256_mul_ps(mVec[3], b.mVec[3]));
+#endif
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            __m256 t2 = _mm256_fnmadd_ps(mVec[2], b.mVec[2], c.mVec[2]);
+            __m256 t3 = _mm256_fnmadd_ps(mVec[3], b.mVec[3], c.mVec[3]);
+#else
+            __m256 t0 = _mm256_sub_ps(c.mVec[0], _mm256_mul_ps(mVec[0], b.mVec[0]));
+            __m256 t1 = _mm256_sub_ps(c.mVec[1], _mm256_mul_ps(mVec[1], b.mVec[1]));
+            __m256 t2 = _mm256_sub_ps(c.mVec[2], _mm256_mul_ps(mVec[2], b.mVec[2]));
+            __m256 t3 = _mm256_sub_ps(c.mVec[3], _mm256_mul_ps(mVec[3], b.mVec[3]));
+#endif
+            __m256 t4 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t5 = BLEND(mVec[1], t1, mask.mMask[1]);
+            __m256 t6 = BLEND(mVec[2], t2, mask.mMask[2]);
+            __m256 t7 = BLEND(mVec[3], t3, mask.mMask[3]);
+            return SIMDVec_f(t4, t5, t6, t7);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            __m256 t2 = _mm256_fnmsub_ps(mVec[2], b.mVec[2], c.mVec[2]);
+            __m256 t3 = _mm256_fnmsub_ps(mVec[3], b.mVec[3], c.mVec[3]);
+#else
+            __m256 t0 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]), _mm256_set1_ps(-0.0f));
+            __m256 t1 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]), _mm256_set1_ps(-0.0f));
+            __m256 t2 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[2], b.mVec[2]), c.mVec[2]), _mm256_set1_ps(-0.0f));
+            __m256 t3 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[3], b.mVec[3]), c.mVec[3]), _mm256_set1_ps(-0.0f));
+#endif
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m256 t1 = _mm256_fnmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            __m256 t2 = _mm256_fnmsub_ps(mVec[2], b.mVec[2], c.mVec[2]);
+            __m256 t3 = _mm256_fnmsub_ps(mVec[3], b.mVec[3], c.mVec[3]);
+#else
+            __m256 t0 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]), _mm256_set1_ps(-0.0f));
+            __m256 t1 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]), _mm256_set1_ps(-0.0f));
+            __m256 t2 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[2], b.mVec[2]), c.mVec[2]), _mm256_set1_ps(-0.0f));
+            __m256 t3 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec[3], b.mVec[3]), c.mVec[3]), _mm256_set1_ps(-0.0f));
+#endif
+            __m256 t4 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m256 t5 = BLEND(mVec[1], t1, mask.mMask[1]);
+            __m256 t6 = BLEND(mVec[2], t2, mask.mMask[2]);
+            __m256 t7 = BLEND(mVec[3], t3, mask.mMask[3]);
             return SIMDVec_f(t4, t5, t6, t7);
         }
-        // FMULSUBV  - Fused multiply and sub (A*B - C) with vectors
-        // MFMULSUBV - Masked fused multiply and sub (A*B - C) with vectors
-        // FADDMULV  - Fused add and multiply ((A + B)*C) with vectors
-        // MFADDMULV - Masked fused add and multiply ((A + B)*C) with vectors
-        // FSUBMULV  - Fused sub and multiply ((A - B)*C) with vectors
-        // MFSUBMULV - Masked fused sub and multiply ((A - B)*C) with vectors
 
         // (Mathematical operations)
         // MAXV   - Max with vector
@@ -976,6 +1225,22 @@ namespace SIMD {
         // MPOWV     - Masked power (exponents in vector)
         // POWS      - Power (exponent in scalar)
         // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1017,12 +1282,60 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<32> const & mask) const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // LOG
         // MLOG
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<32>>(*this, b);
+        }
         // SIN       - Sine
         // MSIN      - Masked sine
         // COS       - Cosine
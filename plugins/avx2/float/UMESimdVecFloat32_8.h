@@ -35,6 +35,9 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
+#include "../UMESimdInterleaveAVX2.h"
+#include "../UMESimdCompressAVX2.h"
 
 #define BLEND(a_256, b_256, mask_256i) _mm256_blendv_ps(a_256, b_256, _mm256_castsi256_ps(mask_256i))
 
@@ -164,6 +167,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -172,10 +177,35 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m256i t0 = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            mVec = _mm256_maskload_ps(p, t0);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            AVX2::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t2 = _mm256_loadu_ps(p + 16);
+            AVX2::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t2 = _mm256_loadu_ps(p + 16);
+            __m256 t3 = _mm256_loadu_ps(p + 24);
+            AVX2::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec = _mm256_load_ps(p);
@@ -183,7 +213,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -211,6 +241,41 @@ namespace SIMD {
             _mm256_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m256i t0 = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            _mm256_maskstore_ps(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m256 t0, t1;
+            AVX2::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m256 t0, t1, t2;
+            AVX2::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            _mm256_storeu_ps(p + 16, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m256 t0, t1, t2, t3;
+            AVX2::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            _mm256_storeu_ps(p + 16, t2);
+            _mm256_storeu_ps(p + 24, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3, SIMDVec_f & v4, SIMDVec_f & v5, SIMDVec_f & v6, SIMDVec_f & v7) {
+            AVX2::transpose8x8(v0.mVec, v1.mVec, v2.mVec, v3.mVec, v4.mVec, v5.mVec, v6.mVec, v7.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float* p) const {
             _mm256_store_ps(p, mVec);
@@ -235,6 +300,47 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<8> const & mask) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256 t2 = _mm256_permutevar8x32_ps(mVec, AVX2::compressPermutation(t0));
+            return SIMDVec_f(_mm256_and_ps(t2, _mm256_castsi256_ps(AVX2::firstLanes(t1))));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, float * p) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256 t2 = _mm256_permutevar8x32_ps(mVec, AVX2::compressPermutation(t0));
+            _mm256_maskstore_ps(p, AVX2::firstLanes(t1), t2);
+            return t1;
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, float const * p) {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256 t2 = _mm256_maskload_ps(p, AVX2::firstLanes(t1));
+            __m256 t3 = _mm256_permutevar8x32_ps(t2, AVX2::expandPermutation(t0));
+            mVec = BLEND(mVec, t3, mask.mMask);
+            return t1;
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            return SIMDVec_f(_mm256_permutevar8x32_ps(mVec, indices.mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256 t0 = _mm256_permutevar8x32_ps(mVec, indices.mVec);
+            return SIMDVec_f(BLEND(mVec, t0, mask.mMask));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256 t0 = _mm256_permutevar8x32_ps(mVec, indices.mVec);
+            __m256 t1 = _mm256_permutevar8x32_ps(b.mVec, indices.mVec);
+            // Bit 3 of the index selects 'b'.
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec, 28));
+            return SIMDVec_f(_mm256_blendv_ps(t0, t1, t2));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
             __m256 t0 = BLEND(mVec, b.mVec, mask.mMask);
@@ -248,6 +354,41 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m256 t0 = AVX2::sortNetwork8<float, false>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = mVec;
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX2::sortNetwork8<float, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m256 t0 = AVX2::sortNetwork8<float, true>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = mVec;
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX2::sortNetwork8<float, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_add_ps(mVec, b.mVec);
@@ -643,6 +784,20 @@ namespace SIMD {
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            return SIMDVec_f(_mm256_rcp_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 11;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            return SIMDVec_f(_mm256_rsqrt_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 11;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_f const & b) const {
             __m256 m0 = _mm256_cmp_ps(mVec, b.mVec, 0);
@@ -779,16 +934,15 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            /* alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-            for (unsigned int j = i + 1; j < 8; j++) {
-            if (raw[i] == raw[j]) {
-            return false;
-            }
-            }
-            }*/
-            return true;
+            // Rotations by 1 to 4 elements compare every pair of elements.
+            __m256i t0 = _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1);
+            __m256 t1 = _mm256_permutevar8x32_ps(mVec, t0);
+            __m256 t2 = _mm256_permutevar8x32_ps(t1, t0);
+            __m256 t3 = _mm256_permutevar8x32_ps(t2, t0);
+            __m256 t4 = _mm256_permutevar8x32_ps(t3, t0);
+            __m256 t5 = _mm256_or_ps(_mm256_cmp_ps(mVec, t1, _CMP_EQ_OQ), _mm256_cmp_ps(mVec, t2, _CMP_EQ_OQ));
+            __m256 t6 = _mm256_or_ps(_mm256_cmp_ps(mVec, t3, _CMP_EQ_OQ), _mm256_cmp_ps(mVec, t4, _CMP_EQ_OQ));
+            return _mm256_movemask_ps(_mm256_or_ps(t5, t6)) == 0;
         }
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -892,60 +1046,101 @@ namespace SIMD {
         }
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
-            return _mm256_fmadd_ps(this->mVec, a.mVec, b.mVec);
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmadd_ps(mVec, b.mVec, c.mVec);
 #else
-            return _mm256_add_ps(_mm256_mul_ps(this->mVec, b.mVec), c.mVec);
+            __m256 t0 = _mm256_add_ps(_mm256_mul_ps(mVec, b.mVec), c.mVec);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
-            __m256 t0 = _mm256_fmadd_ps(this->mVec, b.mVec, c.mVec);
-            return _mm256_blendv_ps(this->mVec, t0, _mm256_cvtepi32_ps(mask.mMask));
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmadd_ps(mVec, b.mVec, c.mVec);
 #else
             __m256 t0 = _mm256_add_ps(_mm256_mul_ps(mVec, b.mVec), c.mVec);
-            return BLEND(mVec, t0, mask.mMask);
 #endif
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
         }
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_mul_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_sub_ps(t0, c.mVec);
-            return SIMDVec_f(t1);
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmsub_ps(mVec, b.mVec, c.mVec);
+#else
+            __m256 t0 = _mm256_sub_ps(_mm256_mul_ps(mVec, b.mVec), c.mVec);
+#endif
+            return SIMDVec_f(t0);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_mul_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_sub_ps(t0, c.mVec);
-            __m256 t2 = BLEND(mVec, t1, mask.mMask);
-            return SIMDVec_f(t2);
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fmsub_ps(mVec, b.mVec, c.mVec);
+#else
+            __m256 t0 = _mm256_sub_ps(_mm256_mul_ps(mVec, b.mVec), c.mVec);
+#endif
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
         }
         // FADDMULV
         UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_add_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m256 t0 = _mm256_mul_ps(_mm256_add_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
         }
         // MFADDMULV
         UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_add_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec);
-            __m256 t2 = BLEND(mVec, t1, mask.mMask);
-            return SIMDVec_f(t2);
+            __m256 t0 = _mm256_mul_ps(_mm256_add_ps(mVec, b.mVec), c.mVec);
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
         }
         // FSUBMULV
         UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_sub_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
         }
         // MFSUBMULV
         UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            __m256 t0 = _mm256_sub_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_mul_ps(t0, c.mVec);
-            __m256 t2 = BLEND(mVec, t1, mask.mMask);
-            return SIMDVec_f(t2);
+            __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(mVec, b.mVec), c.mVec);
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmadd_ps(mVec, b.mVec, c.mVec);
+#else
+            __m256 t0 = _mm256_sub_ps(c.mVec, _mm256_mul_ps(mVec, b.mVec));
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmadd_ps(mVec, b.mVec, c.mVec);
+#else
+            __m256 t0 = _mm256_sub_ps(c.mVec, _mm256_mul_ps(mVec, b.mVec));
+#endif
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmsub_ps(mVec, b.mVec, c.mVec);
+#else
+            __m256 t0 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec, b.mVec), c.mVec), _mm256_set1_ps(-0.0f));
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmsub_ps(mVec, b.mVec, c.mVec);
+#else
+            __m256 t0 = _mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(mVec, b.mVec), c.mVec), _mm256_set1_ps(-0.0f));
+#endif
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
         }
 
         // MAXV
@@ -1105,6 +1300,18 @@ namespace SIMD {
         // IMIN
         // MIMIN
 
+        // GATHERU
+        UME_FORCE_INLINE SIMDVec_f & gatheru(float const * baseAddr, uint32_t stride) {
+            __m256i t0 = _mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            mVec = _mm256_i32gather_ps(baseAddr, t0, 4);
+            return *this;
+        }
+        // MGATHERU
+        UME_FORCE_INLINE SIMDVec_f & gatheru(SIMDVecMask<8> const & mask, float const * baseAddr, uint32_t stride) {
+            __m256i t0 = _mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            mVec = _mm256_mask_i32gather_ps(mVec, baseAddr, t0, _mm256_castsi256_ps(mask.mMask), 4);
+            return *this;
+        }
         // GATHERS
         UME_FORCE_INLINE SIMDVec_f & gather(float const * baseAddr, uint32_t const * indices) {
             __m256i t0 = _mm256_loadu_si256((__m256i*)indices);
@@ -1273,9 +1480,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1348,6 +1567,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -1368,9 +1595,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -1433,9 +1672,33 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
@@ -35,9 +35,14 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX2.h"
+#include "../UMESimdCompressAVX2.h"
+#include "../UMESimdPermuteAVX2.h"
 
 #if defined UME_USE_MASK_64B
     #define BLEND(a_256d, b_256d, mask_256i) _mm256_blendv_pd(a_256d, b_256d, _mm256_castsi256_pd(mask_256i))
+    #define MASK_LOAD(f64_addr, mask_256i) \
+        _mm256_maskload_pd(f64_addr, mask_256i)
     #define MASK_STORE(f64_addr, mask_256i, a_256d) \
         _mm256_maskstore_pd( \
             f64_addr, \
@@ -50,6 +55,9 @@
             a_256d, \
             b_256d, \
             _mm256_cvtepi32_pd(mask_128i))
+    #define MASK_LOAD(f64_addr, mask_128i) \
+        _mm256_maskload_pd( \
+            f64_addr, _mm256_cvtepi32_epi64(mask_128i))
     #define MASK_STORE(f64_addr, mask_128i, a_256d) \
         _mm256_maskstore_pd( \
             f64_addr, _mm256_cvtepi32_epi64(mask_128i), a_256d)
@@ -74,6 +82,10 @@ namespace SIMD {
             SIMDVec_f<double, 4>,
             SIMDVec_f<double, 2 >>
     {
+        friend class SIMDVec_u<uint64_t, 4>;
+        friend class SIMDVec_i<int64_t, 4>;
+        friend class SIMDVec_f<double, 8>;
+        friend class SIMDVec_f<double, 16>;
     private:
         __m256d mVec;
 
@@ -189,10 +201,35 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(double const * p, uint32_t count) {
+            __m256i t0 = _mm256_cmpgt_epi64(_mm256_set1_epi64x(count), _mm256_setr_epi64x(0, 1, 2, 3));
+            mVec = _mm256_maskload_pd(p, t0);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            AVX2::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            __m256d t2 = _mm256_loadu_pd(p + 8);
+            AVX2::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            __m256d t2 = _mm256_loadu_pd(p + 8);
+            __m256d t3 = _mm256_loadu_pd(p + 12);
+            AVX2::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
             mVec = _mm256_load_pd(p);
@@ -200,7 +237,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_load_pd(p);
+            __m256d t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -211,11 +248,44 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<4> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m256d t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_pd(p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE double* storeTail(double* p, uint32_t count) const {
+            __m256i t0 = _mm256_cmpgt_epi64(_mm256_set1_epi64x(count), _mm256_setr_epi64x(0, 1, 2, 3));
+            _mm256_maskstore_pd(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m256d t0, t1;
+            AVX2::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m256d t0, t1, t2;
+            AVX2::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            _mm256_storeu_pd(p + 8, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m256d t0, t1, t2, t3;
+            AVX2::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            _mm256_storeu_pd(p + 8, t2);
+            _mm256_storeu_pd(p + 12, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            AVX2::transpose4x4(v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE double* storea(double* p) const {
             _mm256_store_pd(p, mVec);
@@ -227,6 +297,50 @@ namespace SIMD {
             return p;
         }
         
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<4> const & mask) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256d t2 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), AVX2::compressPermutation(AVX2::widenBits64(t0))));
+            return SIMDVec_f(_mm256_and_pd(t2, _mm256_castsi256_pd(AVX2::firstLanes(2 * t1))));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, double * p) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256d t2 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), AVX2::compressPermutation(AVX2::widenBits64(t0))));
+            _mm256_maskstore_pd(p, AVX2::firstLanes(2 * t1), t2);
+            return t1;
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<4> const & mask, double const * p) {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256d t2 = _mm256_maskload_pd(p, AVX2::firstLanes(2 * t1));
+            __m256d t3 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(t2), AVX2::expandPermutation(AVX2::widenBits64(t0))));
+            mVec = BLEND(mVec, t3, mask.mMask);
+            return t1;
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            return SIMDVec_f(_mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), t0)));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            __m256d t1 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), t0));
+            return SIMDVec_f(BLEND(mVec, t1, mask.mMask));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            __m256d t1 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), t0));
+            __m256d t2 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(b.mVec), t0));
+            // Bit 2 of the index selects 'b'.
+            __m256d t3 = _mm256_castsi256_pd(_mm256_slli_epi64(indices.mVec, 61));
+            return SIMDVec_f(_mm256_blendv_pd(t1, t2, t3));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
             __m256d t0 = BLEND(mVec, b.mVec, mask.mMask);
@@ -735,7 +849,7 @@ namespace SIMD {
         //(Fused arithmetics)
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
+#if defined(__FMA__)
             __m256d t0 = _mm256_fmadd_pd(mVec, b.mVec, c.mVec);
 #else
             __m256d t0 = _mm256_add_pd(_mm256_mul_pd(mVec, b.mVec), c.mVec);
@@ -744,7 +858,7 @@ namespace SIMD {
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-#ifdef FMA
+#if defined(__FMA__)
             __m256d t0 = _mm256_fmadd_pd(mVec, b.mVec, c.mVec);
 #else
             __m256d t0 = _mm256_add_pd(_mm256_mul_pd(mVec, b.mVec), c.mVec);
@@ -752,12 +866,85 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
         }
-        // FMULSUBV  - Fused multiply and sub (A*B - C) with vectors
-        // MFMULSUBV - Masked fused multiply and sub (A*B - C) with vectors
-        // FADDMULV  - Fused add and multiply ((A + B)*C) with vectors
-        // MFADDMULV - Masked fused add and multiply ((A + B)*C) with vectors
-        // FSUBMULV  - Fused sub and multiply ((A - B)*C) with vectors
-        // MFSUBMULV - Masked fused sub and multiply ((A - B)*C) with vectors
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fmsub_pd(mVec, b.mVec, c.mVec);
+#else
+            __m256d t0 = _mm256_sub_pd(_mm256_mul_pd(mVec, b.mVec), c.mVec);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fmsub_pd(mVec, b.mVec, c.mVec);
+#else
+            __m256d t0 = _mm256_sub_pd(_mm256_mul_pd(mVec, b.mVec), c.mVec);
+#endif
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256d t0 = _mm256_mul_pd(_mm256_add_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256d t0 = _mm256_mul_pd(_mm256_add_pd(mVec, b.mVec), c.mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256d t0 = _mm256_mul_pd(_mm256_sub_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m256d t0 = _mm256_mul_pd(_mm256_sub_pd(mVec, b.mVec), c.mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fnmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m256d t0 = _mm256_sub_pd(c.mVec, _mm256_mul_pd(mVec, b.mVec));
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fnmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m256d t0 = _mm256_sub_pd(c.mVec, _mm256_mul_pd(mVec, b.mVec));
+#endif
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fnmsub_pd(mVec, b.mVec, c.mVec);
+#else
+            __m256d t0 = _mm256_xor_pd(_mm256_add_pd(_mm256_mul_pd(mVec, b.mVec), c.mVec), _mm256_set1_pd(-0.0));
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fnmsub_pd(mVec, b.mVec, c.mVec);
+#else
+            __m256d t0 = _mm256_xor_pd(_mm256_add_pd(_mm256_mul_pd(mVec, b.mVec), c.mVec), _mm256_set1_pd(-0.0));
+#endif
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
 
         // (Mathematical operations)
         // MAXV
@@ -930,6 +1117,22 @@ namespace SIMD {
         // MPOWV     - Masked power (exponents in vector)
         // POWS      - Power (exponent in scalar)
         // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -943,8 +1146,17 @@ namespace SIMD {
         }
         // TRUNC     - Truncate to integer (returns Signed integer vector)
         // MTRUNC    - Masked truncate to integer (returns Signed integer vector)
-        // FLOOR     - Floor
-        // MFLOOR    - Masked floor
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<4> const & mask) const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
         // ISFIN     - Is finite
@@ -973,6 +1185,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -993,16 +1213,28 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
 #if defined(UME_USE_SVML)
             __m256d t0 = _mm256_sin_pd(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<4>>(*this);
 #endif
         }
         // MSIN
@@ -1012,7 +1244,7 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
 #endif
         }
         // COS
@@ -1021,7 +1253,7 @@ namespace SIMD {
             __m256d t0 = _mm256_cos_pd(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<4>>(*this);
 #endif
         }
         // MCOS
@@ -1031,9 +1263,59 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+#endif
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+#if defined(UME_USE_SVML)
+            alignas(32) double raw_cos[4];
+            sinvec.mVec = _mm256_sincos_pd((__m256d*)raw_cos, mVec);
+            cosvec.mVec = _mm256_load_pd(raw_cos);
+#else
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<4>>(*this, sinvec, cosvec);
 #endif
         }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+#if defined(UME_USE_SVML)
+            alignas(32) double raw_cos[4];
+            __m256d t0 = _mm256_sincos_pd((__m256d*)raw_cos, mVec);
+            __m256d t1 = _mm256_load_pd(raw_cos);
+            sinvec.mVec = BLEND(mVec, t0, mask.mMask);
+            cosvec.mVec = BLEND(mVec, t1, mask.mMask);
+#else
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
+#endif
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
         // TAN       - Tangent
         // MTAN      - Masked tangent
         // CTAN      - Cotangent
@@ -1053,5 +1335,7 @@ namespace SIMD {
 }
 
 #undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
 
 #endif
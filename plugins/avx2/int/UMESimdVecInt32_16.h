@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
 
 namespace UME {
 namespace SIMD {
@@ -178,6 +179,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -187,12 +190,21 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            mVec[0] = _mm256_maskload_epi32((int const *)p, t1);
+            mVec[1] = _mm256_maskload_epi32((int const *)(p + 8), t2);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec[0] = _mm256_load_si256((__m256i *)p);
@@ -201,8 +213,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -233,6 +245,15 @@ namespace SIMD {
             _mm256_maskstore_epi32(p + 8, mask.mMask[1], mVec[1]);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            _mm256_maskstore_epi32((int *)p, t1, mVec[0]);
+            _mm256_maskstore_epi32((int *)(p + 8), t2, mVec[1]);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE int32_t* storea(int32_t * p) const {
             _mm256_store_si256((__m256i*)p, mVec[0]);
@@ -266,6 +287,59 @@ namespace SIMD {
         // SWIZZLE 
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            AVX2::sortNetwork16<int32_t, false>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t2, t3);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVec[0]);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVec[1]);
+            AVX2::sortNetwork16<int32_t, false>(t0, t1, t2, t3);
+            payload.mVec[0] = _mm256_castps_si256(t2);
+            payload.mVec[1] = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t4, t5);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            AVX2::sortNetwork16<int32_t, true>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t2, t3);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 16> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVec[0]);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVec[1]);
+            AVX2::sortNetwork16<int32_t, true>(t0, t1, t2, t3);
+            payload.mVec[0] = _mm256_castps_si256(t2);
+            payload.mVec[1] = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_i(t4, t5);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_add_epi32(mVec[0], b.mVec[0]);
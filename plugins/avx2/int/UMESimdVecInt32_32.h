@@ -233,16 +233,29 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<32> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 16));
-            __m256i t3 = _mm256_loadu_si256((__m256i*)(p + 24));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
+            __m256i t2 = _mm256_maskload_epi32((int const *)(p + 16), mask.mMask[2]);
+            __m256i t3 = _mm256_maskload_epi32((int const *)(p + 24), mask.mMask[3]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             mVec[2] = _mm256_blendv_epi8(mVec[2], t2, mask.mMask[2]);
             mVec[3] = _mm256_blendv_epi8(mVec[3], t3, mask.mMask[3]);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            __m256i t3 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(16, 17, 18, 19, 20, 21, 22, 23));
+            __m256i t4 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(24, 25, 26, 27, 28, 29, 30, 31));
+            mVec[0] = _mm256_maskload_epi32((int const *)p, t1);
+            mVec[1] = _mm256_maskload_epi32((int const *)(p + 8), t2);
+            mVec[2] = _mm256_maskload_epi32((int const *)(p + 16), t3);
+            mVec[3] = _mm256_maskload_epi32((int const *)(p + 24), t4);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec[0] = _mm256_load_si256((__m256i *)p);
@@ -253,10 +266,10 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<32> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 16));
-            __m256i t3 = _mm256_load_si256((__m256i*)(p + 24));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
+            __m256i t2 = _mm256_maskload_epi32((int const *)(p + 16), mask.mMask[2]);
+            __m256i t3 = _mm256_maskload_epi32((int const *)(p + 24), mask.mMask[3]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             mVec[2] = _mm256_blendv_epi8(mVec[2], t2, mask.mMask[2]);
@@ -273,18 +286,23 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<32> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            _mm256_storeu_si256((__m256i*)p, t1);
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_storeu_si256((__m256i*)(p + 8), t3);
-            __m256i t4 = _mm256_loadu_si256((__m256i*)(p + 16));
-            __m256i t5 = BLEND(t4, mVec[2], mask.mMask[2]);
-            _mm256_storeu_si256((__m256i*)(p + 16), t5);
-            __m256i t6 = _mm256_loadu_si256((__m256i*)(p + 24));
-            __m256i t7 = BLEND(t6, mVec[3], mask.mMask[3]);
-            _mm256_storeu_si256((__m256i*)(p + 24), t7);
+            _mm256_maskstore_epi32((int *)p, mask.mMask[0], mVec[0]);
+            _mm256_maskstore_epi32((int *)(p + 8), mask.mMask[1], mVec[1]);
+            _mm256_maskstore_epi32((int *)(p + 16), mask.mMask[2], mVec[2]);
+            _mm256_maskstore_epi32((int *)(p + 24), mask.mMask[3], mVec[3]);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            __m256i t3 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(16, 17, 18, 19, 20, 21, 22, 23));
+            __m256i t4 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(24, 25, 26, 27, 28, 29, 30, 31));
+            _mm256_maskstore_epi32((int *)p, t1, mVec[0]);
+            _mm256_maskstore_epi32((int *)(p + 8), t2, mVec[1]);
+            _mm256_maskstore_epi32((int *)(p + 16), t3, mVec[2]);
+            _mm256_maskstore_epi32((int *)(p + 24), t4, mVec[3]);
             return p;
         }
         // STOREA
@@ -297,18 +315,10 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<32> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            _mm256_store_si256((__m256i*)p, t1);
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_store_si256((__m256i*)(p + 8), t3);
-            __m256i t4 = _mm256_load_si256((__m256i*)(p + 16));
-            __m256i t5 = BLEND(t4, mVec[2], mask.mMask[2]);
-            _mm256_store_si256((__m256i*)(p + 16), t5);
-            __m256i t6 = _mm256_load_si256((__m256i*)(p + 24));
-            __m256i t7 = BLEND(t6, mVec[3], mask.mMask[3]);
-            _mm256_store_si256((__m256i*)(p + 24), t7);
+            _mm256_maskstore_epi32((int *)p, mask.mMask[0], mVec[0]);
+            _mm256_maskstore_epi32((int *)(p + 8), mask.mMask[1], mVec[1]);
+            _mm256_maskstore_epi32((int *)(p + 16), mask.mMask[2], mVec[2]);
+            _mm256_maskstore_epi32((int *)(p + 24), mask.mMask[3], mVec[3]);
             return p;
         }
 
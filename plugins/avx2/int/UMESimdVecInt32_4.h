@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
 
 #if defined UME_USE_MASK_64B
 #define BLEND(a_128i, b_128i, mask_256i) \
@@ -48,6 +49,15 @@
             0 \
             ))
 
+    #define MASK_LOAD(int32_addr, mask_256i) \
+        _mm_maskload_epi32( \
+            (int const *)(int32_addr), \
+            _mm256_extractf128_si256( \
+                _mm256_permutevar8x32_epi32( \
+                    mask_256i, \
+                    _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0)), \
+                0))
+
     #define MASK_STORE(int32_addr, mask_256i, a_128i) \
         _mm_maskstore_epi32( \
             int32_addr, \
@@ -60,6 +70,7 @@
             )
 #else
     #define BLEND(a_128i, b_128i, mask_128i) _mm_blendv_epi8(a_128i, b_128i, mask_128i)
+    #define MASK_LOAD(int32_addr, mask_128i) _mm_maskload_epi32((int const *)(int32_addr), mask_128i)
     #define MASK_STORE(int32_addr, mask_128i, a_128i) _mm_maskstore_epi32(int32_addr, mask_128i, a_128i)
 #endif
 
@@ -188,6 +199,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -196,10 +209,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int32_t const * p) {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            mVec = _mm_maskload_epi32((int const *)p, t0);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec = _mm_load_si128((__m128i*)p);
@@ -207,7 +226,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<4> const & mask, int32_t const * p) {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -221,6 +240,12 @@ namespace SIMD {
             MASK_STORE(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            _mm_maskstore_epi32((int *)p, t0, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE int32_t * storea(int32_t * p) const {
             _mm_store_si128((__m128i *)p, mVec);
@@ -246,6 +271,43 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX2::sortNetwork4<int32_t, false>(t0);
+            return SIMDVec_i(_mm_castps_si128(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX2::sortNetwork4<int32_t, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_i(_mm_castps_si128(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX2::sortNetwork4<int32_t, true>(t0);
+            return SIMDVec_i(_mm_castps_si128(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX2::sortNetwork4<int32_t, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_i(_mm_castps_si128(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -949,6 +1011,9 @@ namespace SIMD {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
         // MBANDV
         UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -961,6 +1026,9 @@ namespace SIMD {
             __m128i t1 = _mm_and_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator& (int32_t b) const {
+            return band(b);
+        }
         // MBANDS
         UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -973,6 +1041,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
         // MBANDVA
         UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -985,6 +1056,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int32_t b) {
+            return banda(b);
+        }
         // MBANDSA
         UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -997,6 +1071,9 @@ namespace SIMD {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
         // MBORV
         UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1009,6 +1086,9 @@ namespace SIMD {
             __m128i t1 = _mm_or_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator| (int32_t b) const {
+            return bor(b);
+        }
         // MBORS
         UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1021,6 +1101,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
         // MBORVA
         UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1033,6 +1116,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int32_t b) {
+            return bora(b);
+        }
         // MBORSA
         UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1045,6 +1131,9 @@ namespace SIMD {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
         // MBXORV
         UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1057,6 +1146,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int32_t b) const {
+            return bxor(b);
+        }
         // MBXORS
         UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1069,6 +1161,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
         // MBXORVA
         UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1081,6 +1176,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int32_t b) {
+            return bxora(b);
+        }
         // MBXORSA
         UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1094,6 +1192,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
         // MBNOT
         UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<4> const & mask) const {
             __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
@@ -1402,6 +1503,7 @@ namespace SIMD {
 }
 
 #undef BLEND
+#undef MASK_LOAD
 #undef MASK_STORE
 
 #endif
@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
+#include "../UMESimdCompressAVX2.h"
 
 namespace UME {
 namespace SIMD {
@@ -160,6 +162,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -168,10 +172,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            mVec = _mm256_maskload_epi32((int const *)p, t0);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec = _mm256_load_si256((__m256i *)p);
@@ -179,7 +189,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -201,9 +211,13 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<8> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*)p, t1);
+            _mm256_maskstore_epi32((int*) p, mask.mMask, mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            _mm256_maskstore_epi32((int*) p, t0, mVec);
             return p;
         }
         // STOREA
@@ -228,6 +242,47 @@ namespace SIMD {
             _mm256_stream_si256((__m256i*)p, t1);
             return p;
         }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<8> const & mask) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(t0));
+            return SIMDVec_i(_mm256_and_si256(t2, AVX2::firstLanes(t1)));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, int32_t * p) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(t0));
+            _mm256_maskstore_epi32((int *)p, AVX2::firstLanes(t1), t2);
+            return t1;
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, int32_t const * p) {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_maskload_epi32((int const *)p, AVX2::firstLanes(t1));
+            __m256i t3 = _mm256_permutevar8x32_epi32(t2, AVX2::expandPermutation(t0));
+            mVec = _mm256_blendv_epi8(mVec, t3, mask.mMask);
+            return t1;
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            return SIMDVec_i(_mm256_permutevar8x32_epi32(mVec, indices.mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, indices.mVec);
+            return SIMDVec_i(_mm256_blendv_epi8(mVec, t0, mask.mMask));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, indices.mVec);
+            __m256i t1 = _mm256_permutevar8x32_epi32(b.mVec, indices.mVec);
+            // Bit 3 of the index selects 'b'.
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec, 28));
+            return SIMDVec_i(_mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t1), t2)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
             __m256i t0 = _mm256_blendv_epi8(mVec, b.mVec, mask.mMask);
@@ -242,6 +297,43 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX2::sortNetwork8<int32_t, false>(t0);
+            return SIMDVec_i(_mm256_castps_si256(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX2::sortNetwork8<int32_t, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_i(_mm256_castps_si256(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX2::sortNetwork8<int32_t, true>(t0);
+            return SIMDVec_i(_mm256_castps_si256(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX2::sortNetwork8<int32_t, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_i(_mm256_castps_si256(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_add_epi32(mVec, b.mVec);
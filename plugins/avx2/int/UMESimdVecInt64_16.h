@@ -223,6 +223,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -234,16 +236,33 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_loadu_si256((__m256i*)(p + 12));
-
-            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask[0]);
-            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask[0]);
-            mVec[2] = BLEND_LO(mVec[2], t2, mask.mMask[1]);
-            mVec[3] = BLEND_HI(mVec[3], t3, mask.mMask[1]);
-
+            __m256i t0 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 0));
+            __m256i t1 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 1));
+            __m256i t2 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 0));
+            __m256i t3 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 1));
+            __m256i t4 = _mm256_maskload_epi64((long long const *)p, t0);
+            __m256i t5 = _mm256_maskload_epi64((long long const *)(p + 4), t1);
+            __m256i t6 = _mm256_maskload_epi64((long long const *)(p + 8), t2);
+            __m256i t7 = _mm256_maskload_epi64((long long const *)(p + 12), t3);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t4, t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t5, t1);
+            mVec[2] = _mm256_blendv_epi8(mVec[2], t6, t2);
+            mVec[3] = _mm256_blendv_epi8(mVec[3], t7, t3);
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int64_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            __m256i t3 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t1, 0));
+            __m256i t4 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t1, 1));
+            __m256i t5 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t2, 0));
+            __m256i t6 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t2, 1));
+            mVec[0] = _mm256_maskload_epi64((long long const *)p, t3);
+            mVec[1] = _mm256_maskload_epi64((long long const *)(p + 4), t4);
+            mVec[2] = _mm256_maskload_epi64((long long const *)(p + 8), t5);
+            mVec[3] = _mm256_maskload_epi64((long long const *)(p + 12), t6);
             return *this;
         }
         // LOADA
@@ -256,14 +275,18 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_load_si256((__m256i*)(p + 12));
-            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask[0]);
-            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask[0]);
-            mVec[2] = BLEND_LO(mVec[2], t2, mask.mMask[1]);
-            mVec[3] = BLEND_HI(mVec[3], t3, mask.mMask[1]);
+            __m256i t0 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 0));
+            __m256i t1 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 1));
+            __m256i t2 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 0));
+            __m256i t3 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 1));
+            __m256i t4 = _mm256_maskload_epi64((long long const *)p, t0);
+            __m256i t5 = _mm256_maskload_epi64((long long const *)(p + 4), t1);
+            __m256i t6 = _mm256_maskload_epi64((long long const *)(p + 8), t2);
+            __m256i t7 = _mm256_maskload_epi64((long long const *)(p + 12), t3);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t4, t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t5, t1);
+            mVec[2] = _mm256_blendv_epi8(mVec[2], t6, t2);
+            mVec[3] = _mm256_blendv_epi8(mVec[3], t7, t3);
             return *this;
         }
         // STORE
@@ -276,18 +299,29 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<16> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_loadu_si256((__m256i*)(p + 12));
-            __m256i t4 = BLEND_LO(t0, mVec[0], mask.mMask[0]);
-            __m256i t5 = BLEND_HI(t1, mVec[1], mask.mMask[0]);
-            __m256i t6 = BLEND_LO(t2, mVec[2], mask.mMask[1]);
-            __m256i t7 = BLEND_HI(t3, mVec[3], mask.mMask[1]);
-            _mm256_storeu_si256((__m256i*) p, t4);
-            _mm256_storeu_si256((__m256i*) (p + 4), t5);
-            _mm256_storeu_si256((__m256i*) (p + 8), t6);
-            _mm256_storeu_si256((__m256i*) (p + 12), t7);
+            __m256i t0 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 0));
+            __m256i t1 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 1));
+            __m256i t2 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 0));
+            __m256i t3 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 1));
+            _mm256_maskstore_epi64((long long *)p, t0, mVec[0]);
+            _mm256_maskstore_epi64((long long *)(p + 4), t1, mVec[1]);
+            _mm256_maskstore_epi64((long long *)(p + 8), t2, mVec[2]);
+            _mm256_maskstore_epi64((long long *)(p + 12), t3, mVec[3]);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int64_t * storeTail(int64_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            __m256i t3 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t1, 0));
+            __m256i t4 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t1, 1));
+            __m256i t5 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t2, 0));
+            __m256i t6 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(t2, 1));
+            _mm256_maskstore_epi64((long long *)p, t3, mVec[0]);
+            _mm256_maskstore_epi64((long long *)(p + 4), t4, mVec[1]);
+            _mm256_maskstore_epi64((long long *)(p + 8), t5, mVec[2]);
+            _mm256_maskstore_epi64((long long *)(p + 12), t6, mVec[3]);
             return p;
         }
         // STOREA
@@ -300,18 +334,14 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<16> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_load_si256((__m256i*)(p + 12));
-            __m256i t4 = BLEND_LO(t0, mVec[0], mask.mMask[0]);
-            __m256i t5 = BLEND_HI(t1, mVec[1], mask.mMask[0]);
-            __m256i t6 = BLEND_LO(t2, mVec[2], mask.mMask[1]);
-            __m256i t7 = BLEND_HI(t3, mVec[3], mask.mMask[1]);
-            _mm256_store_si256((__m256i*) p, t4);
-            _mm256_store_si256((__m256i*) (p + 4), t5);
-            _mm256_store_si256((__m256i*) (p + 8), t6);
-            _mm256_store_si256((__m256i*) (p + 12), t7);
+            __m256i t0 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 0));
+            __m256i t1 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[0], 1));
+            __m256i t2 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 0));
+            __m256i t3 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask.mMask[1], 1));
+            _mm256_maskstore_epi64((long long *)p, t0, mVec[0]);
+            _mm256_maskstore_epi64((long long *)(p + 4), t1, mVec[1]);
+            _mm256_maskstore_epi64((long long *)(p + 8), t2, mVec[2]);
+            _mm256_maskstore_epi64((long long *)(p + 12), t3, mVec[3]);
             return p;
         }
 
@@ -35,6 +35,9 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdIntrinsicsAVX2.h"
+#include "../UMESimdCompressAVX2.h"
+#include "../UMESimdPermuteAVX2.h"
 
 
 #if defined (_MSC_VER) && !defined (__x86_64__)
@@ -54,8 +57,12 @@
 
 #if defined UME_USE_MASK_64B
     #define BLEND(a_256i, b_256i, mask_256i) _mm256_blendv_epi8(a_256i, b_256i, mask_256i)
+    #define MASK_LOAD(ptr_i64, mask_256i) _mm256_maskload_epi64((long long const *)ptr_i64, mask_256i)
+    #define MASK_STORE(ptr_i64, mask_256i, a_256i) _mm256_maskstore_epi64((long long *)ptr_i64, mask_256i, a_256i)
 #else
     #define BLEND(a_256i, b_256i, mask_128i) _mm256_blendv_epi8(a_256i, b_256i, _mm256_cvtepi32_epi64(mask_128i))
+    #define MASK_LOAD(ptr_i64, mask_128i) _mm256_maskload_epi64((long long const *)ptr_i64, _mm256_cvtepi32_epi64(mask_128i))
+    #define MASK_STORE(ptr_i64, mask_128i, a_256i) _mm256_maskstore_epi64((long long *)ptr_i64, _mm256_cvtepi32_epi64(mask_128i), a_256i)
 #endif
 
 namespace UME {
@@ -80,6 +87,7 @@ namespace SIMD {
         friend class SIMDVec_f<double, 4>;
 
         friend class SIMDVec_i<int64_t, 8>;
+        friend class FUNCTIONS::Divisor<SIMDVec_i<int64_t, 4>>;
     private:
         __m256i mVec;
 
@@ -183,6 +191,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -191,10 +201,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int64_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_cmpgt_epi64(SET1_EPI64(count), _mm256_setr_epi64x(0, 1, 2, 3));
+            mVec = _mm256_maskload_epi64((long long const *)p, t0);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int64_t const * p) {
             mVec = _mm256_load_si256((__m256i*)p);
@@ -202,7 +218,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -213,9 +229,13 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*) p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int64_t * storeTail(int64_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_cmpgt_epi64(SET1_EPI64(count), _mm256_setr_epi64x(0, 1, 2, 3));
+            _mm256_maskstore_epi64((long long *)p, t0, mVec);
             return p;
         }
         // STOREA
@@ -225,12 +245,54 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i*) p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
             return p;
         }
 
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<4> const & mask) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(AVX2::widenBits64(t0)));
+            return SIMDVec_i(_mm256_and_si256(t2, AVX2::firstLanes(2 * t1)));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, int64_t * p) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(AVX2::widenBits64(t0)));
+            _mm256_maskstore_epi64((long long *)p, AVX2::firstLanes(2 * t1), t2);
+            return t1;
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<4> const & mask, int64_t const * p) {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_maskload_epi64((long long const *)p, AVX2::firstLanes(2 * t1));
+            __m256i t3 = _mm256_permutevar8x32_epi32(t2, AVX2::expandPermutation(AVX2::widenBits64(t0)));
+            mVec = BLEND(mVec, t3, mask.mMask);
+            return t1;
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            return SIMDVec_i(_mm256_permutevar8x32_epi32(mVec, t0));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, t0);
+            return SIMDVec_i(BLEND(mVec, t1, mask.mMask));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(b.mVec, t0);
+            // Bit 2 of the index selects 'b'.
+            __m256d t3 = _mm256_castsi256_pd(_mm256_slli_epi64(indices.mVec, 61));
+            return SIMDVec_i(_mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t1), _mm256_castsi256_pd(t2), t3)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m256i t0 = BLEND(mVec, b.mVec, mask.mMask);
@@ -416,21 +478,114 @@ namespace SIMD {
         // PREFDEC
         // MPREFDEC
         // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
         // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int64_t b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int64_t b) const {
+            return mul(b);
+        }
         // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec = AVX2::mullo_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
         // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = AVX2::mullo_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int64_t b) {
+            mVec = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int64_t b) {
+            return mula(b);
+        }
         // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // There is no vector division instruction. Element-wise division by a
+        // vector stays emulated, but DIVS variants divide by a precomputed
+        // reciprocal of the scalar.
         // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            return SCALAR_EMULATION::div<SIMDVec_i>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            return SCALAR_EMULATION::div<SIMDVec_i, SIMDVecMask<4>>(mask, *this, b);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int64_t b) const {
+            __m256i t0 = AVX2::DivisorI64(b).divide(mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (int64_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = AVX2::DivisorI64(b).divide(mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            return SCALAR_EMULATION::divAssign<SIMDVec_i>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            return SCALAR_EMULATION::divAssign<SIMDVec_i, SIMDVecMask<4>>(mask, *this, b);
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int64_t b) {
+            mVec = AVX2::DivisorI64(b).divide(mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (int64_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = AVX2::DivisorI64(b).divide(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -609,10 +764,33 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 4>() const;
     };
 
+namespace FUNCTIONS {
+
+    // Keeps the reciprocal computed by AVX2::DivisorI64 for all divisions.
+    template<>
+    class Divisor<SIMDVec_i<int64_t, 4>> {
+    private:
+        AVX2::DivisorI64 mDivisor;
+
+    public:
+        UME_FORCE_INLINE explicit Divisor(int64_t d) : mDivisor(d) {}
+
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 4> divide(SIMDVec_i<int64_t, 4> const & src) const {
+            return SIMDVec_i<int64_t, 4>(mDivisor.divide(src.mVec));
+        }
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 4> divide(SIMDVecMask<4> const & mask, SIMDVec_i<int64_t, 4> const & src) const {
+            return src.blend(mask, divide(src));
+        }
+    };
+
+}
+
 }
 }
 
 #undef SET1_EPI64
 #undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
 
 #endif
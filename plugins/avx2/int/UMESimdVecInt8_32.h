@@ -0,0 +1,1664 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+#ifndef UME_SIMD_VEC_INT8_32_H_
+#define UME_SIMD_VEC_INT8_32_H_
+
+#include <type_traits>
+#include <limits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int8_t, 32> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int8_t, 32>,
+            SIMDVec_u<uint8_t, 32>,
+            int8_t,
+            32,
+            uint8_t,
+            SIMDVecMask<32>,
+            SIMDSwizzle<32>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int8_t, 32>,
+            SIMDVec_i<int8_t, 16>>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint8_t, 32>;
+    private:
+        __m256i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 32; }
+        constexpr static uint32_t alignment() { return 32; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int8_t i) {
+            mVec = _mm256_set1_epi8(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i,
+            typename std::enable_if< std::is_fundamental<T>::value &&
+                                    !std::is_same<T, int8_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int8_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int8_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int8_t i0, int8_t i1, int8_t i2, int8_t i3, int8_t i4, int8_t i5, int8_t i6, int8_t i7,
+                                   int8_t i8, int8_t i9, int8_t i10, int8_t i11, int8_t i12, int8_t i13, int8_t i14, int8_t i15,
+                                   int8_t i16, int8_t i17, int8_t i18, int8_t i19, int8_t i20, int8_t i21, int8_t i22, int8_t i23,
+                                   int8_t i24, int8_t i25, int8_t i26, int8_t i27, int8_t i28, int8_t i29, int8_t i30, int8_t i31)
+        {
+            mVec = _mm256_setr_epi8(i0, i1, i2, i3, i4, i5, i6, i7,
+                                    i8, i9, i10, i11, i12, i13, i14, i15,
+                                    i16, i17, i18, i19, i20, i21, i22, i23,
+                                    i24, i25, i26, i27, i28, i29, i30, i31);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int8_t extract(uint32_t index) const {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int8_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int8_t value) {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm256_load_si256((__m256i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int8_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int8_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<32>> operator() (SIMDVecMask<32> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<32>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<32>> operator[] (SIMDVecMask<32> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<32>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            mVec = _mm256_blendv_epi8(mVec, b.mVec, mask.toEpi8());
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int8_t b) {
+            mVec = _mm256_set1_epi8(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int8_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int8_t const * p) {
+            mVec = _mm256_loadu_si256((__m256i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<32> const & mask, int8_t const * p) {
+            // Doublewords with every element active go through a masked load,
+            // the remaining active elements are read one by one. Inactive
+            // elements are never touched.
+            __m256i t0 = mask.toEpi8();
+            __m256i t1 = _mm256_cmpeq_epi32(t0, _mm256_set1_epi32(-1));
+            __m256i t2 = _mm256_maskload_epi32((int const *)p, t1);
+            mVec = _mm256_blendv_epi8(mVec, t2, t1);
+            uint32_t t3 = uint32_t(_mm256_movemask_epi8(_mm256_andnot_si256(t1, t0)));
+            if (t3 != 0) {
+                alignas(32) int8_t raw[32];
+                _mm256_store_si256((__m256i *)raw, mVec);
+                for (int i = 0; i < 32; i++) {
+                    if ((t3 >> (i)) & 1) raw[i] = p[i];
+                }
+                mVec = _mm256_load_si256((__m256i *)raw);
+            }
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int8_t const * p, uint32_t count) {
+            uint32_t t0 = count < 32 ? count : 32;
+            __m256i t1 = _mm256_cmpgt_epi32(_mm256_set1_epi32(t0 / 4), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            mVec = _mm256_maskload_epi32((int const *)p, t1);
+            if ((t0 % 4) != 0) {
+                alignas(32) int8_t raw[32];
+                _mm256_store_si256((__m256i *)raw, mVec);
+                for (uint32_t i = t0 - t0 % 4; i < t0; i++) raw[i] = p[i];
+                mVec = _mm256_load_si256((__m256i *)raw);
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int8_t const * p) {
+            mVec = _mm256_load_si256((__m256i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<32> const & mask, int8_t const * p) {
+            return load(mask, p);
+        }
+        // STORE
+        UME_FORCE_INLINE int8_t * store(int8_t * p) const {
+            _mm256_storeu_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int8_t * store(SIMDVecMask<32> const & mask, int8_t * p) const {
+            // Same split as MLOAD: memory of inactive elements is left alone.
+            __m256i t0 = mask.toEpi8();
+            __m256i t1 = _mm256_cmpeq_epi32(t0, _mm256_set1_epi32(-1));
+            _mm256_maskstore_epi32((int *)p, t1, mVec);
+            uint32_t t2 = uint32_t(_mm256_movemask_epi8(_mm256_andnot_si256(t1, t0)));
+            if (t2 != 0) {
+                alignas(32) int8_t raw[32];
+                _mm256_store_si256((__m256i *)raw, mVec);
+                for (int i = 0; i < 32; i++) {
+                    if ((t2 >> (i)) & 1) p[i] = raw[i];
+                }
+            }
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int8_t * storeTail(int8_t * p, uint32_t count) const {
+            uint32_t t0 = count < 32 ? count : 32;
+            __m256i t1 = _mm256_cmpgt_epi32(_mm256_set1_epi32(t0 / 4), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            _mm256_maskstore_epi32((int *)p, t1, mVec);
+            if ((t0 % 4) != 0) {
+                alignas(32) int8_t raw[32];
+                _mm256_store_si256((__m256i *)raw, mVec);
+                for (uint32_t i = t0 - t0 % 4; i < t0; i++) p[i] = raw[i];
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int8_t * storea(int8_t * p) const {
+            _mm256_store_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int8_t * storea(SIMDVecMask<32> const & mask, int8_t * p) const {
+            return store(mask, p);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_blendv_epi8(mVec, b.mVec, mask.toEpi8());
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_blendv_epi8(mVec, _mm256_set1_epi8(b), mask.toEpi8());
+            return SIMDVec_i(t0);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_add_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_add_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_add_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int8_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_add_epi8(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm256_add_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_add_epi8(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int8_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_add_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_adds_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_adds_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_adds_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_adds_epi8(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = _mm256_adds_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_adds_epi8(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_adds_epi8(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_adds_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m256i t0 = _mm256_set1_epi8(1);
+            __m256i t1 = mVec;
+            mVec = _mm256_add_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_set1_epi8(1);
+            __m256i t1 = mVec;
+            __m256i t2 = _mm256_add_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t2, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m256i t0 = _mm256_set1_epi8(1);
+            mVec = _mm256_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_set1_epi8(1);
+            __m256i t1 = _mm256_add_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_sub_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int8_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_sub_epi8(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm256_sub_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_sub_epi8(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int8_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_sub_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_subs_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_subs_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_subs_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_subs_epi8(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = _mm256_subs_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_subs_epi8(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_subs_epi8(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_subs_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi8(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi8(b.mVec, mVec);
+            __m256i t1 = _mm256_blendv_epi8(b.mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int8_t b) const {
+            __m256i t0 = _mm256_sub_epi8(_mm256_set1_epi8(b), mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_sub_epi8(t0, mVec);
+            __m256i t2 = _mm256_blendv_epi8(t0, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm256_sub_epi8(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_sub_epi8(b.mVec, mVec);
+            mVec = _mm256_blendv_epi8(b.mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int8_t b) {
+            mVec = _mm256_sub_epi8(_mm256_set1_epi8(b), mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_sub_epi8(t0, mVec);
+            mVec = _mm256_blendv_epi8(t0, t1, mask.toEpi8());
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m256i t0 = _mm256_set1_epi8(1);
+            __m256i t1 = mVec;
+            mVec = _mm256_sub_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_set1_epi8(1);
+            __m256i t1 = mVec;
+            __m256i t2 = _mm256_sub_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t2, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m256i t0 = _mm256_set1_epi8(1);
+            mVec = _mm256_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_set1_epi8(1);
+            __m256i t1 = _mm256_sub_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(b.mVec, 8));
+            __m256i t2 = _mm256_or_si256(_mm256_and_si256(t0, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t1, 8));
+            return SIMDVec_i(t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(b.mVec, 8));
+            __m256i t2 = _mm256_or_si256(_mm256_and_si256(t0, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t1, 8));
+            __m256i t3 = _mm256_blendv_epi8(mVec, t2, mask.toEpi8());
+            return SIMDVec_i(t3);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec, t0);
+            __m256i t2 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(t0, 8));
+            __m256i t3 = _mm256_or_si256(_mm256_and_si256(t1, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t2, 8));
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int8_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec, t0);
+            __m256i t2 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(t0, 8));
+            __m256i t3 = _mm256_or_si256(_mm256_and_si256(t1, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t2, 8));
+            __m256i t4 = _mm256_blendv_epi8(mVec, t3, mask.toEpi8());
+            return SIMDVec_i(t4);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(b.mVec, 8));
+            mVec = _mm256_or_si256(_mm256_and_si256(t0, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t1, 8));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(b.mVec, 8));
+            __m256i t2 = _mm256_or_si256(_mm256_and_si256(t0, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t1, 8));
+            mVec = _mm256_blendv_epi8(mVec, t2, mask.toEpi8());
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec, t0);
+            __m256i t2 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(t0, 8));
+            mVec = _mm256_or_si256(_mm256_and_si256(t1, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t2, 8));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int8_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec, t0);
+            __m256i t2 = _mm256_mullo_epi16(_mm256_srli_epi16(mVec, 8), _mm256_srli_epi16(t0, 8));
+            __m256i t3 = _mm256_or_si256(_mm256_and_si256(t1, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(t2, 8));
+            mVec = _mm256_blendv_epi8(mVec, t3, mask.toEpi8());
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpeq(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi8(mVec, b.mVec);
+            return SIMDVecMask<32>::fromEpi8(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<32> cmpeq(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<32>::fromEpi8(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator== (int8_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpne(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<32>::fromEpi8(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<32> cmpne(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_cmpeq_epi8(mVec, t0);
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<32>::fromEpi8(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator!= (int8_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpgt(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi8(mVec, b.mVec);
+            return SIMDVecMask<32>::fromEpi8(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<32> cmpgt(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_cmpgt_epi8(mVec, t0);
+            return SIMDVecMask<32>::fromEpi8(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator> (int8_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<32> cmplt(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi8(b.mVec, mVec);
+            return SIMDVecMask<32>::fromEpi8(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<32> cmplt(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_cmpgt_epi8(t0, mVec);
+            return SIMDVecMask<32>::fromEpi8(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator< (int8_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpge(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_max_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<32>::fromEpi8(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<32> cmpge(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_max_epi8(mVec, t0);
+            __m256i t2 = _mm256_cmpeq_epi8(mVec, t1);
+            return SIMDVecMask<32>::fromEpi8(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator>= (int8_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmple(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_min_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<32>::fromEpi8(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<32> cmple(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_min_epi8(mVec, t0);
+            __m256i t2 = _mm256_cmpeq_epi8(mVec, t1);
+            return SIMDVecMask<32>::fromEpi8(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator<= (int8_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpeq_epi8(mVec, b.mVec);
+            return _mm256_movemask_epi8(m0) == int(0xFFFFFFFF);
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i m0 = _mm256_cmpeq_epi8(mVec, t0);
+            return _mm256_movemask_epi8(m0) == int(0xFFFFFFFF);
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i *)raw, mVec);
+            for (unsigned int i = 0; i < 32 - 1; i++) {
+                for (unsigned int j = i + 1; j < 32; j++) {
+                    if (raw[i] == raw[j]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        // HADD
+        UME_FORCE_INLINE int8_t hadd() const {
+            __m256i t0 = _mm256_sad_epu8(mVec, _mm256_setzero_si256());
+            __m128i t1 = _mm_add_epi64(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_add_epi64(t1, _mm_unpackhi_epi64(t1, t1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHADD
+        UME_FORCE_INLINE int8_t hadd(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_blendv_epi8(_mm256_setzero_si256(), mVec, mask.toEpi8());
+            __m256i t1 = _mm256_sad_epu8(t0, _mm256_setzero_si256());
+            __m128i t2 = _mm_add_epi64(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_add_epi64(t2, _mm_unpackhi_epi64(t2, t2));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t3));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int8_t hadd(int8_t b) const {
+            return int8_t(hadd() + b);
+        }
+        // MHADDS
+        UME_FORCE_INLINE int8_t hadd(SIMDVecMask<32> const & mask, int8_t b) const {
+            return int8_t(hadd(mask) + b);
+        }
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+        // FMULADDV
+        // MFMULADDV
+        // FMULSUBV
+        // MFMULSUBV
+        // FADDMULV
+        // MFADDMULV
+        // FSUBMULV
+        // MFSUBMULV
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_max_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_max_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_max_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_max_epi8(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = _mm256_max_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_max_epi8(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_max_epi8(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_max_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_min_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_min_epi8(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_min_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_min_epi8(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = _mm256_min_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_min_epi8(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_min_epi8(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_min_epi8(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int8_t hmax() const {
+            __m128i t0 = _mm_max_epi8(_mm256_castsi256_si128(mVec), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_max_epi8(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_max_epi8(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_max_epi8(t2, _mm_srli_si128(t2, 2));
+            __m128i t4 = _mm_max_epi8(t3, _mm_srli_si128(t3, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t4));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int8_t hmax(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_set1_epi8(std::numeric_limits<int8_t>::lowest());
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.toEpi8());
+            __m128i t2 = _mm_max_epi8(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_max_epi8(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_max_epi8(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_max_epi8(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_max_epi8(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t6));
+            return retval;
+        }
+        // HMAXS
+        UME_FORCE_INLINE int8_t hmax(int8_t b) const {
+            int8_t retval = hmax();
+            return retval > b ? retval : b;
+        }
+        // MHMAXS
+        UME_FORCE_INLINE int8_t hmax(SIMDVecMask<32> const & mask, int8_t b) const {
+            int8_t retval = hmax(mask);
+            return retval > b ? retval : b;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int8_t hmin() const {
+            __m128i t0 = _mm_min_epi8(_mm256_castsi256_si128(mVec), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_min_epi8(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_min_epi8(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_min_epi8(t2, _mm_srli_si128(t2, 2));
+            __m128i t4 = _mm_min_epi8(t3, _mm_srli_si128(t3, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t4));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int8_t hmin(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_set1_epi8(std::numeric_limits<int8_t>::max());
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.toEpi8());
+            __m128i t2 = _mm_min_epi8(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_min_epi8(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_min_epi8(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_min_epi8(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_min_epi8(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t6));
+            return retval;
+        }
+        // HMINS
+        UME_FORCE_INLINE int8_t hmin(int8_t b) const {
+            int8_t retval = hmin();
+            return retval < b ? retval : b;
+        }
+        // MHMINS
+        UME_FORCE_INLINE int8_t hmin(SIMDVecMask<32> const & mask, int8_t b) const {
+            int8_t retval = hmin(mask);
+            return retval < b ? retval : b;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int8_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm256_and_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_and_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int8_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int8_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm256_or_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_or_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int8_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int8_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<32> const & mask, int8_t b) const {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm256_xor_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = _mm256_xor_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int8_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<32> const & mask, int8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return SIMDVec_i(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            mVec = _mm256_xor_si256(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.toEpi8());
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int8_t hband() const {
+            __m128i t0 = _mm_and_si128(_mm256_castsi256_si128(mVec), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 2));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t4));
+            return retval;
+        }
+        // MHBAND
+        UME_FORCE_INLINE int8_t hband(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.toEpi8());
+            __m128i t2 = _mm_and_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_and_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t6));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int8_t hband(int8_t b) const {
+            int8_t retval = hband();
+            return retval & b;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int8_t hband(SIMDVecMask<32> const & mask, int8_t b) const {
+            int8_t retval = hband(mask);
+            return retval & b;
+        }
+        // HBOR
+        UME_FORCE_INLINE int8_t hbor() const {
+            __m128i t0 = _mm_or_si128(_mm256_castsi256_si128(mVec), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 2));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t4));
+            return retval;
+        }
+        // MHBOR
+        UME_FORCE_INLINE int8_t hbor(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.toEpi8());
+            __m128i t2 = _mm_or_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_or_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t6));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int8_t hbor(int8_t b) const {
+            int8_t retval = hbor();
+            return retval | b;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int8_t hbor(SIMDVecMask<32> const & mask, int8_t b) const {
+            int8_t retval = hbor(mask);
+            return retval | b;
+        }
+        // HBXOR
+        UME_FORCE_INLINE int8_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(_mm256_castsi256_si128(mVec), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 2));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t4));
+            return retval;
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int8_t hbxor(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.toEpi8());
+            __m128i t2 = _mm_xor_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_xor_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_cvtsi128_si32(t6));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int8_t hbxor(int8_t b) const {
+            int8_t retval = hbxor();
+            return retval ^ b;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int8_t hbxor(SIMDVecMask<32> const & mask, int8_t b) const {
+            int8_t retval = hbxor(mask);
+            return retval ^ b;
+        }
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint8_t, 32> const & b) const {
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF << 4)));
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, _mm256_slli_epi16(b.mVec, 5));
+            __m256i t2 = _mm256_and_si256(_mm256_sll_epi16(t1, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF << 2)));
+            __m256i t3 = _mm256_blendv_epi8(t1, t2, _mm256_slli_epi16(b.mVec, 6));
+            __m256i t4 = _mm256_and_si256(_mm256_sll_epi16(t3, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF << 1)));
+            __m256i t5 = _mm256_blendv_epi8(t3, t4, _mm256_slli_epi16(b.mVec, 7));
+            __m256i t6 = _mm256_cmpeq_epi8(_mm256_min_epu8(b.mVec, _mm256_set1_epi8(7)), b.mVec);
+            __m256i t7 = _mm256_and_si256(t5, t6);
+            return SIMDVec_i(t7);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint8_t, 32> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<32> const & mask, SIMDVec_u<uint8_t, 32> const & b) const {
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF << 4)));
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, _mm256_slli_epi16(b.mVec, 5));
+            __m256i t2 = _mm256_and_si256(_mm256_sll_epi16(t1, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF << 2)));
+            __m256i t3 = _mm256_blendv_epi8(t1, t2, _mm256_slli_epi16(b.mVec, 6));
+            __m256i t4 = _mm256_and_si256(_mm256_sll_epi16(t3, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF << 1)));
+            __m256i t5 = _mm256_blendv_epi8(t3, t4, _mm256_slli_epi16(b.mVec, 7));
+            __m256i t6 = _mm256_cmpeq_epi8(_mm256_min_epu8(b.mVec, _mm256_set1_epi8(7)), b.mVec);
+            __m256i t7 = _mm256_and_si256(t5, t6);
+            __m256i t8 = _mm256_blendv_epi8(mVec, t7, mask.toEpi8());
+            return SIMDVec_i(t8);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint8_t b) const {
+            uint32_t c = b < 8 ? b : 8;
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF << c)));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint8_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<32> const & mask, uint8_t b) const {
+            uint32_t c = b < 8 ? b : 8;
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF << c)));
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint8_t, 32> const & b) {
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF << 4)));
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, _mm256_slli_epi16(b.mVec, 5));
+            __m256i t2 = _mm256_and_si256(_mm256_sll_epi16(t1, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF << 2)));
+            __m256i t3 = _mm256_blendv_epi8(t1, t2, _mm256_slli_epi16(b.mVec, 6));
+            __m256i t4 = _mm256_and_si256(_mm256_sll_epi16(t3, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF << 1)));
+            __m256i t5 = _mm256_blendv_epi8(t3, t4, _mm256_slli_epi16(b.mVec, 7));
+            __m256i t6 = _mm256_cmpeq_epi8(_mm256_min_epu8(b.mVec, _mm256_set1_epi8(7)), b.mVec);
+            __m256i t7 = _mm256_and_si256(t5, t6);
+            mVec = t7;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint8_t, 32> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<32> const & mask, SIMDVec_u<uint8_t, 32> const & b) {
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF << 4)));
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, _mm256_slli_epi16(b.mVec, 5));
+            __m256i t2 = _mm256_and_si256(_mm256_sll_epi16(t1, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF << 2)));
+            __m256i t3 = _mm256_blendv_epi8(t1, t2, _mm256_slli_epi16(b.mVec, 6));
+            __m256i t4 = _mm256_and_si256(_mm256_sll_epi16(t3, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF << 1)));
+            __m256i t5 = _mm256_blendv_epi8(t3, t4, _mm256_slli_epi16(b.mVec, 7));
+            __m256i t6 = _mm256_cmpeq_epi8(_mm256_min_epu8(b.mVec, _mm256_set1_epi8(7)), b.mVec);
+            __m256i t7 = _mm256_and_si256(t5, t6);
+            mVec = _mm256_blendv_epi8(mVec, t7, mask.toEpi8());
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint8_t b) {
+            uint32_t c = b < 8 ? b : 8;
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF << c)));
+            mVec = t0;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint8_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<32> const & mask, uint8_t b) {
+            uint32_t c = b < 8 ? b : 8;
+            __m256i t0 = _mm256_and_si256(_mm256_sll_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF << c)));
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint8_t, 32> const & b) const {
+            __m256i t0 = _mm256_min_epu8(b.mVec, _mm256_set1_epi8(7));
+            __m256i t1 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF >> 4)));
+            __m256i t2 = _mm256_set1_epi8(uint8_t(0x80 >> 4));
+            __m256i t3 = _mm256_sub_epi8(_mm256_xor_si256(t1, t2), t2);
+            __m256i t4 = _mm256_blendv_epi8(mVec, t3, _mm256_slli_epi16(t0, 5));
+            __m256i t5 = _mm256_and_si256(_mm256_srl_epi16(t4, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF >> 2)));
+            __m256i t6 = _mm256_set1_epi8(uint8_t(0x80 >> 2));
+            __m256i t7 = _mm256_sub_epi8(_mm256_xor_si256(t5, t6), t6);
+            __m256i t8 = _mm256_blendv_epi8(t4, t7, _mm256_slli_epi16(t0, 6));
+            __m256i t9 = _mm256_and_si256(_mm256_srl_epi16(t8, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF >> 1)));
+            __m256i t10 = _mm256_set1_epi8(uint8_t(0x80 >> 1));
+            __m256i t11 = _mm256_sub_epi8(_mm256_xor_si256(t9, t10), t10);
+            __m256i t12 = _mm256_blendv_epi8(t8, t11, _mm256_slli_epi16(t0, 7));
+            return SIMDVec_i(t12);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint8_t, 32> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<32> const & mask, SIMDVec_u<uint8_t, 32> const & b) const {
+            __m256i t0 = _mm256_min_epu8(b.mVec, _mm256_set1_epi8(7));
+            __m256i t1 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF >> 4)));
+            __m256i t2 = _mm256_set1_epi8(uint8_t(0x80 >> 4));
+            __m256i t3 = _mm256_sub_epi8(_mm256_xor_si256(t1, t2), t2);
+            __m256i t4 = _mm256_blendv_epi8(mVec, t3, _mm256_slli_epi16(t0, 5));
+            __m256i t5 = _mm256_and_si256(_mm256_srl_epi16(t4, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF >> 2)));
+            __m256i t6 = _mm256_set1_epi8(uint8_t(0x80 >> 2));
+            __m256i t7 = _mm256_sub_epi8(_mm256_xor_si256(t5, t6), t6);
+            __m256i t8 = _mm256_blendv_epi8(t4, t7, _mm256_slli_epi16(t0, 6));
+            __m256i t9 = _mm256_and_si256(_mm256_srl_epi16(t8, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF >> 1)));
+            __m256i t10 = _mm256_set1_epi8(uint8_t(0x80 >> 1));
+            __m256i t11 = _mm256_sub_epi8(_mm256_xor_si256(t9, t10), t10);
+            __m256i t12 = _mm256_blendv_epi8(t8, t11, _mm256_slli_epi16(t0, 7));
+            __m256i t13 = _mm256_blendv_epi8(mVec, t12, mask.toEpi8());
+            return SIMDVec_i(t13);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint8_t b) const {
+            uint32_t c = b < 7 ? b : 7;
+            __m256i t0 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF >> c)));
+            __m256i t1 = _mm256_set1_epi8(uint8_t(0x80 >> c));
+            __m256i t2 = _mm256_sub_epi8(_mm256_xor_si256(t0, t1), t1);
+            return SIMDVec_i(t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint8_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<32> const & mask, uint8_t b) const {
+            uint32_t c = b < 7 ? b : 7;
+            __m256i t0 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF >> c)));
+            __m256i t1 = _mm256_set1_epi8(uint8_t(0x80 >> c));
+            __m256i t2 = _mm256_sub_epi8(_mm256_xor_si256(t0, t1), t1);
+            __m256i t3 = _mm256_blendv_epi8(mVec, t2, mask.toEpi8());
+            return SIMDVec_i(t3);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint8_t, 32> const & b) {
+            __m256i t0 = _mm256_min_epu8(b.mVec, _mm256_set1_epi8(7));
+            __m256i t1 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF >> 4)));
+            __m256i t2 = _mm256_set1_epi8(uint8_t(0x80 >> 4));
+            __m256i t3 = _mm256_sub_epi8(_mm256_xor_si256(t1, t2), t2);
+            __m256i t4 = _mm256_blendv_epi8(mVec, t3, _mm256_slli_epi16(t0, 5));
+            __m256i t5 = _mm256_and_si256(_mm256_srl_epi16(t4, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF >> 2)));
+            __m256i t6 = _mm256_set1_epi8(uint8_t(0x80 >> 2));
+            __m256i t7 = _mm256_sub_epi8(_mm256_xor_si256(t5, t6), t6);
+            __m256i t8 = _mm256_blendv_epi8(t4, t7, _mm256_slli_epi16(t0, 6));
+            __m256i t9 = _mm256_and_si256(_mm256_srl_epi16(t8, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF >> 1)));
+            __m256i t10 = _mm256_set1_epi8(uint8_t(0x80 >> 1));
+            __m256i t11 = _mm256_sub_epi8(_mm256_xor_si256(t9, t10), t10);
+            __m256i t12 = _mm256_blendv_epi8(t8, t11, _mm256_slli_epi16(t0, 7));
+            mVec = t12;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint8_t, 32> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<32> const & mask, SIMDVec_u<uint8_t, 32> const & b) {
+            __m256i t0 = _mm256_min_epu8(b.mVec, _mm256_set1_epi8(7));
+            __m256i t1 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(4)), _mm256_set1_epi8(uint8_t(0xFF >> 4)));
+            __m256i t2 = _mm256_set1_epi8(uint8_t(0x80 >> 4));
+            __m256i t3 = _mm256_sub_epi8(_mm256_xor_si256(t1, t2), t2);
+            __m256i t4 = _mm256_blendv_epi8(mVec, t3, _mm256_slli_epi16(t0, 5));
+            __m256i t5 = _mm256_and_si256(_mm256_srl_epi16(t4, _mm_cvtsi32_si128(2)), _mm256_set1_epi8(uint8_t(0xFF >> 2)));
+            __m256i t6 = _mm256_set1_epi8(uint8_t(0x80 >> 2));
+            __m256i t7 = _mm256_sub_epi8(_mm256_xor_si256(t5, t6), t6);
+            __m256i t8 = _mm256_blendv_epi8(t4, t7, _mm256_slli_epi16(t0, 6));
+            __m256i t9 = _mm256_and_si256(_mm256_srl_epi16(t8, _mm_cvtsi32_si128(1)), _mm256_set1_epi8(uint8_t(0xFF >> 1)));
+            __m256i t10 = _mm256_set1_epi8(uint8_t(0x80 >> 1));
+            __m256i t11 = _mm256_sub_epi8(_mm256_xor_si256(t9, t10), t10);
+            __m256i t12 = _mm256_blendv_epi8(t8, t11, _mm256_slli_epi16(t0, 7));
+            mVec = _mm256_blendv_epi8(mVec, t12, mask.toEpi8());
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint8_t b) {
+            uint32_t c = b < 7 ? b : 7;
+            __m256i t0 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF >> c)));
+            __m256i t1 = _mm256_set1_epi8(uint8_t(0x80 >> c));
+            __m256i t2 = _mm256_sub_epi8(_mm256_xor_si256(t0, t1), t1);
+            mVec = t2;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint8_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<32> const & mask, uint8_t b) {
+            uint32_t c = b < 7 ? b : 7;
+            __m256i t0 = _mm256_and_si256(_mm256_srl_epi16(mVec, _mm_cvtsi32_si128(c)), _mm256_set1_epi8(uint8_t(0xFF >> c)));
+            __m256i t1 = _mm256_set1_epi8(uint8_t(0x80 >> c));
+            __m256i t2 = _mm256_sub_epi8(_mm256_xor_si256(t0, t1), t1);
+            mVec = _mm256_blendv_epi8(mVec, t2, mask.toEpi8());
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m256i t0 = _mm256_sub_epi8(_mm256_setzero_si256(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_sub_epi8(_mm256_setzero_si256(), mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm256_sub_epi8(_mm256_setzero_si256(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_sub_epi8(_mm256_setzero_si256(), mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m256i t0 = _mm256_abs_epi8(mVec);
+            return SIMDVec_i(t0);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_abs_epi8(mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return SIMDVec_i(t1);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = _mm256_abs_epi8(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_abs_epi8(mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.toEpi8());
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int8_t, 16> const & a, SIMDVec_i<int8_t, 16> const & b) {
+            alignas(32) int8_t raw[32];
+            a.store(raw);
+            b.store(raw + 16);
+            mVec = _mm256_load_si256((__m256i*)raw);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int8_t, 16> const & a) {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            a.store(raw);
+            mVec = _mm256_load_si256((__m256i*)raw);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int8_t, 16> const & b) {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            b.store(raw + 16);
+            mVec = _mm256_load_si256((__m256i*)raw);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int8_t, 16> & a, SIMDVec_i<int8_t, 16> & b) const {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            a.load(raw);
+            b.load(raw + 16);
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int8_t, 16> unpacklo() const {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            return SIMDVec_i<int8_t, 16>(raw);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int8_t, 16> unpackhi() const {
+            alignas(32) int8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            return SIMDVec_i<int8_t, 16>(raw + 16);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int16_t, 32>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint8_t, 32>() const;
+    };
+
+}
+}
+
+#endif
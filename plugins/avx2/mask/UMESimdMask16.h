@@ -63,6 +63,17 @@ namespace SIMD {
         __m256i mMask[2];
 
         inline SIMDVecMask(__m256i const & x0, __m256i const & x1) { mMask[0] = x0; mMask[1] = x1; };
+
+        // 16-bit vectors blend with word-wide lanes: narrow the two 32-bit lane
+        // registers into a single register and widen back for compare results.
+        inline __m256i toEpi16() const {
+            __m256i t0 = _mm256_packs_epi32(mMask[0], mMask[1]);
+            return _mm256_permute4x64_epi64(t0, 0xD8);
+        }
+        static inline SIMDVecMask fromEpi16(__m256i const & x) {
+            return SIMDVecMask(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x)),
+                               _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1)));
+        }
     public:
         inline SIMDVecMask() {}
 
@@ -296,6 +307,19 @@ namespace SIMD {
             int t1 = _mm256_testz_si256(mMask[1], mMask[1]);
             return (t0 == 0) | (t1 == 0);
         }
+        // TOBITS
+        inline uint64_t toBits() const {
+            uint64_t t0 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[0])));
+            uint64_t t1 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[1])));
+            return t0 | (t1 << 8);
+        }
+        // FROMBITS
+        static inline SIMDVecMask fromBits(uint64_t bits) {
+            __m256i t0 = _mm256_set_epi32(0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1);
+            __m256i t1 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits >> 0)), t0), t0);
+            __m256i t2 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits >> 8)), t0), t0);
+            return SIMDVecMask(t1, t2);
+        }
     };
 }
 }
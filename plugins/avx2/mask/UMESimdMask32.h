@@ -51,7 +51,9 @@ namespace SIMD {
         // This function returns a boolean value based on internal representation
         static inline bool toBool(uint32_t m) { if ((m & 0x80000000) != 0) return true; else return false; }
 
+        friend class SIMDVec_u<uint8_t, 32>;
         friend class SIMDVec_u<uint32_t, 32>;
+        friend class SIMDVec_i<int8_t, 32>;
         friend class SIMDVec_i<int32_t, 32>;
         friend class SIMDVec_f<float, 32>;
         friend class SIMDVec_f<double, 32>;
@@ -66,6 +68,23 @@ namespace SIMD {
             mMask[3] = x3;
         };
 
+        // 8-bit vectors blend with byte-wide lanes: narrow the four 32-bit lane
+        // registers into a single register and widen back for compare results.
+        inline __m256i toEpi8() const {
+            __m256i t0 = _mm256_packs_epi32(mMask[0], mMask[1]);
+            __m256i t1 = _mm256_packs_epi32(mMask[2], mMask[3]);
+            __m256i t2 = _mm256_packs_epi16(t0, t1);
+            return _mm256_permutevar8x32_epi32(t2, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+        }
+        static inline SIMDVecMask fromEpi8(__m256i const & x) {
+            __m128i t0 = _mm256_castsi256_si128(x);
+            __m128i t1 = _mm256_extracti128_si256(x, 1);
+            return SIMDVecMask(_mm256_cvtepi8_epi32(t0),
+                               _mm256_cvtepi8_epi32(_mm_srli_si128(t0, 8)),
+                               _mm256_cvtepi8_epi32(t1),
+                               _mm256_cvtepi8_epi32(_mm_srli_si128(t1, 8)));
+        }
+
     public:
         inline SIMDVecMask() {}
 
@@ -363,6 +382,23 @@ namespace SIMD {
             int t3 = _mm256_testz_si256(mMask[3], mMask[3]);
             return (t0 == 0) | (t1 == 0) | (t2 == 0) | (t3 == 0);
         }
+        // TOBITS
+        inline uint64_t toBits() const {
+            uint64_t t0 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[0])));
+            uint64_t t1 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[1])));
+            uint64_t t2 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[2])));
+            uint64_t t3 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[3])));
+            return t0 | (t1 << 8) | (t2 << 16) | (t3 << 24);
+        }
+        // FROMBITS
+        static inline SIMDVecMask fromBits(uint64_t bits) {
+            __m256i t0 = _mm256_set_epi32(0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1);
+            __m256i t1 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits >> 0)), t0), t0);
+            __m256i t2 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits >> 8)), t0), t0);
+            __m256i t3 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits >> 16)), t0), t0);
+            __m256i t4 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits >> 24)), t0), t0);
+            return SIMDVecMask(t1, t2, t3, t4);
+        }
     };
 }
 }
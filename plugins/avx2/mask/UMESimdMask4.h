@@ -469,6 +469,26 @@ namespace SIMD {
             alignas(16) uint32_t raw[4];
             _mm_store_si128((__m128i*)raw, mMask);
             return (raw[0] ^ raw[1] ^ raw[2] ^ raw[3]) != 0;
+#endif
+        }
+        // TOBITS
+        UME_FORCE_INLINE uint64_t toBits() const {
+#if defined UME_USE_MASK_64B
+            return uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(mMask)));
+#else
+            return uint64_t(_mm_movemask_ps(_mm_castsi128_ps(mMask)));
+#endif
+        }
+        // FROMBITS
+        static UME_FORCE_INLINE SIMDVecMask fromBits(uint64_t bits) {
+#if defined UME_USE_MASK_64B
+            __m256i t0 = _mm256_set_epi64x(0x8, 0x4, 0x2, 0x1);
+            __m256i t1 = _mm256_and_si256(_mm256_set1_epi64x(int64_t(bits)), t0);
+            return SIMDVecMask(_mm256_cmpeq_epi64(t1, t0));
+#else
+            __m128i t0 = _mm_set_epi32(0x8, 0x4, 0x2, 0x1);
+            __m128i t1 = _mm_and_si128(_mm_set1_epi32(int32_t(bits)), t0);
+            return SIMDVecMask(_mm_cmpeq_epi32(t1, t0));
 #endif
         }
     };
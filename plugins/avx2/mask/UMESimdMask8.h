@@ -262,6 +262,16 @@ namespace SIMD {
             _mm256_store_si256((__m256i*)raw, mMask);
             return (raw[0] ^ raw[1] ^ raw[2] ^ raw[3] ^ raw[4] ^ raw[5] ^ raw[6] ^ raw[7]) == TRUE_VAL();
         }
+        // TOBITS
+        inline uint64_t toBits() const {
+            return uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask)));
+        }
+        // FROMBITS
+        static inline SIMDVecMask fromBits(uint64_t bits) {
+            __m256i t0 = _mm256_set_epi32(0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1);
+            __m256i t1 = _mm256_and_si256(_mm256_set1_epi32(int32_t(bits)), t0);
+            return SIMDVecMask(_mm256_cmpeq_epi32(t1, t0));
+        }
     };
 }
 }
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
 
 namespace UME {
 namespace SIMD {
@@ -178,6 +179,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
@@ -187,12 +190,21 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<16> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint32_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            mVec[0] = _mm256_maskload_epi32((int const *)p, t1);
+            mVec[1] = _mm256_maskload_epi32((int const *)(p + 8), t2);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
             mVec[0] = _mm256_load_si256((__m256i *)p);
@@ -201,8 +213,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<16> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -219,6 +231,15 @@ namespace SIMD {
             _mm256_maskstore_epi32((int*)(p + 8), mask.mMask[1], mVec[1]);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE uint32_t * storeTail(uint32_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_set1_epi32(count);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            __m256i t2 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            _mm256_maskstore_epi32((int *)p, t1, mVec[0]);
+            _mm256_maskstore_epi32((int *)(p + 8), t2, mVec[1]);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE uint32_t* storea(uint32_t * p) const {
             _mm256_store_si256((__m256i*)p, mVec[0]);
@@ -236,6 +257,59 @@ namespace SIMD {
         // SWIZZLE 
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            AVX2::sortNetwork16<uint32_t, false>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t2, t3);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVec[0]);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVec[1]);
+            AVX2::sortNetwork16<uint32_t, false>(t0, t1, t2, t3);
+            payload.mVec[0] = _mm256_castps_si256(t2);
+            payload.mVec[1] = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t4, t5);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            AVX2::sortNetwork16<uint32_t, true>(t0, t1);
+            __m256i t2 = _mm256_castps_si256(t0);
+            __m256i t3 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t2, t3);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec[0]);
+            __m256 t1 = _mm256_castsi256_ps(mVec[1]);
+            __m256 t2 = _mm256_castsi256_ps(payload.mVec[0]);
+            __m256 t3 = _mm256_castsi256_ps(payload.mVec[1]);
+            AVX2::sortNetwork16<uint32_t, true>(t0, t1, t2, t3);
+            payload.mVec[0] = _mm256_castps_si256(t2);
+            payload.mVec[1] = _mm256_castps_si256(t3);
+            __m256i t4 = _mm256_castps_si256(t0);
+            __m256i t5 = _mm256_castps_si256(t1);
+            return SIMDVec_u(t4, t5);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m256i t0 = _mm256_add_epi32(mVec[0], b.mVec[0]);
@@ -812,6 +886,34 @@ namespace SIMD {
             }
             return true;
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+            __m256i t3 = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+            __m256i t4 = _mm256_set1_epi32(1);
+            // Upper half against the lower half: all 8 rotations, each lower
+            // element 'j' rotated together with its bit (1 << j).
+            for (int k = 0; k < 8; k++) {
+                __m256i t5 = _mm256_permutevar8x32_epi32(mVec[0], t2);
+                __m256i t6 = _mm256_permutevar8x32_epi32(t3, t2);
+                t1 = _mm256_or_si256(t1, _mm256_and_si256(_mm256_cmpeq_epi32(mVec[1], t5), t6));
+                t2 = _mm256_sub_epi32(t2, t4);
+            }
+            // Within each half: rotation by 'k' elements, element 'i' meets element
+            // 'i - k', and (1 << i) >> k is zero where the rotation wrapped.
+            __m256i t7 = t3;
+            for (int k = 1; k < 8; k++) {
+                t2 = _mm256_sub_epi32(t2, t4);
+                t7 = _mm256_srli_epi32(t7, 1);
+                __m256i t8 = _mm256_permutevar8x32_epi32(mVec[0], t2);
+                __m256i t9 = _mm256_permutevar8x32_epi32(mVec[1], t2);
+                t0 = _mm256_or_si256(t0, _mm256_and_si256(_mm256_cmpeq_epi32(mVec[0], t8), t7));
+                t1 = _mm256_or_si256(t1, _mm256_slli_epi32(_mm256_and_si256(_mm256_cmpeq_epi32(mVec[1], t9), t7), 8));
+            }
+            return SIMDVec_u(t0, t1);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
             __m256i t0 = _mm256_set1_epi32(0);
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
 
 #if defined UME_USE_MASK_64B
     #define BLEND(a_128i, b_128i, mask_256i) \
@@ -48,6 +49,15 @@
                 0 \
                 ))
 
+    #define MASK_LOAD(int32_addr, mask_256i) \
+        _mm_maskload_epi32( \
+            (int const *)(int32_addr), \
+            _mm256_extractf128_si256( \
+                _mm256_permutevar8x32_epi32( \
+                    mask_256i, \
+                    _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0)), \
+                0))
+
     #define MASK_STORE(int32_addr, mask_256i, a_128i) \
         _mm_maskstore_epi32( \
             int32_addr, \
@@ -61,6 +71,7 @@
 
 #else
     #define BLEND(a_128i, b_128i, mask_128i) _mm_blendv_epi8(a_128i, b_128i, mask_128i)
+    #define MASK_LOAD(int32_addr, mask_128i) _mm_maskload_epi32((int const *)(int32_addr), mask_128i)
     #define MASK_STORE(int32_addr, mask_128i, a_128i) _mm_maskstore_epi32(int32_addr, mask_128i, a_128i)
 #endif
 
@@ -192,6 +203,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
             mVec = _mm_loadu_si128((__m128i*)p);
@@ -199,10 +212,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint32_t const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            mVec = _mm_maskload_epi32((int const *)p, t0);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
             mVec = _mm_load_si128((__m128i*)p);
@@ -210,7 +229,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -224,6 +243,12 @@ namespace SIMD {
             MASK_STORE((int32_t*)p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE uint32_t * storeTail(uint32_t * p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            _mm_maskstore_epi32((int *)p, t0, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE uint32_t * storea(uint32_t * p) const {
             _mm_store_si128((__m128i *)p, mVec);
@@ -267,6 +292,43 @@ namespace SIMD {
             mVec = _mm_castps_si128(t1);
             return *this;
         }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX2::sortNetwork4<uint32_t, false>(t0);
+            return SIMDVec_u(_mm_castps_si128(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX2::sortNetwork4<uint32_t, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_u(_mm_castps_si128(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX2::sortNetwork4<uint32_t, true>(t0);
+            return SIMDVec_u(_mm_castps_si128(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX2::sortNetwork4<uint32_t, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_u(_mm_castps_si128(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -733,6 +795,17 @@ namespace SIMD {
             }
             return true;
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m128i t0 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0x00));
+            __m128i t1 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0x55));
+            __m128i t2 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0xAA));
+            __m128i t3 = _mm_and_si128(t0, _mm_set_epi32(1, 1, 1, 0));
+            __m128i t4 = _mm_and_si128(t1, _mm_set_epi32(2, 2, 0, 0));
+            __m128i t5 = _mm_and_si128(t2, _mm_set_epi32(4, 0, 0, 0));
+            __m128i t6 = _mm_or_si128(t3, _mm_or_si128(t4, t5));
+            return SIMDVec_u(t6);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
             alignas(16) uint32_t raw[4];
@@ -1001,6 +1074,9 @@ namespace SIMD {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
         // MBANDV
         UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -1013,6 +1089,9 @@ namespace SIMD {
             __m128i t1 = _mm_and_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint32_t b) const {
+            return band(b);
+        }
         // MBANDS
         UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1025,6 +1104,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
         // MBANDVA
         UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -1037,6 +1119,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint32_t b) {
+            return banda(b);
+        }
         // MBANDSA
         UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1049,6 +1134,9 @@ namespace SIMD {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
         // MBORV
         UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1061,6 +1149,9 @@ namespace SIMD {
             __m128i t1 = _mm_or_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint32_t b) const {
+            return bor(b);
+        }
         // MBORS
         UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1073,6 +1164,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
         // MBORVA
         UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1085,6 +1179,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint32_t b) {
+            return bora(b);
+        }
         // MBORSA
         UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1097,6 +1194,9 @@ namespace SIMD {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
         // MBXORV
         UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1109,6 +1209,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint32_t b) const {
+            return bxor(b);
+        }
         // MBXORS
         UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1121,6 +1224,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
         // MBXORVA
         UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1133,6 +1239,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint32_t b) {
+            return bxora(b);
+        }
         // MBXORSA
         UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1146,6 +1255,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
         // MBNOT
         UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<4> const & mask) const {
             __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
@@ -1439,6 +1551,7 @@ namespace SIMD {
 }
 
 #undef BLEND
+#undef MASK_LOAD
 #undef MASK_STORE
 
 #endif
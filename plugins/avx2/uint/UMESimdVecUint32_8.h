@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX2.h"
+#include "../UMESimdCompressAVX2.h"
 
 #ifdef _MSC_VER
 // WA: Visual studio 19.0 doesn't support this intrinsic.
@@ -167,6 +169,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
@@ -175,10 +179,16 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<8> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint32_t const * p, uint32_t count) {
+            __m256i t0 = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            mVec = _mm256_maskload_epi32((int const *)p, t0);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
             mVec = _mm256_load_si256((__m256i *)p);
@@ -186,18 +196,77 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<8> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
         // STORE
+        UME_FORCE_INLINE uint32_t * store(uint32_t * p) const {
+            _mm256_storeu_si256((__m256i*)p, mVec);
+            return p;
+        }
         // MSTORE
+        UME_FORCE_INLINE uint32_t * store(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            _mm256_maskstore_epi32((int*) p, mask.mMask, mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE uint32_t * storeTail(uint32_t * p, uint32_t count) const {
+            __m256i t0 = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            _mm256_maskstore_epi32((int*) p, t0, mVec);
+            return p;
+        }
         // STOREA
-        /*UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
-            _mm256_store_si256((__m256i*)addrAligned, mVec);
-            return addrAligned;
-        }*/
+        UME_FORCE_INLINE uint32_t * storea(uint32_t * p) const {
+            _mm256_store_si256((__m256i*)p, mVec);
+            return p;
+        }
         // MSTOREA
+        UME_FORCE_INLINE uint32_t * storea(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            _mm256_maskstore_epi32((int*) p, mask.mMask, mVec);
+            return p;
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_u compress(SIMDVecMask<8> const & mask) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(t0));
+            return SIMDVec_u(_mm256_and_si256(t2, AVX2::firstLanes(t1)));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(t0));
+            _mm256_maskstore_epi32((int *)p, AVX2::firstLanes(t1), t2);
+            return t1;
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, uint32_t const * p) {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_maskload_epi32((int const *)p, AVX2::firstLanes(t1));
+            __m256i t3 = _mm256_permutevar8x32_epi32(t2, AVX2::expandPermutation(t0));
+            mVec = _mm256_blendv_epi8(mVec, t3, mask.mMask);
+            return t1;
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            return SIMDVec_u(_mm256_permutevar8x32_epi32(mVec, indices.mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, indices.mVec);
+            return SIMDVec_u(_mm256_blendv_epi8(mVec, t0, mask.mMask));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_u permute2(SIMDVec_u const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, indices.mVec);
+            __m256i t1 = _mm256_permutevar8x32_epi32(b.mVec, indices.mVec);
+            // Bit 3 of the index selects 'b'.
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec, 28));
+            return SIMDVec_u(_mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t1), t2)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<8> const & mask, SIMDVec_u const &b) const {
             __m256i t0 = _mm256_blendv_epi8(mVec, b.mVec, mask.mMask);
@@ -211,6 +280,43 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX2::sortNetwork8<uint32_t, false>(t0);
+            return SIMDVec_u(_mm256_castps_si256(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX2::sortNetwork8<uint32_t, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_u(_mm256_castps_si256(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX2::sortNetwork8<uint32_t, true>(t0);
+            return SIMDVec_u(_mm256_castps_si256(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX2::sortNetwork8<uint32_t, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_u(_mm256_castps_si256(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m256i t0 = _mm256_add_epi32(mVec, b.mVec);
@@ -690,6 +796,22 @@ namespace SIMD {
             }
             return true;
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+            __m256i t2 = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+            __m256i t3 = _mm256_set1_epi32(1);
+            // Compare with the vector rotated by 'k' elements: element 'i' meets
+            // element 'i - k', and (1 << i) >> k is zero where the rotation wrapped.
+            for (int k = 1; k < 8; k++) {
+                t1 = _mm256_sub_epi32(t1, t3);
+                t2 = _mm256_srli_epi32(t2, 1);
+                __m256i t4 = _mm256_permutevar8x32_epi32(mVec, t1);
+                t0 = _mm256_or_si256(t0, _mm256_and_si256(_mm256_cmpeq_epi32(mVec, t4), t2));
+            }
+            return SIMDVec_u(t0);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
             __m256i t0 = _mm256_set1_epi32(0);
@@ -35,6 +35,9 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdIntrinsicsAVX2.h"
+#include "../UMESimdCompressAVX2.h"
+#include "../UMESimdPermuteAVX2.h"
 
 
 #if defined (_MSC_VER) && !defined (__x86_64__)
@@ -54,12 +57,12 @@
 
 #if defined UME_USE_MASK_64B
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_blendv_epi8((a_256i), (b_256i), mask_256i)
-#define MASK_LOAD(a_256i, mask_256i) _mm256_maskload_epi64((a_256i), mask_256i)
-#define MASK_STORE(ptr_u64, mask_256i, a_256i) _mm256_maskstore_epi64((__int64 *)ptr_u64, mask_256i, a_256i);
+#define MASK_LOAD(ptr_u64, mask_256i) _mm256_maskload_epi64((long long const *)ptr_u64, mask_256i)
+#define MASK_STORE(ptr_u64, mask_256i, a_256i) _mm256_maskstore_epi64((long long *)ptr_u64, mask_256i, a_256i)
 #else
 #define BLEND(a_256i, b_256i, mask_128i) _mm256_blendv_epi8((a_256i), (b_256i), (_mm256_cvtepi32_epi64(mask_128i)))
-#define MASK_LOAD(a_256i, mask_128i) _mm256_maskload_epi64((a_256i), (_mm256_cvtepi32_epi64(mask_128i)))
-#define MASK_STORE(ptr_u64, mask_128i, a_256i) _mm256_maskstore_epi64((__int64 *)ptr_u64, (_mm256_cvtepi32_epi64(mask_128i)), a_256i);
+#define MASK_LOAD(ptr_u64, mask_128i) _mm256_maskload_epi64((long long const *)ptr_u64, (_mm256_cvtepi32_epi64(mask_128i)))
+#define MASK_STORE(ptr_u64, mask_128i, a_256i) _mm256_maskstore_epi64((long long *)ptr_u64, (_mm256_cvtepi32_epi64(mask_128i)), a_256i)
 #endif
 
 namespace UME {
@@ -82,6 +85,7 @@ namespace SIMD {
         friend class SIMDVec_f<double, 4>;
 
         friend class SIMDVec_u<uint64_t, 8>;
+        friend class FUNCTIONS::Divisor<SIMDVec_u<uint64_t, 4>>;
 
     private:
         __m256i mVec;
@@ -181,6 +185,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint64_t const *p) {
@@ -189,13 +195,14 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint64_t const *p) {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskload_epi64' intrinsic
-            __m256i t0 = _mm256_loadu_si256((const __m256i *) p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
-#else
-            mVec = MASK_LOAD((__int64 const*)p, mask.mMask);
-#endif
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint64_t const *p, uint32_t count) {
+            __m256i t0 = _mm256_cmpgt_epi64(SET1_EPI64(count), _mm256_setr_epi64x(0, 1, 2, 3));
+            mVec = _mm256_maskload_epi64((long long const *)p, t0);
             return *this;
         }
         // LOADA
@@ -205,13 +212,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<4> const & mask, uint64_t const *p) {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskload_epi64' intrinsic
-            __m256i t0 = _mm256_load_si256((const __m256i *) p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
-#else
-            mVec = MASK_LOAD((__int64 const*)p, mask.mMask);
-#endif
             return *this;
         }
         // STORE
@@ -221,14 +223,13 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE uint64_t* store(SIMDVecMask<4> const & mask, uint64_t* p) const {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskstore_epi64' intrinsic
-            __m256i t0 = _mm256_loadu_si256((const __m256i *) p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i *)p, t1);
-#else
             MASK_STORE(p, mask.mMask, mVec);
-#endif
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE uint64_t* storeTail(uint64_t* p, uint32_t count) const {
+            __m256i t0 = _mm256_cmpgt_epi64(SET1_EPI64(count), _mm256_setr_epi64x(0, 1, 2, 3));
+            _mm256_maskstore_epi64((long long *)p, t0, mVec);
             return p;
         }
         // STOREA
@@ -238,17 +239,54 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE uint64_t* storea(SIMDVecMask<4> const & mask, uint64_t* p) const {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskstore_epi64' intrinsic
-            __m256i t0 = _mm256_load_si256((const __m256i *) p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i *)p, t1);
-#else
             MASK_STORE(p, mask.mMask, mVec);
-#endif
             return p;
         }
 
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_u compress(SIMDVecMask<4> const & mask) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(AVX2::widenBits64(t0)));
+            return SIMDVec_u(_mm256_and_si256(t2, AVX2::firstLanes(2 * t1)));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, uint64_t * p) const {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, AVX2::compressPermutation(AVX2::widenBits64(t0)));
+            _mm256_maskstore_epi64((long long *)p, AVX2::firstLanes(2 * t1), t2);
+            return t1;
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<4> const & mask, uint64_t const * p) {
+            uint32_t t0 = uint32_t(mask.toBits());
+            uint32_t t1 = SCALAR_EMULATION::bitCount(t0);
+            __m256i t2 = _mm256_maskload_epi64((long long const *)p, AVX2::firstLanes(2 * t1));
+            __m256i t3 = _mm256_permutevar8x32_epi32(t2, AVX2::expandPermutation(AVX2::widenBits64(t0)));
+            mVec = BLEND(mVec, t3, mask.mMask);
+            return t1;
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            return SIMDVec_u(_mm256_permutevar8x32_epi32(mVec, t0));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, t0);
+            return SIMDVec_u(BLEND(mVec, t1, mask.mMask));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_u permute2(SIMDVec_u const & b, SIMDVec_u<uint64_t, 4> const & indices) const {
+            __m256i t0 = AVX2::permutationIndices64(indices.mVec);
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, t0);
+            __m256i t2 = _mm256_permutevar8x32_epi32(b.mVec, t0);
+            // Bit 2 of the index selects 'b'.
+            __m256d t3 = _mm256_castsi256_pd(_mm256_slli_epi64(indices.mVec, 61));
+            return SIMDVec_u(_mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t1), _mm256_castsi256_pd(t2), t3)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m256i t0 = BLEND(mVec, b.mVec, mask.mMask);
@@ -267,9 +305,35 @@ namespace SIMD {
         // SORTD
 
         // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
         // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_add_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint64_t b) const {
+            return add(b);
+        }
         // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_add_epi64(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // ADDVA
         // MADDVA
         // ADDSA
@@ -315,21 +379,114 @@ namespace SIMD {
         // PREFDEC
         // MPREFDEC
         // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
         // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint64_t b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint64_t b) const {
+            return mul(b);
+        }
         // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec = AVX2::mullo_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
         // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = AVX2::mullo_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint64_t b) {
+            mVec = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint64_t b) {
+            return mula(b);
+        }
         // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = AVX2::mullo_epi64(mVec, SET1_EPI64(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // There is no vector division instruction. Element-wise division by a
+        // vector stays emulated, but DIVS variants divide by a precomputed
+        // reciprocal of the scalar.
         // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            return SCALAR_EMULATION::div<SIMDVec_u>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            return SCALAR_EMULATION::div<SIMDVec_u, SIMDVecMask<4>>(mask, *this, b);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint64_t b) const {
+            __m256i t0 = AVX2::DivisorU64(b).divide(mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (uint64_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = AVX2::DivisorU64(b).divide(mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            return SCALAR_EMULATION::divAssign<SIMDVec_u>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            return SCALAR_EMULATION::divAssign<SIMDVec_u, SIMDVecMask<4>>(mask, *this, b);
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint64_t b) {
+            mVec = AVX2::DivisorU64(b).divide(mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (uint64_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = AVX2::DivisorU64(b).divide(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -401,17 +558,69 @@ namespace SIMD {
         // BANDS
         // MBANDS
         // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm256_and_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
         // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_and_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint64_t b) {
+            return banda(b);
+        }
         // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BORV
         // MBORV
         // BORS
         // MBORS
         // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm256_or_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
         // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_or_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint64_t b) {
+            return bora(b);
+        }
         // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BXORV
         // MBXORV
         // BXORS
@@ -451,18 +660,66 @@ namespace SIMD {
         // MSCATTERV
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint64_t b) const {
+            __m256i t0 = _mm256_sll_epi64(mVec, _mm_cvtsi64_si128(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint64_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = _mm256_sll_epi64(mVec, _mm_cvtsi64_si128(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
 
         // LSHVA
         // MLSHVA
         // LSHSA
         // MLSHSA
         // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint64_t b) const {
+            __m256i t0 = _mm256_srl_epi64(mVec, _mm_cvtsi64_si128(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint64_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = _mm256_srl_epi64(mVec, _mm_cvtsi64_si128(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // RSHVA
         // MRSHVA
         // RSHSA
@@ -502,6 +759,27 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 4>() const;
     };
 
+namespace FUNCTIONS {
+
+    // Keeps the reciprocal computed by AVX2::DivisorU64 for all divisions.
+    template<>
+    class Divisor<SIMDVec_u<uint64_t, 4>> {
+    private:
+        AVX2::DivisorU64 mDivisor;
+
+    public:
+        UME_FORCE_INLINE explicit Divisor(uint64_t d) : mDivisor(d) {}
+
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 4> divide(SIMDVec_u<uint64_t, 4> const & src) const {
+            return SIMDVec_u<uint64_t, 4>(mDivisor.divide(src.mVec));
+        }
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 4> divide(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & src) const {
+            return src.blend(mask, divide(src));
+        }
+    };
+
+}
+
 }
 }
 
@@ -517,23 +517,23 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 4>::operator SIMDVec_i<int32_t, 4>() const {
-        __m128i t0 = _mm_cvtps_epi32(mVec);
+        __m128i t0 = _mm_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 8>::operator SIMDVec_i<int32_t, 8>() const {
-        __m256i t0 = _mm256_cvtps_epi32(mVec);
+        __m256i t0 = _mm256_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 8>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 16>::operator SIMDVec_i<int32_t, 16>() const {
-        __m512i t0 = _mm512_cvtps_epi32(mVec);
+        __m512i t0 = _mm512_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 16>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 32>::operator SIMDVec_i<int32_t, 32>() const {
-        __m512i t0 = _mm512_cvtps_epi32(mVec[0]);
-        __m512i t1 = _mm512_cvtps_epi32(mVec[1]);
+        __m512i t0 = _mm512_cvttps_epi32(mVec[0]);
+        __m512i t1 = _mm512_cvttps_epi32(mVec[1]);
         return SIMDVec_i<int32_t, 32>(t0, t1);
     }
 
@@ -544,11 +544,11 @@ namespace SIMD {
     UME_FORCE_INLINE SIMDVec_f<double, 2>::operator SIMDVec_i<int64_t, 2>() const {
 #if defined(__AVX512DQ__)
 #if defined(__AVX512VL__)
-        __m128i t0 = _mm_cvtpd_epi64(mVec);
+        __m128i t0 = _mm_cvttpd_epi64(mVec);
         return SIMDVec_i<int64_t, 2>(t0);
 #else
-        __m512d t0 = _mm512_castpd128_pd512(mVeC);
-        __m512i t1 = _mm512_cvtpd_epi64(t0);
+        __m512d t0 = _mm512_castpd128_pd512(mVec);
+        __m512i t1 = _mm512_cvttpd_epi64(t0);
         __m128i t2 = _mm512_castsi512_si128(t1);
         return SIMDVec_i<int64_t, 2>(t2);
 #endif
@@ -566,13 +566,13 @@ namespace SIMD {
     UME_FORCE_INLINE SIMDVec_f<double, 4>::operator SIMDVec_i<int64_t, 4>() const {
 #if defined(__AVX512DQ__)
 #if defined(__AVX512VL__)
-        __m256i t0 = _mm256_cvtpd_epi64(mVec);
+        __m256i t0 = _mm256_cvttpd_epi64(mVec);
         return SIMDVec_i<int64_t, 4>(t0);
 #else
-        __m512d t0 = _mm512_castpd256_pd512(mVeC);
-        __m512i t1 = _mm512_cvtpd_epi64(t0);
+        __m512d t0 = _mm512_castpd256_pd512(mVec);
+        __m512i t1 = _mm512_cvttpd_epi64(t0);
         __m256i t2 = _mm512_castsi512_si256(t1);
-        return SIMDVec_t<int64_t, 4>(t2);
+        return SIMDVec_i<int64_t, 4>(t2);
 #endif
 #else
         alignas(32) double raw_64f[4];
@@ -589,7 +589,7 @@ namespace SIMD {
 
     UME_FORCE_INLINE SIMDVec_f<double, 8>::operator SIMDVec_i<int64_t, 8>() const {
 #if defined(__AVX512DQ__)
-        __m512i t0 = _mm512_cvtpd_epi64(mVec);
+        __m512i t0 = _mm512_cvttpd_epi64(mVec);
         return SIMDVec_i<int64_t, 8>(t0);
 #else
         alignas(64) double raw_64f[8];
@@ -610,8 +610,8 @@ namespace SIMD {
 
     UME_FORCE_INLINE SIMDVec_f<double, 16>::operator SIMDVec_i<int64_t, 16>() const {
 #if defined(__AVX512DQ__)
-        __m512i t0 = _mm512_cvtpd_epi64(mVec[0]);
-        __m512i t1 = _mm512_cvtpd_epi64(mVec[1]);
+        __m512i t0 = _mm512_cvttpd_epi64(mVec[0]);
+        __m512i t1 = _mm512_cvttpd_epi64(mVec[1]);
         return SIMDVec_i<int64_t, 16>(t0, t1);
 #else
         alignas(64) double raw_64f[16];
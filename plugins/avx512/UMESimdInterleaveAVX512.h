@@ -0,0 +1,567 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_INTERLEAVE_AVX512_H_
+#define UME_SIMD_INTERLEAVE_AVX512_H_
+
+#include <immintrin.h>
+
+#include "../../UMEInline.h"
+
+// Interleaved (array of structures) loads and stores.
+//
+// deinterleaveK() takes K registers loaded from consecutive memory holding
+// structures of K elements each, and returns one register per structure
+// member. interleaveK() is the inverse operation. Only in-register shuffles
+// are used, so that memory is accessed with full-width contiguous loads and
+// stores.
+//
+// transposeNxN() transposes a matrix of N registers with N elements each in
+// place: after the call register 'i' holds element 'i' of every input register.
+
+namespace UME {
+namespace SIMD {
+namespace AVX512 {
+
+    // 128-bit, single precision
+
+    UME_FORCE_INLINE void deinterleave2(__m128 const & a, __m128 const & b, __m128 & x, __m128 & y) {
+        x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    UME_FORCE_INLINE void interleave2(__m128 const & x, __m128 const & y, __m128 & a, __m128 & b) {
+        a = _mm_unpacklo_ps(x, y);
+        b = _mm_unpackhi_ps(x, y);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m128 const & a, __m128 const & b, __m128 const & c, __m128 & x, __m128 & y, __m128 & z) {
+        // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+        __m128 t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+        __m128 t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+        __m128 t2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+        __m128 t3 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+        x = _mm_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(t3, c, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    UME_FORCE_INLINE void interleave3(__m128 const & x, __m128 const & y, __m128 const & z, __m128 & a, __m128 & b, __m128 & c) {
+        __m128 t0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 t1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+        __m128 t2 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 t3 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+        __m128 t4 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+        __m128 t5 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+        a = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+        b = _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+        c = _mm_shuffle_ps(t4, t5, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    // 4x4 transpose: de-interleaving and interleaving are the same operation.
+    UME_FORCE_INLINE void deinterleave4(__m128 const & a, __m128 const & b, __m128 const & c, __m128 const & d,
+                                        __m128 & x, __m128 & y, __m128 & z, __m128 & w) {
+        __m128 t0 = _mm_unpacklo_ps(a, b);
+        __m128 t1 = _mm_unpacklo_ps(c, d);
+        __m128 t2 = _mm_unpackhi_ps(a, b);
+        __m128 t3 = _mm_unpackhi_ps(c, d);
+        x = _mm_movelh_ps(t0, t1);
+        y = _mm_movehl_ps(t1, t0);
+        z = _mm_movelh_ps(t2, t3);
+        w = _mm_movehl_ps(t3, t2);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m128 const & x, __m128 const & y, __m128 const & z, __m128 const & w,
+                                      __m128 & a, __m128 & b, __m128 & c, __m128 & d) {
+        deinterleave4(x, y, z, w, a, b, c, d);
+    }
+
+    // 128-bit, double precision
+
+    UME_FORCE_INLINE void deinterleave2(__m128d const & a, __m128d const & b, __m128d & x, __m128d & y) {
+        x = _mm_unpacklo_pd(a, b);
+        y = _mm_unpackhi_pd(a, b);
+    }
+
+    UME_FORCE_INLINE void interleave2(__m128d const & x, __m128d const & y, __m128d & a, __m128d & b) {
+        a = _mm_unpacklo_pd(x, y);
+        b = _mm_unpackhi_pd(x, y);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m128d const & a, __m128d const & b, __m128d const & c, __m128d & x, __m128d & y, __m128d & z) {
+        // a = x0 y0, b = z0 x1, c = y1 z1
+        x = _mm_shuffle_pd(a, b, 0x2);
+        y = _mm_shuffle_pd(a, c, 0x1);
+        z = _mm_shuffle_pd(b, c, 0x2);
+    }
+
+    UME_FORCE_INLINE void interleave3(__m128d const & x, __m128d const & y, __m128d const & z, __m128d & a, __m128d & b, __m128d & c) {
+        a = _mm_shuffle_pd(x, y, 0x0);
+        b = _mm_shuffle_pd(z, x, 0x2);
+        c = _mm_shuffle_pd(y, z, 0x3);
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m128d const & a, __m128d const & b, __m128d const & c, __m128d const & d,
+                                        __m128d & x, __m128d & y, __m128d & z, __m128d & w) {
+        // a = x0 y0, b = z0 w0, c = x1 y1, d = z1 w1
+        x = _mm_unpacklo_pd(a, c);
+        y = _mm_unpackhi_pd(a, c);
+        z = _mm_unpacklo_pd(b, d);
+        w = _mm_unpackhi_pd(b, d);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m128d const & x, __m128d const & y, __m128d const & z, __m128d const & w,
+                                      __m128d & a, __m128d & b, __m128d & c, __m128d & d) {
+        a = _mm_unpacklo_pd(x, y);
+        b = _mm_unpacklo_pd(z, w);
+        c = _mm_unpackhi_pd(x, y);
+        d = _mm_unpackhi_pd(z, w);
+    }
+
+    // 256-bit, single precision. The 128-bit halves are first regrouped so that
+    // the low half holds the first and the high half the second group of four
+    // structures, which then go through the 128-bit shuffles in both halves.
+
+    UME_FORCE_INLINE void deinterleave2(__m256 const & a, __m256 const & b, __m256 & x, __m256 & y) {
+        __m256 t0 = _mm256_permute2f128_ps(a, b, 0x20);
+        __m256 t1 = _mm256_permute2f128_ps(a, b, 0x31);
+        x = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+        y = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    UME_FORCE_INLINE void interleave2(__m256 const & x, __m256 const & y, __m256 & a, __m256 & b) {
+        __m256 t0 = _mm256_unpacklo_ps(x, y);
+        __m256 t1 = _mm256_unpackhi_ps(x, y);
+        a = _mm256_permute2f128_ps(t0, t1, 0x20);
+        b = _mm256_permute2f128_ps(t0, t1, 0x31);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m256 const & a, __m256 const & b, __m256 const & c, __m256 & x, __m256 & y, __m256 & z) {
+        __m256 t0 = _mm256_permute2f128_ps(a, b, 0x30);
+        __m256 t1 = _mm256_permute2f128_ps(a, c, 0x21);
+        __m256 t2 = _mm256_permute2f128_ps(b, c, 0x30);
+        __m256 t3 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(1, 1, 2, 2));
+        __m256 t4 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 1, 1));
+        __m256 t5 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 2, 3, 3));
+        __m256 t6 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 1, 2, 2));
+        x = _mm256_shuffle_ps(t0, t3, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(t4, t5, _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm256_shuffle_ps(t6, t2, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    UME_FORCE_INLINE void interleave3(__m256 const & x, __m256 const & y, __m256 const & z, __m256 & a, __m256 & b, __m256 & c) {
+        __m256 t0 = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+        __m256 t1 = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+        __m256 t2 = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+        __m256 t3 = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+        __m256 t4 = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+        __m256 t5 = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+        __m256 t6 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 t7 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 t8 = _mm256_shuffle_ps(t4, t5, _MM_SHUFFLE(2, 0, 2, 0));
+        a = _mm256_permute2f128_ps(t6, t7, 0x20);
+        b = _mm256_permute2f128_ps(t8, t6, 0x30);
+        c = _mm256_permute2f128_ps(t7, t8, 0x31);
+    }
+
+    // Transpose the 4x4 blocks held in each 128-bit half separately.
+    UME_FORCE_INLINE void transposeLanes4x4(__m256 & r0, __m256 & r1, __m256 & r2, __m256 & r3) {
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m256 const & a, __m256 const & b, __m256 const & c, __m256 const & d,
+                                        __m256 & x, __m256 & y, __m256 & z, __m256 & w) {
+        x = _mm256_permute2f128_ps(a, c, 0x20);
+        y = _mm256_permute2f128_ps(a, c, 0x31);
+        z = _mm256_permute2f128_ps(b, d, 0x20);
+        w = _mm256_permute2f128_ps(b, d, 0x31);
+        transposeLanes4x4(x, y, z, w);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m256 const & x, __m256 const & y, __m256 const & z, __m256 const & w,
+                                      __m256 & a, __m256 & b, __m256 & c, __m256 & d) {
+        __m256 t0 = x, t1 = y, t2 = z, t3 = w;
+        transposeLanes4x4(t0, t1, t2, t3);
+        a = _mm256_permute2f128_ps(t0, t1, 0x20);
+        b = _mm256_permute2f128_ps(t2, t3, 0x20);
+        c = _mm256_permute2f128_ps(t0, t1, 0x31);
+        d = _mm256_permute2f128_ps(t2, t3, 0x31);
+    }
+
+    // 256-bit, double precision
+
+    UME_FORCE_INLINE void deinterleave2(__m256d const & a, __m256d const & b, __m256d & x, __m256d & y) {
+        __m256d t0 = _mm256_permute2f128_pd(a, b, 0x20);
+        __m256d t1 = _mm256_permute2f128_pd(a, b, 0x31);
+        x = _mm256_unpacklo_pd(t0, t1);
+        y = _mm256_unpackhi_pd(t0, t1);
+    }
+
+    UME_FORCE_INLINE void interleave2(__m256d const & x, __m256d const & y, __m256d & a, __m256d & b) {
+        __m256d t0 = _mm256_unpacklo_pd(x, y);
+        __m256d t1 = _mm256_unpackhi_pd(x, y);
+        a = _mm256_permute2f128_pd(t0, t1, 0x20);
+        b = _mm256_permute2f128_pd(t0, t1, 0x31);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m256d const & a, __m256d const & b, __m256d const & c, __m256d & x, __m256d & y, __m256d & z) {
+        __m256d t0 = _mm256_permute2f128_pd(a, b, 0x30);
+        __m256d t1 = _mm256_permute2f128_pd(a, c, 0x21);
+        __m256d t2 = _mm256_permute2f128_pd(b, c, 0x30);
+        x = _mm256_shuffle_pd(t0, t1, 0xA);
+        y = _mm256_shuffle_pd(t0, t2, 0x5);
+        z = _mm256_shuffle_pd(t1, t2, 0xA);
+    }
+
+    UME_FORCE_INLINE void interleave3(__m256d const & x, __m256d const & y, __m256d const & z, __m256d & a, __m256d & b, __m256d & c) {
+        __m256d t0 = _mm256_shuffle_pd(x, y, 0x0);
+        __m256d t1 = _mm256_shuffle_pd(z, x, 0xA);
+        __m256d t2 = _mm256_shuffle_pd(y, z, 0xF);
+        a = _mm256_permute2f128_pd(t0, t1, 0x20);
+        b = _mm256_permute2f128_pd(t2, t0, 0x30);
+        c = _mm256_permute2f128_pd(t1, t2, 0x31);
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m256d const & a, __m256d const & b, __m256d const & c, __m256d const & d,
+                                        __m256d & x, __m256d & y, __m256d & z, __m256d & w) {
+        __m256d t0 = _mm256_permute2f128_pd(a, c, 0x20);
+        __m256d t1 = _mm256_permute2f128_pd(b, d, 0x20);
+        __m256d t2 = _mm256_permute2f128_pd(a, c, 0x31);
+        __m256d t3 = _mm256_permute2f128_pd(b, d, 0x31);
+        x = _mm256_unpacklo_pd(t0, t1);
+        y = _mm256_unpackhi_pd(t0, t1);
+        z = _mm256_unpacklo_pd(t2, t3);
+        w = _mm256_unpackhi_pd(t2, t3);
+    }
+
+    UME_FORCE_INLINE void interleave4(__m256d const & x, __m256d const & y, __m256d const & z, __m256d const & w,
+                                      __m256d & a, __m256d & b, __m256d & c, __m256d & d) {
+        __m256d t0 = _mm256_unpacklo_pd(x, y);
+        __m256d t1 = _mm256_unpackhi_pd(x, y);
+        __m256d t2 = _mm256_unpacklo_pd(z, w);
+        __m256d t3 = _mm256_unpackhi_pd(z, w);
+        a = _mm256_permute2f128_pd(t0, t2, 0x20);
+        b = _mm256_permute2f128_pd(t1, t3, 0x20);
+        c = _mm256_permute2f128_pd(t0, t2, 0x31);
+        d = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+
+    // 512-bit, single precision
+
+    UME_FORCE_INLINE void deinterleave2(__m512 const & a, __m512 const & b, __m512 & x, __m512 & y) {
+        __m512i t0 = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+        __m512i t1 = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+        x = _mm512_permutex2var_ps(a, t0, b);
+        y = _mm512_permutex2var_ps(a, t1, b);
+    }
+
+    UME_FORCE_INLINE void interleave2(__m512 const & x, __m512 const & y, __m512 & a, __m512 & b) {
+        __m512i t0 = _mm512_set_epi32(23, 7, 22, 6, 21, 5, 20, 4, 19, 3, 18, 2, 17, 1, 16, 0);
+        __m512i t1 = _mm512_set_epi32(31, 15, 30, 14, 29, 13, 28, 12, 27, 11, 26, 10, 25, 9, 24, 8);
+        a = _mm512_permutex2var_ps(x, t0, y);
+        b = _mm512_permutex2var_ps(x, t1, y);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m512 const & a, __m512 const & b, __m512 const & c, __m512 & x, __m512 & y, __m512 & z) {
+        __m512i t0 = _mm512_set_epi32(0, 0, 0, 0, 0, 30, 27, 24, 21, 18, 15, 12, 9, 6, 3, 0);
+        __m512i t1 = _mm512_set_epi32(29, 26, 23, 20, 17, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        __m512i t2 = _mm512_set_epi32(0, 0, 0, 0, 0, 31, 28, 25, 22, 19, 16, 13, 10, 7, 4, 1);
+        __m512i t3 = _mm512_set_epi32(30, 27, 24, 21, 18, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        __m512i t4 = _mm512_set_epi32(0, 0, 0, 0, 0, 0, 29, 26, 23, 20, 17, 14, 11, 8, 5, 2);
+        __m512i t5 = _mm512_set_epi32(31, 28, 25, 22, 19, 16, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        x = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, t0, b), t1, c);
+        y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, t2, b), t3, c);
+        z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, t4, b), t5, c);
+    }
+
+    UME_FORCE_INLINE void interleave3(__m512 const & x, __m512 const & y, __m512 const & z, __m512 & a, __m512 & b, __m512 & c) {
+        __m512i t0 = _mm512_set_epi32(5, 0, 20, 4, 0, 19, 3, 0, 18, 2, 0, 17, 1, 0, 16, 0);
+        __m512i t1 = _mm512_set_epi32(15, 20, 13, 12, 19, 10, 9, 18, 7, 6, 17, 4, 3, 16, 1, 0);
+        __m512i t2 = _mm512_set_epi32(26, 10, 0, 25, 9, 0, 24, 8, 0, 23, 7, 0, 22, 6, 0, 21);
+        __m512i t3 = _mm512_set_epi32(15, 14, 25, 12, 11, 24, 9, 8, 23, 6, 5, 22, 3, 2, 21, 0);
+        __m512i t4 = _mm512_set_epi32(0, 31, 15, 0, 30, 14, 0, 29, 13, 0, 28, 12, 0, 27, 11, 0);
+        __m512i t5 = _mm512_set_epi32(31, 14, 13, 30, 11, 10, 29, 8, 7, 28, 5, 4, 27, 2, 1, 26);
+        a = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, t0, y), t1, z);
+        b = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, t2, y), t3, z);
+        c = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, t4, y), t5, z);
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m512 const & a, __m512 const & b, __m512 const & c, __m512 const & d,
+                                        __m512 & x, __m512 & y, __m512 & z, __m512 & w) {
+        __m512i t0 = _mm512_set_epi32(28, 24, 20, 16, 12, 8, 4, 0, 28, 24, 20, 16, 12, 8, 4, 0);
+        __m512i t1 = _mm512_set_epi32(29, 25, 21, 17, 13, 9, 5, 1, 29, 25, 21, 17, 13, 9, 5, 1);
+        __m512i t2 = _mm512_set_epi32(30, 26, 22, 18, 14, 10, 6, 2, 30, 26, 22, 18, 14, 10, 6, 2);
+        __m512i t3 = _mm512_set_epi32(31, 27, 23, 19, 15, 11, 7, 3, 31, 27, 23, 19, 15, 11, 7, 3);
+        x = _mm512_mask_blend_ps(0xFF00, _mm512_permutex2var_ps(a, t0, b), _mm512_permutex2var_ps(c, t0, d));
+        y = _mm512_mask_blend_ps(0xFF00, _mm512_permutex2var_ps(a, t1, b), _mm512_permutex2var_ps(c, t1, d));
+        z = _mm512_mask_blend_ps(0xFF00, _mm512_permutex2var_ps(a, t2, b), _mm512_permutex2var_ps(c, t2, d));
+        w = _mm512_mask_blend_ps(0xFF00, _mm512_permutex2var_ps(a, t3, b), _mm512_permutex2var_ps(c, t3, d));
+    }
+
+    UME_FORCE_INLINE void interleave4(__m512 const & x, __m512 const & y, __m512 const & z, __m512 const & w,
+                                      __m512 & a, __m512 & b, __m512 & c, __m512 & d) {
+        __m512i t0 = _mm512_set_epi32(19, 3, 19, 3, 18, 2, 18, 2, 17, 1, 17, 1, 16, 0, 16, 0);
+        __m512i t1 = _mm512_set_epi32(23, 7, 23, 7, 22, 6, 22, 6, 21, 5, 21, 5, 20, 4, 20, 4);
+        __m512i t2 = _mm512_set_epi32(27, 11, 27, 11, 26, 10, 26, 10, 25, 9, 25, 9, 24, 8, 24, 8);
+        __m512i t3 = _mm512_set_epi32(31, 15, 31, 15, 30, 14, 30, 14, 29, 13, 29, 13, 28, 12, 28, 12);
+        a = _mm512_mask_blend_ps(0xCCCC, _mm512_permutex2var_ps(x, t0, y), _mm512_permutex2var_ps(z, t0, w));
+        b = _mm512_mask_blend_ps(0xCCCC, _mm512_permutex2var_ps(x, t1, y), _mm512_permutex2var_ps(z, t1, w));
+        c = _mm512_mask_blend_ps(0xCCCC, _mm512_permutex2var_ps(x, t2, y), _mm512_permutex2var_ps(z, t2, w));
+        d = _mm512_mask_blend_ps(0xCCCC, _mm512_permutex2var_ps(x, t3, y), _mm512_permutex2var_ps(z, t3, w));
+    }
+
+    // 512-bit, double precision
+
+    UME_FORCE_INLINE void deinterleave2(__m512d const & a, __m512d const & b, __m512d & x, __m512d & y) {
+        __m512i t0 = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+        __m512i t1 = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+        x = _mm512_permutex2var_pd(a, t0, b);
+        y = _mm512_permutex2var_pd(a, t1, b);
+    }
+
+    UME_FORCE_INLINE void interleave2(__m512d const & x, __m512d const & y, __m512d & a, __m512d & b) {
+        __m512i t0 = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+        __m512i t1 = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+        a = _mm512_permutex2var_pd(x, t0, y);
+        b = _mm512_permutex2var_pd(x, t1, y);
+    }
+
+    UME_FORCE_INLINE void deinterleave3(__m512d const & a, __m512d const & b, __m512d const & c, __m512d & x, __m512d & y, __m512d & z) {
+        __m512i t0 = _mm512_set_epi64(0, 0, 15, 12, 9, 6, 3, 0);
+        __m512i t1 = _mm512_set_epi64(13, 10, 5, 4, 3, 2, 1, 0);
+        __m512i t2 = _mm512_set_epi64(0, 0, 0, 13, 10, 7, 4, 1);
+        __m512i t3 = _mm512_set_epi64(14, 11, 8, 4, 3, 2, 1, 0);
+        __m512i t4 = _mm512_set_epi64(0, 0, 0, 14, 11, 8, 5, 2);
+        __m512i t5 = _mm512_set_epi64(15, 12, 9, 4, 3, 2, 1, 0);
+        x = _mm512_permutex2var_pd(_mm512_permutex2var_pd(a, t0, b), t1, c);
+        y = _mm512_permutex2var_pd(_mm512_permutex2var_pd(a, t2, b), t3, c);
+        z = _mm512_permutex2var_pd(_mm512_permutex2var_pd(a, t4, b), t5, c);
+    }
+
+    UME_FORCE_INLINE void interleave3(__m512d const & x, __m512d const & y, __m512d const & z, __m512d & a, __m512d & b, __m512d & c) {
+        __m512i t0 = _mm512_set_epi64(10, 2, 0, 9, 1, 0, 8, 0);
+        __m512i t1 = _mm512_set_epi64(7, 6, 9, 4, 3, 8, 1, 0);
+        __m512i t2 = _mm512_set_epi64(5, 0, 12, 4, 0, 11, 3, 0);
+        __m512i t3 = _mm512_set_epi64(7, 12, 5, 4, 11, 2, 1, 10);
+        __m512i t4 = _mm512_set_epi64(0, 15, 7, 0, 14, 6, 0, 13);
+        __m512i t5 = _mm512_set_epi64(15, 6, 5, 14, 3, 2, 13, 0);
+        a = _mm512_permutex2var_pd(_mm512_permutex2var_pd(x, t0, y), t1, z);
+        b = _mm512_permutex2var_pd(_mm512_permutex2var_pd(x, t2, y), t3, z);
+        c = _mm512_permutex2var_pd(_mm512_permutex2var_pd(x, t4, y), t5, z);
+    }
+
+    UME_FORCE_INLINE void deinterleave4(__m512d const & a, __m512d const & b, __m512d const & c, __m512d const & d,
+                                        __m512d & x, __m512d & y, __m512d & z, __m512d & w) {
+        __m512i t0 = _mm512_set_epi64(12, 8, 4, 0, 12, 8, 4, 0);
+        __m512i t1 = _mm512_set_epi64(13, 9, 5, 1, 13, 9, 5, 1);
+        __m512i t2 = _mm512_set_epi64(14, 10, 6, 2, 14, 10, 6, 2);
+        __m512i t3 = _mm512_set_epi64(15, 11, 7, 3, 15, 11, 7, 3);
+        x = _mm512_mask_blend_pd(0xF0, _mm512_permutex2var_pd(a, t0, b), _mm512_permutex2var_pd(c, t0, d));
+        y = _mm512_mask_blend_pd(0xF0, _mm512_permutex2var_pd(a, t1, b), _mm512_permutex2var_pd(c, t1, d));
+        z = _mm512_mask_blend_pd(0xF0, _mm512_permutex2var_pd(a, t2, b), _mm512_permutex2var_pd(c, t2, d));
+        w = _mm512_mask_blend_pd(0xF0, _mm512_permutex2var_pd(a, t3, b), _mm512_permutex2var_pd(c, t3, d));
+    }
+
+    UME_FORCE_INLINE void interleave4(__m512d const & x, __m512d const & y, __m512d const & z, __m512d const & w,
+                                      __m512d & a, __m512d & b, __m512d & c, __m512d & d) {
+        __m512i t0 = _mm512_set_epi64(9, 1, 9, 1, 8, 0, 8, 0);
+        __m512i t1 = _mm512_set_epi64(11, 3, 11, 3, 10, 2, 10, 2);
+        __m512i t2 = _mm512_set_epi64(13, 5, 13, 5, 12, 4, 12, 4);
+        __m512i t3 = _mm512_set_epi64(15, 7, 15, 7, 14, 6, 14, 6);
+        a = _mm512_mask_blend_pd(0xCC, _mm512_permutex2var_pd(x, t0, y), _mm512_permutex2var_pd(z, t0, w));
+        b = _mm512_mask_blend_pd(0xCC, _mm512_permutex2var_pd(x, t1, y), _mm512_permutex2var_pd(z, t1, w));
+        c = _mm512_mask_blend_pd(0xCC, _mm512_permutex2var_pd(x, t2, y), _mm512_permutex2var_pd(z, t2, w));
+        d = _mm512_mask_blend_pd(0xCC, _mm512_permutex2var_pd(x, t3, y), _mm512_permutex2var_pd(z, t3, w));
+    }
+
+    // Matrix transpose
+
+    UME_FORCE_INLINE void transpose4x4(__m128 & r0, __m128 & r1, __m128 & r2, __m128 & r3) {
+        __m128 t0 = _mm_unpacklo_ps(r0, r1);
+        __m128 t1 = _mm_unpacklo_ps(r2, r3);
+        __m128 t2 = _mm_unpackhi_ps(r0, r1);
+        __m128 t3 = _mm_unpackhi_ps(r2, r3);
+        r0 = _mm_movelh_ps(t0, t1);
+        r1 = _mm_movehl_ps(t1, t0);
+        r2 = _mm_movelh_ps(t2, t3);
+        r3 = _mm_movehl_ps(t3, t2);
+    }
+
+    UME_FORCE_INLINE void transpose2x2(__m128d & r0, __m128d & r1) {
+        __m128d t0 = _mm_unpacklo_pd(r0, r1);
+        r1 = _mm_unpackhi_pd(r0, r1);
+        r0 = t0;
+    }
+
+    UME_FORCE_INLINE void transpose8x8(__m256 & r0, __m256 & r1, __m256 & r2, __m256 & r3, __m256 & r4, __m256 & r5, __m256 & r6, __m256 & r7) {
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+        __m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44);
+        __m256 u1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+        __m256 u2 = _mm256_shuffle_ps(t1, t3, 0x44);
+        __m256 u3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+        __m256 u4 = _mm256_shuffle_ps(t4, t6, 0x44);
+        __m256 u5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+        __m256 u6 = _mm256_shuffle_ps(t5, t7, 0x44);
+        __m256 u7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+        r0 = _mm256_permute2f128_ps(u0, u4, 0x20);
+        r4 = _mm256_permute2f128_ps(u0, u4, 0x31);
+        r1 = _mm256_permute2f128_ps(u1, u5, 0x20);
+        r5 = _mm256_permute2f128_ps(u1, u5, 0x31);
+        r2 = _mm256_permute2f128_ps(u2, u6, 0x20);
+        r6 = _mm256_permute2f128_ps(u2, u6, 0x31);
+        r3 = _mm256_permute2f128_ps(u3, u7, 0x20);
+        r7 = _mm256_permute2f128_ps(u3, u7, 0x31);
+    }
+
+    UME_FORCE_INLINE void transpose4x4(__m256d & r0, __m256d & r1, __m256d & r2, __m256d & r3) {
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+        r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+        r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+        r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+    UME_FORCE_INLINE void transpose16x16(__m512 & r0, __m512 & r1, __m512 & r2, __m512 & r3, __m512 & r4, __m512 & r5, __m512 & r6, __m512 & r7, __m512 & r8, __m512 & r9, __m512 & r10, __m512 & r11, __m512 & r12, __m512 & r13, __m512 & r14, __m512 & r15) {
+        __m512 t0 = _mm512_unpacklo_ps(r0, r1);
+        __m512 t1 = _mm512_unpackhi_ps(r0, r1);
+        __m512 t2 = _mm512_unpacklo_ps(r2, r3);
+        __m512 t3 = _mm512_unpackhi_ps(r2, r3);
+        __m512 t4 = _mm512_unpacklo_ps(r4, r5);
+        __m512 t5 = _mm512_unpackhi_ps(r4, r5);
+        __m512 t6 = _mm512_unpacklo_ps(r6, r7);
+        __m512 t7 = _mm512_unpackhi_ps(r6, r7);
+        __m512 t8 = _mm512_unpacklo_ps(r8, r9);
+        __m512 t9 = _mm512_unpackhi_ps(r8, r9);
+        __m512 t10 = _mm512_unpacklo_ps(r10, r11);
+        __m512 t11 = _mm512_unpackhi_ps(r10, r11);
+        __m512 t12 = _mm512_unpacklo_ps(r12, r13);
+        __m512 t13 = _mm512_unpackhi_ps(r12, r13);
+        __m512 t14 = _mm512_unpacklo_ps(r14, r15);
+        __m512 t15 = _mm512_unpackhi_ps(r14, r15);
+        __m512 u0 = _mm512_shuffle_ps(t0, t2, 0x44);
+        __m512 u1 = _mm512_shuffle_ps(t0, t2, 0xEE);
+        __m512 u2 = _mm512_shuffle_ps(t1, t3, 0x44);
+        __m512 u3 = _mm512_shuffle_ps(t1, t3, 0xEE);
+        __m512 u4 = _mm512_shuffle_ps(t4, t6, 0x44);
+        __m512 u5 = _mm512_shuffle_ps(t4, t6, 0xEE);
+        __m512 u6 = _mm512_shuffle_ps(t5, t7, 0x44);
+        __m512 u7 = _mm512_shuffle_ps(t5, t7, 0xEE);
+        __m512 u8 = _mm512_shuffle_ps(t8, t10, 0x44);
+        __m512 u9 = _mm512_shuffle_ps(t8, t10, 0xEE);
+        __m512 u10 = _mm512_shuffle_ps(t9, t11, 0x44);
+        __m512 u11 = _mm512_shuffle_ps(t9, t11, 0xEE);
+        __m512 u12 = _mm512_shuffle_ps(t12, t14, 0x44);
+        __m512 u13 = _mm512_shuffle_ps(t12, t14, 0xEE);
+        __m512 u14 = _mm512_shuffle_ps(t13, t15, 0x44);
+        __m512 u15 = _mm512_shuffle_ps(t13, t15, 0xEE);
+        t0 = _mm512_shuffle_f32x4(u0, u4, 0x88);
+        t1 = _mm512_shuffle_f32x4(u0, u4, 0xDD);
+        t2 = _mm512_shuffle_f32x4(u8, u12, 0x88);
+        t3 = _mm512_shuffle_f32x4(u8, u12, 0xDD);
+        t4 = _mm512_shuffle_f32x4(u1, u5, 0x88);
+        t5 = _mm512_shuffle_f32x4(u1, u5, 0xDD);
+        t6 = _mm512_shuffle_f32x4(u9, u13, 0x88);
+        t7 = _mm512_shuffle_f32x4(u9, u13, 0xDD);
+        t8 = _mm512_shuffle_f32x4(u2, u6, 0x88);
+        t9 = _mm512_shuffle_f32x4(u2, u6, 0xDD);
+        t10 = _mm512_shuffle_f32x4(u10, u14, 0x88);
+        t11 = _mm512_shuffle_f32x4(u10, u14, 0xDD);
+        t12 = _mm512_shuffle_f32x4(u3, u7, 0x88);
+        t13 = _mm512_shuffle_f32x4(u3, u7, 0xDD);
+        t14 = _mm512_shuffle_f32x4(u11, u15, 0x88);
+        t15 = _mm512_shuffle_f32x4(u11, u15, 0xDD);
+        r0 = _mm512_shuffle_f32x4(t0, t2, 0x88);
+        r4 = _mm512_shuffle_f32x4(t1, t3, 0x88);
+        r8 = _mm512_shuffle_f32x4(t0, t2, 0xDD);
+        r12 = _mm512_shuffle_f32x4(t1, t3, 0xDD);
+        r1 = _mm512_shuffle_f32x4(t4, t6, 0x88);
+        r5 = _mm512_shuffle_f32x4(t5, t7, 0x88);
+        r9 = _mm512_shuffle_f32x4(t4, t6, 0xDD);
+        r13 = _mm512_shuffle_f32x4(t5, t7, 0xDD);
+        r2 = _mm512_shuffle_f32x4(t8, t10, 0x88);
+        r6 = _mm512_shuffle_f32x4(t9, t11, 0x88);
+        r10 = _mm512_shuffle_f32x4(t8, t10, 0xDD);
+        r14 = _mm512_shuffle_f32x4(t9, t11, 0xDD);
+        r3 = _mm512_shuffle_f32x4(t12, t14, 0x88);
+        r7 = _mm512_shuffle_f32x4(t13, t15, 0x88);
+        r11 = _mm512_shuffle_f32x4(t12, t14, 0xDD);
+        r15 = _mm512_shuffle_f32x4(t13, t15, 0xDD);
+    }
+
+    UME_FORCE_INLINE void transpose8x8(__m512d & r0, __m512d & r1, __m512d & r2, __m512d & r3, __m512d & r4, __m512d & r5, __m512d & r6, __m512d & r7) {
+        __m512d t0 = _mm512_unpacklo_pd(r0, r1);
+        __m512d t1 = _mm512_unpackhi_pd(r0, r1);
+        __m512d t2 = _mm512_unpacklo_pd(r2, r3);
+        __m512d t3 = _mm512_unpackhi_pd(r2, r3);
+        __m512d t4 = _mm512_unpacklo_pd(r4, r5);
+        __m512d t5 = _mm512_unpackhi_pd(r4, r5);
+        __m512d t6 = _mm512_unpacklo_pd(r6, r7);
+        __m512d t7 = _mm512_unpackhi_pd(r6, r7);
+        __m512d u0 = _mm512_shuffle_f64x2(t0, t2, 0x88);
+        __m512d u1 = _mm512_shuffle_f64x2(t0, t2, 0xDD);
+        __m512d u2 = _mm512_shuffle_f64x2(t4, t6, 0x88);
+        __m512d u3 = _mm512_shuffle_f64x2(t4, t6, 0xDD);
+        __m512d u4 = _mm512_shuffle_f64x2(t1, t3, 0x88);
+        __m512d u5 = _mm512_shuffle_f64x2(t1, t3, 0xDD);
+        __m512d u6 = _mm512_shuffle_f64x2(t5, t7, 0x88);
+        __m512d u7 = _mm512_shuffle_f64x2(t5, t7, 0xDD);
+        r0 = _mm512_shuffle_f64x2(u0, u2, 0x88);
+        r2 = _mm512_shuffle_f64x2(u1, u3, 0x88);
+        r4 = _mm512_shuffle_f64x2(u0, u2, 0xDD);
+        r6 = _mm512_shuffle_f64x2(u1, u3, 0xDD);
+        r1 = _mm512_shuffle_f64x2(u4, u6, 0x88);
+        r3 = _mm512_shuffle_f64x2(u5, u7, 0x88);
+        r5 = _mm512_shuffle_f64x2(u4, u6, 0xDD);
+        r7 = _mm512_shuffle_f64x2(u5, u7, 0xDD);
+    }
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,263 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_SORT_AVX512_H_
+#define UME_SIMD_SORT_AVX512_H_
+
+#include <immintrin.h>
+
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+// Sorting networks used by SORTA/SORTD of 32-bit vectors.
+//
+// The networks are bitonic sorters written in 'xor' form: in a stage with
+// distance D every lane i is compared with lane i^D, and keeps the larger of
+// the two values if (i & msb(D)) is set, or the smaller one otherwise.
+// 4, 8 and 16 elements are sorted with stages D = 1, 3, 1, then 7, 2, 1,
+// then 15, 4, 2, 1. Swapping min and max everywhere gives descending order.
+//
+// Permutations and blends are done in float domain, and only min/max depend
+// on the element type. In the key-value variant a payload element follows
+// its key: it is exchanged with its partner whenever the key changes.
+
+namespace UME {
+namespace SIMD {
+namespace AVX512 {
+
+    template<typename SCALAR_TYPE> struct SortOps;
+
+    template<> struct SortOps<float> {
+        static UME_FORCE_INLINE __m128 vmin(__m128 const & a, __m128 const & b) { return _mm_min_ps(a, b); }
+        static UME_FORCE_INLINE __m128 vmax(__m128 const & a, __m128 const & b) { return _mm_max_ps(a, b); }
+        static UME_FORCE_INLINE __m256 vmin(__m256 const & a, __m256 const & b) { return _mm256_min_ps(a, b); }
+        static UME_FORCE_INLINE __m256 vmax(__m256 const & a, __m256 const & b) { return _mm256_max_ps(a, b); }
+        static UME_FORCE_INLINE __m512 vmin(__m512 const & a, __m512 const & b) { return _mm512_min_ps(a, b); }
+        static UME_FORCE_INLINE __m512 vmax(__m512 const & a, __m512 const & b) { return _mm512_max_ps(a, b); }
+    };
+
+    template<> struct SortOps<int32_t> {
+        static UME_FORCE_INLINE __m128 vmin(__m128 const & a, __m128 const & b) {
+            return _mm_castsi128_ps(_mm_min_epi32(_mm_castps_si128(a), _mm_castps_si128(b)));
+        }
+        static UME_FORCE_INLINE __m128 vmax(__m128 const & a, __m128 const & b) {
+            return _mm_castsi128_ps(_mm_max_epi32(_mm_castps_si128(a), _mm_castps_si128(b)));
+        }
+        static UME_FORCE_INLINE __m256 vmin(__m256 const & a, __m256 const & b) {
+            return _mm256_castsi256_ps(_mm256_min_epi32(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+        }
+        static UME_FORCE_INLINE __m256 vmax(__m256 const & a, __m256 const & b) {
+            return _mm256_castsi256_ps(_mm256_max_epi32(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+        }
+        static UME_FORCE_INLINE __m512 vmin(__m512 const & a, __m512 const & b) {
+            return _mm512_castsi512_ps(_mm512_min_epi32(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+        }
+        static UME_FORCE_INLINE __m512 vmax(__m512 const & a, __m512 const & b) {
+            return _mm512_castsi512_ps(_mm512_max_epi32(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+        }
+    };
+
+    template<> struct SortOps<uint32_t> {
+        static UME_FORCE_INLINE __m128 vmin(__m128 const & a, __m128 const & b) {
+            return _mm_castsi128_ps(_mm_min_epu32(_mm_castps_si128(a), _mm_castps_si128(b)));
+        }
+        static UME_FORCE_INLINE __m128 vmax(__m128 const & a, __m128 const & b) {
+            return _mm_castsi128_ps(_mm_max_epu32(_mm_castps_si128(a), _mm_castps_si128(b)));
+        }
+        static UME_FORCE_INLINE __m256 vmin(__m256 const & a, __m256 const & b) {
+            return _mm256_castsi256_ps(_mm256_min_epu32(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+        }
+        static UME_FORCE_INLINE __m256 vmax(__m256 const & a, __m256 const & b) {
+            return _mm256_castsi256_ps(_mm256_max_epu32(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+        }
+        static UME_FORCE_INLINE __m512 vmin(__m512 const & a, __m512 const & b) {
+            return _mm512_castsi512_ps(_mm512_min_epu32(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+        }
+        static UME_FORCE_INLINE __m512 vmax(__m512 const & a, __m512 const & b) {
+            return _mm512_castsi512_ps(_mm512_max_epu32(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+        }
+    };
+
+    // Shuffle immediate moving element i^D to position i (within 128 bits).
+    template<int D> struct SortXorImm {
+        static const int value = (0 ^ D) | ((1 ^ D) << 2) | ((2 ^ D) << 4) | ((3 ^ D) << 6);
+    };
+
+    // Blend immediate of the lanes keeping the larger value in a stage with distance D.
+    template<int D, int LANES, bool DESCENDING> struct SortMaxLanes {
+        static const int pattern = (D >= 8) ? 0xFF00 : (D >= 4) ? 0xF0F0 : (D >= 2) ? 0xCCCC : 0xAAAA;
+        static const int value = (DESCENDING ? ~pattern : pattern) & ((1 << LANES) - 1);
+    };
+
+    template<int D>
+    UME_FORCE_INLINE __m128 sortPermute(__m128 const & a) {
+        return _mm_permute_ps(a, SortXorImm<D>::value);
+    }
+
+    template<int D>
+    UME_FORCE_INLINE __m256 sortPermute(__m256 const & a) {
+        __m256 t0 = (D & 4) ? _mm256_permute2f128_ps(a, a, 0x01) : a;
+        return (D & 3) ? _mm256_permute_ps(t0, SortXorImm<D & 3>::value) : t0;
+    }
+
+    template<int D>
+    UME_FORCE_INLINE __m512 sortPermute(__m512 const & a) {
+        __m512 t0 = (D & 12) ? _mm512_shuffle_f32x4(a, a, SortXorImm<(D >> 2)>::value) : a;
+        return (D & 3) ? _mm512_permute_ps(t0, SortXorImm<D & 3>::value) : t0;
+    }
+
+    // Keep 'payload' where the keys did not change, and take 'exchanged' otherwise.
+    UME_FORCE_INLINE __m128 sortFollowKeys(__m128 const & newKeys, __m128 const & oldKeys, __m128 const & payload, __m128 const & exchanged) {
+        __m128 t0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_castps_si128(newKeys), _mm_castps_si128(oldKeys)));
+        return _mm_blendv_ps(exchanged, payload, t0);
+    }
+
+    UME_FORCE_INLINE __m256 sortFollowKeys(__m256 const & newKeys, __m256 const & oldKeys, __m256 const & payload, __m256 const & exchanged) {
+        __m256 t0 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_castps_si256(newKeys), _mm256_castps_si256(oldKeys)));
+        return _mm256_blendv_ps(exchanged, payload, t0);
+    }
+
+    UME_FORCE_INLINE __m512 sortFollowKeys(__m512 const & newKeys, __m512 const & oldKeys, __m512 const & payload, __m512 const & exchanged) {
+        __mmask16 t0 = _mm512_cmpeq_epi32_mask(_mm512_castps_si512(newKeys), _mm512_castps_si512(oldKeys));
+        return _mm512_mask_blend_ps(t0, exchanged, payload);
+    }
+
+    template<typename SCALAR_TYPE, int D, bool DESCENDING>
+    UME_FORCE_INLINE __m128 sortStage(__m128 const & keys) {
+        __m128 t0 = sortPermute<D>(keys);
+        __m128 t1 = SortOps<SCALAR_TYPE>::vmin(keys, t0);
+        __m128 t2 = SortOps<SCALAR_TYPE>::vmax(keys, t0);
+        return _mm_blend_ps(t1, t2, (SortMaxLanes<D, 4, DESCENDING>::value));
+    }
+
+    template<typename SCALAR_TYPE, int D, bool DESCENDING>
+    UME_FORCE_INLINE __m256 sortStage(__m256 const & keys) {
+        __m256 t0 = sortPermute<D>(keys);
+        __m256 t1 = SortOps<SCALAR_TYPE>::vmin(keys, t0);
+        __m256 t2 = SortOps<SCALAR_TYPE>::vmax(keys, t0);
+        return _mm256_blend_ps(t1, t2, (SortMaxLanes<D, 8, DESCENDING>::value));
+    }
+
+    template<typename SCALAR_TYPE, int D, bool DESCENDING>
+    UME_FORCE_INLINE __m512 sortStage(__m512 const & keys) {
+        __m512 t0 = sortPermute<D>(keys);
+        __m512 t1 = SortOps<SCALAR_TYPE>::vmin(keys, t0);
+        __m512 t2 = SortOps<SCALAR_TYPE>::vmax(keys, t0);
+        return _mm512_mask_blend_ps(__mmask16(SortMaxLanes<D, 16, DESCENDING>::value), t1, t2);
+    }
+
+    template<typename SCALAR_TYPE, int D, bool DESCENDING>
+    UME_FORCE_INLINE void sortStage(__m128 & keys, __m128 & payload) {
+        __m128 t0 = sortStage<SCALAR_TYPE, D, DESCENDING>(keys);
+        payload = sortFollowKeys(t0, keys, payload, sortPermute<D>(payload));
+        keys = t0;
+    }
+
+    template<typename SCALAR_TYPE, int D, bool DESCENDING>
+    UME_FORCE_INLINE void sortStage(__m256 & keys, __m256 & payload) {
+        __m256 t0 = sortStage<SCALAR_TYPE, D, DESCENDING>(keys);
+        payload = sortFollowKeys(t0, keys, payload, sortPermute<D>(payload));
+        keys = t0;
+    }
+
+    template<typename SCALAR_TYPE, int D, bool DESCENDING>
+    UME_FORCE_INLINE void sortStage(__m512 & keys, __m512 & payload) {
+        __m512 t0 = sortStage<SCALAR_TYPE, D, DESCENDING>(keys);
+        payload = sortFollowKeys(t0, keys, payload, sortPermute<D>(payload));
+        keys = t0;
+    }
+
+    template<typename SCALAR_TYPE, bool DESCENDING>
+    UME_FORCE_INLINE __m128 sortNetwork4(__m128 const & keys) {
+        __m128 t0 = sortStage<SCALAR_TYPE, 1, DESCENDING>(keys);
+        __m128 t1 = sortStage<SCALAR_TYPE, 3, DESCENDING>(t0);
+        return sortStage<SCALAR_TYPE, 1, DESCENDING>(t1);
+    }
+
+    template<typename SCALAR_TYPE, bool DESCENDING>
+    UME_FORCE_INLINE void sortNetwork4(__m128 & keys, __m128 & payload) {
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 3, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+    }
+
+    template<typename SCALAR_TYPE, bool DESCENDING>
+    UME_FORCE_INLINE __m256 sortNetwork8(__m256 const & keys) {
+        __m256 t0 = sortStage<SCALAR_TYPE, 1, DESCENDING>(keys);
+        __m256 t1 = sortStage<SCALAR_TYPE, 3, DESCENDING>(t0);
+        __m256 t2 = sortStage<SCALAR_TYPE, 1, DESCENDING>(t1);
+        __m256 t3 = sortStage<SCALAR_TYPE, 7, DESCENDING>(t2);
+        __m256 t4 = sortStage<SCALAR_TYPE, 2, DESCENDING>(t3);
+        return sortStage<SCALAR_TYPE, 1, DESCENDING>(t4);
+    }
+
+    template<typename SCALAR_TYPE, bool DESCENDING>
+    UME_FORCE_INLINE void sortNetwork8(__m256 & keys, __m256 & payload) {
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 3, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 7, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 2, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+    }
+
+    template<typename SCALAR_TYPE, bool DESCENDING>
+    UME_FORCE_INLINE __m512 sortNetwork16(__m512 const & keys) {
+        __m512 t0 = sortStage<SCALAR_TYPE, 1, DESCENDING>(keys);
+        __m512 t1 = sortStage<SCALAR_TYPE, 3, DESCENDING>(t0);
+        __m512 t2 = sortStage<SCALAR_TYPE, 1, DESCENDING>(t1);
+        __m512 t3 = sortStage<SCALAR_TYPE, 7, DESCENDING>(t2);
+        __m512 t4 = sortStage<SCALAR_TYPE, 2, DESCENDING>(t3);
+        __m512 t5 = sortStage<SCALAR_TYPE, 1, DESCENDING>(t4);
+        __m512 t6 = sortStage<SCALAR_TYPE, 15, DESCENDING>(t5);
+        __m512 t7 = sortStage<SCALAR_TYPE, 4, DESCENDING>(t6);
+        __m512 t8 = sortStage<SCALAR_TYPE, 2, DESCENDING>(t7);
+        return sortStage<SCALAR_TYPE, 1, DESCENDING>(t8);
+    }
+
+    template<typename SCALAR_TYPE, bool DESCENDING>
+    UME_FORCE_INLINE void sortNetwork16(__m512 & keys, __m512 & payload) {
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 3, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 7, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 2, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 15, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 4, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 2, DESCENDING>(keys, payload);
+        sortStage<SCALAR_TYPE, 1, DESCENDING>(keys, payload);
+    }
+
+}
+}
+}
+
+#endif
@@ -150,6 +150,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         //(Memory access)
         // LOAD
@@ -773,22 +775,22 @@ namespace SIMD {
 
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec * b.mVec + c.mVec;
+            float t0 = std::fma(mVec, b.mVec, c.mVec);
             return SIMDVec_f(t0);
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<1> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = (mask.mMask == true) ? (mVec * b.mVec + c.mVec) : mVec;
+            float t0 = (mask.mMask == true) ? std::fma(mVec, b.mVec, c.mVec) : mVec;
             return SIMDVec_f(t0);
         }
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec * b.mVec - c.mVec;
+            float t0 = std::fma(mVec, b.mVec, -c.mVec);
             return SIMDVec_f(t0);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<1> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = (mask.mMask == true) ? (mVec * b.mVec - c.mVec) : mVec;
+            float t0 = (mask.mMask == true) ? std::fma(mVec, b.mVec, -c.mVec) : mVec;
             return SIMDVec_f(t0);
         }
         // FADDMULV
@@ -811,6 +813,26 @@ namespace SIMD {
             float t0 = (mask.mMask == true) ? ((mVec - b.mVec) * c.mVec) : mVec;
             return SIMDVec_f(t0);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = std::fma(-mVec, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<1> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = (mask.mMask == true) ? std::fma(-mVec, b.mVec, c.mVec) : mVec;
+            return SIMDVec_f(t0);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = std::fma(-mVec, b.mVec, -c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<1> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = (mask.mMask == true) ? std::fma(-mVec, b.mVec, -c.mVec) : mVec;
+            return SIMDVec_f(t0);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
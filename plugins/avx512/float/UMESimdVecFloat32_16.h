@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -175,6 +177,31 @@ namespace SIMD {
             mVec = _mm512_mask_loadu_ps(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __mmask16 t0 = __mmask16((count >= 16) ? 0xFFFF : ((1 << count) - 1));
+            mVec = _mm512_maskz_loadu_ps(t0, p);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m512 t0 = _mm512_loadu_ps(p);
+            __m512 t1 = _mm512_loadu_ps(p + 16);
+            AVX512::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m512 t0 = _mm512_loadu_ps(p);
+            __m512 t1 = _mm512_loadu_ps(p + 16);
+            __m512 t2 = _mm512_loadu_ps(p + 32);
+            AVX512::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m512 t0 = _mm512_loadu_ps(p);
+            __m512 t1 = _mm512_loadu_ps(p + 16);
+            __m512 t2 = _mm512_loadu_ps(p + 32);
+            __m512 t3 = _mm512_loadu_ps(p + 48);
+            AVX512::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec = _mm512_load_ps(p);
@@ -195,6 +222,45 @@ namespace SIMD {
             _mm512_mask_storeu_ps(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE float * storeTail(float * p, uint32_t count) const {
+            __mmask16 t0 = __mmask16((count >= 16) ? 0xFFFF : ((1 << count) - 1));
+            _mm512_mask_storeu_ps(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m512 t0, t1;
+            AVX512::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm512_storeu_ps(p, t0);
+            _mm512_storeu_ps(p + 16, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m512 t0, t1, t2;
+            AVX512::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm512_storeu_ps(p, t0);
+            _mm512_storeu_ps(p + 16, t1);
+            _mm512_storeu_ps(p + 32, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m512 t0, t1, t2, t3;
+            AVX512::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm512_storeu_ps(p, t0);
+            _mm512_storeu_ps(p + 16, t1);
+            _mm512_storeu_ps(p + 32, t2);
+            _mm512_storeu_ps(p + 48, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(
+            SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3, SIMDVec_f & v4, SIMDVec_f & v5, SIMDVec_f & v6, SIMDVec_f & v7,
+            SIMDVec_f & v8, SIMDVec_f & v9, SIMDVec_f & v10, SIMDVec_f & v11, SIMDVec_f & v12, SIMDVec_f & v13, SIMDVec_f & v14, SIMDVec_f & v15) {
+            AVX512::transpose16x16(
+                v0.mVec, v1.mVec, v2.mVec, v3.mVec, v4.mVec, v5.mVec, v6.mVec, v7.mVec,
+                v8.mVec, v9.mVec, v10.mVec, v11.mVec, v12.mVec, v13.mVec, v14.mVec, v15.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float * p) const {
             _mm512_store_ps(p, mVec);
@@ -205,6 +271,16 @@ namespace SIMD {
             _mm512_mask_store_ps(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float* p) const {
+            _mm512_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<16> const & mask, float* p) const {
+            // There is no masked streaming store.
+            return storea(mask, p);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m512 t0 = _mm512_add_ps(mVec, b.mVec);
@@ -642,6 +718,20 @@ namespace SIMD {
             mVec = _mm512_mask_mul_ps(mVec, mask.mMask, t0, t1);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            return SIMDVec_f(_mm512_rcp14_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            return SIMDVec_f(_mm512_rsqrt14_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<16> cmpeq(SIMDVec_f const & b) const {
             __mmask16 t0 = _mm512_cmp_ps_mask(mVec, b.mVec, 0);
@@ -772,6 +862,32 @@ namespace SIMD {
             __mmask16 t0 = _mm512_cmp_ps_mask(mVec, _mm512_set1_ps(b), 0);
             return (t0 == 0xFFFF);
         }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<16> const & mask) const {
+            return SIMDVec_f(_mm512_maskz_compress_ps(mask.mMask, mVec));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<16> const & mask, float * p) const {
+            _mm512_mask_compressstoreu_ps(p, mask.mMask, mVec);
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<16> const & mask, float const * p) {
+            mVec = _mm512_mask_expandloadu_ps(mVec, mask.mMask, p);
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_f(_mm512_permutexvar_ps(indices.mVec, mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_f(_mm512_mask_permutexvar_ps(mVec, mask.mMask, indices.mVec, mVec));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_f(_mm512_permutex2var_ps(mVec, indices.mVec, b.mVec));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
             __m512 t0 = _mm512_mask_mov_ps(mVec, mask.mMask, b.mVec);
@@ -785,6 +901,41 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m512 t0 = AVX512::sortNetwork16<float, false>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 16> & payload) {
+            __m512 t0 = mVec;
+            __m512 t1 = _mm512_castsi512_ps(payload.mVec);
+            AVX512::sortNetwork16<float, false>(t0, t1);
+            payload.mVec = _mm512_castps_si512(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m512 t0 = AVX512::sortNetwork16<float, true>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 16> & payload) {
+            __m512 t0 = mVec;
+            __m512 t1 = _mm512_castsi512_ps(payload.mVec);
+            AVX512::sortNetwork16<float, true>(t0, t1);
+            payload.mVec = _mm512_castps_si512(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // HADD
         UME_FORCE_INLINE float hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -991,6 +1142,26 @@ namespace SIMD {
             __m512 t1 = _mm512_mask_mul_ps(mVec, mask.mMask, t0, c.mVec);
             return SIMDVec_f(t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512 t0 = _mm512_fnmadd_ps(mVec, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512 t0 = _mm512_mask_fnmadd_ps(mVec, mask.mMask, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512 t0 = _mm512_fnmsub_ps(mVec, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512 t0 = _mm512_mask_fnmsub_ps(mVec, mask.mMask, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
             __m512 t0 = _mm512_max_ps(mVec, b.mVec);
@@ -1386,9 +1557,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m512 t0 = _mm512_roundscale_ps(mVec, 0);
@@ -1642,6 +1825,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -1661,9 +1852,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -1722,9 +1925,33 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<16>>(*this, b);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 8> const & a, SIMDVec_f<float, 8> const & b) {
 #if defined(__AVX512DQ__)
@@ -182,6 +182,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -875,26 +877,26 @@ namespace SIMD {
 
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec[0] * b.mVec[0] + c.mVec[0];
-            float t1 = mVec[1] * b.mVec[1] + c.mVec[1];
+            float t0 = std::fma(mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = std::fma(mVec[1], b.mVec[1], c.mVec[1]);
             return SIMDVec_f(t0, t1);
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = ((mask.mMask & 0x1) != 0) ? (mVec[0] * b.mVec[0] + c.mVec[0]) : mVec[0];
-            float t1 = ((mask.mMask & 0x2) != 0) ? (mVec[1] * b.mVec[1] + c.mVec[1]) : mVec[1];
+            float t0 = ((mask.mMask & 0x1) != 0) ? std::fma(mVec[0], b.mVec[0], c.mVec[0]) : mVec[0];
+            float t1 = ((mask.mMask & 0x2) != 0) ? std::fma(mVec[1], b.mVec[1], c.mVec[1]) : mVec[1];
             return SIMDVec_f(t0, t1);
         }
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec[0] * b.mVec[0] - c.mVec[0];
-            float t1 = mVec[1] * b.mVec[1] - c.mVec[1];
+            float t0 = std::fma(mVec[0], b.mVec[0], -c.mVec[0]);
+            float t1 = std::fma(mVec[1], b.mVec[1], -c.mVec[1]);
             return SIMDVec_f(t0, t1);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = ((mask.mMask & 0x1) != 0) ? (mVec[0] * b.mVec[0] - c.mVec[0]) : mVec[0];
-            float t1 = ((mask.mMask & 0x2) != 0) ? (mVec[1] * b.mVec[1] - c.mVec[1]) : mVec[1];
+            float t0 = ((mask.mMask & 0x1) != 0) ? std::fma(mVec[0], b.mVec[0], -c.mVec[0]) : mVec[0];
+            float t1 = ((mask.mMask & 0x2) != 0) ? std::fma(mVec[1], b.mVec[1], -c.mVec[1]) : mVec[1];
             return SIMDVec_f(t0, t1);
         }
         // FADDMULV
@@ -921,6 +923,30 @@ namespace SIMD {
             float t1 = ((mask.mMask & 0x2) != 0) ? ((mVec[1] - b.mVec[1]) * c.mVec[1]) : mVec[1];
             return SIMDVec_f(t0, t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = std::fma(-mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = std::fma(-mVec[1], b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = ((mask.mMask & 0x1) != 0) ? std::fma(-mVec[0], b.mVec[0], c.mVec[0]) : mVec[0];
+            float t1 = ((mask.mMask & 0x2) != 0) ? std::fma(-mVec[1], b.mVec[1], c.mVec[1]) : mVec[1];
+            return SIMDVec_f(t0, t1);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = std::fma(-mVec[0], b.mVec[0], -c.mVec[0]);
+            float t1 = std::fma(-mVec[1], b.mVec[1], -c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            float t0 = ((mask.mMask & 0x1) != 0) ? std::fma(-mVec[0], b.mVec[0], -c.mVec[0]) : mVec[0];
+            float t1 = ((mask.mMask & 0x2) != 0) ? std::fma(-mVec[1], b.mVec[1], -c.mVec[1]) : mVec[1];
+            return SIMDVec_f(t0, t1);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
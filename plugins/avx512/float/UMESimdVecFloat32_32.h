@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -215,6 +216,34 @@ namespace SIMD {
             mVec[1] = _mm512_mask_loadu_ps(mVec[1], m1, p + 16);
             return *this;
         }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 32 * i;
+                __m512 t1 = _mm512_loadu_ps(t0);
+                __m512 t2 = _mm512_loadu_ps(t0 + 16);
+                AVX512::deinterleave2(t1, t2, v0.mVec[i], v1.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 48 * i;
+                __m512 t1 = _mm512_loadu_ps(t0);
+                __m512 t2 = _mm512_loadu_ps(t0 + 16);
+                __m512 t3 = _mm512_loadu_ps(t0 + 32);
+                AVX512::deinterleave3(t1, t2, t3, v0.mVec[i], v1.mVec[i], v2.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            for (int i = 0; i < 2; i++) {
+                float const * t0 = p + 64 * i;
+                __m512 t1 = _mm512_loadu_ps(t0);
+                __m512 t2 = _mm512_loadu_ps(t0 + 16);
+                __m512 t3 = _mm512_loadu_ps(t0 + 32);
+                __m512 t4 = _mm512_loadu_ps(t0 + 48);
+                AVX512::deinterleave4(t1, t2, t3, t4, v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i]);
+            }
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec[0] = _mm512_load_ps(p);
@@ -243,6 +272,40 @@ namespace SIMD {
             _mm512_mask_storeu_ps(p + 16, m1, mVec[1]);
             return p;
         }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 32 * i;
+                __m512 t1, t2;
+                AVX512::interleave2(v0.mVec[i], v1.mVec[i], t1, t2);
+                _mm512_storeu_ps(t0, t1);
+                _mm512_storeu_ps(t0 + 16, t2);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 48 * i;
+                __m512 t1, t2, t3;
+                AVX512::interleave3(v0.mVec[i], v1.mVec[i], v2.mVec[i], t1, t2, t3);
+                _mm512_storeu_ps(t0, t1);
+                _mm512_storeu_ps(t0 + 16, t2);
+                _mm512_storeu_ps(t0 + 32, t3);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            for (int i = 0; i < 2; i++) {
+                float * t0 = p + 64 * i;
+                __m512 t1, t2, t3, t4;
+                AVX512::interleave4(v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i], t1, t2, t3, t4);
+                _mm512_storeu_ps(t0, t1);
+                _mm512_storeu_ps(t0 + 16, t2);
+                _mm512_storeu_ps(t0 + 32, t3);
+                _mm512_storeu_ps(t0 + 48, t4);
+            }
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float * p) const {
             _mm512_store_ps(p, mVec[0]);
@@ -837,6 +900,24 @@ namespace SIMD {
             mVec[1] = _mm512_mask_mul_ps(mVec[1], m1, t0, t2);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            __m512 t0 = _mm512_rcp14_ps(mVec[0]);
+            __m512 t1 = _mm512_rcp14_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            __m512 t0 = _mm512_rsqrt14_ps(mVec[0]);
+            __m512 t1 = _mm512_rsqrt14_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<32> cmpeq(SIMDVec_f const & b) const {
             __mmask16 m0 = _mm512_cmp_ps_mask(mVec[0], b.mVec[0], 0);
@@ -1335,6 +1416,34 @@ namespace SIMD {
             __m512 t3 = _mm512_mask_mul_ps(mVec[1], m1, t1, c.mVec[1]);
             return SIMDVec_f(t2, t3);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512 t0 = _mm512_fnmadd_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m512 t1 = _mm512_fnmadd_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512 t0 = _mm512_mask_fnmadd_ps(mVec[0], m0, b.mVec[0], c.mVec[0]);
+            __m512 t1 = _mm512_mask_fnmadd_ps(mVec[1], m1, b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512 t0 = _mm512_fnmsub_ps(mVec[0], b.mVec[0], c.mVec[0]);
+            __m512 t1 = _mm512_fnmsub_ps(mVec[1], b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<32> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512 t0 = _mm512_mask_fnmsub_ps(mVec[0], m0, b.mVec[0], c.mVec[0]);
+            __m512 t1 = _mm512_mask_fnmsub_ps(mVec[1], m1, b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
             __m512 t0 = _mm512_max_ps(mVec[0], b.mVec[0]);
@@ -1894,9 +2003,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m512 t0 = _mm512_roundscale_ps(mVec[0], 0);
@@ -2260,6 +2381,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -2283,9 +2412,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -2360,9 +2501,33 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<32>>(*this, b);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 16> const & a, SIMDVec_f<float, 16> const & b) {
             mVec[0] = a.mVec;
@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -183,14 +185,30 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m128 t0 = _mm_loadu_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(mVec);
-            __m512 t2 = _mm512_castps128_ps512(t0);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            mVec = _mm512_castps512_ps128(t3);
+            __m512 t0 = _mm512_mask_loadu_ps(_mm512_castps128_ps512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castps512_ps128(t0);
 #endif
             return *this;
         }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            AVX512::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            __m128 t2 = _mm_loadu_ps(p + 8);
+            AVX512::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            __m128 t2 = _mm_loadu_ps(p + 8);
+            __m128 t3 = _mm_loadu_ps(p + 12);
+            AVX512::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec = _mm_load_ps(p);
@@ -201,11 +219,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m128 t0 = _mm_load_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(mVec);
-            __m512 t2 = _mm512_castps128_ps512(t0);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            mVec = _mm512_castps512_ps128(t3);
+            __m512 t0 = _mm512_mask_loadu_ps(_mm512_castps128_ps512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castps512_ps128(t0);
 #endif
             return *this;
         }
@@ -219,15 +234,39 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_ps(p, mask.mMask, mVec);
 #else
-            __m128 t0 = _mm_loadu_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(t0);
-            __m512 t2 = _mm512_castps128_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m128 t4 = _mm512_castps512_ps128(t3);
-            _mm_storeu_ps(p, t4);
+            _mm512_mask_storeu_ps(p, mask.mMask & 0xF, _mm512_castps128_ps512(mVec));
 #endif
             return p;
         }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m128 t0, t1;
+            AVX512::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m128 t0, t1, t2;
+            AVX512::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            _mm_storeu_ps(p + 8, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m128 t0, t1, t2, t3;
+            AVX512::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            _mm_storeu_ps(p + 8, t2);
+            _mm_storeu_ps(p + 12, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            AVX512::transpose4x4(v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float * p) const {
             _mm_store_ps(p, mVec);
@@ -238,12 +277,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_store_ps(p, mask.mMask, mVec);
 #else
-            __m128 t0 = _mm_load_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(t0);
-            __m512 t2 = _mm512_castps128_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m128 t4 = _mm512_castps512_ps128(t3);
-            _mm_store_ps(p, t4);
+            _mm512_mask_storeu_ps(p, mask.mMask & 0xF, _mm512_castps128_ps512(mVec));
 #endif
             return p;
         }
@@ -895,6 +929,32 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+#if defined(__AVX512VL__)
+            __m128 t0 = _mm_rcp14_ps(mVec);
+#else
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m128 t0 = _mm512_castps512_ps128(_mm512_rcp14_ps(t1));
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+#if defined(__AVX512VL__)
+            __m128 t0 = _mm_rsqrt14_ps(mVec);
+#else
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m128 t0 = _mm512_castps512_ps128(_mm512_rsqrt14_ps(t1));
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_f const & b) const {
 #if defined(__AVX512VL__)
@@ -1148,7 +1208,40 @@ namespace SIMD {
         // SWIZZLEA
 
         // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m128 t0 = AVX512::sortNetwork4<float, false>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX512::sortNetwork4<float, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_f(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m128 t0 = AVX512::sortNetwork4<float, true>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX512::sortNetwork4<float, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
 
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1277,14 +1370,15 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
 #if defined(__FMA__)
             __m128 t0 = _mm_fmadd_ps(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
-            __m128 t1 = _mm_add_ps(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m512 t2 = _mm512_castps128_ps512(b.mVec);
+            __m512 t3 = _mm512_castps128_ps512(c.mVec);
+            __m512 t4 = _mm512_fmadd_ps(t1, t2, t3);
+            __m128 t0 = _mm512_castps512_ps128(t4);
 #endif
+            return SIMDVec_f(t0);
         }
-
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
 #if defined(__AVX512VL__)
@@ -1300,14 +1394,16 @@ namespace SIMD {
         }
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-#if defined (__FMA__)
+#if defined(__FMA__)
             __m128 t0 = _mm_fmsub_ps(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
-            __m128 t1 = _mm_sub_ps(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m512 t2 = _mm512_castps128_ps512(b.mVec);
+            __m512 t3 = _mm512_castps128_ps512(c.mVec);
+            __m512 t4 = _mm512_fmsub_ps(t1, t2, t3);
+            __m128 t0 = _mm512_castps512_ps128(t4);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
@@ -1364,6 +1460,58 @@ namespace SIMD {
 #endif
             return SIMDVec_f(t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128 t0 = _mm_fnmadd_ps(mVec, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m512 t2 = _mm512_castps128_ps512(b.mVec);
+            __m512 t3 = _mm512_castps128_ps512(c.mVec);
+            __m512 t4 = _mm512_fnmadd_ps(t1, t2, t3);
+            __m128 t0 = _mm512_castps512_ps128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m128 t0 = _mm_mask_fnmadd_ps(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m512 t2 = _mm512_castps128_ps512(b.mVec);
+            __m512 t3 = _mm512_castps128_ps512(c.mVec);
+            __m512 t4 = _mm512_mask_fnmadd_ps(t1, mask.mMask, t2, t3);
+            __m128 t0 = _mm512_castps512_ps128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128 t0 = _mm_fnmsub_ps(mVec, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m512 t2 = _mm512_castps128_ps512(b.mVec);
+            __m512 t3 = _mm512_castps128_ps512(c.mVec);
+            __m512 t4 = _mm512_fnmsub_ps(t1, t2, t3);
+            __m128 t0 = _mm512_castps512_ps128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m128 t0 = _mm_mask_fnmsub_ps(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps128_ps512(mVec);
+            __m512 t2 = _mm512_castps128_ps512(b.mVec);
+            __m512 t3 = _mm512_castps128_ps512(c.mVec);
+            __m512 t4 = _mm512_mask_fnmsub_ps(t1, mask.mMask, t2, t3);
+            __m128 t0 = _mm512_castps512_ps128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
@@ -1553,10 +1701,10 @@ namespace SIMD {
             float t1 = (raw[2] < raw[3]) ? raw[2] : raw[3];
             return t0 < t1 ? t0 : t1;
 #else
-            __m512 t0 = _mm512_castps128_ps512(mVec);
+            __m512 t0 = _mm512_castps128_ps512(mVec);
             // Top 384 bits are undefined. Need to mask the result out.
             __mmask16 mask = 0xF;
-            float retval = _mm512_mask_reduce_min_ps(mask, t0);
+            float retval = _mm512_mask_reduce_min_ps(mask, t0);
             return retval;
 #endif
         }
@@ -1893,9 +2041,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m128 t0 = _mm_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -2235,6 +2395,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -2256,9 +2424,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
 
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
@@ -2325,9 +2505,33 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 2> const & a, SIMDVec_f<float, 2> const & b) {
@@ -35,6 +35,8 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -186,14 +188,30 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t2, mask.mMask, t1);
-            mVec = _mm512_castps512_ps256(t3);
+            __m512 t0 = _mm512_mask_loadu_ps(_mm512_castps256_ps512(mVec), mask.mMask & 0xFF, p);
+            mVec = _mm512_castps512_ps256(t0);
 #endif
             return *this;
         }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            AVX512::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t2 = _mm256_loadu_ps(p + 16);
+            AVX512::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t2 = _mm256_loadu_ps(p + 16);
+            __m256 t3 = _mm256_loadu_ps(p + 24);
+            AVX512::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
             mVec = _mm256_load_ps(p);
@@ -204,11 +222,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m256 t0 = _mm256_load_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t2, mask.mMask, t1);
-            mVec = _mm512_castps512_ps256(t3);
+            __m512 t0 = _mm512_mask_loadu_ps(_mm512_castps256_ps512(mVec), mask.mMask & 0xFF, p);
+            mVec = _mm512_castps512_ps256(t0);
 #endif
             return *this;
         }
@@ -222,15 +237,39 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_ps(p, mask.mMask, mVec);
 #else
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m256 t4 = _mm512_castps512_ps256(t3);
-            _mm256_storeu_ps(p, t4);
+            _mm512_mask_storeu_ps(p, mask.mMask & 0xFF, _mm512_castps256_ps512(mVec));
 #endif
             return p;
         }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m256 t0, t1;
+            AVX512::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m256 t0, t1, t2;
+            AVX512::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            _mm256_storeu_ps(p + 16, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m256 t0, t1, t2, t3;
+            AVX512::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm256_storeu_ps(p, t0);
+            _mm256_storeu_ps(p + 8, t1);
+            _mm256_storeu_ps(p + 16, t2);
+            _mm256_storeu_ps(p + 24, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3, SIMDVec_f & v4, SIMDVec_f & v5, SIMDVec_f & v6, SIMDVec_f & v7) {
+            AVX512::transpose8x8(v0.mVec, v1.mVec, v2.mVec, v3.mVec, v4.mVec, v5.mVec, v6.mVec, v7.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float * p) const {
             _mm256_store_ps(p, mVec);
@@ -241,12 +280,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_ps(p, mask.mMask, mVec);
 #else
-            __m256 t0 = _mm256_load_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m256 t4 = _mm512_castps512_ps256(t3);
-            _mm256_store_ps(p, t4);
+            _mm512_mask_storeu_ps(p, mask.mMask & 0xFF, _mm512_castps256_ps512(mVec));
 #endif
             return p;
         }
@@ -901,6 +935,32 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+#if defined(__AVX512VL__)
+            __m256 t0 = _mm256_rcp14_ps(mVec);
+#else
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m256 t0 = _mm512_castps512_ps256(_mm512_rcp14_ps(t1));
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+#if defined(__AVX512VL__)
+            __m256 t0 = _mm256_rsqrt14_ps(mVec);
+#else
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m256 t0 = _mm512_castps512_ps256(_mm512_rsqrt14_ps(t1));
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_f const & b) const {
 #if defined(__AVX512VL__)
@@ -1122,6 +1182,54 @@ namespace SIMD {
 #endif
             return (m0 == 0x0F);
         }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<8> const & mask) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_f(_mm256_maskz_compress_ps(mask.mMask, mVec));
+#else
+            __m512 t1 = _mm512_maskz_compress_ps(mask.mMask, _mm512_castps256_ps512(mVec));
+            return SIMDVec_f(_mm512_castps512_ps256(t1));
+#endif
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, float * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_ps(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_ps(p, mask.mMask, _mm512_castps256_ps512(mVec));
+#endif
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, float const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_ps(mVec, mask.mMask, p);
+#else
+            __m512 t1 = _mm512_mask_expandloadu_ps(_mm512_castps256_ps512(mVec), mask.mMask, p);
+            mVec = _mm512_castps512_ps256(t1);
+#endif
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            return SIMDVec_f(_mm256_permutevar8x32_ps(mVec, indices.mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & indices) const {
+            SIMDVec_f t0 = permute(indices);
+            return blend(mask, t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_f(_mm256_permutex2var_ps(mVec, indices.mVec, b.mVec));
+#else
+            __m512 t0 = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(mVec)), _mm256_castps_pd(b.mVec), 1));
+            __m256i t1 = _mm256_and_si256(indices.mVec, _mm256_set1_epi32(0xF));
+            __m512 t2 = _mm512_permutexvar_ps(_mm512_castsi256_si512(t1), t0);
+            return SIMDVec_f(_mm512_castps512_ps256(t2));
+#endif
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
 #if defined(__AVX512VL__)
@@ -1152,7 +1260,40 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
         // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() {
+            __m256 t0 = AVX512::sortNetwork8<float, false>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = mVec;
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX512::sortNetwork8<float, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_f(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() {
+            __m256 t0 = AVX512::sortNetwork8<float, true>(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = mVec;
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX512::sortNetwork8<float, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_f(t0);
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_f sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_f, float, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
 
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1292,12 +1433,14 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
 #if defined(__FMA__)
             __m256 t0 = _mm256_fmadd_ps(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m256 t0 = _mm256_mul_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_add_ps(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m512 t2 = _mm512_castps256_ps512(b.mVec);
+            __m512 t3 = _mm512_castps256_ps512(c.mVec);
+            __m512 t4 = _mm512_fmadd_ps(t1, t2, t3);
+            __m256 t0 = _mm512_castps512_ps256(t4);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
@@ -1316,12 +1459,14 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
 #if defined(__FMA__)
             __m256 t0 = _mm256_fmsub_ps(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m256 t0 = _mm256_mul_ps(mVec, b.mVec);
-            __m256 t1 = _mm256_sub_ps(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m512 t2 = _mm512_castps256_ps512(b.mVec);
+            __m512 t3 = _mm512_castps256_ps512(c.mVec);
+            __m512 t4 = _mm512_fmsub_ps(t1, t2, t3);
+            __m256 t0 = _mm512_castps512_ps256(t4);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
@@ -1378,6 +1523,58 @@ namespace SIMD {
 #endif
             return SIMDVec_f(t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmadd_ps(mVec, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m512 t2 = _mm512_castps256_ps512(b.mVec);
+            __m512 t3 = _mm512_castps256_ps512(c.mVec);
+            __m512 t4 = _mm512_fnmadd_ps(t1, t2, t3);
+            __m256 t0 = _mm512_castps512_ps256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m256 t0 = _mm256_mask_fnmadd_ps(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m512 t2 = _mm512_castps256_ps512(b.mVec);
+            __m512 t3 = _mm512_castps256_ps512(c.mVec);
+            __m512 t4 = _mm512_mask_fnmadd_ps(t1, mask.mMask, t2, t3);
+            __m256 t0 = _mm512_castps512_ps256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256 t0 = _mm256_fnmsub_ps(mVec, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m512 t2 = _mm512_castps256_ps512(b.mVec);
+            __m512 t3 = _mm512_castps256_ps512(c.mVec);
+            __m512 t4 = _mm512_fnmsub_ps(t1, t2, t3);
+            __m256 t0 = _mm512_castps512_ps256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m256 t0 = _mm256_mask_fnmsub_ps(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512 t1 = _mm512_castps256_ps512(mVec);
+            __m512 t2 = _mm512_castps256_ps512(b.mVec);
+            __m512 t3 = _mm512_castps256_ps512(c.mVec);
+            __m512 t4 = _mm512_mask_fnmsub_ps(t1, mask.mMask, t2, t3);
+            __m256 t0 = _mm512_castps512_ps256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_max_ps(mVec, b.mVec);
@@ -1912,9 +2109,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -2216,6 +2425,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -2237,9 +2454,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -2304,9 +2533,33 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
 /*
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -184,6 +185,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -197,6 +200,34 @@ namespace SIMD {
             mVec[1] = _mm512_mask_loadu_pd(mVec[1], ((mask.mMask & 0xFF00) >> 8), p + 8);
             return *this;
         }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            for (int i = 0; i < 2; i++) {
+                double const * t0 = p + 16 * i;
+                __m512d t1 = _mm512_loadu_pd(t0);
+                __m512d t2 = _mm512_loadu_pd(t0 + 8);
+                AVX512::deinterleave2(t1, t2, v0.mVec[i], v1.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            for (int i = 0; i < 2; i++) {
+                double const * t0 = p + 24 * i;
+                __m512d t1 = _mm512_loadu_pd(t0);
+                __m512d t2 = _mm512_loadu_pd(t0 + 8);
+                __m512d t3 = _mm512_loadu_pd(t0 + 16);
+                AVX512::deinterleave3(t1, t2, t3, v0.mVec[i], v1.mVec[i], v2.mVec[i]);
+            }
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            for (int i = 0; i < 2; i++) {
+                double const * t0 = p + 32 * i;
+                __m512d t1 = _mm512_loadu_pd(t0);
+                __m512d t2 = _mm512_loadu_pd(t0 + 8);
+                __m512d t3 = _mm512_loadu_pd(t0 + 16);
+                __m512d t4 = _mm512_loadu_pd(t0 + 24);
+                AVX512::deinterleave4(t1, t2, t3, t4, v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i]);
+            }
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
             mVec[0] = _mm512_load_pd(p);
@@ -221,6 +252,40 @@ namespace SIMD {
             _mm512_mask_storeu_pd(p + 8, ((mask.mMask & 0xFF00) >> 8), mVec[1]);
             return p;
         }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            for (int i = 0; i < 2; i++) {
+                double * t0 = p + 16 * i;
+                __m512d t1, t2;
+                AVX512::interleave2(v0.mVec[i], v1.mVec[i], t1, t2);
+                _mm512_storeu_pd(t0, t1);
+                _mm512_storeu_pd(t0 + 8, t2);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            for (int i = 0; i < 2; i++) {
+                double * t0 = p + 24 * i;
+                __m512d t1, t2, t3;
+                AVX512::interleave3(v0.mVec[i], v1.mVec[i], v2.mVec[i], t1, t2, t3);
+                _mm512_storeu_pd(t0, t1);
+                _mm512_storeu_pd(t0 + 8, t2);
+                _mm512_storeu_pd(t0 + 16, t3);
+            }
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            for (int i = 0; i < 2; i++) {
+                double * t0 = p + 32 * i;
+                __m512d t1, t2, t3, t4;
+                AVX512::interleave4(v0.mVec[i], v1.mVec[i], v2.mVec[i], v3.mVec[i], t1, t2, t3, t4);
+                _mm512_storeu_pd(t0, t1);
+                _mm512_storeu_pd(t0 + 8, t2);
+                _mm512_storeu_pd(t0 + 16, t3);
+                _mm512_storeu_pd(t0 + 24, t4);
+            }
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE double* storea(double * p) const {
             _mm512_store_pd(p, mVec[0]);
@@ -727,6 +792,24 @@ namespace SIMD {
             mVec[1] = _mm512_mask_mul_pd(t1, ((mask.mMask & 0xFF00) >> 8), t1, _mm512_set1_pd(b));
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            __m512d t0 = _mm512_rcp14_pd(mVec[0]);
+            __m512d t1 = _mm512_rcp14_pd(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            __m512d t0 = _mm512_rsqrt14_pd(mVec[0]);
+            __m512d t1 = _mm512_rsqrt14_pd(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
 
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<16> cmpeq(SIMDVec_f const & b) const {
@@ -1121,6 +1204,30 @@ namespace SIMD {
             __m512d t3 = _mm512_mask_mul_pd(mVec[1], ((mask.mMask & 0xFF00) >> 8), t1, c.mVec[1]);
             return SIMDVec_f(t2, t3);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_fnmadd_pd(mVec[0], b.mVec[0], c.mVec[0]);
+            __m512d t1 = _mm512_fnmadd_pd(mVec[1], b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_mask_fnmadd_pd(mVec[0], mask.mMask & 0xFF, b.mVec[0], c.mVec[0]);
+            __m512d t1 = _mm512_mask_fnmadd_pd(mVec[1], ((mask.mMask & 0xFF00) >> 8), b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_fnmsub_pd(mVec[0], b.mVec[0], c.mVec[0]);
+            __m512d t1 = _mm512_fnmsub_pd(mVec[1], b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<16> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_mask_fnmsub_pd(mVec[0], mask.mMask & 0xFF, b.mVec[0], c.mVec[0]);
+            __m512d t1 = _mm512_mask_fnmsub_pd(mVec[1], ((mask.mMask & 0xFF00) >> 8), b.mVec[1], c.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
@@ -1635,9 +1742,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm512_extractf64x4_pd(mVec[0], 0);
@@ -1803,6 +1922,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 16>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -1826,9 +1953,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 16>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 16>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -1836,7 +1975,7 @@ namespace SIMD {
             __m512d t1 = _mm512_sin_pd(mVec[1]);
             return SIMDVec_f(t0, t1);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 16>, SIMDVecMask<16>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<16>>(*this);
         #endif
         }
         // MSIN
@@ -1848,7 +1987,7 @@ namespace SIMD {
             __m512d t1 = _mm512_mask_sin_pd(mVec[1], m1, mVec[1]);
             return SIMDVec_f(t0, t1);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
         #endif
         }
         // COS
@@ -1858,7 +1997,7 @@ namespace SIMD {
             __m512d t1 = _mm512_cos_pd(mVec[1]);
             return SIMDVec_f(t0, t1);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 16>, SIMDVecMask<16>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<16>>(*this);
         #endif
         }
         // MCOS
@@ -1870,7 +2009,7 @@ namespace SIMD {
             __m512d t1 = _mm512_mask_cos_pd(mVec[1], m1, mVec[1]);
             return SIMDVec_f(t0, t1);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
         #endif
         }
         // SINCOS
@@ -1883,7 +2022,7 @@ namespace SIMD {
             cosvec.mVec[0] = _mm512_load_pd(raw_cos0);
             cosvec.mVec[1] = _mm512_load_pd(raw_cos1);
         #else
-            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 16>, SIMDVecMask<16>>(*this, sinvec, cosvec);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<16>>(*this, sinvec, cosvec);
         #endif
         }
         // MSINCOS
@@ -1898,14 +2037,37 @@ namespace SIMD {
             cosvec.mVec[0] = _mm512_load_pd(raw_cos0);
             cosvec.mVec[1] = _mm512_load_pd(raw_cos1);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<16>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<16>>(*this, b);
+        }
 
         // PACK
         // PACKLO
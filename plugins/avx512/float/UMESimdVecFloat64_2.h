@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 #define EXPAND_CALL_UNARY(a_128d, unary_op) \
             _mm512_castpd512_pd128( \
@@ -211,6 +212,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -222,14 +225,30 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_pd(mVec, mask.mMask, p);
 #else
-            __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_loadu_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd128(t3);
+            __m512d t0 = _mm512_mask_loadu_pd(_mm512_castpd128_pd512(mVec), mask.mMask & 0x3, p);
+            mVec = _mm512_castpd512_pd128(t0);
 #endif
             return *this;
         }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            AVX512::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            __m128d t2 = _mm_loadu_pd(p + 4);
+            AVX512::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            __m128d t2 = _mm_loadu_pd(p + 4);
+            __m128d t3 = _mm_loadu_pd(p + 6);
+            AVX512::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
             mVec = _mm_load_pd(p);
@@ -240,11 +259,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_load_pd(mVec, mask.mMask, p);
 #else
-            __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_load_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd128(t3);
+            __m512d t0 = _mm512_mask_loadu_pd(_mm512_castpd128_pd512(mVec), mask.mMask & 0x3, p);
+            mVec = _mm512_castpd512_pd128(t0);
 #endif
             return *this;
         }
@@ -258,15 +274,39 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_pd(p, mask.mMask, mVec);
 #else
-            __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_loadu_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m128d t4 = _mm512_castpd512_pd128(t3);
-            _mm_storeu_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask & 0x3, _mm512_castpd128_pd512(mVec));
 #endif
             return p;
         }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m128d t0, t1;
+            AVX512::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm_storeu_pd(p, t0);
+            _mm_storeu_pd(p + 2, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m128d t0, t1, t2;
+            AVX512::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm_storeu_pd(p, t0);
+            _mm_storeu_pd(p + 2, t1);
+            _mm_storeu_pd(p + 4, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m128d t0, t1, t2, t3;
+            AVX512::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm_storeu_pd(p, t0);
+            _mm_storeu_pd(p + 2, t1);
+            _mm_storeu_pd(p + 4, t2);
+            _mm_storeu_pd(p + 6, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1) {
+            AVX512::transpose2x2(v0.mVec, v1.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE double* storea(double * p) const {
             _mm_store_pd(p, mVec);
@@ -277,12 +317,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
              _mm_mask_store_pd(p, mask.mMask, mVec);
 #else
-            __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_load_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m128d t4 = _mm512_castpd512_pd128(t3);
-            _mm_store_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask & 0x3, _mm512_castpd128_pd512(mVec));
 #endif
             return p;
         }
@@ -868,6 +903,30 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+#if defined(__AVX512VL__)
+            __m128d t0 = _mm_rcp14_pd(mVec);
+#else
+            __m128d t0 = EXPAND_CALL_UNARY(mVec, _mm512_rcp14_pd);
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+#if defined(__AVX512VL__)
+            __m128d t0 = _mm_rsqrt14_pd(mVec);
+#else
+            __m128d t0 = EXPAND_CALL_UNARY(mVec, _mm512_rsqrt14_pd);
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
 
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<2> cmpeq(SIMDVec_f const & b) const {
@@ -1207,14 +1266,16 @@ namespace SIMD {
 
         // FMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-#if defined (__FMA__)
+#if defined(__FMA__)
             __m128d t0 = _mm_fmadd_pd(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
-            __m128d t1 = _mm_add_pd(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512d t1 = _mm512_castpd128_pd512(mVec);
+            __m512d t2 = _mm512_castpd128_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd128_pd512(c.mVec);
+            __m512d t4 = _mm512_fmadd_pd(t1, t2, t3);
+            __m128d t0 = _mm512_castpd512_pd128(t4);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
@@ -1233,12 +1294,14 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
 #if defined(__FMA__)
             __m128d t0 = _mm_fmsub_pd(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
-            __m128d t1 = _mm_sub_pd(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512d t1 = _mm512_castpd128_pd512(mVec);
+            __m512d t2 = _mm512_castpd128_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd128_pd512(c.mVec);
+            __m512d t4 = _mm512_fmsub_pd(t1, t2, t3);
+            __m128d t0 = _mm512_castpd512_pd128(t4);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
@@ -1295,6 +1358,58 @@ namespace SIMD {
 #endif
             return SIMDVec_f(t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128d t0 = _mm_fnmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd128_pd512(mVec);
+            __m512d t2 = _mm512_castpd128_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd128_pd512(c.mVec);
+            __m512d t4 = _mm512_fnmadd_pd(t1, t2, t3);
+            __m128d t0 = _mm512_castpd512_pd128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m128d t0 = _mm_mask_fnmadd_pd(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd128_pd512(mVec);
+            __m512d t2 = _mm512_castpd128_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd128_pd512(c.mVec);
+            __m512d t4 = _mm512_mask_fnmadd_pd(t1, mask.mMask, t2, t3);
+            __m128d t0 = _mm512_castpd512_pd128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128d t0 = _mm_fnmsub_pd(mVec, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd128_pd512(mVec);
+            __m512d t2 = _mm512_castpd128_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd128_pd512(c.mVec);
+            __m512d t4 = _mm512_fnmsub_pd(t1, t2, t3);
+            __m128d t0 = _mm512_castpd512_pd128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m128d t0 = _mm_mask_fnmsub_pd(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd128_pd512(mVec);
+            __m512d t2 = _mm512_castpd128_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd128_pd512(c.mVec);
+            __m512d t4 = _mm512_mask_fnmsub_pd(t1, mask.mMask, t2, t3);
+            __m128d t0 = _mm512_castpd512_pd128(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
@@ -1820,9 +1935,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m128d t0 = _mm_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -1928,6 +2055,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -1949,16 +2084,28 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m128d t0 = _mm_sin_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<2>>(*this);
         #endif
         }
         // MSIN
@@ -1969,7 +2116,7 @@ namespace SIMD {
             __m128d t2 = _mm512_castpd512_pd128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
         #endif
         }
         // COS
@@ -1978,7 +2125,7 @@ namespace SIMD {
             __m128d t0 = _mm_cos_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<2>>(*this);
         #endif
         }
         // MCOS
@@ -1989,7 +2136,7 @@ namespace SIMD {
             __m128d t2 = _mm512_castpd512_pd128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
         #endif
         }
         // SINCOS
@@ -1999,7 +2146,7 @@ namespace SIMD {
             sinvec.mVec = _mm_sincos_pd((__m128d*)raw_cos, mVec);
             cosvec.mVec = _mm_load_pd(raw_cos);
         #else
-            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this, sinvec, cosvec);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<2>>(*this, sinvec, cosvec);
         #endif
         }
         // MSINCOS
@@ -2011,14 +2158,37 @@ namespace SIMD {
             sinvec.mVec = _mm512_castpd512_pd128(t1);
             cosvec.mVec = _mm_load_pd(raw_cos);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<2>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<2>>(*this, b);
+        }
 
         // PACK
         SIMDVec_f & pack(SIMDVec_f<double, 1> const & a, SIMDVec_f<double, 1> const & b) {
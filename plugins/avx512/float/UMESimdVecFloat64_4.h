@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 #define EXPAND_CALL_UNARY(a_256d, unary_op) \
             _mm512_castpd512_pd256( \
@@ -209,6 +210,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -220,14 +223,30 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_pd(mVec, mask.mMask, p);
 #else
-            __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_loadu_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd256(t3);
+            __m512d t0 = _mm512_mask_loadu_pd(_mm512_castpd256_pd512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castpd512_pd256(t0);
 #endif
             return *this;
         }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            AVX512::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            __m256d t2 = _mm256_loadu_pd(p + 8);
+            AVX512::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t1 = _mm256_loadu_pd(p + 4);
+            __m256d t2 = _mm256_loadu_pd(p + 8);
+            __m256d t3 = _mm256_loadu_pd(p + 12);
+            AVX512::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
             mVec = _mm256_load_pd(p);
@@ -238,11 +257,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_load_pd(mVec, mask.mMask, p);
 #else
-            __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_loadu_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd256(t3);
+            __m512d t0 = _mm512_mask_loadu_pd(_mm512_castpd256_pd512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castpd512_pd256(t0);
 #endif
             return *this;
         }
@@ -256,15 +272,39 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_pd(p, mask.mMask, mVec);
 #else
-            __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_loadu_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m256d t4 = _mm512_castpd512_pd256(t3);
-            _mm256_storeu_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask & 0xF, _mm512_castpd256_pd512(mVec));
 #endif
             return p;
         }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m256d t0, t1;
+            AVX512::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m256d t0, t1, t2;
+            AVX512::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            _mm256_storeu_pd(p + 8, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m256d t0, t1, t2, t3;
+            AVX512::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm256_storeu_pd(p, t0);
+            _mm256_storeu_pd(p + 4, t1);
+            _mm256_storeu_pd(p + 8, t2);
+            _mm256_storeu_pd(p + 12, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            AVX512::transpose4x4(v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE double* storea(double * p) const {
             _mm256_store_pd(p, mVec);
@@ -275,16 +315,68 @@ namespace SIMD {
 #if defined(__AVX512VL__)
              _mm256_mask_store_pd(p, mask.mMask, mVec);
 #else
-            __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_load_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m256d t4 = _mm512_castpd512_pd256(t3);
-            _mm256_store_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask & 0xF, _mm512_castpd256_pd512(mVec));
 #endif
             return p;
         }
 
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<4> const & mask) const {
+            __mmask8 t0 = mask.mMask & 0xF;
+#if defined(__AVX512VL__)
+            return SIMDVec_f(_mm256_maskz_compress_pd(t0, mVec));
+#else
+            __m512d t1 = _mm512_maskz_compress_pd(t0, _mm512_castpd256_pd512(mVec));
+            return SIMDVec_f(_mm512_castpd512_pd256(t1));
+#endif
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, double * p) const {
+            __mmask8 t0 = mask.mMask & 0xF;
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_pd(p, t0, mVec);
+#else
+            _mm512_mask_compressstoreu_pd(p, t0, _mm512_castpd256_pd512(mVec));
+#endif
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<4> const & mask, double const * p) {
+            __mmask8 t0 = mask.mMask & 0xF;
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_pd(mVec, t0, p);
+#else
+            __m512d t1 = _mm512_mask_expandloadu_pd(_mm512_castpd256_pd512(mVec), t0, p);
+            mVec = _mm512_castpd512_pd256(t1);
+#endif
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint64_t, 4> const & indices) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_f(_mm256_permutexvar_pd(indices.mVec, mVec));
+#else
+            __m256i t0 = _mm256_and_si256(indices.mVec, _mm256_set1_epi64x(0x3));
+            __m512d t1 = _mm512_permutexvar_pd(_mm512_castsi256_si512(t0), _mm512_castpd256_pd512(mVec));
+            return SIMDVec_f(_mm512_castpd512_pd256(t1));
+#endif
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & indices) const {
+            SIMDVec_f t0 = permute(indices);
+            return blend(mask, t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint64_t, 4> const & indices) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_f(_mm256_permutex2var_pd(mVec, indices.mVec, b.mVec));
+#else
+            __m512d t0 = _mm512_insertf64x4(_mm512_castpd256_pd512(mVec), b.mVec, 1);
+            __m256i t1 = _mm256_and_si256(indices.mVec, _mm256_set1_epi64x(0x7));
+            __m512d t2 = _mm512_permutexvar_pd(_mm512_castsi256_si512(t1), t0);
+            return SIMDVec_f(_mm512_castpd512_pd256(t2));
+#endif
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
 #if defined(__AVX512VL__)
@@ -866,6 +958,30 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+#if defined(__AVX512VL__)
+            __m256d t0 = _mm256_rcp14_pd(mVec);
+#else
+            __m256d t0 = EXPAND_CALL_UNARY(mVec, _mm512_rcp14_pd);
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+#if defined(__AVX512VL__)
+            __m256d t0 = _mm256_rsqrt14_pd(mVec);
+#else
+            __m256d t0 = EXPAND_CALL_UNARY(mVec, _mm512_rsqrt14_pd);
+#endif
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
 
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_f const & b) const {
@@ -1215,12 +1331,14 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
 #if defined(__FMA__)
             __m256d t0 = _mm256_fmadd_pd(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m256d t0 = _mm256_mul_pd(mVec, b.mVec);
-            __m256d t1 = _mm256_add_pd(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512d t1 = _mm512_castpd256_pd512(mVec);
+            __m512d t2 = _mm512_castpd256_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd256_pd512(c.mVec);
+            __m512d t4 = _mm512_fmadd_pd(t1, t2, t3);
+            __m256d t0 = _mm512_castpd512_pd256(t4);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULADDV
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
@@ -1239,12 +1357,14 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
 #if defined(__FMA__)
             __m256d t0 = _mm256_fmsub_pd(mVec, b.mVec, c.mVec);
-            return SIMDVec_f(t0);
 #else
-            __m256d t0 = _mm256_mul_pd(mVec, b.mVec);
-            __m256d t1 = _mm256_sub_pd(t0, c.mVec);
-            return SIMDVec_f(t1);
+            __m512d t1 = _mm512_castpd256_pd512(mVec);
+            __m512d t2 = _mm512_castpd256_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd256_pd512(c.mVec);
+            __m512d t4 = _mm512_fmsub_pd(t1, t2, t3);
+            __m256d t0 = _mm512_castpd512_pd256(t4);
 #endif
+            return SIMDVec_f(t0);
         }
         // MFMULSUBV
         UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
@@ -1301,6 +1421,58 @@ namespace SIMD {
 #endif
             return SIMDVec_f(t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fnmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd256_pd512(mVec);
+            __m512d t2 = _mm512_castpd256_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd256_pd512(c.mVec);
+            __m512d t4 = _mm512_fnmadd_pd(t1, t2, t3);
+            __m256d t0 = _mm512_castpd512_pd256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m256d t0 = _mm256_mask_fnmadd_pd(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd256_pd512(mVec);
+            __m512d t2 = _mm512_castpd256_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd256_pd512(c.mVec);
+            __m512d t4 = _mm512_mask_fnmadd_pd(t1, mask.mMask, t2, t3);
+            __m256d t0 = _mm512_castpd512_pd256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m256d t0 = _mm256_fnmsub_pd(mVec, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd256_pd512(mVec);
+            __m512d t2 = _mm512_castpd256_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd256_pd512(c.mVec);
+            __m512d t4 = _mm512_fnmsub_pd(t1, t2, t3);
+            __m256d t0 = _mm512_castpd512_pd256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__AVX512VL__)
+            __m256d t0 = _mm256_mask_fnmsub_pd(mVec, mask.mMask, b.mVec, c.mVec);
+#else
+            __m512d t1 = _mm512_castpd256_pd512(mVec);
+            __m512d t2 = _mm512_castpd256_pd512(b.mVec);
+            __m512d t3 = _mm512_castpd256_pd512(c.mVec);
+            __m512d t4 = _mm512_mask_fnmsub_pd(t1, mask.mMask, t2, t3);
+            __m256d t0 = _mm512_castpd512_pd256(t4);
+#endif
+            return SIMDVec_f(t0);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
@@ -1856,9 +2028,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -1968,6 +2152,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -1989,16 +2181,28 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m256d t0 = _mm256_sin_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<4>>(*this);
         #endif
         }
         // MSIN
@@ -2009,7 +2213,7 @@ namespace SIMD {
             __m256d t2 = _mm512_castpd512_pd256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
         #endif
         }
         // COS
@@ -2018,7 +2222,7 @@ namespace SIMD {
             __m256d t0 = _mm256_cos_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<4>>(*this);
         #endif
         }
         // MCOS
@@ -2029,7 +2233,7 @@ namespace SIMD {
             __m256d t2 = _mm512_castpd512_pd256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
         #endif
         }
         // SINCOS
@@ -2039,7 +2243,7 @@ namespace SIMD {
             sinvec.mVec = _mm256_sincos_pd((__m256d*)raw_cos, mVec);
             cosvec.mVec = _mm256_load_pd(raw_cos);
         #else
-            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this, sinvec, cosvec);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<4>>(*this, sinvec, cosvec);
         #endif
         }
         // MSINCOS
@@ -2051,14 +2255,37 @@ namespace SIMD {
             sinvec.mVec = _mm512_castpd512_pd256(t1);
             cosvec.mVec = _mm256_load_pd(raw_cos);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
 
         // PACK
         SIMDVec_f & pack(SIMDVec_f<double, 2> const & a, SIMDVec_f<double, 2> const & b) {
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdInterleaveAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -163,6 +164,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -174,6 +177,31 @@ namespace SIMD {
             mVec = _mm512_mask_loadu_pd(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(double const * p, uint32_t count) {
+            __mmask8 t0 = __mmask8((count >= 8) ? 0xFF : ((1 << count) - 1));
+            mVec = _mm512_maskz_loadu_pd(t0, p);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m512d t0 = _mm512_loadu_pd(p);
+            __m512d t1 = _mm512_loadu_pd(p + 8);
+            AVX512::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m512d t0 = _mm512_loadu_pd(p);
+            __m512d t1 = _mm512_loadu_pd(p + 8);
+            __m512d t2 = _mm512_loadu_pd(p + 16);
+            AVX512::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m512d t0 = _mm512_loadu_pd(p);
+            __m512d t1 = _mm512_loadu_pd(p + 8);
+            __m512d t2 = _mm512_loadu_pd(p + 16);
+            __m512d t3 = _mm512_loadu_pd(p + 24);
+            AVX512::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
             mVec = _mm512_load_pd(p);
@@ -194,6 +222,41 @@ namespace SIMD {
             _mm512_mask_storeu_pd(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE double * storeTail(double * p, uint32_t count) const {
+            __mmask8 t0 = __mmask8((count >= 8) ? 0xFF : ((1 << count) - 1));
+            _mm512_mask_storeu_pd(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m512d t0, t1;
+            AVX512::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm512_storeu_pd(p, t0);
+            _mm512_storeu_pd(p + 8, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m512d t0, t1, t2;
+            AVX512::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm512_storeu_pd(p, t0);
+            _mm512_storeu_pd(p + 8, t1);
+            _mm512_storeu_pd(p + 16, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m512d t0, t1, t2, t3;
+            AVX512::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm512_storeu_pd(p, t0);
+            _mm512_storeu_pd(p + 8, t1);
+            _mm512_storeu_pd(p + 16, t2);
+            _mm512_storeu_pd(p + 24, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3, SIMDVec_f & v4, SIMDVec_f & v5, SIMDVec_f & v6, SIMDVec_f & v7) {
+            AVX512::transpose8x8(v0.mVec, v1.mVec, v2.mVec, v3.mVec, v4.mVec, v5.mVec, v6.mVec, v7.mVec);
+        }
         // STOREA
         UME_FORCE_INLINE double* storea(double * p) const {
             _mm512_store_pd(p, mVec);
@@ -205,6 +268,32 @@ namespace SIMD {
             return p;
         }
         
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<8> const & mask) const {
+            return SIMDVec_f(_mm512_maskz_compress_pd(mask.mMask, mVec));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, double * p) const {
+            _mm512_mask_compressstoreu_pd(p, mask.mMask, mVec);
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, double const * p) {
+            mVec = _mm512_mask_expandloadu_pd(mVec, mask.mMask, p);
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint64_t, 8> const & indices) const {
+            return SIMDVec_f(_mm512_permutexvar_pd(indices.mVec, mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & indices) const {
+            return SIMDVec_f(_mm512_mask_permutexvar_pd(mVec, mask.mMask, indices.mVec, mVec));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint64_t, 8> const & indices) const {
+            return SIMDVec_f(_mm512_permutex2var_pd(mVec, indices.mVec, b.mVec));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
             __m512d t0 = _mm512_mask_mov_pd(mVec, mask.mMask, b.mVec);
@@ -643,6 +732,20 @@ namespace SIMD {
             mVec = _mm512_mask_div_pd(mVec, mask.mMask, _mm512_set1_pd(b), mVec);
             return *this;
         }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            return SIMDVec_f(_mm512_rcp14_pd(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 14;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            return SIMDVec_f(_mm512_rsqrt14_pd(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 14;
+        }
 
         // CMPEQV
         UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_f const & b) const {
@@ -953,6 +1056,26 @@ namespace SIMD {
             __m512d t1 = _mm512_mask_mul_pd(mVec, mask.mMask, t0, c.mVec);
             return SIMDVec_f(t1);
         }
+        // FNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_fnmadd_pd(mVec, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFNMADDV
+        UME_FORCE_INLINE SIMDVec_f fnmadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_mask_fnmadd_pd(mVec, mask.mMask, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // FNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_fnmsub_pd(mVec, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFNMSUBV
+        UME_FORCE_INLINE SIMDVec_f fnmsub(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m512d t0 = _mm512_mask_fnmsub_pd(mVec, mask.mMask, b.mVec, c.mVec);
+            return SIMDVec_f(t0);
+        }
 
         // MAXV
         UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
@@ -1401,9 +1524,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm512_extractf64x4_pd(mVec, 0);
@@ -1518,6 +1653,14 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
@@ -1537,16 +1680,28 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m512d t0 = _mm512_sin_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<8>>(*this);
         #endif
         }
         // MSIN
@@ -1555,7 +1710,7 @@ namespace SIMD {
             __m512d t0 = _mm512_mask_sin_pd(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
         #endif
         }
         // COS
@@ -1564,7 +1719,7 @@ namespace SIMD {
             __m512d t0 = _mm512_cos_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<8>>(*this);
         #endif
         }
         // MCOS
@@ -1573,7 +1728,7 @@ namespace SIMD {
             __m512d t0 = _mm512_mask_cos_pd(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
         #endif
         }
         // SINCOS
@@ -1583,7 +1738,7 @@ namespace SIMD {
             sinvec.mVec = _mm512_sincos_pd((__m512d*)raw_cos, mVec);
             cosvec.mVec = _mm512_load_pd(raw_cos);
         #else
-            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this, sinvec, cosvec);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<8>>(*this, sinvec, cosvec);
         #endif
         }
         // MSINCOS
@@ -1593,14 +1748,37 @@ namespace SIMD {
             sinvec.mVec = _mm512_mask_sincos_pd((__m512d*)raw_cos, mVec, mVec, mask.mMask, mVec);
             cosvec.mVec = _mm512_load_pd(raw_cos);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
 
         // PACK
         SIMDVec_f & pack(SIMDVec_f<double, 4> const & a, SIMDVec_f<double, 4> const & b) {
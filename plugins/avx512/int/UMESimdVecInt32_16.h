@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -160,6 +161,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
             mVec = _mm512_loadu_si512(p);
@@ -170,6 +173,12 @@ namespace SIMD {
             mVec = _mm512_mask_loadu_epi32(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int32_t const * p, uint32_t count) {
+            __mmask16 t0 = __mmask16((count >= 16) ? 0xFFFF : ((1 << count) - 1));
+            mVec = _mm512_maskz_loadu_epi32(t0, p);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
             mVec = _mm512_load_si512((__m512i*)p);
@@ -190,8 +199,14 @@ namespace SIMD {
             _mm512_mask_storeu_epi32(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE int32_t * storeTail(int32_t * p, uint32_t count) const {
+            __mmask16 t0 = __mmask16((count >= 16) ? 0xFFFF : ((1 << count) - 1));
+            _mm512_mask_storeu_epi32(p, t0, mVec);
+            return p;
+        }
         // STOREA
-        UME_FORCE_INLINE int32_t * storea(int32_t * addrAligned) {
+        UME_FORCE_INLINE int32_t * storea(int32_t * addrAligned) const {
             _mm512_store_si512((__m512i*)addrAligned, mVec);
             return addrAligned;
         }
@@ -200,6 +215,32 @@ namespace SIMD {
             _mm512_mask_store_epi32(p, mask.mMask, mVec);
             return p;
         }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<16> const & mask) const {
+            return SIMDVec_i(_mm512_maskz_compress_epi32(mask.mMask, mVec));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<16> const & mask, int32_t * p) const {
+            _mm512_mask_compressstoreu_epi32((void *)p, mask.mMask, mVec);
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<16> const & mask, int32_t const * p) {
+            mVec = _mm512_mask_expandloadu_epi32(mVec, mask.mMask, (void const *)p);
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_i(_mm512_permutexvar_epi32(indices.mVec, mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_i(_mm512_mask_permutexvar_epi32(mVec, mask.mMask, indices.mVec, mVec));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_i(_mm512_permutex2var_epi32(mVec, indices.mVec, b.mVec));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
             __m512i t0 = _mm512_mask_mov_epi32(mVec, mask.mMask, b.mVec);
@@ -213,6 +254,43 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = AVX512::sortNetwork16<int32_t, false>(t0);
+            return SIMDVec_i(_mm512_castps_si512(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 16> & payload) {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = _mm512_castsi512_ps(payload.mVec);
+            AVX512::sortNetwork16<int32_t, false>(t0, t1);
+            payload.mVec = _mm512_castps_si512(t1);
+            return SIMDVec_i(_mm512_castps_si512(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = AVX512::sortNetwork16<int32_t, true>(t0);
+            return SIMDVec_i(_mm512_castps_si512(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 16> & payload) {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = _mm512_castsi512_ps(payload.mVec);
+            AVX512::sortNetwork16<int32_t, true>(t0, t1);
+            payload.mVec = _mm512_castps_si512(t1);
+            return SIMDVec_i(_mm512_castps_si512(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m512i t0 = _mm512_add_epi32(mVec, b.mVec);
@@ -649,8 +727,8 @@ namespace SIMD {
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
             __m512i t0 = _mm512_conflict_epi32(mVec);
-            __mmask16 t1 = _mm512_cmpeq_epi32_mask(t0, _mm512_set1_epi32(1));
-            return (t1 == 0x0000);
+            __mmask16 t1 = _mm512_cmpeq_epi32_mask(t0, _mm512_setzero_epi32());
+            return (t1 == 0xFFFF);
         }
         // HADD
         UME_FORCE_INLINE int32_t hadd() const {
@@ -45,7 +45,7 @@ namespace SIMD {
             SIMDVec_i<int32_t, 32>,
             SIMDVec_u<uint32_t, 32>,
             int32_t,
-            16,
+            32,
             uint32_t,
             SIMDVecMask<32>,
             SIMDSwizzle<32>> ,
@@ -199,6 +199,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
             mVec[0] = _mm512_loadu_si512(p);
@@ -242,7 +244,7 @@ namespace SIMD {
             return p;
         }
         // STOREA
-        UME_FORCE_INLINE int32_t * storea(int32_t * p) {
+        UME_FORCE_INLINE int32_t * storea(int32_t * p) const {
             _mm512_store_si512((__m512i*)p, mVec[0]);
             _mm512_store_si512((__m512i*)(p + 16), mVec[1]);
             return p;
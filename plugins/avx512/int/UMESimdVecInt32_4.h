@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -170,6 +171,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
 #if defined(__AVX512VL__)
@@ -184,11 +187,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_epi32(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi128_si512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castsi512_si128(t0);
 #endif
             return *this;
         }
@@ -202,11 +202,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_load_epi32(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi128_si512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castsi512_si128(t0);
 #endif
             return *this;
         }
@@ -220,12 +217,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_epi32(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_storeu_si128((__m128i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xF, _mm512_castsi128_si512(mVec));
 #endif
             return p;
         }
@@ -239,12 +231,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_store_epi32(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_store_si128((__m128i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xF, _mm512_castsi128_si512(mVec));
 #endif
             return p;
         }
@@ -277,6 +264,43 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX512::sortNetwork4<int32_t, false>(t0);
+            return SIMDVec_i(_mm_castps_si128(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX512::sortNetwork4<int32_t, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_i(_mm_castps_si128(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX512::sortNetwork4<int32_t, true>(t0);
+            return SIMDVec_i(_mm_castps_si128(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 4> & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX512::sortNetwork4<int32_t, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_i(_mm_castps_si128(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -171,6 +172,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
             mVec = _mm256_loadu_si256((__m256i*)p);
@@ -181,11 +184,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_epi32(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, (__mmask16)mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi256_si512(mVec), mask.mMask & 0xFF, p);
+            mVec = _mm512_castsi512_si256(t0);
 #endif
             return *this;
         }
@@ -199,11 +199,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_load_epi32(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, (__mmask16)mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi256_si512(mVec), mask.mMask & 0xFF, p);
+            mVec = _mm512_castsi512_si256(t0);
 #endif
             return *this;
         }
@@ -221,17 +218,12 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_epi32(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_storeu_si256((__m256i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xFF, _mm512_castsi256_si512(mVec));
 #endif
             return p;
         }
         // STOREA
-        UME_FORCE_INLINE int32_t * storea(int32_t * addrAligned) {
+        UME_FORCE_INLINE int32_t * storea(int32_t * addrAligned) const {
             _mm256_store_si256((__m256i*)addrAligned, mVec);
             return addrAligned;
         }
@@ -240,15 +232,58 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_epi32(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_store_si256((__m256i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xFF, _mm512_castsi256_si512(mVec));
 #endif
             return p;
         }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<8> const & mask) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_i(_mm256_maskz_compress_epi32(mask.mMask, mVec));
+#else
+            __m512i t1 = _mm512_maskz_compress_epi32(mask.mMask, _mm512_castsi256_si512(mVec));
+            return SIMDVec_i(_mm512_castsi512_si256(t1));
+#endif
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, int32_t * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_epi32((void *)p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_epi32((void *)p, mask.mMask, _mm512_castsi256_si512(mVec));
+#endif
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, int32_t const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_epi32(mVec, mask.mMask, (void const *)p);
+#else
+            __m512i t1 = _mm512_mask_expandloadu_epi32(_mm512_castsi256_si512(mVec), mask.mMask, (void const *)p);
+            mVec = _mm512_castsi512_si256(t1);
+#endif
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            return SIMDVec_i(_mm256_permutevar8x32_epi32(mVec, indices.mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & indices) const {
+            SIMDVec_i t0 = permute(indices);
+            return blend(mask, t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_i(_mm256_permutex2var_epi32(mVec, indices.mVec, b.mVec));
+#else
+            __m512i t0 = _mm512_inserti64x4(_mm512_castsi256_si512(mVec), b.mVec, 1);
+            __m256i t1 = _mm256_and_si256(indices.mVec, _mm256_set1_epi32(0xF));
+            __m512i t2 = _mm512_permutexvar_epi32(_mm512_castsi256_si512(t1), t0);
+            return SIMDVec_i(_mm512_castsi512_si256(t2));
+#endif
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
 #if defined(__AVX512VL__)
@@ -279,7 +314,42 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
         // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX512::sortNetwork8<int32_t, false>(t0);
+            return SIMDVec_i(_mm256_castps_si256(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX512::sortNetwork8<int32_t, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_i(_mm256_castps_si256(t0));
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX512::sortNetwork8<int32_t, true>(t0);
+            return SIMDVec_i(_mm256_castps_si256(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 8> & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX512::sortNetwork8<int32_t, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_i(_mm256_castps_si256(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_i sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_i, int32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
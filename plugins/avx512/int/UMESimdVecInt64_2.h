@@ -215,6 +215,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const *p) {
@@ -226,11 +228,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_epi64(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_mask_loadu_epi64(_mm512_castsi128_si512(mVec), mask.mMask & 0x3, p);
+            mVec = _mm512_castsi512_si128(t0);
 #endif
             return *this;
         }
@@ -244,11 +243,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_load_epi64(mVec, mask.mMask, p);
 #else 
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_mask_loadu_epi64(_mm512_castsi128_si512(mVec), mask.mMask & 0x3, p);
+            mVec = _mm512_castsi512_si128(t0);
 #endif
             return *this;
         }
@@ -262,12 +258,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_epi64(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_storeu_si128((__m128i*)p, t4);
+            _mm512_mask_storeu_epi64(p, mask.mMask & 0x3, _mm512_castsi128_si512(mVec));
 #endif
             return p;
         }
@@ -281,12 +272,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_store_epi64(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_store_si128((__m128i*)p, t4);
+            _mm512_mask_storeu_epi64(p, mask.mMask & 0x3, _mm512_castsi128_si512(mVec));
 #endif
             return p;
         }
@@ -1733,7 +1719,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            mVec = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            mVec = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
             return *this;
         }
@@ -1744,7 +1730,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m128i t1 = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            __m128i t1 = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            __m128i t1 = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
@@ -1764,7 +1750,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            mVec = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            mVec = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
             return *this;
         }
@@ -1775,7 +1761,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m128i t1 = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            __m128i t1 = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            __m128i t1 = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
@@ -1794,7 +1780,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            mVec = _mm_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            mVec = _mm_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
             return *this;
         }
@@ -1804,7 +1790,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m128i t0 = _mm_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            __m128i t0 = _mm_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            __m128i t0 = _mm_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
@@ -208,6 +208,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const *p) {
@@ -219,11 +221,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_epi64(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_mask_loadu_epi64(_mm512_castsi256_si512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castsi512_si256(t0);
 #endif
             return *this;
         }
@@ -237,11 +236,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_load_epi64(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_mask_loadu_epi64(_mm512_castsi256_si512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castsi512_si256(t0);
 #endif
             return *this;
         }
@@ -255,12 +251,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_epi64(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_storeu_si256((__m256i*)p, t4);
+            _mm512_mask_storeu_epi64(p, mask.mMask & 0xF, _mm512_castsi256_si512(mVec));
 #endif
             return p;
         }
@@ -274,16 +265,68 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_epi64(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_store_si256((__m256i*)p, t4);
+            _mm512_mask_storeu_epi64(p, mask.mMask & 0xF, _mm512_castsi256_si512(mVec));
 #endif
             return p;
         }
 
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<4> const & mask) const {
+            __mmask8 t0 = mask.mMask & 0xF;
+#if defined(__AVX512VL__)
+            return SIMDVec_i(_mm256_maskz_compress_epi64(t0, mVec));
+#else
+            __m512i t1 = _mm512_maskz_compress_epi64(t0, _mm512_castsi256_si512(mVec));
+            return SIMDVec_i(_mm512_castsi512_si256(t1));
+#endif
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, int64_t * p) const {
+            __mmask8 t0 = mask.mMask & 0xF;
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_epi64((void *)p, t0, mVec);
+#else
+            _mm512_mask_compressstoreu_epi64((void *)p, t0, _mm512_castsi256_si512(mVec));
+#endif
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<4> const & mask, int64_t const * p) {
+            __mmask8 t0 = mask.mMask & 0xF;
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_epi64(mVec, t0, (void const *)p);
+#else
+            __m512i t1 = _mm512_mask_expandloadu_epi64(_mm512_castsi256_si512(mVec), t0, (void const *)p);
+            mVec = _mm512_castsi512_si256(t1);
+#endif
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint64_t, 4> const & indices) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_i(_mm256_permutexvar_epi64(indices.mVec, mVec));
+#else
+            __m256i t0 = _mm256_and_si256(indices.mVec, _mm256_set1_epi64x(0x3));
+            __m512i t1 = _mm512_permutexvar_epi64(_mm512_castsi256_si512(t0), _mm512_castsi256_si512(mVec));
+            return SIMDVec_i(_mm512_castsi512_si256(t1));
+#endif
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & indices) const {
+            SIMDVec_i t0 = permute(indices);
+            return blend(mask, t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint64_t, 4> const & indices) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_i(_mm256_permutex2var_epi64(mVec, indices.mVec, b.mVec));
+#else
+            __m512i t0 = _mm512_inserti64x4(_mm512_castsi256_si512(mVec), b.mVec, 1);
+            __m256i t1 = _mm256_and_si256(indices.mVec, _mm256_set1_epi64x(0x7));
+            __m512i t2 = _mm512_permutexvar_epi64(_mm512_castsi256_si512(t1), t0);
+            return SIMDVec_i(_mm512_castsi512_si256(t2));
+#endif
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
 #if defined(__AVX512VL__)
@@ -1815,12 +1858,12 @@ namespace SIMD {
             __m256i t2 = _mm256_mullo_epi64(t0, t1);
 #else
             __m256i t2 = _mm256_setr_epi64x(0, stride, 2*stride, 3*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, t2, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, t2, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, t2, 8);
 #endif
             return *this;
         }
@@ -1832,12 +1875,12 @@ namespace SIMD {
             __m256i t2 = _mm256_mullo_epi64(t0, t1);
 #else
             __m256i t2 = _mm256_setr_epi64x(0, stride, 2*stride, 3*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             __m256i t3 = _mm256_i64gather_epi64((const long long int*)baseAddr, t2, 8);
 #else
-            __m256i t3 = _mm256_i64gather_epi64((int64_t const*)baseAddr, t2, 8);
+            __m256i t3 = _mm256_i64gather_epi64((long long const*)baseAddr, t2, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t3);
@@ -1852,23 +1895,23 @@ namespace SIMD {
         }
         // GATHERS
         UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, uint64_t const * indices) {
-            __m256i t0 =_mm256_loadu_si256((__m256i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m256i t0 =_mm256_loadu_si256((__m256i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
             return *this;
         }
         // MGATHERS
         UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<4> const & mask, int64_t const * baseAddr, uint64_t const * indices) {
-            __m256i t0 = _mm256_loadu_si256((__m256i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m256i t0 = _mm256_loadu_si256((__m256i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             __m256i t1 = _mm256_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            __m256i t1 = _mm256_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            __m256i t1 = _mm256_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
@@ -1882,22 +1925,22 @@ namespace SIMD {
             return *this;
         }
         // GATHERV
-        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, SIMDVec_u<uint64_t, 4> const & indices) {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, SIMDVec_u<uint64_t, 4> const & indices) {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
             return *this;
         }
         // MGATHERV
-        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<4> const & mask, int64_t const * baseAddr, SIMDVec_u<uint64_t, 4> const & indices) {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<4> const & mask, int64_t const * baseAddr, SIMDVec_u<uint64_t, 4> const & indices) {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             __m256i t0 = _mm256_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            __m256i t0 = _mm256_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            __m256i t0 = _mm256_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
@@ -1918,8 +1961,8 @@ namespace SIMD {
             __m256i t2 = _mm256_mullo_epi64(t0, t1);
 #else
             __m256i t2 = _mm256_setr_epi64x(0, stride, 2*stride, 3*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
   #if defined(__AVX512VL__)
             _mm256_i64scatter_epi64((long long int*)baseAddr, t2, mVec, 8);
@@ -1947,8 +1990,8 @@ namespace SIMD {
             __m256i t2 = _mm256_mullo_epi64(t0, t1);
 #else
             __m256i t2 = _mm256_setr_epi64x(0, stride, 2*stride, 3*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
   #if defined(__AVX512VL__)
             _mm256_mask_i64scatter_epi64((long long int*)baseAddr, mask.mMask, t2, mVec, 8);
@@ -1970,8 +2013,8 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, uint64_t* indices) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m256i t0 = _mm256_loadu_si256((__m256i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
   #if defined(__AVX512VL__)
             _mm256_i64scatter_epi64((long long int*)baseAddr, t0, mVec, 8);
@@ -1999,8 +2042,8 @@ namespace SIMD {
         }
         // MSCATTERS
         UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<4> const & mask, int64_t* baseAddr, uint64_t* indices) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m256i t0 = _mm256_loadu_si256((__m256i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
   #if defined(__AVX512VL__)
             _mm256_mask_i64scatter_epi64((long long int*)baseAddr, mask.mMask, t0, mVec, 8);
@@ -2027,8 +2070,8 @@ namespace SIMD {
             return baseAddr;
         }
         // SCATTERV
-        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, SIMDVec_u<uint64_t, 4> const & indices) const {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, SIMDVec_u<uint64_t, 4> const & indices) const {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
   #if defined(__AVX512VL__)
             _mm256_i64scatter_epi64((long long int*)baseAddr, indices.mVec, mVec, 8);
@@ -2055,8 +2098,8 @@ namespace SIMD {
             return baseAddr;
         }
         // MSCATTERV
-        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<4> const & mask, int64_t* baseAddr, SIMDVec_u<uint64_t, 4> const & indices) const {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<4> const & mask, int64_t* baseAddr, SIMDVec_u<uint64_t, 4> const & indices) const {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
   #if defined(__AVX512VL__)
             _mm256_mask_i64scatter_epi64((long long int*)baseAddr, mask.mMask, indices.mVec, mVec, 8);
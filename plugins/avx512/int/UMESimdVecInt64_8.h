@@ -160,6 +160,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const *p) {
@@ -171,6 +173,12 @@ namespace SIMD {
             mVec = _mm512_mask_loadu_epi64(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int64_t const * p, uint32_t count) {
+            __mmask8 t0 = __mmask8((count >= 8) ? 0xFF : ((1 << count) - 1));
+            mVec = _mm512_maskz_loadu_epi64(t0, p);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_i & loada(int64_t const *p) {
             mVec = _mm512_load_si512((const __m512i *) p);
@@ -191,6 +199,12 @@ namespace SIMD {
             _mm512_mask_storeu_epi64(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE int64_t * storeTail(int64_t * p, uint32_t count) const {
+            __mmask8 t0 = __mmask8((count >= 8) ? 0xFF : ((1 << count) - 1));
+            _mm512_mask_storeu_epi64(p, t0, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE int64_t* storea(int64_t* p) const {
             _mm512_store_si512((__m512i *)p, mVec);
@@ -202,6 +216,32 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<8> const & mask) const {
+            return SIMDVec_i(_mm512_maskz_compress_epi64(mask.mMask, mVec));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, int64_t * p) const {
+            _mm512_mask_compressstoreu_epi64((void *)p, mask.mMask, mVec);
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, int64_t const * p) {
+            mVec = _mm512_mask_expandloadu_epi64(mVec, mask.mMask, (void const *)p);
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint64_t, 8> const & indices) const {
+            return SIMDVec_i(_mm512_permutexvar_epi64(indices.mVec, mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & indices) const {
+            return SIMDVec_i(_mm512_mask_permutexvar_epi64(mVec, mask.mMask, indices.mVec, mVec));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint64_t, 8> const & indices) const {
+            return SIMDVec_i(_mm512_permutex2var_epi64(mVec, indices.mVec, b.mVec));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
             __m512i t0 = _mm512_mask_mov_epi64(mVec, mask.mMask, b.mVec);
@@ -1679,8 +1719,8 @@ namespace SIMD {
             __m512i t2 = _mm512_mullo_epi64(t0, t1);
 #else
             __m512i t2 = _mm512_setr_epi64(0, stride, 2*stride, 3*stride, 4*stride, 5*stride, 6*stride, 7*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             mVec = _mm512_i64gather_epi64(t2, (const long long int*)baseAddr, 8);
 #else
@@ -1696,8 +1736,8 @@ namespace SIMD {
             __m512i t2 = _mm512_mullo_epi64(t0, t1);
 #else
             __m512i t2 = _mm512_setr_epi64(0, stride, 2*stride, 3*stride, 4*stride, 5*stride, 6*stride, 7*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             __m512i t3 = _mm512_i64gather_epi64(t2, (const long long int*)baseAddr, 8);
 #else
@@ -1708,8 +1748,8 @@ namespace SIMD {
         }
         // GATHERS
         UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, uint64_t const * indices) {
-            __m512i t0 =_mm512_loadu_si512((__m512i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m512i t0 =_mm512_loadu_si512((__m512i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             mVec = _mm512_i64gather_epi64(t0, (const long long int*)baseAddr, 8);
 #else
@@ -1719,8 +1759,8 @@ namespace SIMD {
         }
         // MGATHERS
         UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<8> const & mask, int64_t const * baseAddr, uint64_t const * indices) {
-            __m512i t0 = _mm512_loadu_si512((__m512i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m512i t0 = _mm512_loadu_si512((__m512i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             __m512i t1 = _mm512_i64gather_epi64(t0, (const long long int*)baseAddr, 8);
 #else
@@ -1730,8 +1770,8 @@ namespace SIMD {
             return *this;
         }
         // GATHERV
-        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             mVec = _mm512_i64gather_epi64(indices.mVec, (const long long int*)baseAddr, 8);
 #else
@@ -1740,8 +1780,8 @@ namespace SIMD {
             return *this;
         }
         // MGATHERV
-        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<8> const & mask, int64_t const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<8> const & mask, int64_t const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             __m512i t0 = _mm512_i64gather_epi64(indices.mVec, (const long long int*)baseAddr, 8);
 #else
@@ -1758,8 +1798,8 @@ namespace SIMD {
             __m512i t2 = _mm512_mullo_epi64(t0, t1);
 #else
             __m512i t2 = _mm512_setr_epi64(0, stride, 2*stride, 3*stride, 4*stride, 5*stride, 6*stride, 7*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             _mm512_i64scatter_epi64((long long int*)baseAddr, t2, mVec, 8);
 #else
@@ -1775,8 +1815,8 @@ namespace SIMD {
             __m512i t2 = _mm512_mullo_epi64(t0, t1);
 #else
             __m512i t2 = _mm512_setr_epi64(0, stride, 2*stride, 3*stride, 4*stride, 5*stride, 6*stride, 7*stride);
-#endif
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+#endif
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             _mm512_mask_i64scatter_epi64((long long int*)baseAddr, mask.mMask, t2, mVec, 8);
 #else
@@ -1786,8 +1826,8 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, uint64_t* indices) const {
-            __m512i t0 = _mm512_loadu_si512((__m512i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m512i t0 = _mm512_loadu_si512((__m512i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             _mm512_i64scatter_epi64((long long int*)baseAddr, t0, mVec, 8);
 #else
@@ -1797,8 +1837,8 @@ namespace SIMD {
         }
         // MSCATTERS
         UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<8> const & mask, int64_t* baseAddr, uint64_t* indices) const {
-            __m512i t0 = _mm512_loadu_si512((__m512i *)indices);
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+            __m512i t0 = _mm512_loadu_si512((__m512i *)indices);
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             _mm512_mask_i64scatter_epi64((long long int*)baseAddr, mask.mMask, t0, mVec, 8);
 #else
@@ -1807,8 +1847,8 @@ namespace SIMD {
             return baseAddr;
         }
         // SCATTERV
-        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, SIMDVec_u<uint64_t, 8> const & indices) const {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, SIMDVec_u<uint64_t, 8> const & indices) const {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             _mm512_i64scatter_epi64((long long int*)baseAddr, indices.mVec, mVec, 8);
 #else
@@ -1817,8 +1857,8 @@ namespace SIMD {
             return baseAddr;
         }
         // MSCATTERV
-        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<8> const & mask, int64_t* baseAddr, SIMDVec_u<uint64_t, 8> const & indices) const {
-#if defined(WA_GCC_INTR_SUPPORT_7_1)
+        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<8> const & mask, int64_t* baseAddr, SIMDVec_u<uint64_t, 8> const & indices) const {
+#if defined(WA_GCC_INTR_SUPPORT_7_1)
             // g++ has some interface issues.
             _mm512_mask_i64scatter_epi64((long long int*)baseAddr, mask.mMask, indices.mVec, mVec, 8);
 #else
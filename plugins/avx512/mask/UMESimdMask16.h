@@ -451,6 +451,16 @@ namespace SIMD {
         UME_FORCE_INLINE bool cmpe(bool b) const {
             return (mMask & 0xFFFF) == (b ? 0xFFFF : 0);
         }
+        // TOBITS
+        UME_FORCE_INLINE uint64_t toBits() const {
+            return uint64_t(mMask & 0xFFFF);
+        }
+        // FROMBITS
+        static UME_FORCE_INLINE SIMDVecMask fromBits(uint64_t bits) {
+            SIMDVecMask t0;
+            t0.mMask = __mmask16(bits & 0xFFFF);
+            return t0;
+        }
     };
 
 }
@@ -351,6 +351,16 @@ namespace SIMD {
         UME_FORCE_INLINE bool cmpe(bool b) const {
             return (mMask & 0x3) == (b ? 0x3 : 0);
         }
+        // TOBITS
+        UME_FORCE_INLINE uint64_t toBits() const {
+            return uint64_t(mMask & 0x3);
+        }
+        // FROMBITS
+        static UME_FORCE_INLINE SIMDVecMask fromBits(uint64_t bits) {
+            SIMDVecMask t0;
+            t0.mMask = __mmask8(bits & 0x3);
+            return t0;
+        }
     };
 }
 }
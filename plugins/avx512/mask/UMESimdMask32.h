@@ -540,6 +540,16 @@ namespace SIMD {
         UME_FORCE_INLINE bool cmpe(bool b) const {
             return (mMask & 0xFFFFFFFF) == (b ? 0xFFFFFFFF : 0);
         }
+        // TOBITS
+        UME_FORCE_INLINE uint64_t toBits() const {
+            return uint64_t(mMask & 0xFFFFFFFF);
+        }
+        // FROMBITS
+        static UME_FORCE_INLINE SIMDVecMask fromBits(uint64_t bits) {
+            SIMDVecMask t0;
+            t0.mMask = __mmask32(bits & 0xFFFFFFFF);
+            return t0;
+        }
     };
 
 }
@@ -368,6 +368,16 @@ namespace SIMD {
         UME_FORCE_INLINE bool cmpe(bool b) const {
             return (mMask & 0xF) == (b ? 0xF : 0);
         }
+        // TOBITS
+        UME_FORCE_INLINE uint64_t toBits() const {
+            return uint64_t(mMask & 0xF);
+        }
+        // FROMBITS
+        static UME_FORCE_INLINE SIMDVecMask fromBits(uint64_t bits) {
+            SIMDVecMask t0;
+            t0.mMask = __mmask8(bits & 0xF);
+            return t0;
+        }
     };
 }
 }
@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -160,6 +161,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
             mVec = _mm512_loadu_si512(p);
@@ -170,6 +173,12 @@ namespace SIMD {
             mVec = _mm512_mask_loadu_epi32(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint32_t const * p, uint32_t count) {
+            __mmask16 t0 = __mmask16((count >= 16) ? 0xFFFF : ((1 << count) - 1));
+            mVec = _mm512_maskz_loadu_epi32(t0, p);
+            return *this;
+        }
         // LOADA
         UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
             mVec = _mm512_load_si512((__m512i*)p);
@@ -190,8 +199,14 @@ namespace SIMD {
             _mm512_mask_storeu_epi32(p, mask.mMask, mVec);
             return p;
         }
+        // STORETAIL
+        UME_FORCE_INLINE uint32_t * storeTail(uint32_t * p, uint32_t count) const {
+            __mmask16 t0 = __mmask16((count >= 16) ? 0xFFFF : ((1 << count) - 1));
+            _mm512_mask_storeu_epi32(p, t0, mVec);
+            return p;
+        }
         // STOREA
-        UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) {
+        UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
             _mm512_store_si512((__m512i*)addrAligned, mVec);
             return addrAligned;
         }
@@ -200,6 +215,32 @@ namespace SIMD {
             _mm512_mask_store_epi32(p, mask.mMask, mVec);
             return p;
         }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_u compress(SIMDVecMask<16> const & mask) const {
+            return SIMDVec_u(_mm512_maskz_compress_epi32(mask.mMask, mVec));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<16> const & mask, uint32_t * p) const {
+            _mm512_mask_compressstoreu_epi32((void *)p, mask.mMask, mVec);
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<16> const & mask, uint32_t const * p) {
+            mVec = _mm512_mask_expandloadu_epi32(mVec, mask.mMask, (void const *)p);
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_u(_mm512_permutexvar_epi32(indices.mVec, mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_u(_mm512_mask_permutexvar_epi32(mVec, mask.mMask, indices.mVec, mVec));
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_u permute2(SIMDVec_u const & b, SIMDVec_u<uint32_t, 16> const & indices) const {
+            return SIMDVec_u(_mm512_permutex2var_epi32(mVec, indices.mVec, b.mVec));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
             __m512i t0 = _mm512_mask_mov_epi32(mVec, mask.mMask, b.mVec);
@@ -229,6 +270,43 @@ namespace SIMD {
             mVec = _mm512_permutexvar_epi32(sMask.mVec, mVec);
             return *this;
         }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = AVX512::sortNetwork16<uint32_t, false>(t0);
+            return SIMDVec_u(_mm512_castps_si512(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = _mm512_castsi512_ps(payload.mVec);
+            AVX512::sortNetwork16<uint32_t, false>(t0, t1);
+            payload.mVec = _mm512_castps_si512(t1);
+            return SIMDVec_u(_mm512_castps_si512(t0));
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = AVX512::sortNetwork16<uint32_t, true>(t0);
+            return SIMDVec_u(_mm512_castps_si512(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m512 t0 = _mm512_castsi512_ps(mVec);
+            __m512 t1 = _mm512_castsi512_ps(payload.mVec);
+            AVX512::sortNetwork16<uint32_t, true>(t0, t1);
+            payload.mVec = _mm512_castps_si512(t1);
+            return SIMDVec_u(_mm512_castps_si512(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m512i t0 = _mm512_add_epi32(mVec, b.mVec);
@@ -762,6 +840,11 @@ namespace SIMD {
             __mmask16 t1 = _mm512_cmpeq_epu32_mask(t0, _mm512_setzero_epi32());
             return (t1 == 0xFFFF);
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m512i t0 = _mm512_conflict_epi32(mVec);
+            return SIMDVec_u(t0);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
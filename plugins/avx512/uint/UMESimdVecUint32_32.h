@@ -201,6 +201,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
             mVec[0] = _mm512_loadu_si512(p);
@@ -244,7 +246,7 @@ namespace SIMD {
             return p;
         }
         // STOREA
-        UME_FORCE_INLINE uint32_t * storea(uint32_t * p) {
+        UME_FORCE_INLINE uint32_t * storea(uint32_t * p) const {
             _mm512_store_si512((__m512i*)p, mVec[0]);
             _mm512_store_si512((__m512i*)(p + 16), mVec[1]);
             return p;
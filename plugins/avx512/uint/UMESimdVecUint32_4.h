@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -169,6 +170,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
 #if defined(__AVX512VL__)
@@ -183,11 +186,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_epi32(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi128_si512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castsi512_si128(t0);
 #endif
             return *this;
         }
@@ -201,11 +201,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_load_epi32(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi128_si512(mVec), mask.mMask & 0xF, p);
+            mVec = _mm512_castsi512_si128(t0);
 #endif
             return *this;
         }
@@ -219,12 +216,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_epi32(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_storeu_si128((__m128i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xF, _mm512_castsi128_si512(mVec));
 #endif
             return p;
         }
@@ -238,12 +230,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_store_epi32(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_store_si128((__m128i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xF, _mm512_castsi128_si512(mVec));
 #endif
             return p;
         }
@@ -277,7 +264,42 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
         // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX512::sortNetwork4<uint32_t, false>(t0);
+            return SIMDVec_u(_mm_castps_si128(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX512::sortNetwork4<uint32_t, false>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_u(_mm_castps_si128(t0));
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = AVX512::sortNetwork4<uint32_t, true>(t0);
+            return SIMDVec_u(_mm_castps_si128(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m128 t0 = _mm_castsi128_ps(mVec);
+            __m128 t1 = _mm_castsi128_ps(payload.mVec);
+            AVX512::sortNetwork4<uint32_t, true>(t0, t1);
+            payload.mVec = _mm_castps_si128(t1);
+            return SIMDVec_u(_mm_castps_si128(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -981,6 +1003,21 @@ namespace SIMD {
             return t0 && t1 && t2 && t3 && t4 && t5;
 #endif
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m128i t6 = _mm_conflict_epi32(mVec);
+#else
+            __m128i t0 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0x00));
+            __m128i t1 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0x55));
+            __m128i t2 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, 0xAA));
+            __m128i t3 = _mm_and_si128(t0, _mm_set_epi32(1, 1, 1, 0));
+            __m128i t4 = _mm_and_si128(t1, _mm_set_epi32(2, 2, 0, 0));
+            __m128i t5 = _mm_and_si128(t2, _mm_set_epi32(4, 0, 0, 0));
+            __m128i t6 = _mm_or_si128(t3, _mm_or_si128(t4, t5));
+#endif
+            return SIMDVec_u(t6);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
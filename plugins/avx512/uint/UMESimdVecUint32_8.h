@@ -35,6 +35,7 @@
 #include <immintrin.h>
 
 #include "../../../UMESimdInterface.h"
+#include "../UMESimdSortAVX512.h"
 
 namespace UME {
 namespace SIMD {
@@ -170,6 +171,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
@@ -181,11 +184,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_epi32(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, (__mmask16) mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi256_si512(mVec), mask.mMask & 0xFF, p);
+            mVec = _mm512_castsi512_si256(t0);
 #endif
             return *this;
         }
@@ -199,11 +199,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_load_epi32(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, (__mmask16) mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_mask_loadu_epi32(_mm512_castsi256_si512(mVec), mask.mMask & 0xFF, p);
+            mVec = _mm512_castsi512_si256(t0);
 #endif
             return *this;
         }
@@ -221,12 +218,7 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_epi32(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_storeu_si256((__m256i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xFF, _mm512_castsi256_si512(mVec));
 #endif
             return p;
         }
@@ -240,15 +232,58 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_epi32(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_store_si256((__m256i*)p, t4);
+            _mm512_mask_storeu_epi32(p, mask.mMask & 0xFF, _mm512_castsi256_si512(mVec));
 #endif
             return p;
         }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_u compress(SIMDVecMask<8> const & mask) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_u(_mm256_maskz_compress_epi32(mask.mMask, mVec));
+#else
+            __m512i t1 = _mm512_maskz_compress_epi32(mask.mMask, _mm512_castsi256_si512(mVec));
+            return SIMDVec_u(_mm512_castsi512_si256(t1));
+#endif
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, uint32_t * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_epi32((void *)p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_epi32((void *)p, mask.mMask, _mm512_castsi256_si512(mVec));
+#endif
+            return mask.count();
+        }
+        // EXPAND
+        UME_FORCE_INLINE uint32_t expand(SIMDVecMask<8> const & mask, uint32_t const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_epi32(mVec, mask.mMask, (void const *)p);
+#else
+            __m512i t1 = _mm512_mask_expandloadu_epi32(_mm512_castsi256_si512(mVec), mask.mMask, (void const *)p);
+            mVec = _mm512_castsi512_si256(t1);
+#endif
+            return mask.count();
+        }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            return SIMDVec_u(_mm256_permutevar8x32_epi32(mVec, indices.mVec));
+        }
+        // MPERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & indices) const {
+            SIMDVec_u t0 = permute(indices);
+            return blend(mask, t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_u permute2(SIMDVec_u const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+#if defined(__AVX512VL__)
+            return SIMDVec_u(_mm256_permutex2var_epi32(mVec, indices.mVec, b.mVec));
+#else
+            __m512i t0 = _mm512_inserti64x4(_mm512_castsi256_si512(mVec), b.mVec, 1);
+            __m256i t1 = _mm256_and_si256(indices.mVec, _mm256_set1_epi32(0xF));
+            __m512i t2 = _mm512_permutexvar_epi32(_mm512_castsi256_si512(t1), t0);
+            return SIMDVec_u(_mm512_castsi512_si256(t2));
+#endif
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
 #if defined(__AVX512VL__)
@@ -285,7 +320,7 @@ namespace SIMD {
             return SIMDVec_u(t0);
 #else
   #if defined(__AVX512VL__) && !defined(WA_GCC_INTR_SUPPORT_7_1)
-            __m256i t0 = _mm256_permutexvar_epi32(mVec, sMask.mVec);
+            __m256i t0 = _mm256_permutexvar_epi32(sMask.mVec, mVec);
             return SIMDVec_u(t0);
   #else
             __m512i t0 = _mm512_castsi256_si512(sMask.mVec);
@@ -306,7 +341,7 @@ namespace SIMD {
 #else
   #if defined(__AVX512VL__) && !defined(WA_GCC_INTR_SUPPORT_7_1)
             __m256i t0 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
-            __m256i t1 = _mm256_permutexvar_epi32(mVec, t0);
+            __m256i t1 = _mm256_permutexvar_epi32(t0, mVec);
             return SIMDVec_u(t1);
   #else
             __m512i t0 = _mm512_setr_epi32(
@@ -327,7 +362,7 @@ namespace SIMD {
             return *this;
 #else
   #if defined(__AVX512VL__) && !defined(WA_GCC_INTR_SUPPORT_7_1)
-            mVec = _mm256_permutexvar_epi32(mVec, sMask.mVec);
+            mVec = _mm256_permutexvar_epi32(sMask.mVec, mVec);
             return *this;
   #else
             __m512i t0 = _mm512_castsi256_si512(sMask.mVec);
@@ -340,7 +375,42 @@ namespace SIMD {
         }
 
         // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX512::sortNetwork8<uint32_t, false>(t0);
+            return SIMDVec_u(_mm256_castps_si256(t1));
+        }
+        // SORTAKV
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX512::sortNetwork8<uint32_t, false>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_u(_mm256_castps_si256(t0));
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = AVX512::sortNetwork8<uint32_t, true>(t0);
+            return SIMDVec_u(_mm256_castps_si256(t1));
+        }
+        // SORTDKV
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(payload.mVec);
+            AVX512::sortNetwork8<uint32_t, true>(t0, t1);
+            payload.mVec = _mm256_castps_si256(t1);
+            return SIMDVec_u(_mm256_castps_si256(t0));
+        }
+        // SORTAKV, SORTDKV - other payload types
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sorta(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortAscending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FORCE_INLINE SIMDVec_u sortd(PAYLOAD_VEC_TYPE & payload) {
+            return SCALAR_EMULATION::sortDescending<SIMDVec_u, uint32_t, PAYLOAD_VEC_TYPE>(*this, payload);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
@@ -1048,6 +1118,26 @@ namespace SIMD {
         return true;
 #endif
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m256i t0 = _mm256_conflict_epi32(mVec);
+#else
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+            __m256i t2 = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+            __m256i t3 = _mm256_set1_epi32(1);
+            // Compare with the vector rotated by 'k' elements: element 'i' meets
+            // element 'i - k', and (1 << i) >> k is zero where the rotation wrapped.
+            for (int k = 1; k < 8; k++) {
+                t1 = _mm256_sub_epi32(t1, t3);
+                t2 = _mm256_srli_epi32(t2, 1);
+                __m256i t4 = _mm256_permutevar8x32_epi32(mVec, t1);
+                t0 = _mm256_or_si256(t0, _mm256_and_si256(_mm256_cmpeq_epi32(mVec, t4), t2));
+            }
+#endif
+            return SIMDVec_u(t0);
+        }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
 #if defined(WA_GCC_INTR_SUPPORT_6_4)
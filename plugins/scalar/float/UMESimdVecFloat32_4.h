@@ -170,6 +170,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FUNC_ATTRIB SIMDVec_f & load(float const *p) {
@@ -1195,34 +1197,34 @@ namespace SIMD {
 
         // FMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec[0] * b.mVec[0] + c.mVec[0];
-            float t1 = mVec[1] * b.mVec[1] + c.mVec[1];
-            float t2 = mVec[2] * b.mVec[2] + c.mVec[2];
-            float t3 = mVec[3] * b.mVec[3] + c.mVec[3];
+            float t0 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[1], b.mVec[1], c.mVec[1]);
+            float t2 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[2], b.mVec[2], c.mVec[2]);
+            float t3 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[3], b.mVec[3], c.mVec[3]);
             return SIMDVec_f(t0, t1, t2, t3);
         }
         // MFMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mask.mMask[0] ? (mVec[0] * b.mVec[0] + c.mVec[0]) : mVec[0];
-            float t1 = mask.mMask[1] ? (mVec[1] * b.mVec[1] + c.mVec[1]) : mVec[1];
-            float t2 = mask.mMask[2] ? (mVec[2] * b.mVec[2] + c.mVec[2]) : mVec[2];
-            float t3 = mask.mMask[3] ? (mVec[3] * b.mVec[3] + c.mVec[3]) : mVec[3];
+            float t0 = mask.mMask[0] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[0], b.mVec[0], c.mVec[0])) : mVec[0];
+            float t1 = mask.mMask[1] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[1], b.mVec[1], c.mVec[1])) : mVec[1];
+            float t2 = mask.mMask[2] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[2], b.mVec[2], c.mVec[2])) : mVec[2];
+            float t3 = mask.mMask[3] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[3], b.mVec[3], c.mVec[3])) : mVec[3];
             return SIMDVec_f(t0, t1, t2, t3);
         }
         // FMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec[0] * b.mVec[0] - c.mVec[0];
-            float t1 = mVec[1] * b.mVec[1] - c.mVec[1];
-            float t2 = mVec[2] * b.mVec[2] - c.mVec[2];
-            float t3 = mVec[3] * b.mVec[3] - c.mVec[3];
+            float t0 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[1], b.mVec[1], c.mVec[1]);
+            float t2 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[2], b.mVec[2], c.mVec[2]);
+            float t3 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[3], b.mVec[3], c.mVec[3]);
             return SIMDVec_f(t0, t1, t2, t3);
         }
         // MFMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mask.mMask[0] ? (mVec[0] * b.mVec[0] - c.mVec[0]) : mVec[0];
-            float t1 = mask.mMask[1] ? (mVec[1] * b.mVec[1] - c.mVec[1]) : mVec[1];
-            float t2 = mask.mMask[2] ? (mVec[2] * b.mVec[2] - c.mVec[2]) : mVec[2];
-            float t3 = mask.mMask[3] ? (mVec[3] * b.mVec[3] - c.mVec[3]) : mVec[3];
+            float t0 = mask.mMask[0] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[0], b.mVec[0], c.mVec[0])) : mVec[0];
+            float t1 = mask.mMask[1] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[1], b.mVec[1], c.mVec[1])) : mVec[1];
+            float t2 = mask.mMask[2] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[2], b.mVec[2], c.mVec[2])) : mVec[2];
+            float t3 = mask.mMask[3] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[3], b.mVec[3], c.mVec[3])) : mVec[3];
             return SIMDVec_f(t0, t1, t2, t3);
         }
         // FADDMULV
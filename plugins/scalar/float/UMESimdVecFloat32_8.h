@@ -199,6 +199,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FUNC_ATTRIB SIMDVec_f & load(float const *p) {
@@ -1726,50 +1728,50 @@ namespace SIMD {
 
         // FMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec[0] * b.mVec[0] + c.mVec[0];
-            float t1 = mVec[1] * b.mVec[1] + c.mVec[1];
-            float t2 = mVec[2] * b.mVec[2] + c.mVec[2];
-            float t3 = mVec[3] * b.mVec[3] + c.mVec[3];
-            float t4 = mVec[4] * b.mVec[4] + c.mVec[4];
-            float t5 = mVec[5] * b.mVec[5] + c.mVec[5];
-            float t6 = mVec[6] * b.mVec[6] + c.mVec[6];
-            float t7 = mVec[7] * b.mVec[7] + c.mVec[7];
+            float t0 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[1], b.mVec[1], c.mVec[1]);
+            float t2 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[2], b.mVec[2], c.mVec[2]);
+            float t3 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[3], b.mVec[3], c.mVec[3]);
+            float t4 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[4], b.mVec[4], c.mVec[4]);
+            float t5 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[5], b.mVec[5], c.mVec[5]);
+            float t6 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[6], b.mVec[6], c.mVec[6]);
+            float t7 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[7], b.mVec[7], c.mVec[7]);
             return SIMDVec_f(t0, t1, t2, t3, t4, t5, t6, t7);
         }
         // MFMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mask.mMask[0] ? (mVec[0] * b.mVec[0] + c.mVec[0]) : mVec[0];
-            float t1 = mask.mMask[1] ? (mVec[1] * b.mVec[1] + c.mVec[1]) : mVec[1];
-            float t2 = mask.mMask[2] ? (mVec[2] * b.mVec[2] + c.mVec[2]) : mVec[2];
-            float t3 = mask.mMask[3] ? (mVec[3] * b.mVec[3] + c.mVec[3]) : mVec[3];
-            float t4 = mask.mMask[4] ? (mVec[4] * b.mVec[4] + c.mVec[4]) : mVec[4];
-            float t5 = mask.mMask[5] ? (mVec[5] * b.mVec[5] + c.mVec[5]) : mVec[5];
-            float t6 = mask.mMask[6] ? (mVec[6] * b.mVec[6] + c.mVec[6]) : mVec[6];
-            float t7 = mask.mMask[7] ? (mVec[7] * b.mVec[7] + c.mVec[7]) : mVec[7];
+            float t0 = mask.mMask[0] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[0], b.mVec[0], c.mVec[0])) : mVec[0];
+            float t1 = mask.mMask[1] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[1], b.mVec[1], c.mVec[1])) : mVec[1];
+            float t2 = mask.mMask[2] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[2], b.mVec[2], c.mVec[2])) : mVec[2];
+            float t3 = mask.mMask[3] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[3], b.mVec[3], c.mVec[3])) : mVec[3];
+            float t4 = mask.mMask[4] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[4], b.mVec[4], c.mVec[4])) : mVec[4];
+            float t5 = mask.mMask[5] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[5], b.mVec[5], c.mVec[5])) : mVec[5];
+            float t6 = mask.mMask[6] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[6], b.mVec[6], c.mVec[6])) : mVec[6];
+            float t7 = mask.mMask[7] ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[7], b.mVec[7], c.mVec[7])) : mVec[7];
             return SIMDVec_f(t0, t1, t2, t3, t4, t5, t6, t7);
         }
         // FMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mVec[0] * b.mVec[0] - c.mVec[0];
-            float t1 = mVec[1] * b.mVec[1] - c.mVec[1];
-            float t2 = mVec[2] * b.mVec[2] - c.mVec[2];
-            float t3 = mVec[3] * b.mVec[3] - c.mVec[3];
-            float t4 = mVec[4] * b.mVec[4] - c.mVec[4];
-            float t5 = mVec[5] * b.mVec[5] - c.mVec[5];
-            float t6 = mVec[6] * b.mVec[6] - c.mVec[6];
-            float t7 = mVec[7] * b.mVec[7] - c.mVec[7];
+            float t0 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[0], b.mVec[0], c.mVec[0]);
+            float t1 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[1], b.mVec[1], c.mVec[1]);
+            float t2 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[2], b.mVec[2], c.mVec[2]);
+            float t3 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[3], b.mVec[3], c.mVec[3]);
+            float t4 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[4], b.mVec[4], c.mVec[4]);
+            float t5 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[5], b.mVec[5], c.mVec[5]);
+            float t6 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[6], b.mVec[6], c.mVec[6]);
+            float t7 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[7], b.mVec[7], c.mVec[7]);
             return SIMDVec_f(t0, t1, t2, t3, t4, t5, t6, t7);
         }
         // MFMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            float t0 = mask.mMask[0] ? (mVec[0] * b.mVec[0] - c.mVec[0]) : mVec[0];
-            float t1 = mask.mMask[1] ? (mVec[1] * b.mVec[1] - c.mVec[1]) : mVec[1];
-            float t2 = mask.mMask[2] ? (mVec[2] * b.mVec[2] - c.mVec[2]) : mVec[2];
-            float t3 = mask.mMask[3] ? (mVec[3] * b.mVec[3] - c.mVec[3]) : mVec[3];
-            float t4 = mask.mMask[4] ? (mVec[4] * b.mVec[4] - c.mVec[4]) : mVec[4];
-            float t5 = mask.mMask[5] ? (mVec[5] * b.mVec[5] - c.mVec[5]) : mVec[5];
-            float t6 = mask.mMask[6] ? (mVec[6] * b.mVec[6] - c.mVec[6]) : mVec[6];
-            float t7 = mask.mMask[7] ? (mVec[7] * b.mVec[7] - c.mVec[7]) : mVec[7];
+            float t0 = mask.mMask[0] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[0], b.mVec[0], c.mVec[0])) : mVec[0];
+            float t1 = mask.mMask[1] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[1], b.mVec[1], c.mVec[1])) : mVec[1];
+            float t2 = mask.mMask[2] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[2], b.mVec[2], c.mVec[2])) : mVec[2];
+            float t3 = mask.mMask[3] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[3], b.mVec[3], c.mVec[3])) : mVec[3];
+            float t4 = mask.mMask[4] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[4], b.mVec[4], c.mVec[4])) : mVec[4];
+            float t5 = mask.mMask[5] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[5], b.mVec[5], c.mVec[5])) : mVec[5];
+            float t6 = mask.mMask[6] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[6], b.mVec[6], c.mVec[6])) : mVec[6];
+            float t7 = mask.mMask[7] ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[7], b.mVec[7], c.mVec[7])) : mVec[7];
             return SIMDVec_f(t0, t1, t2, t3, t4, t5, t6, t7);
         }
         // FADDMULV
@@ -148,6 +148,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         //(Memory access)
         // LOAD
@@ -723,22 +725,22 @@ namespace SIMD {
 
         // FMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = mVec * b.mVec + c.mVec;
+            double t0 = SCALAR_EMULATION::MATH::fmuladdElement(mVec, b.mVec, c.mVec);
             return SIMDVec_f(t0);
         }
         // MFMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVecMask<1> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = (mask.mMask == true) ? (mVec * b.mVec + c.mVec) : mVec;
+            double t0 = (mask.mMask == true) ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec, b.mVec, c.mVec)) : mVec;
             return SIMDVec_f(t0);
         }
         // FMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = mVec * b.mVec - c.mVec;
+            double t0 = SCALAR_EMULATION::MATH::fmulsubElement(mVec, b.mVec, c.mVec);
             return SIMDVec_f(t0);
         }
         // MFMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVecMask<1> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = (mask.mMask == true) ? (mVec * b.mVec - c.mVec) : mVec;
+            double t0 = (mask.mMask == true) ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec, b.mVec, c.mVec)) : mVec;
             return SIMDVec_f(t0);
         }
         // FADDMULV
@@ -179,6 +179,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FUNC_ATTRIB SIMDVec_f & load(double const * p) {
@@ -828,26 +830,26 @@ namespace SIMD {
 
         // FMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = mVec[0] * b.mVec[0] + c.mVec[0];
-            double t1 = mVec[1] * b.mVec[1] + c.mVec[1];
+            double t0 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[0], b.mVec[0], c.mVec[0]);
+            double t1 = SCALAR_EMULATION::MATH::fmuladdElement(mVec[1], b.mVec[1], c.mVec[1]);
             return SIMDVec_f(t0, t1);
         }
         // MFMULADDV
         UME_FUNC_ATTRIB SIMDVec_f fmuladd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = (mask.mMask[0] == true) ? (mVec[0] * b.mVec[0] + c.mVec[0]) : mVec[0];
-            double t1 = (mask.mMask[1] == true) ? (mVec[1] * b.mVec[1] + c.mVec[1]) : mVec[1];
+            double t0 = (mask.mMask[0] == true) ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[0], b.mVec[0], c.mVec[0])) : mVec[0];
+            double t1 = (mask.mMask[1] == true) ? (SCALAR_EMULATION::MATH::fmuladdElement(mVec[1], b.mVec[1], c.mVec[1])) : mVec[1];
             return SIMDVec_f(t0, t1);
         }
         // FMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = mVec[0] * b.mVec[0] - c.mVec[0];
-            double t1 = mVec[1] * b.mVec[1] - c.mVec[1];
+            double t0 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[0], b.mVec[0], c.mVec[0]);
+            double t1 = SCALAR_EMULATION::MATH::fmulsubElement(mVec[1], b.mVec[1], c.mVec[1]);
             return SIMDVec_f(t0, t1);
         }
         // MFMULSUBV
         UME_FUNC_ATTRIB SIMDVec_f fmulsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
-            double t0 = (mask.mMask[0] == true) ? (mVec[0] * b.mVec[0] - c.mVec[0]) : mVec[0];
-            double t1 = (mask.mMask[1] == true) ? (mVec[1] * b.mVec[1] - c.mVec[1]) : mVec[1];
+            double t0 = (mask.mMask[0] == true) ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[0], b.mVec[0], c.mVec[0])) : mVec[0];
+            double t1 = (mask.mMask[1] == true) ? (SCALAR_EMULATION::MATH::fmulsubElement(mVec[1], b.mVec[1], c.mVec[1])) : mVec[1];
             return SIMDVec_f(t0, t1);
         }
         // FADDMULV
@@ -141,6 +141,8 @@ namespace SIMD {
         // PREFETCH0
         // PREFETCH1
         // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
 
         // LOAD
         UME_FUNC_ATTRIB SIMDVec_i & load(int32_t const *p) {
@@ -0,0 +1,269 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_INTRINSICS_SSE_H_
+#define UME_SIMD_INTRINSICS_SSE_H_
+
+#include <immintrin.h>
+
+#include "../../UMEInline.h"
+
+// SSE4.1 and SSE4.2 instructions used by the plugin. When compiling for the SSE2
+// baseline (no -msse4.1 or -msse4.2), equivalent SSE2 sequences are used instead.
+
+namespace UME {
+namespace SIMD {
+namespace SSE {
+
+    // Select elements from 'b' where 'mask' is set, and from 'a' otherwise.
+    // Mask elements are expected to be all-ones or all-zeros.
+    UME_FORCE_INLINE __m128 blendv_ps(__m128 const & a, __m128 const & b, __m128 const & mask) {
+#if defined(__SSE4_1__)
+        return _mm_blendv_ps(a, b, mask);
+#else
+        return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+#endif
+    }
+
+    UME_FORCE_INLINE __m128d blendv_pd(__m128d const & a, __m128d const & b, __m128d const & mask) {
+#if defined(__SSE4_1__)
+        return _mm_blendv_pd(a, b, mask);
+#else
+        return _mm_or_pd(_mm_and_pd(mask, b), _mm_andnot_pd(mask, a));
+#endif
+    }
+
+    UME_FORCE_INLINE __m128i blendv_epi8(__m128i const & a, __m128i const & b, __m128i const & mask) {
+#if defined(__SSE4_1__)
+        return _mm_blendv_epi8(a, b, mask);
+#else
+        return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+#endif
+    }
+
+    UME_FORCE_INLINE __m128i mullo_epi32(__m128i const & a, __m128i const & b) {
+#if defined(__SSE4_1__)
+        return _mm_mullo_epi32(a, b);
+#else
+        // Multiply even and odd elements separately, and interleave low halves of the products.
+        __m128i t0 = _mm_mul_epu32(a, b);
+        __m128i t1 = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+        __m128i t2 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(0, 0, 2, 0));
+        __m128i t3 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(0, 0, 2, 0));
+        return _mm_unpacklo_epi32(t2, t3);
+#endif
+    }
+
+    UME_FORCE_INLINE __m128i min_epi32(__m128i const & a, __m128i const & b) {
+#if defined(__SSE4_1__)
+        return _mm_min_epi32(a, b);
+#else
+        return blendv_epi8(a, b, _mm_cmpgt_epi32(a, b));
+#endif
+    }
+
+    UME_FORCE_INLINE __m128i max_epi32(__m128i const & a, __m128i const & b) {
+#if defined(__SSE4_1__)
+        return _mm_max_epi32(a, b);
+#else
+        return blendv_epi8(a, b, _mm_cmplt_epi32(a, b));
+#endif
+    }
+
+    // Unsigned comparison: flip sign bits and compare as signed.
+    UME_FORCE_INLINE __m128i cmpgt_epu32(__m128i const & a, __m128i const & b) {
+        __m128i t0 = _mm_set1_epi32(0x80000000);
+        return _mm_cmpgt_epi32(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+    }
+
+    UME_FORCE_INLINE __m128i min_epu32(__m128i const & a, __m128i const & b) {
+#if defined(__SSE4_1__)
+        return _mm_min_epu32(a, b);
+#else
+        return blendv_epi8(a, b, cmpgt_epu32(a, b));
+#endif
+    }
+
+    UME_FORCE_INLINE __m128i max_epu32(__m128i const & a, __m128i const & b) {
+#if defined(__SSE4_1__)
+        return _mm_max_epu32(a, b);
+#else
+        return blendv_epi8(a, b, cmpgt_epu32(b, a));
+#endif
+    }
+
+    UME_FORCE_INLINE __m128i cmpeq_epi64(__m128i const & a, __m128i const & b) {
+#if defined(__SSE4_1__)
+        return _mm_cmpeq_epi64(a, b);
+#else
+        // Both 32-bit halves of an element have to be equal.
+        __m128i t0 = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(t0, _mm_shuffle_epi32(t0, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+    }
+
+    UME_FORCE_INLINE __m128i cmpgt_epi64(__m128i const & a, __m128i const & b) {
+#if defined(__SSE4_2__)
+        return _mm_cmpgt_epi64(a, b);
+#else
+        // Signed comparison of the high halves, unsigned comparison of the low
+        // halves when the high halves are equal. The result is then copied
+        // from the high half to the whole element.
+        __m128i t0 = _mm_set_epi32(0, int(0x80000000), 0, int(0x80000000));
+        __m128i t1 = _mm_cmpgt_epi32(a, b);
+        __m128i t2 = _mm_cmpeq_epi32(a, b);
+        __m128i t3 = _mm_cmpgt_epi32(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+        __m128i t4 = _mm_shuffle_epi32(t3, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128i t5 = _mm_or_si128(t1, _mm_and_si128(t2, t4));
+        return _mm_shuffle_epi32(t5, _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+    }
+
+    // Unsigned comparison: flip sign bits and compare as signed.
+    UME_FORCE_INLINE __m128i cmpgt_epu64(__m128i const & a, __m128i const & b) {
+        __m128i t0 = _mm_set1_epi64x(0x8000000000000000LL);
+        return cmpgt_epi64(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+    }
+
+    // Shifts of 64-bit elements by per-element counts. SSE shifts all elements
+    // by the same count, so each element is shifted separately.
+    UME_FORCE_INLINE __m128i sllv_epi64(__m128i const & a, __m128i const & count) {
+        __m128i t0 = _mm_sll_epi64(a, count);
+        __m128i t1 = _mm_sll_epi64(a, _mm_unpackhi_epi64(count, count));
+        return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(t1), _mm_castsi128_pd(t0)));
+    }
+
+    UME_FORCE_INLINE __m128i srlv_epi64(__m128i const & a, __m128i const & count) {
+        __m128i t0 = _mm_srl_epi64(a, count);
+        __m128i t1 = _mm_srl_epi64(a, _mm_unpackhi_epi64(count, count));
+        return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(t1), _mm_castsi128_pd(t0)));
+    }
+
+    // Arithmetic right shifts of 64-bit elements. Negative elements are
+    // inverted before and after the logical shift, so that sign bits are
+    // shifted in.
+    UME_FORCE_INLINE __m128i sra_epi64(__m128i const & a, __m128i const & count) {
+        __m128i t0 = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+        return _mm_xor_si128(_mm_srl_epi64(_mm_xor_si128(a, t0), count), t0);
+    }
+
+    UME_FORCE_INLINE __m128i srav_epi64(__m128i const & a, __m128i const & count) {
+        __m128i t0 = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+        return _mm_xor_si128(srlv_epi64(_mm_xor_si128(a, t0), count), t0);
+    }
+
+#if defined(__SSE4_1__)
+    // One stage of the 4-element sorting network of SORTA/SORTD with a payload:
+    // keys are compared with their permutation SHUFFLE, lanes selected by BLEND
+    // keep the larger key, and payload elements move together with their keys.
+    template<int SHUFFLE, int BLEND>
+    UME_FORCE_INLINE void sortStage_epi32(__m128i & keys, __m128i & payload) {
+        __m128i t0 = _mm_shuffle_epi32(keys, SHUFFLE);
+        __m128i t1 = _mm_min_epi32(keys, t0);
+        __m128i t2 = _mm_max_epi32(keys, t0);
+        __m128i t3 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t1), _mm_castsi128_ps(t2), BLEND));
+        __m128i t4 = _mm_cmpeq_epi32(t3, keys);
+        payload = _mm_blendv_epi8(_mm_shuffle_epi32(payload, SHUFFLE), payload, t4);
+        keys = t3;
+    }
+#endif
+
+    // Masked loads. Elements that are not selected are zeroed, like with the
+    // AVX maskload instructions, and their memory is never read.
+    UME_FORCE_INLINE __m128 maskload_ps(float const * p, __m128i const & mask) {
+        int m = _mm_movemask_ps(_mm_castsi128_ps(mask));
+        if (m == 0xF) return _mm_loadu_ps(p);
+        alignas(16) float raw[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        if ((m & 0x1) != 0) raw[0] = p[0];
+        if ((m & 0x2) != 0) raw[1] = p[1];
+        if ((m & 0x4) != 0) raw[2] = p[2];
+        if ((m & 0x8) != 0) raw[3] = p[3];
+        return _mm_load_ps(raw);
+    }
+
+    UME_FORCE_INLINE __m128d maskload_pd(double const * p, __m128i const & mask) {
+        __m128d t0 = _mm_setzero_pd();
+        int m = _mm_movemask_pd(_mm_castsi128_pd(mask));
+        if ((m & 0x1) != 0) t0 = _mm_loadl_pd(t0, p);
+        if ((m & 0x2) != 0) t0 = _mm_loadh_pd(t0, p + 1);
+        return t0;
+    }
+
+    UME_FORCE_INLINE __m128i maskload_epi32(int32_t const * p, __m128i const & mask) {
+        int m = _mm_movemask_ps(_mm_castsi128_ps(mask));
+        if (m == 0xF) return _mm_loadu_si128((__m128i const *)p);
+        alignas(16) int32_t raw[4] = { 0, 0, 0, 0 };
+        if ((m & 0x1) != 0) raw[0] = p[0];
+        if ((m & 0x2) != 0) raw[1] = p[1];
+        if ((m & 0x4) != 0) raw[2] = p[2];
+        if ((m & 0x8) != 0) raw[3] = p[3];
+        return _mm_load_si128((__m128i const *)raw);
+    }
+
+    UME_FORCE_INLINE __m128i maskload_epi64(int64_t const * p, __m128i const & mask) {
+        return _mm_castpd_si128(maskload_pd((double const *)p, mask));
+    }
+
+    // Masked stores. SSE has no masked store instruction that does not bypass
+    // the cache, so only the selected elements are written one by one.
+    UME_FORCE_INLINE void maskstore_ps(float * p, __m128i const & mask, __m128 const & a) {
+        alignas(16) float raw[4];
+        _mm_store_ps(raw, a);
+        int m = _mm_movemask_ps(_mm_castsi128_ps(mask));
+        if ((m & 0x1) != 0) p[0] = raw[0];
+        if ((m & 0x2) != 0) p[1] = raw[1];
+        if ((m & 0x4) != 0) p[2] = raw[2];
+        if ((m & 0x8) != 0) p[3] = raw[3];
+    }
+
+    UME_FORCE_INLINE void maskstore_pd(double * p, __m128i const & mask, __m128d const & a) {
+        int m = _mm_movemask_pd(_mm_castsi128_pd(mask));
+        if ((m & 0x1) != 0) _mm_storel_pd(p, a);
+        if ((m & 0x2) != 0) _mm_storeh_pd(p + 1, a);
+    }
+
+    UME_FORCE_INLINE void maskstore_epi32(int32_t * p, __m128i const & mask, __m128i const & a) {
+        alignas(16) int32_t raw[4];
+        _mm_store_si128((__m128i *)raw, a);
+        int m = _mm_movemask_ps(_mm_castsi128_ps(mask));
+        if ((m & 0x1) != 0) p[0] = raw[0];
+        if ((m & 0x2) != 0) p[1] = raw[1];
+        if ((m & 0x4) != 0) p[2] = raw[2];
+        if ((m & 0x8) != 0) p[3] = raw[3];
+    }
+
+    UME_FORCE_INLINE void maskstore_epi64(int64_t * p, __m128i const & mask, __m128i const & a) {
+        maskstore_pd((double *)p, mask, _mm_castsi128_pd(a));
+    }
+}
+}
+}
+
+#endif
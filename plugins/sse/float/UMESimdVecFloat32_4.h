@@ -0,0 +1,1391 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_FLOAT32_4_H_
+#define UME_SIMD_VEC_FLOAT32_4_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdIntrinsicsSSE.h"
+#include "../UMESimdInterleaveSSE.h"
+
+#define BLEND(a, b, mask) SSE::blendv_ps(a, b, _mm_castsi128_ps(mask))
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_f<float, 4> :
+        public SIMDVecFloatInterface<
+            SIMDVec_f<float, 4>,
+            SIMDVec_u<uint32_t, 4>,
+            SIMDVec_i<int32_t, 4>,
+            float,
+            4,
+            uint32_t,
+            int32_t,
+            SIMDVecMask<4>,
+            SIMDSwizzle<4>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_f<float, 4>,
+            SIMDVec_f<float, 2 >>
+    {
+        friend class SIMDVec_u<uint32_t, 4>;
+        friend class SIMDVec_i<int32_t, 4>;
+
+        friend class SIMDVec_f<float, 8>;
+    private:
+        __m128 mVec;
+
+        UME_FORCE_INLINE SIMDVec_f(__m128 const & x) {
+            this->mVec = x;
+        }
+
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_f() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(float f) {
+            mVec = _mm_set1_ps(f);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_f(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, float>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_f(static_cast<float>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_f(float const * p) {
+            mVec = _mm_loadu_ps(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(float f0, float f1, float f2, float f3) {
+            mVec = _mm_setr_ps(f0, f1, f2, f3);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE float extract(uint32_t index) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE float operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_f & insert(uint32_t index, float value) {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_ps(raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_f, float> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_f, float>(index, static_cast<SIMDVec_f &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>> operator() (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>> operator[] (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVec_f const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SIMDVec_f const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(float b) {
+            mVec = _mm_set1_ps(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (float b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
+            mVec = _mm_loadu_ps(p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, float const * p) {
+            __m128 t0 = SSE::maskload_ps(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(float const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            mVec = SSE::maskload_ps(p, t0);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            SSE::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            __m128 t2 = _mm_loadu_ps(p + 8);
+            SSE::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(float const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            __m128 t2 = _mm_loadu_ps(p + 8);
+            __m128 t3 = _mm_loadu_ps(p + 12);
+            SSE::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
+            mVec = _mm_load_ps(p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, float const * p) {
+            __m128 t0 = SSE::maskload_ps(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE float* store(float* p) const {
+            _mm_storeu_ps(p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE float* store(SIMDVecMask<4> const & mask, float * p) const {
+            SSE::maskstore_ps(p, mask.mMask, mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE float* storeTail(float* p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 1, 2, 3));
+            SSE::maskstore_ps(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m128 t0, t1;
+            SSE::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m128 t0, t1, t2;
+            SSE::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            _mm_storeu_ps(p + 8, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE float* storeInterleaved(float * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m128 t0, t1, t2, t3;
+            SSE::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm_storeu_ps(p, t0);
+            _mm_storeu_ps(p + 4, t1);
+            _mm_storeu_ps(p + 8, t2);
+            _mm_storeu_ps(p + 12, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            SSE::transpose4x4(v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
+        // STOREA
+        UME_FORCE_INLINE float* storea(float * p) const {
+            _mm_store_ps(p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE float* storea(SIMDVecMask<4> const & mask, float * p) const {
+            SSE::maskstore_ps(p, mask.mMask, mVec);
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float* p) const {
+            _mm_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<4> const & mask, float* p) const {
+            // There is no masked streaming store.
+            return storea(mask, p);
+        }
+
+        // BLENDV
+        // BLENDS
+        // SWIZZLE
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_f add(float b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (float b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVec_f const & b) {
+            mVec = _mm_add_ps(this->mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(float b) {
+            mVec = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (float b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        // MSADDV
+        // SADDS
+        // MSADDS
+        // SADDVA
+        // MSADDVA
+        // SADDSA
+        // MSADDSA
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            __m128 t0 = mVec;
+            mVec = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<4> const & mask) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            mVec = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            mVec = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            return *this;
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_f sub(float b) const {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (float b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVec_f const & b) {
+            mVec = _mm_sub_ps(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-=(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_sub_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(float b) {
+            mVec = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (float b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        // MSSUBV
+        // SSUBS
+        // MSSUBS
+        // SSUBVA
+        // MSSUBVA
+        // SSUBSA
+        // MSSUBSA
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(b.mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(b.mVec, mVec);
+            __m128 t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(float b) const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(b), mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_sub_ps(t0, mVec);
+            __m128 t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVec_f const & b) {
+            mVec = _mm_sub_ps(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_sub_ps(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_sub_ps(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_sub_ps(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec() {
+            __m128 t0 = mVec;
+            mVec = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec(SIMDVecMask<4> const & mask) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec() {
+            mVec = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SIMDVec_f const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
+            __m128 t2 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_f mul(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_mul_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (float b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_mul_ps(mVec, t0);
+            __m128 t2 = _mm_castsi128_ps(mask.mMask);
+            __m128 t3 = SSE::blendv_ps(mVec, t1, t2);
+            return SIMDVec_f(t3);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVec_f const & b) {
+            mVec = _mm_mul_ps(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SIMDVec_f const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
+            mVec = SSE::blendv_ps(mVec, t0, _mm_castsi128_ps(mask.mMask));
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_mul_ps(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (float b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_mul_ps(mVec, t0);
+            mVec = SSE::blendv_ps(mVec, t1, _mm_castsi128_ps(mask.mMask));
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_div_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SIMDVec_f const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_div_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_f div(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_div_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (float b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_div_ps(mVec, t0);
+            __m128 t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVec_f const & b) {
+            mVec = _mm_div_ps(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (SIMDVec_f const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_div_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_div_ps(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (float b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_div_ps(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_f rcp() const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(float b) const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            __m128 t2 = _mm_mul_ps(t0, t1);
+            return SIMDVec_f(t2);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            __m128 t2 = _mm_mul_ps(t0, t1);
+            __m128 t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa() {
+            mVec = _mm_rcp_ps(mVec);
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(float b) {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            mVec = _mm_mul_ps(t0, t1);
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            __m128 t2 = _mm_mul_ps(t0, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // RCPE
+        UME_FORCE_INLINE SIMDVec_f rcpe() const {
+            return SIMDVec_f(_mm_rcp_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rcpeBits() {
+            return 11;
+        }
+        // RSQRTE
+        UME_FORCE_INLINE SIMDVec_f rsqrte() const {
+            return SIMDVec_f(_mm_rsqrt_ps(mVec));
+        }
+        UME_FORCE_INLINE static constexpr int rsqrteBits() {
+            return 11;
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castps_si128(_mm_cmpeq_ps(mVec, b.mVec));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_f const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128i m0 = _mm_castps_si128(_mm_cmpeq_ps(mVec, t0));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (float b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castps_si128(_mm_cmpneq_ps(mVec, b.mVec));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_f const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128i m0 = _mm_castps_si128(_mm_cmpneq_ps(mVec, t0));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (float b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castps_si128(_mm_cmpgt_ps(mVec, b.mVec));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_f const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128i m0 = _mm_castps_si128(_mm_cmpgt_ps(mVec, t0));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (float b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_cmplt_ps(mVec, b.mVec);
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_f const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(float b) const {
+            __m128 t0 = _mm_cmplt_ps(mVec, _mm_set1_ps(b));
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (float b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_cmpge_ps(mVec, b.mVec);
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_f const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(float b) const {
+            __m128 t0 = _mm_cmpge_ps(mVec, _mm_set1_ps(b));
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (float b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_cmple_ps(mVec, b.mVec);
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_f const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(float b) const {
+            __m128 t0 = _mm_cmple_ps(mVec, _mm_set1_ps(b));
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (float b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_f const & b) const {
+            alignas(16) uint32_t raw[4];
+            __m128 m0 = _mm_cmpeq_ps(mVec, b.mVec);
+            _mm_store_si128((__m128i*)raw, _mm_castps_si128(m0));
+            return (raw[0] != 0) && (raw[1] != 0) && (raw[2] != 0) && (raw[3] !=0);
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(float b) const {
+            alignas(16) uint32_t raw[4];
+            __m128 m0 = _mm_cmpeq_ps(mVec, _mm_set1_ps(b));
+            _mm_store_si128((__m128i*)raw, _mm_castps_si128(m0));
+            return (raw[0] != 0) && (raw[1] != 0) && (raw[2] != 0) && (raw[3] !=0);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = BLEND(mVec, _mm_set1_ps(b), mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // HADD
+        UME_FORCE_INLINE float hadd() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] + raw[1] + raw[2] + raw[3];
+        }
+        // MHADD
+        UME_FORCE_INLINE float hadd(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(0.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] + raw[1] + raw[2] + raw[3];
+        }
+        // HADDS
+        UME_FORCE_INLINE float hadd(float b) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] + raw[1] + raw[2] + raw[3] + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE float hadd(SIMDVecMask<4> const & mask, float b) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(0.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] + raw[1] + raw[2] + raw[3] + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE float hmul() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] * raw[1] * raw[2] * raw[3];
+        }
+        // MHMUL
+        UME_FORCE_INLINE float hmul(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(1.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] * raw[1] * raw[2] * raw[3];
+        }
+        // HMULS
+        UME_FORCE_INLINE float hmul(float b) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] * raw[1] * raw[2] * raw[3] * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE float hmul(SIMDVecMask<4> const & mask, float b) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(1.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] * raw[1] * raw[2] * raw[3] * b;
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128 t0 = _mm_fmadd_ps(mVec, b.mVec, c.mVec);
+#else
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128 t0 = _mm_fmadd_ps(mVec, b.mVec, c.mVec);
+#else
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+#endif
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_sub_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_sub_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_add_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_add_ps(mVec, b.mVec), c.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_sub_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_sub_ps(mVec, b.mVec), c.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_max_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_max_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_f max(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec, t0);
+            __m128 t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVec_f const & b) {
+            mVec = _mm_max_ps(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_max_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_max_ps(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_min_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_min_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_f min(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec, t0);
+            __m128 t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVec_f const & b) {
+            mVec = _mm_min_ps(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_min_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_min_ps(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE float hmax() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            float t0 = (raw[0] > raw[1]) ? raw[0] : raw[1];
+            float t1 = (raw[2] > raw[3]) ? raw[2] : raw[3];
+            return t0 > t1 ? t0 : t1;
+        }
+        // MHMAX
+        UME_FORCE_INLINE float hmax(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::lowest());
+            __m128 t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_ps(raw, t1);
+            float t2 = (raw[0] > raw[1]) ? raw[0] : raw[1];
+            float t3 = (raw[2] > raw[3]) ? raw[2] : raw[3];
+            return t2 > t3 ? t2 : t3;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE float hmin() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            float t0 = (raw[0] < raw[1]) ? raw[0] : raw[1];
+            float t1 = (raw[2] < raw[3]) ? raw[2] : raw[3];
+            return t0 < t1 ? t0 : t1;
+        }
+        // MHMIN
+        UME_FORCE_INLINE float hmin(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::max());
+            __m128 t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_ps(raw, t1);
+            float t2 = (raw[0] < raw[1]) ? raw[0] : raw[1];
+            float t3 = (raw[2] < raw[3]) ? raw[2] : raw[3];
+            return t2 < t3 ? t2 : t3;
+        }
+        // IMIN
+        // MIMIN
+
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_f neg() const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_f neg(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_f & nega() {
+            mVec = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_f & nega(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_f abs() const {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            __m128 t2 = _mm_and_ps(t1, mVec);
+            return SIMDVec_f(t2);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_f abs(SIMDVecMask<4> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            __m128 t2 = _mm_and_ps(t1, mVec);
+            __m128 t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_f & absa() {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            mVec = _mm_and_ps(t1, mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_f & absa(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            __m128 t2 = _mm_and_ps(t1, mVec);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // CMPEQRV
+        // CMPEQRS
+
+        // SQR
+        UME_FORCE_INLINE SIMDVec_f sqr() const {
+            __m128 t0 = _mm_mul_ps(mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQR
+        UME_FORCE_INLINE SIMDVec_f sqr(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_mul_ps(mVec, mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra() {
+            mVec = _mm_mul_ps(mVec, mVec);
+            return *this;
+        }
+        // MSQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_mul_ps(mVec, mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt() const {
+            __m128 t0 = _mm_sqrt_ps(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_sqrt_ps(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta() {
+            mVec = _mm_sqrt_ps(mVec);
+            return *this;
+        }
+        // MSQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_sqrt_ps(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
+#if defined(__SSE4_1__)
+        // ROUND
+        UME_FORCE_INLINE SIMDVec_f round() const {
+            __m128 t0 = _mm_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
+            return SIMDVec_f(t0);
+        }
+        // MROUND
+        UME_FORCE_INLINE SIMDVec_f round(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+#endif
+        // TRUNC
+        SIMDVec_i<int32_t, 4> trunc() const {
+            __m128i t0 = _mm_cvttps_epi32(mVec);
+            return SIMDVec_i<int32_t, 4>(t0);
+        }
+        // MTRUNC
+        SIMDVec_i<int32_t, 4> trunc(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_castsi128_ps(mask.mMask);
+            __m128 t1 = _mm_setzero_ps();
+            __m128i t2 = _mm_cvttps_epi32(SSE::blendv_ps(t1, mVec, t0));
+            return SIMDVec_i<int32_t, 4>(t2);
+        }
+#if defined(__SSE4_1__)
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m128 t0 = _mm_floor_ps(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_floor_ps(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // CEIL
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            __m128 t0 = _mm_ceil_ps(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MCEIL
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_ceil_ps(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+#endif
+        // ISFIN
+        // ISINF
+        // ISAN
+        // ISNAN
+        // ISSUB
+        // ISZERO
+        // ISZEROSUB
+
+        // EXP
+        UME_FORCE_INLINE SIMDVec_f exp() const {
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXP
+        UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG
+        // MLOG
+        // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SIN
+        // MSIN
+        // COS
+        // MCOS
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 2> const & a, SIMDVec_f<float, 2> const & b) {
+            alignas(16) float raw[4] = { a[0], a[1], b[0], b[1] };
+            mVec = _mm_load_ps(raw);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_f & packlo(SIMDVec_f<float, 2> const & a) {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            raw[0] = a[0];
+            raw[1] = a[1];
+            mVec = _mm_load_ps(raw);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_f & packhi(SIMDVec_f<float, 2> const & b) {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            raw[2] = b[0];
+            raw[3] = b[1];
+            mVec = _mm_load_ps(raw);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_f<float, 2> & a, SIMDVec_f<float, 2> & b) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            a.insert(0, raw[0]);
+            a.insert(1, raw[1]);
+            b.insert(0, raw[2]);
+            b.insert(1, raw[3]);
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_f<float, 2> unpacklo() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return SIMDVec_f<float, 2>(raw[0], raw[1]);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_f<float, 2> unpackhi() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return SIMDVec_f<float, 2>(raw[2], raw[3]);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_f<double, 4>() const;
+        // DEGRADE
+        // -
+
+        // FTOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint32_t, 4>() const;
+        // FTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 4>() const;
+    };
+}
+}
+
+#undef BLEND
+
+#endif
@@ -0,0 +1,1345 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_FLOAT64_2_H_
+#define UME_SIMD_VEC_FLOAT64_2_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdIntrinsicsSSE.h"
+#include "../UMESimdInterleaveSSE.h"
+
+#define BLEND(a, b, mask) SSE::blendv_pd(a, b, _mm_castsi128_pd(mask))
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_f<double, 2> :
+        public SIMDVecFloatInterface<
+            SIMDVec_f<double, 2>,
+            SIMDVec_u<uint64_t, 2>,
+            SIMDVec_i<int64_t, 2>,
+            double,
+            2,
+            uint64_t,
+            int64_t,
+            SIMDVecMask<2>,
+            SIMDSwizzle<2>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_f<double, 2>,
+            SIMDVec_f<double, 1>>
+    {
+        friend class SIMDVec_u<uint64_t, 2>;
+        friend class SIMDVec_i<int64_t, 2>;
+
+        friend class SIMDVec_f<double, 4>;
+    private:
+        __m128d mVec;
+
+        UME_FORCE_INLINE SIMDVec_f(__m128d const & x) {
+            this->mVec = x;
+        }
+
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_f() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(double f) {
+            mVec = _mm_set1_pd(f);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_f(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, double>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_f(static_cast<double>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_f(double const * p) {
+            mVec = _mm_loadu_pd(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(double f0, double f1) {
+            mVec = _mm_setr_pd(f0, f1);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE double extract(uint32_t index) const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE double operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_f & insert(uint32_t index, double value) {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_pd(raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_f, double> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_f, double>(index, static_cast<SIMDVec_f &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>> operator() (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>> operator[] (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVec_f const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SIMDVec_f const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(double b) {
+            mVec = _mm_set1_pd(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (double b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
+            mVec = _mm_loadu_pd(p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<2> const & mask, double const * p) {
+            __m128d t0 = SSE::maskload_pd(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_f & loadTail(double const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 0, 1, 1));
+            mVec = SSE::maskload_pd(p, t0);
+            return *this;
+        }
+        // LOADINTERLEAVED
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1) {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            SSE::deinterleave2(t0, t1, v0.mVec, v1.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2) {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            __m128d t2 = _mm_loadu_pd(p + 4);
+            SSE::deinterleave3(t0, t1, t2, v0.mVec, v1.mVec, v2.mVec);
+        }
+        static UME_FORCE_INLINE void loadInterleaved(double const * p, SIMDVec_f & v0, SIMDVec_f & v1, SIMDVec_f & v2, SIMDVec_f & v3) {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            __m128d t2 = _mm_loadu_pd(p + 4);
+            __m128d t3 = _mm_loadu_pd(p + 6);
+            SSE::deinterleave4(t0, t1, t2, t3, v0.mVec, v1.mVec, v2.mVec, v3.mVec);
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
+            mVec = _mm_load_pd(p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<2> const & mask, double const * p) {
+            __m128d t0 = SSE::maskload_pd(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE double* store(double* p) const {
+            _mm_storeu_pd(p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE double* store(SIMDVecMask<2> const & mask, double * p) const {
+            SSE::maskstore_pd(p, mask.mMask, mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE double* storeTail(double* p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 0, 1, 1));
+            SSE::maskstore_pd(p, t0, mVec);
+            return p;
+        }
+        // STOREINTERLEAVED
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1) {
+            __m128d t0, t1;
+            SSE::interleave2(v0.mVec, v1.mVec, t0, t1);
+            _mm_storeu_pd(p, t0);
+            _mm_storeu_pd(p + 2, t1);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2) {
+            __m128d t0, t1, t2;
+            SSE::interleave3(v0.mVec, v1.mVec, v2.mVec, t0, t1, t2);
+            _mm_storeu_pd(p, t0);
+            _mm_storeu_pd(p + 2, t1);
+            _mm_storeu_pd(p + 4, t2);
+            return p;
+        }
+        static UME_FORCE_INLINE double* storeInterleaved(double * p, SIMDVec_f const & v0, SIMDVec_f const & v1, SIMDVec_f const & v2, SIMDVec_f const & v3) {
+            __m128d t0, t1, t2, t3;
+            SSE::interleave4(v0.mVec, v1.mVec, v2.mVec, v3.mVec, t0, t1, t2, t3);
+            _mm_storeu_pd(p, t0);
+            _mm_storeu_pd(p + 2, t1);
+            _mm_storeu_pd(p + 4, t2);
+            _mm_storeu_pd(p + 6, t3);
+            return p;
+        }
+        // TRANSPOSE
+        static UME_FORCE_INLINE void transpose(SIMDVec_f & v0, SIMDVec_f & v1) {
+            SSE::transpose2x2(v0.mVec, v1.mVec);
+        }
+        // STOREA
+        UME_FORCE_INLINE double* storea(double * p) const {
+            _mm_store_pd(p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE double* storea(SIMDVecMask<2> const & mask, double * p) const {
+            SSE::maskstore_pd(p, mask.mMask, mVec);
+            return p;
+        }
+
+        // BLENDV
+        // BLENDS
+        // SWIZZLE
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_f add(double b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (double b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVec_f const & b) {
+            mVec = _mm_add_pd(this->mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_add_pd(this->mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(double b) {
+            mVec = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (double b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        // MSADDV
+        // SADDS
+        // MSADDS
+        // SADDVA
+        // MSADDVA
+        // SADDSA
+        // MSADDSA
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            __m128d t0 = mVec;
+            mVec = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<2> const & mask) {
+            __m128d t0 = mVec;
+            __m128d t1 = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            mVec = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            mVec = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            return *this;
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_f sub(double b) const {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (double b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVec_f const & b) {
+            mVec = _mm_sub_pd(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-=(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_sub_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(double b) {
+            mVec = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (double b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        // MSSUBV
+        // SSUBS
+        // MSSUBS
+        // SSUBVA
+        // MSSUBVA
+        // SSUBSA
+        // MSSUBSA
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(b.mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(b.mVec, mVec);
+            __m128d t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(double b) const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(b), mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_sub_pd(t0, mVec);
+            __m128d t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVec_f const & b) {
+            mVec = _mm_sub_pd(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_sub_pd(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_sub_pd(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_sub_pd(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec() {
+            __m128d t0 = mVec;
+            mVec = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec(SIMDVecMask<2> const & mask) {
+            __m128d t0 = mVec;
+            __m128d t1 = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec() {
+            mVec = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SIMDVec_f const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
+            __m128d t2 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_f mul(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_mul_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (double b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_mul_pd(mVec, t0);
+            __m128d t2 = _mm_castsi128_pd(mask.mMask);
+            __m128d t3 = SSE::blendv_pd(mVec, t1, t2);
+            return SIMDVec_f(t3);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVec_f const & b) {
+            mVec = _mm_mul_pd(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SIMDVec_f const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
+            mVec = SSE::blendv_pd(mVec, t0, _mm_castsi128_pd(mask.mMask));
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_mul_pd(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (double b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_mul_pd(mVec, t0);
+            mVec = SSE::blendv_pd(mVec, t1, _mm_castsi128_pd(mask.mMask));
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_div_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SIMDVec_f const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_div_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_f div(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_div_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (double b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_div_pd(mVec, t0);
+            __m128d t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVec_f const & b) {
+            mVec = _mm_div_pd(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (SIMDVec_f const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_div_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_div_pd(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (double b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_div_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_f rcp() const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            return SIMDVec_f(t0);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(double b) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            __m128d t2 = _mm_mul_pd(t0, t1);
+            return SIMDVec_f(t2);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            __m128d t2 = _mm_mul_pd(t0, t1);
+            __m128d t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa() {
+            mVec = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(double b) {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            mVec = _mm_mul_pd(t0, t1);
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            __m128d t2 = _mm_mul_pd(t0, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castpd_si128(_mm_cmpeq_pd(mVec, b.mVec));
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (SIMDVec_f const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128i m0 = _mm_castpd_si128(_mm_cmpeq_pd(mVec, t0));
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (double b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castpd_si128(_mm_cmpneq_pd(mVec, b.mVec));
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (SIMDVec_f const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128i m0 = _mm_castpd_si128(_mm_cmpneq_pd(mVec, t0));
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (double b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castpd_si128(_mm_cmpgt_pd(mVec, b.mVec));
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (SIMDVec_f const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128i m0 = _mm_castpd_si128(_mm_cmpgt_pd(mVec, t0));
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (double b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmplt_pd(mVec, b.mVec);
+            __m128i m0 = _mm_castpd_si128(t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (SIMDVec_f const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(double b) const {
+            __m128d t0 = _mm_cmplt_pd(mVec, _mm_set1_pd(b));
+            __m128i m0 = _mm_castpd_si128(t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (double b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmpge_pd(mVec, b.mVec);
+            __m128i m0 = _mm_castpd_si128(t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (SIMDVec_f const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(double b) const {
+            __m128d t0 = _mm_cmpge_pd(mVec, _mm_set1_pd(b));
+            __m128i m0 = _mm_castpd_si128(t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (double b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmple_pd(mVec, b.mVec);
+            __m128i m0 = _mm_castpd_si128(t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (SIMDVec_f const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(double b) const {
+            __m128d t0 = _mm_cmple_pd(mVec, _mm_set1_pd(b));
+            __m128i m0 = _mm_castpd_si128(t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (double b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_f const & b) const {
+            alignas(16) uint64_t raw[2];
+            __m128d m0 = _mm_cmpeq_pd(mVec, b.mVec);
+            _mm_store_si128((__m128i*)raw, _mm_castpd_si128(m0));
+            return (raw[0] != 0) && (raw[1] != 0);
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(double b) const {
+            alignas(16) uint64_t raw[2];
+            __m128d m0 = _mm_cmpeq_pd(mVec, _mm_set1_pd(b));
+            _mm_store_si128((__m128i*)raw, _mm_castpd_si128(m0));
+            return (raw[0] != 0) && (raw[1] != 0);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = BLEND(mVec, _mm_set1_pd(b), mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // HADD
+        UME_FORCE_INLINE double hadd() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] + raw[1];
+        }
+        // MHADD
+        UME_FORCE_INLINE double hadd(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(0.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] + raw[1];
+        }
+        // HADDS
+        UME_FORCE_INLINE double hadd(double b) const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] + raw[1] + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE double hadd(SIMDVecMask<2> const & mask, double b) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(0.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] + raw[1] + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE double hmul() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] * raw[1];
+        }
+        // MHMUL
+        UME_FORCE_INLINE double hmul(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(1.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] * raw[1];
+        }
+        // HMULS
+        UME_FORCE_INLINE double hmul(double b) const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] * raw[1] * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE double hmul(SIMDVecMask<2> const & mask, double b) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(1.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] * raw[1] * b;
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128d t0 = _mm_fmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#if defined(__FMA__)
+            __m128d t0 = _mm_fmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+#endif
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_sub_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_sub_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_add_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_add_pd(mVec, b.mVec), c.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_sub_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_sub_pd(mVec, b.mVec), c.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_max_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_max_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_f max(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_max_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_max_pd(mVec, t0);
+            __m128d t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVec_f const & b) {
+            mVec = _mm_max_pd(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_max_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_max_pd(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_max_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_min_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_min_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_f min(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_min_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_min_pd(mVec, t0);
+            __m128d t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVec_f const & b) {
+            mVec = _mm_min_pd(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_min_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_min_pd(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_min_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE double hmax() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return (raw[0] > raw[1]) ? raw[0] : raw[1];
+        }
+        // MHMAX
+        UME_FORCE_INLINE double hmax(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = _mm_set1_pd(std::numeric_limits<double>::lowest());
+            __m128d t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_pd(raw, t1);
+            return (raw[0] > raw[1]) ? raw[0] : raw[1];
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE double hmin() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return (raw[0] < raw[1]) ? raw[0] : raw[1];
+        }
+        // MHMIN
+        UME_FORCE_INLINE double hmin(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = _mm_set1_pd(std::numeric_limits<double>::max());
+            __m128d t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_pd(raw, t1);
+            return (raw[0] < raw[1]) ? raw[0] : raw[1];
+        }
+        // IMIN
+        // MIMIN
+
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_f neg() const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_f neg(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_f & nega() {
+            mVec = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_f & nega(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_f abs() const {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFFll);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec);
+            return SIMDVec_f(t2);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_f abs(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFFll);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec);
+            __m128d t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_f & absa() {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFFll);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            mVec = _mm_and_pd(t1, mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_f & absa(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFFll);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // CMPEQRV
+        // CMPEQRS
+
+        // SQR
+        UME_FORCE_INLINE SIMDVec_f sqr() const {
+            __m128d t0 = _mm_mul_pd(mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQR
+        UME_FORCE_INLINE SIMDVec_f sqr(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_mul_pd(mVec, mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra() {
+            mVec = _mm_mul_pd(mVec, mVec);
+            return *this;
+        }
+        // MSQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_mul_pd(mVec, mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt() const {
+            __m128d t0 = _mm_sqrt_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_sqrt_pd(mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta() {
+            mVec = _mm_sqrt_pd(mVec);
+            return *this;
+        }
+        // MSQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_sqrt_pd(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this, SIMDVec_f(b));
+        }
+#if defined(__SSE4_1__)
+        // ROUND
+        UME_FORCE_INLINE SIMDVec_f round() const {
+            __m128d t0 = _mm_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
+            return SIMDVec_f(t0);
+        }
+        // MROUND
+        UME_FORCE_INLINE SIMDVec_f round(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+#endif
+        // TRUNC
+        SIMDVec_i<int64_t, 2> trunc() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return SIMDVec_i<int64_t, 2>(int64_t(raw[0]), int64_t(raw[1]));
+        }
+        // MTRUNC
+        SIMDVec_i<int64_t, 2> trunc(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_setzero_pd(), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return SIMDVec_i<int64_t, 2>(int64_t(raw[0]), int64_t(raw[1]));
+        }
+#if defined(__SSE4_1__)
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m128d t0 = _mm_floor_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_floor_pd(mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // CEIL
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            __m128d t0 = _mm_ceil_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MCEIL
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_ceil_pd(mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+#endif
+        // ISFIN
+        // ISINF
+        // ISAN
+        // ISNAN
+        // ISSUB
+        // ISZERO
+        // ISZEROSUB
+
+        // EXP
+        UME_FORCE_INLINE SIMDVec_f exp() const {
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MEXP
+        UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // LOG
+        // MLOG
+        // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // SIN
+        // MSIN
+        // COS
+        // MCOS
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<2>>(*this, b);
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<double, 1> const & a, SIMDVec_f<double, 1> const & b) {
+            mVec = _mm_setr_pd(a[0], b[0]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_f & packlo(SIMDVec_f<double, 1> const & a) {
+            mVec = _mm_move_sd(mVec, _mm_set1_pd(a[0]));
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_f & packhi(SIMDVec_f<double, 1> const & b) {
+            mVec = _mm_move_sd(_mm_set1_pd(b[0]), mVec);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_f<double, 1> & a, SIMDVec_f<double, 1> & b) const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            a.insert(0, raw[0]);
+            b.insert(0, raw[1]);
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_f<double, 1> unpacklo() const {
+            return SIMDVec_f<double, 1>(_mm_cvtsd_f64(mVec));
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_f<double, 1> unpackhi() const {
+            return SIMDVec_f<double, 1>(_mm_cvtsd_f64(_mm_unpackhi_pd(mVec, mVec)));
+        }
+
+        // PROMOTE
+        // -
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_f<float, 2>() const;
+
+        // FTOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 2>() const;
+        // FTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int64_t, 2>() const;
+    };
+}
+}
+
+#undef BLEND
+
+#endif
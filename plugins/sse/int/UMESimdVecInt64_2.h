@@ -0,0 +1,1107 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT64_2_H_
+#define UME_SIMD_VEC_INT64_2_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdIntrinsicsSSE.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int64_t, 2> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int64_t, 2>,
+            SIMDVec_u<uint64_t, 2>,
+            int64_t,
+            2,
+            uint64_t,
+            SIMDVecMask<2>,
+            SIMDSwizzle<2>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int64_t, 2>,
+            SIMDVec_i<int64_t, 1>>
+    {
+        friend class SIMDVec_u<uint64_t, 2>;
+        friend class SIMDVec_f<double, 2>;
+
+        friend class SIMDVec_i<int64_t, 4>;
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 2; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int64_t i) {
+            mVec = _mm_set1_epi64x(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if<std::is_fundamental<T>::value &&
+                                    !std::is_same<T, int64_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int64_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int64_t const *p) { this->load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int64_t i0, int64_t i1) {
+            mVec = _mm_set_epi64x(i1, i0);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int64_t extract(uint32_t index) const {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i *)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int64_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int64_t value) {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int64_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int64_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>> operator() (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>> operator[] (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ****************************************************************************************
+        // Overloading Interface functions starts here!
+        // ****************************************************************************************
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            mVec = SSE::blendv_epi8(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int64_t b) {
+            mVec = _mm_set1_epi64x(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int64_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
+            mVec = _mm_loadu_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<2> const & mask, int64_t const * p) {
+            __m128i t0 = SSE::maskload_epi64((int64_t const *)p, mask.mMask);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_i & loadTail(int64_t const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 0, 1, 1));
+            mVec = SSE::maskload_epi64((int64_t const *)p, t0);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int64_t const * p) {
+            mVec = _mm_load_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<2> const & mask, int64_t const * p) {
+            __m128i t0 = SSE::maskload_epi64((int64_t const *)p, mask.mMask);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int64_t * store(int64_t * p) const {
+            _mm_storeu_si128((__m128i*) p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int64_t * store(SIMDVecMask<2> const & mask, int64_t * p) const {
+            SSE::maskstore_epi64((int64_t *)p, mask.mMask, mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE int64_t * storeTail(int64_t * p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 0, 1, 1));
+            SSE::maskstore_epi64((int64_t *)p, t0, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int64_t * storea(int64_t * p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int64_t * storea(SIMDVecMask<2> const & mask, int64_t * p) const {
+            SSE::maskstore_epi64((int64_t *)p, mask.mMask, mVec);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = SSE::blendv_epi8(mVec, b.mVec, mask.mMask);
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int64_t b) const {
+            __m128i t0 = _mm_add_epi64(mVec, _mm_set1_epi64x(b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int64_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm_add_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int64_t b) {
+            mVec = _mm_add_epi64(mVec, _mm_set1_epi64x(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int64_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        // MSADDV
+        // SADDS
+        // MSADDS
+        // SADDVA
+        // MSADDVA
+        // SADDSA
+        // MSADDSA
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            mVec = _mm_add_epi64(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_add_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t2, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            mVec = _mm_add_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int64_t b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, _mm_set1_epi64x(b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int64_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int64_t b) {
+            mVec = _mm_sub_epi64(mVec, _mm_set1_epi64x(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int64_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        // MSSUBV
+        // SSUBS
+        // MSSUBS
+        // SSUBVA
+        // MSSUBVA
+        // SSUBSA
+        // MSSUBSA
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            __m128i t1 = SSE::blendv_epi8(b.mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int64_t b) const {
+            __m128i t0 = _mm_sub_epi64(_mm_set1_epi64x(b), mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            __m128i t2 = SSE::blendv_epi8(t0, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi64(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            mVec = SSE::blendv_epi8(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int64_t b) {
+            mVec = _mm_sub_epi64(_mm_set1_epi64x(b), mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            mVec = SSE::blendv_epi8(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            mVec = _mm_sub_epi64(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_sub_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t2, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            mVec = _mm_sub_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MULV
+        // MMULV
+        // MULS
+        // MMULS
+        // MULVA
+        // MMULVA
+        // MULSA
+        // MMULSA
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(SIMDVec_i const & b) const {
+            __m128i t0 = SSE::cmpeq_epi64(mVec, b.mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpeq_epi64(mVec, t0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (int64_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(SIMDVec_i const & b) const {
+            __m128i t0 = SSE::cmpeq_epi64(mVec, b.mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(t0, m0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpeq_epi64(mVec, t0);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t2 = _mm_xor_si128(t1, m0);
+            return SIMDVecMask<2>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (int64_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(SIMDVec_i const & b) const {
+            __m128i m0 = SSE::cmpgt_epi64(mVec, b.mVec);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i m0 = SSE::cmpgt_epi64(mVec, t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (int64_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(SIMDVec_i const & b) const {
+            __m128i m0 = SSE::cmpgt_epi64(b.mVec, mVec);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i m0 = SSE::cmpgt_epi64(t0, mVec);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (int64_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(SIMDVec_i const & b) const {
+            __m128i t0 = SSE::cmpgt_epi64(b.mVec, mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(t0, m0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpgt_epi64(t0, mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t2 = _mm_xor_si128(t1, m0);
+            return SIMDVecMask<2>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (int64_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(SIMDVec_i const & b) const {
+            __m128i t0 = SSE::cmpgt_epi64(mVec, b.mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(t0, m0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpgt_epi64(mVec, t0);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t2 = _mm_xor_si128(t1, m0);
+            return SIMDVecMask<2>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (int64_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m128i m0 = SSE::cmpeq_epi64(mVec, b.mVec);
+            return _mm_movemask_pd(_mm_castsi128_pd(m0)) == 0x3;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i m0 = SSE::cmpeq_epi64(mVec, t0);
+            return _mm_movemask_pd(_mm_castsi128_pd(m0)) == 0x3;
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] != raw[1];
+        }
+        // HADD
+        // MHADD
+        // HADDS
+        // MHADDS
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+        // FMULADDV
+        // MFMULADDV
+        // FMULSUBV
+        // MFMULSUBV
+        // FADDMULV
+        // MFADDMULV
+        // FSUBMULV
+        // MFSUBMULV
+        // MAXV
+        // MMAXV
+        // MAXS
+        // MMAXS
+        // MAXVA
+        // MMAXVA
+        // MAXSA
+        // MMAXSA
+        // MINV
+        // MMINV
+        // MINS
+        // MMINS
+        // MINVA
+        // MMINVA
+        // MINSA
+        // MMINSA
+        // HMAX
+        // MHMAX
+        // IMAX
+        // MIMAX
+        // HMIN
+        // MHMIN
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HBAND
+        // MHBAND
+        // HBANDS
+        // MHBANDS
+        // HBOR
+        // MHBOR
+        // HBORS
+        // MHBORS
+        // HBXOR
+        // MHBXOR
+        // HBXORS
+        // MHBXORS
+
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SSE::sllv_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint64_t, 2> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SSE::sllv_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint64_t b) const {
+            __m128i t0 = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint64_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint64_t, 2> const & b) {
+            mVec = SSE::sllv_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint64_t, 2> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = SSE::sllv_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint64_t b) {
+            mVec = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint64_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SSE::srav_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint64_t, 2> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SSE::srav_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint64_t b) const {
+            __m128i t0 = SSE::sra_epi64(mVec, _mm_set_epi64x(0, b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint64_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SSE::sra_epi64(mVec, _mm_set_epi64x(0, b));
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint64_t, 2> const & b) {
+            mVec = SSE::srav_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint64_t, 2> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = SSE::srav_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint64_t b) {
+            mVec = SSE::sra_epi64(mVec, _mm_set_epi64x(0, b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SSE::sra_epi64(mVec, _mm_set_epi64x(0, b));
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m128i t0 = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m128i t0 = _mm_shuffle_epi32(_mm_srai_epi32(mVec, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            __m128i t1 = _mm_sub_epi64(_mm_xor_si128(mVec, t0), t0);
+            return SIMDVec_i(t1);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_shuffle_epi32(_mm_srai_epi32(mVec, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            __m128i t1 = _mm_sub_epi64(_mm_xor_si128(mVec, t0), t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            __m128i t0 = _mm_shuffle_epi32(_mm_srai_epi32(mVec, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            mVec = _mm_sub_epi64(_mm_xor_si128(mVec, t0), t0);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_shuffle_epi32(_mm_srai_epi32(mVec, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            __m128i t1 = _mm_sub_epi64(_mm_xor_si128(mVec, t0), t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int64_t, 1> const & a, SIMDVec_i<int64_t, 1> const & b) {
+            mVec = _mm_set_epi64x(b[0], a[0]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int64_t, 1> const & a) {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[0] = a[0];
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int64_t, 1> const & b) {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[1] = b[0];
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int64_t, 1> & a, SIMDVec_i<int64_t, 1> & b) const {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            a.insert(0, raw[0]);
+            b.insert(0, raw[1]);
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 1> unpacklo() const {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return SIMDVec_i<int64_t, 1>(raw[0]);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 1> unpackhi() const {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return SIMDVec_i<int64_t, 1>(raw[1]);
+        }
+
+        // PROMOTE
+        // -
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 2>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 2>() const;
+        // ITOF
+        UME_FORCE_INLINE operator SIMDVec_f<double, 2>() const;
+    };
+
+}
+}
+
+#endif
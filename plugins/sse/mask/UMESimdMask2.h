@@ -0,0 +1,289 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_MASK_2_H_
+#define UME_SIMD_MASK_2_H_
+
+#include "UMESimdMaskPrototype.h"
+
+namespace UME {
+namespace SIMD {
+
+    // Mask elements are 64b wide, so that the mask can be used directly
+    // with 2x64b vectors.
+    template<>
+    class SIMDVecMask<2> :
+        public SIMDMaskBaseInterface<
+            SIMDVecMask<2>,
+            uint64_t,
+            2>
+    {
+        static uint64_t TRUE_VAL() { return 0xFFFFFFFFFFFFFFFF; };
+        static uint64_t FALSE_VAL() { return 0x0000000000000000; };
+
+        // This function returns internal representation of boolean value based on bool input
+        static inline uint64_t toMaskBool(bool m) { if (m == true) return TRUE_VAL(); else return FALSE_VAL(); }
+
+        friend class SIMDVec_u<uint8_t, 2>;
+        friend class SIMDVec_u<uint16_t, 2>;
+        friend class SIMDVec_u<uint32_t, 2>;
+        friend class SIMDVec_u<uint64_t, 2>;
+        friend class SIMDVec_i<int8_t, 2>;
+        friend class SIMDVec_i<int16_t, 2>;
+        friend class SIMDVec_i<int32_t, 2>;
+        friend class SIMDVec_i<int64_t, 2>;
+        friend class SIMDVec_f<float, 2>;
+        friend class SIMDVec_f<double, 2>;
+    private:
+        __m128i mMask;
+
+        inline SIMDVecMask(__m128i const & x) { mMask = x; };
+    public:
+        constexpr static uint32_t length() { return 2; }
+        constexpr static uint32_t alignment() { return 16; }
+        inline SIMDVecMask() {}
+
+        // Regardless of the mask representation, the interface should only allow initialization using 
+        // standard bool or using equivalent mask
+        // SET-CONSTR
+        inline SIMDVecMask(bool m) {
+            mMask = _mm_set1_epi64x(toMaskBool(m));
+        }
+
+        // LOAD-CONSTR
+        inline explicit SIMDVecMask(bool const *p) {
+            mMask = _mm_set_epi64x(toMaskBool(p[1]), toMaskBool(p[0]));
+        }
+        // FULL-CONSTR
+        inline explicit SIMDVecMask(bool m0, bool m1) {
+            mMask = _mm_set_epi64x(toMaskBool(m1), toMaskBool(m0));
+        }
+
+        inline SIMDVecMask(SIMDVecMask const & mask) {
+            this->mMask = mask.mMask;
+        }
+        // EXTRACT
+        inline bool extract(uint32_t index) const {
+            int m = _mm_movemask_pd(_mm_castsi128_pd(mMask));
+            return ((m >> (index & 1)) & 1) != 0;
+        }
+        inline bool operator[] (uint32_t index) const {
+            return extract(index);
+        }
+        // INSERT
+        inline void insert(uint32_t index, bool x) {
+            UME_PERFORMANCE_UNOPTIMAL_WARNING()
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mMask);
+            raw[index & 1] = toMaskBool(x);
+            mMask = _mm_load_si128((__m128i*)raw);
+        }
+        // LOAD
+        inline SIMDVecMask & load(bool const * p) {
+            mMask = _mm_set_epi64x(toMaskBool(p[1]), toMaskBool(p[0]));
+            return *this;
+        }
+        // LOADA
+        inline SIMDVecMask & loada(bool const * p) {
+            mMask = _mm_set_epi64x(toMaskBool(p[1]), toMaskBool(p[0]));
+            return *this;
+        }
+        // STORE
+        inline bool* store(bool * p) const {
+            int m = _mm_movemask_pd(_mm_castsi128_pd(mMask));
+            p[0] = (m & 0x1) != 0;
+            p[1] = (m & 0x2) != 0;
+            return p;
+        }
+        // STOREA
+        inline bool* storea(bool * p) const {
+            return store(p);
+        }
+        // ASSIGN
+        inline SIMDVecMask & operator= (SIMDVecMask const & x) {
+            mMask = x.mMask;
+            return *this;
+        }
+        // LANDV
+        inline SIMDVecMask land(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_and_si128(mMask, b.mMask);
+            return SIMDVecMask(t0);
+        }
+        inline SIMDVecMask operator& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        inline SIMDVecMask operator&& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        // LANDS
+        inline SIMDVecMask land(bool b) const {
+            __m128i t0 = _mm_set1_epi64x(toMaskBool(b));
+            __m128i t1 = _mm_and_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        inline SIMDVecMask operator& (bool b) const {
+            return land(b);
+        }
+        inline SIMDVecMask operator&& (bool b) const {
+            return land(b);
+        }
+        // LANDVA
+        inline SIMDVecMask & landa(SIMDVecMask const & b) {
+            mMask = _mm_and_si128(mMask, b.mMask);
+            return *this;
+        }
+        inline SIMDVecMask operator&= (SIMDVecMask const & b) {
+            return landa(b);
+        }
+        // LANDSA
+        inline SIMDVecMask & landa(bool b) {
+            __m128i t0 = _mm_set1_epi64x(toMaskBool(b));
+            mMask = _mm_and_si128(mMask, t0);
+            return *this;
+        }
+        inline SIMDVecMask operator&= (bool b) {
+            return landa(b);
+        }
+        // LORV
+        inline SIMDVecMask lor(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_or_si128(mMask, b.mMask);
+            return SIMDVecMask(t0);
+        }
+        inline SIMDVecMask operator| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        inline SIMDVecMask operator|| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        // LORS
+        inline SIMDVecMask lor(bool b) const {
+            __m128i t0 = _mm_set1_epi64x(toMaskBool(b));
+            __m128i t1 = _mm_or_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        inline SIMDVecMask operator| (bool b) const {
+            return lor(b);
+        }
+        inline SIMDVecMask operator|| (bool b) const {
+            return lor(b);
+        }
+        // LORVA
+        inline SIMDVecMask & lora(SIMDVecMask const & b) {
+            mMask = _mm_or_si128(mMask, b.mMask);
+            return *this;
+        }
+        inline SIMDVecMask & operator|= (SIMDVecMask const & b) {
+            return lora(b);
+        }
+        // LORSA
+        inline SIMDVecMask & lora(bool b) {
+            __m128i t0 = _mm_set1_epi64x(toMaskBool(b));
+            mMask = _mm_or_si128(mMask, t0);
+            return *this;
+        }
+        inline SIMDVecMask & operator |= (bool b) {
+            return lora(b);
+        }
+        // LXORV
+        inline SIMDVecMask lxor(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_xor_si128(mMask, b.mMask);
+            return SIMDVecMask(t0);
+        }
+        inline SIMDVecMask operator^ (SIMDVecMask const & b) const {
+            return lxor(b);
+        }
+        // LXORS
+        inline SIMDVecMask lxor(bool b) const {
+            __m128i t0 = _mm_set1_epi64x(toMaskBool(b));
+            __m128i t1 = _mm_xor_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        inline SIMDVecMask operator^ (bool b) const {
+            return lxor(b);
+        }
+        // LXORVA
+        inline SIMDVecMask & lxora(SIMDVecMask const & b) {
+            mMask = _mm_xor_si128(mMask, b.mMask);
+            return *this;
+        }
+        inline SIMDVecMask operator^= (SIMDVecMask const & b) {
+            return lxora(b);
+        }
+        // LXORSA
+        inline SIMDVecMask & lxora(bool b) {
+            __m128i t0 = _mm_set1_epi64x(toMaskBool(b));
+            mMask = _mm_xor_si128(mMask, t0);
+            return *this;
+        }
+        inline SIMDVecMask operator^= (bool b) {
+            return lxora(b);
+        }
+        // LNOT
+        inline SIMDVecMask lnot() const {
+            __m128i t0 = _mm_set1_epi64x(TRUE_VAL());
+            __m128i t1 = _mm_andnot_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        inline SIMDVecMask operator! () const {
+            return lnot();
+        }
+        // LNOTA
+        inline SIMDVecMask lnota() {
+            __m128i t0 = _mm_set1_epi64x(TRUE_VAL());
+            mMask = _mm_andnot_si128(mMask, t0);
+            return *this;
+        }
+        // HLAND
+        inline bool hland() const {
+            return _mm_movemask_pd(_mm_castsi128_pd(mMask)) == 0x3;
+        }
+        // HLOR
+        inline bool hlor() const {
+            return _mm_movemask_pd(_mm_castsi128_pd(mMask)) != 0;
+        }
+        // HLXOR
+        inline bool hlxor() const {
+            int m = _mm_movemask_pd(_mm_castsi128_pd(mMask));
+            return m == 0x1 || m == 0x2;
+        }
+        // TOBITS
+        inline uint64_t toBits() const {
+            return uint64_t(_mm_movemask_pd(_mm_castsi128_pd(mMask)));
+        }
+        // FROMBITS
+        static inline SIMDVecMask fromBits(uint64_t bits) {
+            return SIMDVecMask(_mm_set_epi64x(toMaskBool((bits & 0x2) != 0), toMaskBool((bits & 0x1) != 0)));
+        }
+    };
+
+}
+}
+
+#endif
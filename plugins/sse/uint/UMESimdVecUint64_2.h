@@ -0,0 +1,1057 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT64_2_H_
+#define UME_SIMD_VEC_UINT64_2_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdIntrinsicsSSE.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_u<uint64_t, 2> :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<uint64_t, 2>,
+            uint64_t,
+            2,
+            SIMDVecMask<2>,
+            SIMDSwizzle<2>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<uint64_t, 2>,
+            SIMDVec_u<uint64_t, 1>>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_i<int64_t, 2>;
+        friend class SIMDVec_f<double, 2>;
+
+        friend class SIMDVec_u<uint64_t, 4>;
+
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { this->mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { this->mVec = x; }
+
+    public:
+
+        constexpr static uint32_t length() { return 2; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint64_t i) {
+            mVec = _mm_set1_epi64x(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i, 
+            typename std::enable_if<std::is_fundamental<T>::value &&
+                                    !std::is_same<T, uint64_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<uint64_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_u(uint64_t const *p) { this->load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint64_t i0, uint64_t i1) {
+            mVec = _mm_set_epi64x(i1, i0);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE uint64_t extract(uint32_t index) const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i *)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE uint64_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, uint64_t value) {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, uint64_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, uint64_t>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>> operator() (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>> operator[] (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ****************************************************************************************
+        // Overloading Interface functions starts here!
+        // ****************************************************************************************
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SIMDVec_u const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            mVec = SSE::blendv_epi8(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(uint64_t b) {
+            mVec = _mm_set1_epi64x(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (uint64_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+        // PREFETCHNTA
+        // PREFETCHW
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(uint64_t const * p) {
+            mVec = _mm_loadu_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<2> const & mask, uint64_t const * p) {
+            __m128i t0 = SSE::maskload_epi64((int64_t const *)p, mask.mMask);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADTAIL
+        UME_FORCE_INLINE SIMDVec_u & loadTail(uint64_t const * p, uint32_t count) {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 0, 1, 1));
+            mVec = SSE::maskload_epi64((int64_t const *)p, t0);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(uint64_t const * p) {
+            mVec = _mm_load_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<2> const & mask, uint64_t const * p) {
+            __m128i t0 = SSE::maskload_epi64((int64_t const *)p, mask.mMask);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE uint64_t * store(uint64_t * p) const {
+            _mm_storeu_si128((__m128i*) p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE uint64_t * store(SIMDVecMask<2> const & mask, uint64_t * p) const {
+            SSE::maskstore_epi64((int64_t *)p, mask.mMask, mVec);
+            return p;
+        }
+        // STORETAIL
+        UME_FORCE_INLINE uint64_t * storeTail(uint64_t * p, uint32_t count) const {
+            __m128i t0 = _mm_cmpgt_epi32(_mm_set1_epi32(count), _mm_setr_epi32(0, 0, 1, 1));
+            SSE::maskstore_epi64((int64_t *)p, t0, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE uint64_t * storea(uint64_t * p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE uint64_t * storea(SIMDVecMask<2> const & mask, uint64_t * p) const {
+            SSE::maskstore_epi64((int64_t *)p, mask.mMask, mVec);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = SSE::blendv_epi8(mVec, b.mVec, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint64_t b) const {
+            __m128i t0 = _mm_add_epi64(mVec, _mm_set1_epi64x(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint64_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = _mm_add_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint64_t b) {
+            mVec = _mm_add_epi64(mVec, _mm_set1_epi64x(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint64_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        // MSADDV
+        // SADDS
+        // MSADDS
+        // SADDVA
+        // MSADDVA
+        // SADDSA
+        // MSADDSA
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            mVec = _mm_add_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_add_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t2, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            mVec = _mm_add_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint64_t b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, _mm_set1_epi64x(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint64_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint64_t b) {
+            mVec = _mm_sub_epi64(mVec, _mm_set1_epi64x(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint64_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        // MSSUBV
+        // SSUBS
+        // MSSUBS
+        // SSUBVA
+        // MSSUBVA
+        // SSUBSA
+        // MSSUBSA
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            __m128i t1 = SSE::blendv_epi8(b.mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(uint64_t b) const {
+            __m128i t0 = _mm_sub_epi64(_mm_set1_epi64x(b), mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            __m128i t2 = SSE::blendv_epi8(t0, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi64(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            mVec = SSE::blendv_epi8(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(uint64_t b) {
+            mVec = _mm_sub_epi64(_mm_set1_epi64x(b), mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            mVec = SSE::blendv_epi8(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            mVec = _mm_sub_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_sub_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t2, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec() {
+            __m128i t0 = _mm_set1_epi64x(1);
+            mVec = _mm_sub_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(1);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MULV
+        // MMULV
+        // MULS
+        // MMULS
+        // MULVA
+        // MMULVA
+        // MULSA
+        // MMULSA
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(SIMDVec_u const & b) const {
+            __m128i t0 = SSE::cmpeq_epi64(mVec, b.mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpeq_epi64(mVec, t0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (uint64_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(SIMDVec_u const & b) const {
+            __m128i t0 = SSE::cmpeq_epi64(mVec, b.mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(t0, m0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpeq_epi64(mVec, t0);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t2 = _mm_xor_si128(t1, m0);
+            return SIMDVecMask<2>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (uint64_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(SIMDVec_u const & b) const {
+            __m128i m0 = SSE::cmpgt_epu64(mVec, b.mVec);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i m0 = SSE::cmpgt_epu64(mVec, t0);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (uint64_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(SIMDVec_u const & b) const {
+            __m128i m0 = SSE::cmpgt_epu64(b.mVec, mVec);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i m0 = SSE::cmpgt_epu64(t0, mVec);
+            return SIMDVecMask<2>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (uint64_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(SIMDVec_u const & b) const {
+            __m128i t0 = SSE::cmpgt_epu64(b.mVec, mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(t0, m0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpgt_epu64(t0, mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t2 = _mm_xor_si128(t1, m0);
+            return SIMDVecMask<2>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (uint64_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(SIMDVec_u const & b) const {
+            __m128i t0 = SSE::cmpgt_epu64(mVec, b.mVec);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(t0, m0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = SSE::cmpgt_epu64(mVec, t0);
+            __m128i m0 = _mm_set1_epi64x(SIMDVecMask<2>::TRUE_VAL());
+            __m128i t2 = _mm_xor_si128(t1, m0);
+            return SIMDVecMask<2>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (uint64_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_u const & b) const {
+            __m128i m0 = SSE::cmpeq_epi64(mVec, b.mVec);
+            return _mm_movemask_pd(_mm_castsi128_pd(m0)) == 0x3;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i m0 = SSE::cmpeq_epi64(mVec, t0);
+            return _mm_movemask_pd(_mm_castsi128_pd(m0)) == 0x3;
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] != raw[1];
+        }
+        // HADD
+        // MHADD
+        // HADDS
+        // MHADDS
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+        // FMULADDV
+        // MFMULADDV
+        // FMULSUBV
+        // MFMULSUBV
+        // FADDMULV
+        // MFADDMULV
+        // FSUBMULV
+        // MFSUBMULV
+        // MAXV
+        // MMAXV
+        // MAXS
+        // MMAXS
+        // MAXVA
+        // MMAXVA
+        // MAXSA
+        // MMAXSA
+        // MINV
+        // MMINV
+        // MINS
+        // MMINS
+        // MINVA
+        // MMINVA
+        // MINSA
+        // MMINSA
+        // HMAX
+        // MHMAX
+        // IMAX
+        // MIMAX
+        // HMIN
+        // MHMIN
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = SSE::blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HBAND
+        // MHBAND
+        // HBANDS
+        // MHBANDS
+        // HBOR
+        // MHBOR
+        // HBORS
+        // MHBORS
+        // HBXOR
+        // MHBXOR
+        // HBXORS
+        // MHBXORS
+
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m128i t0 = SSE::sllv_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = SSE::sllv_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint64_t b) const {
+            __m128i t0 = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint64_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = SSE::sllv_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = SSE::sllv_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint64_t b) {
+            mVec = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint64_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_sll_epi64(mVec, _mm_set_epi64x(0, b));
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m128i t0 = SSE::srlv_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = SSE::srlv_epi64(mVec, b.mVec);
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint64_t b) const {
+            __m128i t0 = _mm_srl_epi64(mVec, _mm_set_epi64x(0, b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint64_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_srl_epi64(mVec, _mm_set_epi64x(0, b));
+            __m128i t1 = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = SSE::srlv_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = SSE::srlv_epi64(mVec, b.mVec);
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint64_t b) {
+            mVec = _mm_srl_epi64(mVec, _mm_set_epi64x(0, b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_srl_epi64(mVec, _mm_set_epi64x(0, b));
+            mVec = SSE::blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint64_t, 1> const & a, SIMDVec_u<uint64_t, 1> const & b) {
+            mVec = _mm_set_epi64x(b[0], a[0]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_u & packlo(SIMDVec_u<uint64_t, 1> const & a) {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[0] = a[0];
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_u & packhi(SIMDVec_u<uint64_t, 1> const & b) {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[1] = b[0];
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_u<uint64_t, 1> & a, SIMDVec_u<uint64_t, 1> & b) const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            a.insert(0, raw[0]);
+            b.insert(0, raw[1]);
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 1> unpacklo() const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return SIMDVec_u<uint64_t, 1>(raw[0]);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 1> unpackhi() const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return SIMDVec_u<uint64_t, 1>(raw[1]);
+        }
+
+        // PROMOTE
+        // -
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_u<uint32_t, 2>() const;
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int64_t, 2>() const;
+        // UTOF
+        UME_FORCE_INLINE operator SIMDVec_f<double, 2>() const;
+    };
+
+}
+}
+
+#endif
@@ -33,6 +33,9 @@
 
 #include "UMEUnitTestCommon.h"
 #include "UMEUnitTestMemory.h"
+#include "UMEUnitTestDispatch.h"
+#include "UMEUnitTestAlgorithms.h"
+#include "UMEUnitTestParallel.h"
 #include "UMEUnitTestSimd.h"
 
 int main()
@@ -42,6 +45,12 @@ int main()
     
     total_failed += test_allocators(false);
     total_tests +=g_totalTests;
+    total_failed += test_dispatch(false);
+    total_tests +=g_totalTests;
+    total_failed += test_algorithms(false);
+    total_tests +=g_totalTests;
+    total_failed += test_parallel(false);
+    total_tests +=g_totalTests;
     total_failed += test_UMESimd(false);
     total_tests +=g_totalTests;
     std::cout << std::endl;
@@ -0,0 +1,209 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_ALGORITHMS_H_
+#define UME_UNIT_TEST_ALGORITHMS_H_
+
+#include "UMEUnitTestCommon.h"
+#include "../UMEAlgorithms.h"
+
+template<typename VEC_T>
+void genericAlgorithmsTest()
+{
+    typedef typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T SCALAR_T;
+    typedef typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_UINT_T SCALAR_UINT_T;
+    const int MAX_LEN = 100;
+
+    // Arrays are offset by one element, so that both peeling and remainder are exercised.
+    alignas(VEC_T::alignment()) SCALAR_T x_buf[MAX_LEN + 1];
+    alignas(VEC_T::alignment()) SCALAR_T y_buf[MAX_LEN + 2];
+    alignas(VEC_T::alignment()) SCALAR_T z_buf[MAX_LEN + 2];
+    SCALAR_T* x = &x_buf[1];
+    SCALAR_T* y = &y_buf[1];
+    SCALAR_T* z = &z_buf[1];
+    SCALAR_UINT_T idx[MAX_LEN];
+
+    for (int i = 0; i < MAX_LEN; i++) x[i] = SCALAR_T(i % 5 + 1);
+
+    // Prefetches are only hints, without visible effects.
+    VEC_T::prefetch0(x);
+    VEC_T::prefetch1(x);
+    VEC_T::prefetch2(x);
+    VEC_T::prefetchnta(x);
+    VEC_T::prefetchw(z);
+
+    for (int n = 0; n <= MAX_LEN; n += 3) {
+        SCALAR_T sum = 0, sumSq = 0, dot = 0, maxVal = 0;
+        uint64_t countGt2 = 0;
+        for (int i = 0; i < n; i++) {
+            y[i] = SCALAR_T(i % 3);
+            sum += x[i];
+            sumSq += x[i] * x[i];
+            dot += x[i] * y[i];
+            maxVal = x[i] > maxVal ? x[i] : maxVal;
+            if (x[i] > SCALAR_T(2)) countGt2++;
+        }
+        z[n] = SCALAR_T(99);
+
+        UME::SIMD::transform<VEC_T>(x, z, n, [](VEC_T const & a) { return a * SCALAR_T(2) + SCALAR_T(1); });
+        bool exact = z[n] == SCALAR_T(99);
+        for (int i = 0; i < n; i++) exact &= (z[i] == SCALAR_T(x[i] * 2 + 1));
+        CHECK_CONDITION(exact, "transform");
+
+        UME::SIMD::transform<VEC_T>(x, y, z, n, [](VEC_T const & a, VEC_T const & b) { return a + b; });
+        exact = z[n] == SCALAR_T(99);
+        for (int i = 0; i < n; i++) exact &= (z[i] == SCALAR_T(x[i] + y[i]));
+        CHECK_CONDITION(exact, "transform (binary)");
+
+        CHECK_CONDITION(UME::SIMD::reduce<VEC_T>(x, n) == sum, "reduce");
+
+        SCALAR_T t0 = UME::SIMD::reduce<VEC_T>(x, n, SCALAR_T(0),
+            [](VEC_T const & a, VEC_T const & b) { return a.max(b); });
+        CHECK_CONDITION(t0 == maxVal, "reduce (max)");
+
+        SCALAR_T t1 = UME::SIMD::transform_reduce<VEC_T>(x, n, SCALAR_T(0),
+            [](VEC_T const & a, VEC_T const & b) { return a + b; },
+            [](VEC_T const & a) { return a * a; });
+        CHECK_CONDITION(t1 == sumSq, "transform_reduce");
+
+        SCALAR_T t2 = UME::SIMD::transform_reduce<VEC_T>(x, y, n, SCALAR_T(0),
+            [](VEC_T const & a, VEC_T const & b) { return a + b; },
+            [](VEC_T const & a, VEC_T const & b) { return a * b; });
+        CHECK_CONDITION(t2 == dot, "transform_reduce (binary)");
+
+        UME::SIMD::inclusive_scan<VEC_T>(x, z, n);
+        SCALAR_T running = 0;
+        exact = z[n] == SCALAR_T(99);
+        for (int i = 0; i < n; i++) {
+            running += x[i];
+            exact &= (z[i] == running);
+        }
+        CHECK_CONDITION(exact, "inclusive_scan");
+
+        z[n] = SCALAR_T(99);
+        UME::SIMD::inclusive_scan<VEC_T>(x, z, n, SCALAR_T(0),
+            [](VEC_T const & a, VEC_T const & b) { return a.max(b); });
+        running = 0;
+        exact = z[n] == SCALAR_T(99);
+        for (int i = 0; i < n; i++) {
+            running = x[i] > running ? x[i] : running;
+            exact &= (z[i] == running);
+        }
+        CHECK_CONDITION(exact, "inclusive_scan (max)");
+
+        // Non-commutative operation: the first non-zero element seen so far.
+        for (int i = 0; i < n; i++) y[i] = SCALAR_T(i % 4 == 3 ? i % 7 + 1 : 0);
+        z[n] = SCALAR_T(99);
+        UME::SIMD::inclusive_scan<VEC_T>(y, z, n, SCALAR_T(0),
+            [](VEC_T const & a, VEC_T const & b) { return b.blend(a != SCALAR_T(0), a); });
+        running = 0;
+        exact = z[n] == SCALAR_T(99);
+        for (int i = 0; i < n; i++) {
+            running = running != SCALAR_T(0) ? running : y[i];
+            exact &= (z[i] == running);
+        }
+        CHECK_CONDITION(exact, "inclusive_scan (first non-zero)");
+
+        uint64_t t3 = UME::SIMD::count_if<VEC_T>(x, n, [](VEC_T const & a) { return a > SCALAR_T(2); });
+        CHECK_CONDITION(t3 == countGt2, "count_if");
+
+        for (int i = 0; i < n; i++) idx[i] = SCALAR_UINT_T((i * 7) % MAX_LEN);
+        UME::SIMD::gather<VEC_T>(x, idx, z, n);
+        exact = z[n] == SCALAR_T(99);
+        for (int i = 0; i < n; i++) exact &= (z[i] == x[idx[i]]);
+        CHECK_CONDITION(exact, "gather");
+
+        int m = n / 3;
+        z[m] = SCALAR_T(99);
+        UME::SIMD::gather_strided<VEC_T>(x, 3, z, m, 4);
+        exact = z[m] == SCALAR_T(99);
+        for (int i = 0; i < m; i++) exact &= (z[i] == x[3 * i]);
+        CHECK_CONDITION(exact, "gather_strided");
+
+        // Reversed indices, so each element goes to a different position.
+        for (int i = 0; i < n; i++) idx[i] = SCALAR_UINT_T(n - 1 - i);
+        UME::SIMD::scatter<VEC_T>(x, idx, z, n);
+        exact = z[n] == SCALAR_T(99);
+        for (int i = 0; i < n; i++) exact &= (z[n - 1 - i] == x[i]);
+        CHECK_CONDITION(exact, "scatter");
+
+        // With repeated indices the last element is stored.
+        for (int i = 0; i < n; i++) idx[i] = SCALAR_UINT_T(0);
+        UME::SIMD::scatter<VEC_T>(x, idx, z, n, 0);
+        CHECK_CONDITION(n == 0 || z[0] == x[n - 1], "scatter (repeated indices)");
+
+        for (int distance = 0; distance <= 20; distance += 5) {
+            std::size_t prefetched = 0;
+            std::size_t processed = 0;
+            bool ordered = true;
+            UME::SIMD::for_each_prefetched<VEC_T>(std::size_t(n), std::size_t(distance),
+                [&](std::size_t j) {
+                    ordered &= (j == prefetched);
+                    prefetched++;
+                    return x + j % MAX_LEN;
+                },
+                [&](std::size_t i, uint32_t count) {
+                    std::size_t ahead = i + count + distance < std::size_t(n) ? i + count + distance : std::size_t(n);
+                    ordered &= (i == processed) && (distance == 0 || prefetched == ahead);
+                    processed += count;
+                });
+            ordered &= (processed == std::size_t(n)) && (prefetched == (distance == 0 ? 0 : std::size_t(n)));
+            CHECK_CONDITION(ordered, "for_each_prefetched");
+        }
+    }
+}
+
+int test_algorithms(bool supressMessages)
+{
+    char header[] = "UME::SIMD algorithms test";
+    INIT_TEST(header, supressMessages);
+
+    genericAlgorithmsTest<UME::SIMD::SIMD1_32f>();
+    genericAlgorithmsTest<UME::SIMD::SIMD8_32f>();
+    genericAlgorithmsTest<UME::SIMD::SIMD16_32f>();
+    genericAlgorithmsTest<UME::SIMD::SIMD4_64f>();
+    genericAlgorithmsTest<UME::SIMD::SIMD8_32i>();
+    genericAlgorithmsTest<UME::SIMD::SIMD16_32u>();
+    genericAlgorithmsTest<UME::SIMD::SIMD32_8u>();
+    genericAlgorithmsTest<UME::SIMD::SIMD16_16i>();
+
+    {
+        // 8-bit per-element counters have to be flushed before they overflow.
+        const int LEN = 20000;
+        static uint8_t data[LEN];
+        for (int i = 0; i < LEN; i++) data[i] = uint8_t(i % 4);
+        uint64_t count = UME::SIMD::count_if<UME::SIMD::SIMD32_8u>(data, LEN,
+            [](UME::SIMD::SIMD32_8u const & a) { return a > uint8_t(0); });
+        CHECK_CONDITION(count == uint64_t(LEN - LEN / 4), "count_if (8-bit overflow)");
+    }
+
+    return g_failCount;
+}
+#endif
@@ -234,6 +234,32 @@ bool valuesExact(bool const *values, bool const *expectedValues, unsigned int co
     return retval;
 }
 
+bool valuesExact(float const *values, float const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        if(values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(double const *values, double const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        if(values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
 bool valuesInRange(float const *values, float const *expectedValues, unsigned int count, float errMargin)
 {
     bool retval = true;
@@ -40,6 +40,11 @@
 
 #include <random>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 extern int g_totalTests;
 extern int g_totalFailed;
 extern int g_testMaxId;
@@ -99,6 +104,8 @@ bool valuesExact(uint32_t const *values, uint32_t const *expectedValues, unsigne
 bool valuesExact(int64_t const *values, int64_t const *expectedValues, unsigned int count);
 bool valuesExact(uint64_t const *values, uint64_t const *expectedValues, unsigned int count);
 bool valuesExact(bool const *values, bool const *expectedValues, unsigned int count);
+bool valuesExact(float const *values, float const *expectedValues, unsigned int count);
+bool valuesExact(double const *values, double const *expectedValues, unsigned int count);
 bool valuesInRange(float const *values, float const *expectedValues, unsigned int count, float errMargin);
 bool valuesInRange(double const *values, double const *expectedValues, unsigned int count, double errMargin);
 
@@ -1196,6 +1203,103 @@ void genericHLXORTest()
     CHECK_CONDITION(value == expected, "HLXOR");
 }
 
+template<typename MASK_TYPE, int VEC_LEN>
+void genericMaskActiveTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    bool inputA[VEC_LEN];
+    uint32_t expectedCount = 0;
+    uint32_t expectedFirst = VEC_LEN;
+    uint32_t expectedLast = VEC_LEN;
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<bool>(gen);
+        if (inputA[i] == true) {
+            expectedCount++;
+            if (expectedFirst == VEC_LEN) expectedFirst = i;
+            expectedLast = i;
+        }
+    }
+
+    {
+        MASK_TYPE m0(inputA);
+        CHECK_CONDITION(m0.count() == expectedCount, "COUNT");
+        CHECK_CONDITION(m0.firstActive() == expectedFirst, "FIRSTACTIVE");
+        CHECK_CONDITION(m0.lastActive() == expectedLast, "LASTACTIVE");
+    }
+    {
+        MASK_TYPE m0(false);
+        bool cond = (m0.count() == 0) && (m0.firstActive() == VEC_LEN) && (m0.lastActive() == VEC_LEN);
+        CHECK_CONDITION(cond, "COUNT/FIRSTACTIVE/LASTACTIVE (none set)");
+    }
+    {
+        MASK_TYPE m0(true);
+        bool cond = (m0.count() == VEC_LEN) && (m0.firstActive() == 0) && (m0.lastActive() == VEC_LEN - 1);
+        CHECK_CONDITION(cond, "COUNT/FIRSTACTIVE/LASTACTIVE (all set)");
+    }
+}
+
+// TOBITS, FROMBITS and ACTIVELANES are only available for masks of up to 64
+// elements. This test needs to be wrapped in a class to provide partial
+// specialization for SIMDMask128.
+template<typename MASK_TYPE, int VEC_LEN>
+class genericMaskBitsTest_random {
+public:
+    static void run()
+    {
+        std::random_device rd;
+        std::mt19937 gen(rd());
+
+        bool inputA[VEC_LEN];
+        uint64_t expected = 0;
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<bool>(gen);
+            if (inputA[i] == true) expected |= (uint64_t(1) << i);
+        }
+
+        {
+            MASK_TYPE m0(inputA);
+            CHECK_CONDITION(m0.toBits() == expected, "TOBITS");
+        }
+        {
+            // Bits above the mask length are ignored.
+            uint64_t t0 = (VEC_LEN < 64) ? (expected | (~uint64_t(0) << (VEC_LEN % 64))) : expected;
+            bool values[VEC_LEN];
+            MASK_TYPE m0 = MASK_TYPE::fromBits(t0);
+            m0.store(values);
+            CHECK_CONDITION(valuesExact(values, inputA, VEC_LEN), "FROMBITS");
+        }
+        {
+            MASK_TYPE m0(inputA);
+            bool values[VEC_LEN];
+            bool ordered = true;
+            int previous = -1;
+            for (int i = 0; i < VEC_LEN; i++) values[i] = false;
+            for (uint32_t i : m0.activeLanes()) {
+                if ((int)i <= previous || i >= VEC_LEN) {
+                    ordered = false;
+                    break;
+                }
+                values[i] = true;
+                previous = i;
+            }
+            CHECK_CONDITION(ordered && valuesExact(values, inputA, VEC_LEN), "ACTIVELANES");
+        }
+    }
+};
+
+template<typename MASK_TYPE>
+class genericMaskBitsTest_random<MASK_TYPE, 128> {
+public:
+    static void run()
+    {
+        // do nothing
+    }
+};
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericEXTRACTTest()
 {
@@ -1512,6 +1616,254 @@ void genericMSTORETest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericLOADTAIL_STORETAILTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputB[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+
+    for (int count = 0; count <= VEC_LEN; count++) {
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        VEC_TYPE vec0(inputB);
+
+        for (int i = 0; i < VEC_LEN; i++) output[i] = (i < count) ? inputA[i] : SCALAR_TYPE(0);
+        vec0.loadTail(inputA, count);
+        vec0.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "LOADTAIL");
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            values[i] = inputB[i];
+            output[i] = (i < count) ? inputA[i] : inputB[i];
+        }
+        vec0.load(inputA);
+        vec0.storeTail(values, count);
+        inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "STORETAIL");
+    }
+}
+// Masked and tail loads/stores of a buffer ending exactly at a page boundary.
+// The following page is inaccessible, so touching memory of inactive
+// elements faults.
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMLOAD_MSTOREPageBoundaryTest_random()
+{
+#if defined(__linux__)
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    long pageSize = sysconf(_SC_PAGESIZE);
+    char * base = (char *)mmap(NULL, 2 * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) return;
+    if (mprotect(base + pageSize, pageSize, PROT_NONE) != 0) {
+        munmap(base, 2 * pageSize);
+        return;
+    }
+    SCALAR_TYPE * end = (SCALAR_TYPE *)(base + pageSize);
+
+    for (int count = 0; count <= VEC_LEN; count++) {
+        SCALAR_TYPE * p = end - count;
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        bool inputMask[VEC_LEN];
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            inputMask[i] = (i < count) && randomValue<bool>(gen);
+        }
+        for (int i = 0; i < count; i++) p[i] = randomValue<SCALAR_TYPE>(gen);
+
+        {
+            VEC_TYPE vec0(inputA);
+            MASK_TYPE mask(inputMask);
+
+            for (int i = 0; i < VEC_LEN; i++) output[i] = inputMask[i] ? p[i] : inputA[i];
+            vec0.load(mask, p);
+            vec0.store(values);
+            bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION((inRange), "MLOAD page boundary");
+        }
+        {
+            VEC_TYPE vec0(inputA);
+
+            for (int i = 0; i < VEC_LEN; i++) output[i] = (i < count) ? p[i] : SCALAR_TYPE(0);
+            vec0.loadTail(p, count);
+            vec0.store(values);
+            bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION((inRange), "LOADTAIL page boundary");
+        }
+        {
+            VEC_TYPE vec0(inputA);
+            MASK_TYPE mask(inputMask);
+
+            for (int i = 0; i < count; i++) output[i] = inputMask[i] ? inputA[i] : p[i];
+            vec0.store(mask, p);
+            bool inRange = valuesInRange(p, output, count, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION((inRange), "MSTORE page boundary");
+        }
+        {
+            VEC_TYPE vec0(inputA);
+
+            vec0.storeTail(p, count);
+            bool inRange = valuesInRange(p, inputA, count, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION((inRange), "STORETAIL page boundary");
+        }
+    }
+    munmap(base, 2 * pageSize);
+#endif
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericCOMPRESS_EXPANDTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputB[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+
+    // Random mask, then no element and all elements selected.
+    for (int k = 0; k < 3; k++) {
+        bool inputMask[VEC_LEN];
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputMask[i] = (k == 0) ? randomValue<bool>(gen) : (k == 2);
+        }
+
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        uint32_t expectedCount = 0;
+        for (int i = 0; i < VEC_LEN; i++) {
+            if (inputMask[i] == true) output[expectedCount++] = inputA[i];
+        }
+        for (int i = expectedCount; i < VEC_LEN; i++) output[i] = SCALAR_TYPE(0);
+
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.compress(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "COMPRESS");
+
+        // Elements past the returned count are not written.
+        for (int i = 0; i < VEC_LEN; i++) {
+            values[i] = inputB[i];
+            if (i >= (int)expectedCount) output[i] = inputB[i];
+        }
+        uint32_t count = vec0.compressStore(mask, values);
+        inRange = (count == expectedCount) && valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "COMPRESSSTORE");
+
+        for (int i = 0, j = 0; i < VEC_LEN; i++) {
+            output[i] = (inputMask[i] == true) ? inputA[j++] : inputB[i];
+        }
+        VEC_TYPE vec2(inputB);
+        count = vec2.expand(mask, inputA);
+        vec2.store(values);
+        inRange = (count == expectedCount) && valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "EXPAND");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericLOADINTERLEAVED_STOREINTERLEAVEDTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE input[4 * VEC_LEN];
+    for (int i = 0; i < 4 * VEC_LEN; i++) {
+        input[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+
+    for (int K = 2; K <= 4; K++) {
+        SCALAR_TYPE values[4][VEC_LEN];
+        SCALAR_TYPE output[4][VEC_LEN];
+        SCALAR_TYPE stored[4 * VEC_LEN];
+        VEC_TYPE vec[4];
+
+        for (int j = 0; j < K; j++) {
+            for (int i = 0; i < VEC_LEN; i++) output[j][i] = input[K*i + j];
+        }
+        if (K == 2) VEC_TYPE::loadInterleaved(input, vec[0], vec[1]);
+        else if (K == 3) VEC_TYPE::loadInterleaved(input, vec[0], vec[1], vec[2]);
+        else VEC_TYPE::loadInterleaved(input, vec[0], vec[1], vec[2], vec[3]);
+        bool inRange = true;
+        for (int j = 0; j < K; j++) {
+            vec[j].store(values[j]);
+            inRange = inRange && valuesInRange(values[j], output[j], VEC_LEN, SCALAR_TYPE(0.01f));
+        }
+        CHECK_CONDITION((inRange), "LOADINTERLEAVED");
+
+        for (int i = 0; i < 4 * VEC_LEN; i++) stored[i] = SCALAR_TYPE(0);
+        if (K == 2) VEC_TYPE::storeInterleaved(stored, vec[0], vec[1]);
+        else if (K == 3) VEC_TYPE::storeInterleaved(stored, vec[0], vec[1], vec[2]);
+        else VEC_TYPE::storeInterleaved(stored, vec[0], vec[1], vec[2], vec[3]);
+        inRange = valuesInRange(stored, input, K * VEC_LEN, SCALAR_TYPE(0.01f));
+        for (int i = K * VEC_LEN; i < 4 * VEC_LEN; i++) inRange = inRange && (stored[i] == SCALAR_TYPE(0));
+        CHECK_CONDITION((inRange), "STOREINTERLEAVED");
+    }
+}
+
+// Calls VEC_TYPE::transpose() with the VEC_LEN elements of an array of vectors as arguments.
+template<int COUNT, typename VEC_TYPE, typename... ARGS>
+struct TransposeCaller {
+    static void call(VEC_TYPE * v, ARGS & ... args) {
+        TransposeCaller<COUNT - 1, VEC_TYPE, ARGS..., VEC_TYPE>::call(v, args..., v[sizeof...(ARGS)]);
+    }
+};
+
+template<typename VEC_TYPE, typename... ARGS>
+struct TransposeCaller<0, VEC_TYPE, ARGS...> {
+    static void call(VEC_TYPE *, ARGS & ... args) {
+        VEC_TYPE::transpose(args...);
+    }
+};
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericTRANSPOSETest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE input[VEC_LEN][VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN][VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN][VEC_LEN];
+    VEC_TYPE vec[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        for (int j = 0; j < VEC_LEN; j++) {
+            input[i][j] = randomValue<SCALAR_TYPE>(gen);
+        }
+    }
+    for (int i = 0; i < VEC_LEN; i++) {
+        for (int j = 0; j < VEC_LEN; j++) output[i][j] = input[j][i];
+        vec[i].load(input[i]);
+    }
+
+    TransposeCaller<VEC_LEN, VEC_TYPE>::call(vec);
+    bool inRange = true;
+    for (int i = 0; i < VEC_LEN; i++) {
+        vec[i].store(values[i]);
+        inRange = inRange && valuesInRange(values[i], output[i], VEC_LEN, SCALAR_TYPE(0.01f));
+    }
+    CHECK_CONDITION((inRange), "TRANSPOSE");
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericLOADA_STOREATest()
 {
@@ -3127,6 +3479,70 @@ void genericMULVATest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMULSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB = randomValue<SCALAR_TYPE>(gen);
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE outputMasked[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        // Products of full range operands wrap around. Compute them with
+        // unsigned arithmetic to avoid signed overflow in the reference.
+        output[i] = SCALAR_TYPE(uint64_t(inputA[i]) * uint64_t(inputB));
+        outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.mul(inputB);
+        vec1.store(values);
+        bool exact = valuesExact(values, output, VEC_LEN);
+        CHECK_CONDITION(exact, "MULS gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0 * inputB;
+        vec1.store(values);
+        bool exact = valuesExact(values, output, VEC_LEN);
+        CHECK_CONDITION(exact, "MULS(operator*) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.mul(mask, inputB);
+        vec1.store(values);
+        bool exact = valuesExact(values, outputMasked, VEC_LEN);
+        CHECK_CONDITION(exact, "MMULS gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        vec0.mula(inputB);
+        vec0.store(values);
+        bool exact = valuesExact(values, output, VEC_LEN);
+        CHECK_CONDITION(exact, "MULSA gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        vec0.mula(mask, inputB);
+        vec0.store(values);
+        bool exact = valuesExact(values, outputMasked, VEC_LEN);
+        CHECK_CONDITION(exact, "MMULSA gen");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
 void genericMMULVATest()
 {
@@ -3460,33 +3876,145 @@ void genericMDIVSATest()
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericREMVTest_random()
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericDIVSTest_random()
 {
     std::random_device rd;
     std::mt19937 gen(rd());
 
-    SCALAR_TYPE inputA[VEC_LEN];
-    SCALAR_TYPE inputB[VEC_LEN];
-    SCALAR_TYPE output[VEC_LEN];
+    const SCALAR_TYPE minValue = std::numeric_limits<SCALAR_TYPE>::min();
+    const SCALAR_TYPE maxValue = std::numeric_limits<SCALAR_TYPE>::max();
+    // Edge cases for division by a precomputed reciprocal: trivial divisors, powers
+    // of two, and divisors with the most significant bit set. Zero (the minimum of
+    // unsigned types) is skipped.
+    SCALAR_TYPE divisors[] = {
+        randomValue<SCALAR_TYPE>(gen),
+        SCALAR_TYPE(1),
+        SCALAR_TYPE(2),
+        SCALAR_TYPE(7),
+        SCALAR_TYPE(SCALAR_TYPE(1) << (sizeof(SCALAR_TYPE) * 8 - 2)),
+        maxValue,
+        minValue,
+        SCALAR_TYPE(-1),
+        SCALAR_TYPE(-3)
+    };
+
+    for (SCALAR_TYPE inputB : divisors) {
+        if (inputB == SCALAR_TYPE(0)) continue;
 
-    for (int i = 0; i < VEC_LEN; i++) {
-        // C++ standard says:
-        // "The binary / operator yields the quotient, and the binary % operator 
-        //  yields the remainder from the division of the first expression by the
-        //  second. If the second operand of / or % is zero the behavior is undefined. 
-        //  For integral operands the / operator yields the algebraic quotient with any 
-        //  fractional part discarded; if the quotient a/b is representable in the type 
-        //  of the result, (a/b)*b + a%b is equal to a."
-        // And also:
-        // "If both operands are nonnegative then the remainder is nonnegative; 
-        //  if not, the sign of the remainder is implementation-defined."
-        // This means we can only check this operation for non-negative left operand
-        // and positive, non-zero right operand.
-        do {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        SCALAR_TYPE outputMasked[VEC_LEN];
+        bool inputMask[VEC_LEN];
+
+        for (int i = 0; i < VEC_LEN; i++) {
             inputA[i] = randomValue<SCALAR_TYPE>(gen);
-        } while (inputA[i] < 0);
-        do {
+            inputMask[i] = randomValue<bool>(gen);
+        }
+        inputA[0] = maxValue;
+        inputA[VEC_LEN - 1] = minValue;
+        for (int i = 0; i < VEC_LEN; i++) {
+            // The quotient of the minimum signed value and -1 is not representable.
+            if (std::numeric_limits<SCALAR_TYPE>::is_signed && inputA[i] == minValue && inputB == SCALAR_TYPE(-1)) {
+                inputA[i] = SCALAR_TYPE(minValue + 1);
+            }
+            output[i] = SCALAR_TYPE(inputA[i] / inputB);
+            outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1 = vec0.div(inputB);
+            vec1.store(values);
+            bool exact = valuesExact(values, output, VEC_LEN);
+            CHECK_CONDITION(exact, "DIVS gen");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1 = vec0 / inputB;
+            vec1.store(values);
+            bool exact = valuesExact(values, output, VEC_LEN);
+            CHECK_CONDITION(exact, "DIVS(operator/) gen");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            MASK_TYPE mask(inputMask);
+            VEC_TYPE vec1 = vec0.div(mask, inputB);
+            vec1.store(values);
+            bool exact = valuesExact(values, outputMasked, VEC_LEN);
+            CHECK_CONDITION(exact, "MDIVS gen");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            vec0.diva(inputB);
+            vec0.store(values);
+            bool exact = valuesExact(values, output, VEC_LEN);
+            CHECK_CONDITION(exact, "DIVSA gen");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            vec0 /= inputB;
+            vec0.store(values);
+            bool exact = valuesExact(values, output, VEC_LEN);
+            CHECK_CONDITION(exact, "DIVSA(operator/=) gen");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            MASK_TYPE mask(inputMask);
+            vec0.diva(mask, inputB);
+            vec0.store(values);
+            bool exact = valuesExact(values, outputMasked, VEC_LEN);
+            CHECK_CONDITION(exact, "MDIVSA gen");
+        }
+        {
+            // One divisor applied to several vectors.
+            SCALAR_TYPE values[VEC_LEN];
+            UME::SIMD::FUNCTIONS::Divisor<VEC_TYPE> divisor(inputB);
+            VEC_TYPE vec0(inputA);
+            MASK_TYPE mask(inputMask);
+            VEC_TYPE vec1 = divisor.divide(vec0);
+            vec1.store(values);
+            bool exact = valuesExact(values, output, VEC_LEN);
+            VEC_TYPE vec2 = divisor.divide(mask, vec0);
+            vec2.store(values);
+            exact &= valuesExact(values, outputMasked, VEC_LEN);
+            CHECK_CONDITION(exact, "Divisor gen");
+        }
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericREMVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        // C++ standard says:
+        // "The binary / operator yields the quotient, and the binary % operator 
+        //  yields the remainder from the division of the first expression by the
+        //  second. If the second operand of / or % is zero the behavior is undefined. 
+        //  For integral operands the / operator yields the algebraic quotient with any 
+        //  fractional part discarded; if the quotient a/b is representable in the type 
+        //  of the result, (a/b)*b + a%b is equal to a."
+        // And also:
+        // "If both operands are nonnegative then the remainder is nonnegative; 
+        //  if not, the sign of the remainder is implementation-defined."
+        // This means we can only check this operation for non-negative left operand
+        // and positive, non-zero right operand.
+        do {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        } while (inputA[i] < 0);
+        do {
             inputB[i] = randomValue<SCALAR_TYPE>(gen);
         } while (inputB[i] <= 0);
         output[i] = inputA[i] % inputB[i];
@@ -6095,162 +6623,535 @@ void genericSORTDTest_random()
     }
 }
 
-        //(Reduction to scalar operations)
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
-void genericHADDTest()
+// Checks that 'values' are sorted, and that each payload element is the index
+// of its key in 'input'.
+template<typename SCALAR_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN>
+bool sortedWithPayload(SCALAR_TYPE const * input, SCALAR_TYPE const * values, UINT_SCALAR_TYPE const * payload, bool descending)
 {
-    {
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        SCALAR_TYPE value = vec0.hadd();
-        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-        CHECK_CONDITION(inRange, "HADD");
-    }
-    {
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0);
-        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-        CHECK_CONDITION(inRange, "HADD(function)");
+    bool used[VEC_LEN] = { false };
+    for (int i = 0; i < VEC_LEN; i++) {
+        if (i > 0 && (descending ? values[i - 1] < values[i] : values[i] < values[i - 1])) return false;
+        if (int(payload[i]) >= VEC_LEN || used[payload[i]]) return false;
+        if (!(input[payload[i]] == values[i])) return false;
+        used[payload[i]] = true;
     }
+    return true;
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericHADDTest_random()
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN>
+void genericSORTAKVTest_random()
 {
-
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
     {
-        SCALAR_TYPE inputA[VEC_LEN];
-        SCALAR_TYPE output = SCALAR_TYPE(0);
+        VEC_TYPE t0, t1;
+        UINT_VEC_TYPE t2;
+        SCALAR_TYPE input[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        UINT_SCALAR_TYPE indices[VEC_LEN];
+        UINT_SCALAR_TYPE payload[VEC_LEN];
 
-        for (int i = 0; i < VEC_LEN; i++) {
-            inputA[i] = randomValue<SCALAR_TYPE>(gen);
-            output += inputA[i];
-        }
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
         {
-            VEC_TYPE vec0(inputA);
-            SCALAR_TYPE value = vec0.hadd();
-            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-            CHECK_CONDITION(inRange, "HADD gen");
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = randomValue<SCALAR_TYPE>(gen);
+                indices[i] = UINT_SCALAR_TYPE(i);
+            }
+            // Repeat some of the keys
+            if (test % 2 == 1) {
+                for (int i = 1; i < VEC_LEN; i += 3) input[i] = input[i / 2];
+            }
+
+            t0.load(input);
+            t2.load(indices);
+            t1 = t0.sorta(t2);
+            t1.store(values);
+            t2.store(payload);
+
+            inRange &= sortedWithPayload<SCALAR_TYPE, UINT_SCALAR_TYPE, VEC_LEN>(input, values, payload, false);
         }
+        CHECK_CONDITION(inRange, "SORTAKV");
     }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN>
+void genericSORTDKVTest_random()
+{
     {
-        SCALAR_TYPE inputA[VEC_LEN];
-        SCALAR_TYPE output = SCALAR_TYPE(0);
+        VEC_TYPE t0, t1;
+        UINT_VEC_TYPE t2;
+        SCALAR_TYPE input[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        UINT_SCALAR_TYPE indices[VEC_LEN];
+        UINT_SCALAR_TYPE payload[VEC_LEN];
 
-        for (int i = 0; i < VEC_LEN; i++) {
-            inputA[i] = randomValue<SCALAR_TYPE>(gen);
-            output += inputA[i];
-        }
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
         {
-            VEC_TYPE vec0(inputA);
-            SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0);
-            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-            CHECK_CONDITION(inRange, "HADD(function) gen");
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = randomValue<SCALAR_TYPE>(gen);
+                indices[i] = UINT_SCALAR_TYPE(i);
+            }
+            // Repeat some of the keys
+            if (test % 2 == 1) {
+                for (int i = 1; i < VEC_LEN; i += 3) input[i] = input[i / 2];
+            }
+
+            t0.load(input);
+            t2.load(indices);
+            t1 = t0.sortd(t2);
+            t1.store(values);
+            t2.store(payload);
+
+            inRange &= sortedWithPayload<SCALAR_TYPE, UINT_SCALAR_TYPE, VEC_LEN>(input, values, payload, true);
         }
+        CHECK_CONDITION(inRange, "SORTDKV");
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
-void genericMHADDTest_random()
+// Payload of the same type as the keys: plugins with a native uint32 payload
+// sort still have to accept other payload types.
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericSORTKVTest_vectorPayload()
 {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
     {
-        SCALAR_TYPE inputA[VEC_LEN];
-        bool inputMask[VEC_LEN];
-        SCALAR_TYPE output = SCALAR_TYPE(0);
+        VEC_TYPE t0, t1, t2;
+        SCALAR_TYPE input[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE indices[VEC_LEN];
+        SCALAR_TYPE payload[VEC_LEN];
+        uint32_t payloadIndices[VEC_LEN];
 
-        for (int i = 0; i < VEC_LEN; i++) {
-            inputA[i] = randomValue<SCALAR_TYPE>(gen);
-            inputMask[i] = randomValue<bool>(gen);
-            if(inputMask[i] == true) output += inputA[i];
-        }
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRangeA = true;
+        bool inRangeD = true;
+
+        for (int test = 0; test < 100; test++)
         {
-            VEC_TYPE vec0(inputA);
-            MASK_TYPE mask(inputMask);
-            SCALAR_TYPE value = vec0.hadd(mask);
-            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-            CHECK_CONDITION(inRange, "MHADD gen");
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = randomValue<SCALAR_TYPE>(gen);
+                indices[i] = SCALAR_TYPE(i);
+            }
+
+            t0.load(input);
+            t2.load(indices);
+            t1 = t0.sorta(t2);
+            t1.store(values);
+            t2.store(payload);
+            for (int i = 0; i < VEC_LEN; i++) payloadIndices[i] = uint32_t(payload[i]);
+            inRangeA &= sortedWithPayload<SCALAR_TYPE, uint32_t, VEC_LEN>(input, values, payloadIndices, false);
+
+            t2.load(indices);
+            t1 = t0.sortd(t2);
+            t1.store(values);
+            t2.store(payload);
+            for (int i = 0; i < VEC_LEN; i++) payloadIndices[i] = uint32_t(payload[i]);
+            inRangeD &= sortedWithPayload<SCALAR_TYPE, uint32_t, VEC_LEN>(input, values, payloadIndices, true);
         }
+        CHECK_CONDITION(inRangeA, "SORTAKV vector payload");
+        CHECK_CONDITION(inRangeD, "SORTDKV vector payload");
     }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericCONFLICTTest_random()
+{
     {
-        SCALAR_TYPE inputA[VEC_LEN];
-        bool inputMask[VEC_LEN];
-        SCALAR_TYPE output = SCALAR_TYPE(0);
+        VEC_TYPE t0, t1;
+        SCALAR_TYPE input[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
 
-        for (int i = 0; i < VEC_LEN; i++) {
-            inputA[i] = randomValue<SCALAR_TYPE>(gen);
-            inputMask[i] = randomValue<bool>(gen);
-            if(inputMask[i] == true) output += inputA[i];
-        }
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
         {
-            VEC_TYPE vec0(inputA);
-            MASK_TYPE mask(inputMask);
-            SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(mask, vec0);
-            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-            CHECK_CONDITION(inRange, "MHADD(function) gen");
+            // Narrow the range of values so that repeated elements are likely
+            SCALAR_TYPE range = SCALAR_TYPE(1 + test % VEC_LEN);
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = SCALAR_TYPE(randomValue<SCALAR_TYPE>(gen) % range);
+            }
+            for (int i = 0; i < VEC_LEN; i++) {
+                output[i] = 0;
+                for (int j = 0; j < i; j++) {
+                    if (input[j] == input[i]) output[i] |= SCALAR_TYPE(SCALAR_TYPE(1) << j);
+                }
+            }
+
+            t0.load(input);
+            t1 = t0.conflict();
+            t1.store(values);
+
+            inRange &= valuesExact(values, output, VEC_LEN);
         }
+        CHECK_CONDITION(inRange, "CONFLICT");
     }
 }
 
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericHADDSTest_random()
+void genericLOOKUPTest_random()
 {
-
     std::random_device rd;
     std::mt19937 gen(rd());
 
-    {
-        SCALAR_TYPE inputA[VEC_LEN];
-        SCALAR_TYPE scalarA = randomValue<SCALAR_TYPE>(gen);
-        SCALAR_TYPE output = scalarA;
+    SCALAR_TYPE table[32];
+    SCALAR_TYPE indices[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
 
-        for (int i = 0; i < VEC_LEN; i++) {
-            inputA[i] = randomValue<SCALAR_TYPE>(gen);
-            output += inputA[i];
-        }
-        {
-            VEC_TYPE vec0(inputA);
-            SCALAR_TYPE value = vec0.hadd(scalarA);
-            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-            CHECK_CONDITION(inRange, "HADDS gen");
-        }
+    for (int i = 0; i < 32; i++) {
+        table[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+    // Indices are not reduced to the table length: the upper bits are ignored.
+    for (int i = 0; i < VEC_LEN; i++) {
+        indices[i] = randomValue<SCALAR_TYPE>(gen);
     }
-    {
-        SCALAR_TYPE inputA[VEC_LEN];
-        SCALAR_TYPE scalarA = randomValue<SCALAR_TYPE>(gen);
-        SCALAR_TYPE output = scalarA;
 
-        for (int i = 0; i < VEC_LEN; i++) {
-            inputA[i] = randomValue<SCALAR_TYPE>(gen);
-            output += inputA[i];
-        }
-        {
-            VEC_TYPE vec0(inputA);
-            SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0, scalarA);
-            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-            CHECK_CONDITION(inRange, "HADDS(function) gen");
-        }
+    VEC_TYPE vec0(indices);
+    {
+        for (int i = 0; i < VEC_LEN; i++) output[i] = table[indices[i] & 15];
+        VEC_TYPE vec1 = vec0.lookup16(table);
+        vec1.store(values);
+        CHECK_CONDITION(valuesExact(values, output, VEC_LEN), "LOOKUP16");
+    }
+    {
+        for (int i = 0; i < VEC_LEN; i++) output[i] = table[indices[i] & 31];
+        VEC_TYPE vec1 = vec0.lookup32(table);
+        vec1.store(values);
+        CHECK_CONDITION(valuesExact(values, output, VEC_LEN), "LOOKUP32");
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
-void genericMHADDSTest_random()
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN>
+void genericSCATTERADDTest_random()
 {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
     {
-        SCALAR_TYPE inputA[VEC_LEN];
-        bool inputMask[VEC_LEN];
-        SCALAR_TYPE scalarA = randomValue<SCALAR_TYPE>(gen);
-        SCALAR_TYPE output = scalarA;
+        VEC_TYPE t0;
+        UINT_VEC_TYPE t1;
+        SCALAR_TYPE input[VEC_LEN];
+        UINT_SCALAR_TYPE indices[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
 
-        for (int i = 0; i < VEC_LEN; i++) {
-            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
+        {
+            // Narrow the range of indices so that repeated indices are likely
+            UINT_SCALAR_TYPE range = UINT_SCALAR_TYPE(1 + test % VEC_LEN);
+            for (int i = 0; i < VEC_LEN; i++) {
+                // Scale down so that the sums of up to 64 elements do not overflow
+                input[i] = SCALAR_TYPE(randomValue<SCALAR_TYPE>(gen) / SCALAR_TYPE(64));
+                indices[i] = UINT_SCALAR_TYPE(randomValue<UINT_SCALAR_TYPE>(gen) % range);
+                values[i] = SCALAR_TYPE(randomValue<SCALAR_TYPE>(gen) / SCALAR_TYPE(64));
+                output[i] = values[i];
+            }
+            for (int i = 0; i < VEC_LEN; i++) {
+                output[indices[i]] = SCALAR_TYPE(output[indices[i]] + input[i]);
+            }
+
+            t0.load(input);
+            t1.load(indices);
+            UME::SIMD::FUNCTIONS::scatterAdd(values, t1, t0);
+
+            inRange &= valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        }
+        CHECK_CONDITION(inRange, "SCATTERADDV");
+    }
+    {
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::MASK_T MASK_TYPE;
+        VEC_TYPE t0;
+        UINT_VEC_TYPE t1;
+        SCALAR_TYPE input[VEC_LEN];
+        UINT_SCALAR_TYPE indices[VEC_LEN];
+        bool inputMask[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
+        {
+            UINT_SCALAR_TYPE range = UINT_SCALAR_TYPE(1 + test % VEC_LEN);
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = SCALAR_TYPE(randomValue<SCALAR_TYPE>(gen) / SCALAR_TYPE(64));
+                inputMask[i] = randomValue<bool>(gen);
+                // Inactive elements point past the end of 'values'
+                indices[i] = inputMask[i] ? UINT_SCALAR_TYPE(randomValue<UINT_SCALAR_TYPE>(gen) % range) : UINT_SCALAR_TYPE(~UINT_SCALAR_TYPE(0));
+                values[i] = SCALAR_TYPE(randomValue<SCALAR_TYPE>(gen) / SCALAR_TYPE(64));
+                output[i] = values[i];
+            }
+            for (int i = 0; i < VEC_LEN; i++) {
+                if (inputMask[i]) output[indices[i]] = SCALAR_TYPE(output[indices[i]] + input[i]);
+            }
+
+            t0.load(input);
+            t1.load(indices);
+            MASK_TYPE mask(inputMask);
+            UME::SIMD::FUNCTIONS::scatterAdd(mask, values, t1, t0);
+
+            inRange &= valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        }
+        CHECK_CONDITION(inRange, "MSCATTERADDV");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericSCATTERINCTest_random()
+{
+    {
+        VEC_TYPE t0;
+        SCALAR_TYPE indices[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
+        {
+            SCALAR_TYPE range = SCALAR_TYPE(1 + test % VEC_LEN);
+            for (int i = 0; i < VEC_LEN; i++) {
+                indices[i] = SCALAR_TYPE(randomValue<SCALAR_TYPE>(gen) % range);
+                values[i] = 0;
+                output[i] = 0;
+            }
+            for (int i = 0; i < VEC_LEN; i++) {
+                output[indices[i]]++;
+            }
+
+            t0.load(indices);
+            UME::SIMD::FUNCTIONS::scatterInc(values, t0);
+
+            inRange &= valuesExact(values, output, VEC_LEN);
+        }
+        CHECK_CONDITION(inRange, "SCATTERINCV");
+    }
+    {
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::MASK_T MASK_TYPE;
+        VEC_TYPE t0;
+        SCALAR_TYPE indices[VEC_LEN];
+        bool inputMask[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
+        {
+            SCALAR_TYPE range = SCALAR_TYPE(1 + test % VEC_LEN);
+            // Tail mask, as used for the remainder of a loop
+            int count = test % (VEC_LEN + 1);
+            for (int i = 0; i < VEC_LEN; i++) {
+                inputMask[i] = i < count;
+                indices[i] = inputMask[i] ? SCALAR_TYPE(randomValue<SCALAR_TYPE>(gen) % range) : SCALAR_TYPE(0);
+                values[i] = 0;
+                output[i] = 0;
+            }
+            for (int i = 0; i < count; i++) {
+                output[indices[i]]++;
+            }
+
+            t0.load(indices);
+            MASK_TYPE mask(inputMask);
+            UME::SIMD::FUNCTIONS::scatterInc(mask, values, t0);
+
+            inRange &= valuesExact(values, output, VEC_LEN);
+        }
+        CHECK_CONDITION(inRange, "MSCATTERINCV");
+    }
+}
+
+// CONFLICT is only defined when every element has a bit for each lane.
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN,
+         bool HAS_CONFLICT = (VEC_LEN <= 8 * sizeof(UINT_SCALAR_TYPE))>
+struct genericConflictTests {
+    static void scatterAdd() {
+        genericSCATTERADDTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>();
+    }
+    static void conflict() {
+        genericCONFLICTTest_random<UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>();
+        genericSCATTERINCTest_random<UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>();
+    }
+};
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN>
+struct genericConflictTests<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN, false> {
+    static void scatterAdd() {}
+    static void conflict() {}
+};
+
+        //(Reduction to scalar operations)
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
+void genericHADDTest()
+{
+    {
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        SCALAR_TYPE value = vec0.hadd();
+        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+        CHECK_CONDITION(inRange, "HADD");
+    }
+    {
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0);
+        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+        CHECK_CONDITION(inRange, "HADD(function)");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericHADDTest_random()
+{
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE output = SCALAR_TYPE(0);
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            output += inputA[i];
+        }
+        {
+            VEC_TYPE vec0(inputA);
+            SCALAR_TYPE value = vec0.hadd();
+            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+            CHECK_CONDITION(inRange, "HADD gen");
+        }
+    }
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE output = SCALAR_TYPE(0);
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            output += inputA[i];
+        }
+        {
+            VEC_TYPE vec0(inputA);
+            SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0);
+            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+            CHECK_CONDITION(inRange, "HADD(function) gen");
+        }
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMHADDTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        bool inputMask[VEC_LEN];
+        SCALAR_TYPE output = SCALAR_TYPE(0);
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            inputMask[i] = randomValue<bool>(gen);
+            if(inputMask[i] == true) output += inputA[i];
+        }
+        {
+            VEC_TYPE vec0(inputA);
+            MASK_TYPE mask(inputMask);
+            SCALAR_TYPE value = vec0.hadd(mask);
+            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+            CHECK_CONDITION(inRange, "MHADD gen");
+        }
+    }
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        bool inputMask[VEC_LEN];
+        SCALAR_TYPE output = SCALAR_TYPE(0);
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            inputMask[i] = randomValue<bool>(gen);
+            if(inputMask[i] == true) output += inputA[i];
+        }
+        {
+            VEC_TYPE vec0(inputA);
+            MASK_TYPE mask(inputMask);
+            SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(mask, vec0);
+            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+            CHECK_CONDITION(inRange, "MHADD(function) gen");
+        }
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericHADDSTest_random()
+{
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE scalarA = randomValue<SCALAR_TYPE>(gen);
+        SCALAR_TYPE output = scalarA;
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            output += inputA[i];
+        }
+        {
+            VEC_TYPE vec0(inputA);
+            SCALAR_TYPE value = vec0.hadd(scalarA);
+            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+            CHECK_CONDITION(inRange, "HADDS gen");
+        }
+    }
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE scalarA = randomValue<SCALAR_TYPE>(gen);
+        SCALAR_TYPE output = scalarA;
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            output += inputA[i];
+        }
+        {
+            VEC_TYPE vec0(inputA);
+            SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0, scalarA);
+            bool inRange = valueInRange(value, output, SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+            CHECK_CONDITION(inRange, "HADDS(function) gen");
+        }
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMHADDSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        bool inputMask[VEC_LEN];
+        SCALAR_TYPE scalarA = randomValue<SCALAR_TYPE>(gen);
+        SCALAR_TYPE output = scalarA;
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
             inputMask[i] = randomValue<bool>(gen);
             if(inputMask[i] == true) output += inputA[i];
         }
@@ -6846,16 +7747,67 @@ void genericMGATHERVTest_random()
     CHECK_CONDITION(inRange, "MGATHERV");
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericSCATTERUTest_random()
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename SCALAR_UINT_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericPERMUTEVTest_random()
 {
     std::random_device rd;
     std::mt19937 gen(rd());
 
-    uint32_t stride;
-    alignas(VEC_TYPE::alignment()) SCALAR_TYPE inputA[VEC_LEN * 100];
-    alignas(VEC_TYPE::alignment()) SCALAR_TYPE inputB[VEC_LEN];
-    alignas(VEC_TYPE::alignment()) SCALAR_TYPE output[VEC_LEN * 100];
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_UINT_TYPE indices[VEC_LEN];
+    bool inputMask[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
+
+    // Indices are not reduced to the vector length: the upper bits are ignored.
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputB[i] = randomValue<SCALAR_TYPE>(gen);
+        indices[i] = randomValue<SCALAR_UINT_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+    }
+
+    VEC_TYPE vec0(inputA);
+    VEC_TYPE vec1(inputB);
+    UINT_VEC_TYPE vec2(indices);
+    MASK_TYPE mask(inputMask);
+    {
+        for (int i = 0; i < VEC_LEN; i++) output[i] = inputA[indices[i] & (VEC_LEN - 1)];
+        VEC_TYPE vec3 = vec0.permute(vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "PERMUTEV");
+    }
+    {
+        for (int i = 0; i < VEC_LEN; i++) output[i] = inputMask[i] ? inputA[indices[i] & (VEC_LEN - 1)] : inputA[i];
+        VEC_TYPE vec3 = vec0.permute(mask, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "MPERMUTEV");
+    }
+    {
+        for (int i = 0; i < VEC_LEN; i++) {
+            uint32_t t0 = uint32_t(indices[i] & (2 * VEC_LEN - 1));
+            output[i] = (t0 < VEC_LEN) ? inputA[t0] : inputB[t0 - VEC_LEN];
+        }
+        VEC_TYPE vec3 = vec0.permute2(vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "PERMUTE2V");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericSCATTERUTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    uint32_t stride;
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE inputA[VEC_LEN * 100];
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE inputB[VEC_LEN];
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE output[VEC_LEN * 100];
 
     for (int i = 0; i < VEC_LEN * 100; i++) {
         inputA[i] = randomValue<SCALAR_TYPE>(gen);
@@ -7322,6 +8274,270 @@ void genericMFSUBMULVTest()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericFNMADDVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.5), SCALAR_TYPE(2));
+    std::uniform_real_distribution<SCALAR_TYPE> distC(SCALAR_TYPE(8), SCALAR_TYPE(16));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE inputC[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distA(gen);
+        inputC[i] = distC(gen);
+        output[i] = -(inputA[i] * inputB[i]) + inputC[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        VEC_TYPE vec3 = vec0.fnmadd(vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "FNMADDV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        VEC_TYPE vec3 = UME::SIMD::FUNCTIONS::fnmadd(vec0, vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "FNMADDV(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMFNMADDVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.5), SCALAR_TYPE(2));
+    std::uniform_real_distribution<SCALAR_TYPE> distC(SCALAR_TYPE(8), SCALAR_TYPE(16));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE inputC[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distA(gen);
+        inputC[i] = distC(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? (-(inputA[i] * inputB[i]) + inputC[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec3 = vec0.fnmadd(mask, vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "MFNMADDV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec3 = UME::SIMD::FUNCTIONS::fnmadd(mask, vec0, vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "MFNMADDV(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericFNMSUBVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.5), SCALAR_TYPE(2));
+    std::uniform_real_distribution<SCALAR_TYPE> distC(SCALAR_TYPE(8), SCALAR_TYPE(16));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE inputC[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distA(gen);
+        inputC[i] = distC(gen);
+        output[i] = -(inputA[i] * inputB[i]) - inputC[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        VEC_TYPE vec3 = vec0.fnmsub(vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "FNMSUBV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        VEC_TYPE vec3 = UME::SIMD::FUNCTIONS::fnmsub(vec0, vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "FNMSUBV(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMFNMSUBVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.5), SCALAR_TYPE(2));
+    std::uniform_real_distribution<SCALAR_TYPE> distC(SCALAR_TYPE(8), SCALAR_TYPE(16));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE inputC[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distA(gen);
+        inputC[i] = distC(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? (-(inputA[i] * inputB[i]) - inputC[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec3 = vec0.fnmsub(mask, vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "MFNMSUBV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2(inputC);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec3 = UME::SIMD::FUNCTIONS::fnmsub(mask, vec0, vec1, vec2);
+        vec3.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange && isUnmodified), "MFNMSUBV(function) gen");
+    }
+}
+
+// With hardware FMA the fused operations are rounded once: x*x - round(x*x)
+// then yields the rounding error of the product instead of zero.
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericFMAExactTest_random()
+{
+#if defined(__FMA__)
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.5), SCALAR_TYPE(2));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE product[VEC_LEN];
+    SCALAR_TYPE negProduct[VEC_LEN];
+    SCALAR_TYPE error[VEC_LEN];
+    SCALAR_TYPE negError[VEC_LEN];
+    SCALAR_TYPE maskedError[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        product[i] = inputA[i] * inputA[i];
+        negProduct[i] = -product[i];
+        error[i] = std::fma(inputA[i], inputA[i], negProduct[i]);
+        negError[i] = std::fma(-inputA[i], inputA[i], product[i]);
+        inputMask[i] = randomValue<bool>(gen);
+        maskedError[i] = inputMask[i] ? error[i] : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(negProduct);
+        VEC_TYPE vec2 = vec0.fmuladd(vec0, vec1);
+        vec2.store(values);
+        CHECK_CONDITION(valuesExact(values, error, VEC_LEN), "FMULADDV exact");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(product);
+        VEC_TYPE vec2 = vec0.fmulsub(vec0, vec1);
+        vec2.store(values);
+        CHECK_CONDITION(valuesExact(values, error, VEC_LEN), "FMULSUBV exact");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(product);
+        VEC_TYPE vec2 = vec0.fnmadd(vec0, vec1);
+        vec2.store(values);
+        CHECK_CONDITION(valuesExact(values, negError, VEC_LEN), "FNMADDV exact");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(negProduct);
+        VEC_TYPE vec2 = vec0.fnmsub(vec0, vec1);
+        vec2.store(values);
+        CHECK_CONDITION(valuesExact(values, negError, VEC_LEN), "FNMSUBV exact");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(negProduct);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec2 = vec0.fmuladd(mask, vec0, vec1);
+        vec2.store(values);
+        CHECK_CONDITION(valuesExact(values, maskedError, VEC_LEN), "MFMULADDV exact");
+    }
+#endif
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericMAXVTest()
 {
@@ -9162,6 +10378,86 @@ void genericMRSHSATest_random()
     }
 }
 
+// Shifting by a count of at least the element width moves every bit out: LSH
+// and unsigned RSH give 0 and signed RSH gives the sign fill. For 8-bit and
+// 16-bit elements C++ promotes to 'int', so such counts are well defined.
+template<typename VEC_TYPE, typename UINT_VEC_TYPE, typename SCALAR_TYPE, typename SCALAR_UINT_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericSHIFTWideCountTest_random()
+{
+    const uint32_t BIT_COUNT = sizeof(SCALAR_TYPE) * 8;
+    if (BIT_COUNT > 16) return;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    bool inputMask[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_UINT_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE outputLSH[VEC_LEN];
+    SCALAR_TYPE outputRSH[VEC_LEN];
+    SCALAR_TYPE outputMLSH[VEC_LEN];
+    SCALAR_TYPE outputMRSH[VEC_LEN];
+    SCALAR_TYPE outputRSHSA[VEC_LEN];
+    SCALAR_UINT_TYPE inputS = SCALAR_UINT_TYPE(BIT_COUNT + randomValue<SCALAR_UINT_TYPE>(gen) % BIT_COUNT);
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputMask[i] = randomValue<bool>(gen);
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        // Mix in-range counts with counts in [BIT_COUNT, 2*BIT_COUNT).
+        inputB[i] = SCALAR_UINT_TYPE(randomValue<SCALAR_UINT_TYPE>(gen) % (2 * BIT_COUNT));
+        bool wide = inputB[i] >= BIT_COUNT;
+        SCALAR_TYPE signFill = std::is_signed<SCALAR_TYPE>::value ? SCALAR_TYPE(inputA[i] >> (BIT_COUNT - 1)) : SCALAR_TYPE(0);
+        outputLSH[i] = wide ? SCALAR_TYPE(0) : SCALAR_TYPE(inputA[i] << inputB[i]);
+        outputRSH[i] = wide ? signFill : SCALAR_TYPE(inputA[i] >> inputB[i]);
+        outputMLSH[i] = inputMask[i] ? SCALAR_TYPE(0) : inputA[i];
+        outputMRSH[i] = inputMask[i] ? signFill : inputA[i];
+        outputRSHSA[i] = signFill;
+    }
+
+    MASK_TYPE mask(inputMask);
+    VEC_TYPE vec0(inputA);
+    UINT_VEC_TYPE vec1(inputB);
+    {
+        VEC_TYPE vec2 = vec0.lsh(vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputLSH, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "LSHV wide count");
+    }
+    {
+        VEC_TYPE vec2 = vec0.rsh(vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputRSH, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "RSHV wide count");
+    }
+    {
+        VEC_TYPE vec2 = vec0.lsh(mask, inputS);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputMLSH, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "MLSHS wide count");
+    }
+    {
+        VEC_TYPE vec2 = vec0.rsh(mask, inputS);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputMRSH, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "MRSHS wide count");
+    }
+    {
+        VEC_TYPE vec2 = vec0;
+        vec2.lsha(vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputLSH, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "LSHVA wide count");
+    }
+    {
+        VEC_TYPE vec2 = vec0;
+        vec2.rsha(inputS);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputRSHSA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "RSHSA wide count");
+    }
+}
+
 template<typename VEC_TYPE, typename UINT_VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericROLVTest()
 {
@@ -10399,6 +11695,44 @@ void genericMEXPTest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericEXP2Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-100), SCALAR_TYPE(100));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::exp2(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.exp2();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXP2 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::exp2(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXP2(function) gen");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
 void genericLOGTest_random()
 {
@@ -10607,262 +11941,611 @@ void genericCOSTest()
         VEC_TYPE vec0(DATA_SET::inputs::inputA);
         VEC_TYPE vec1 = vec0.cos();
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::COS, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::COS, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "COS");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::cos(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::COS, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "COS(function)");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericCOSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        output[i] = std::cos(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.cos();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COS gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::cos(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COS(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
+void genericMCOSTest()
+{
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec1 = vec0.cos(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::MCOS, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "MCOS");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::cos(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::MCOS, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "MCOS(function)");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
+void genericTANTest()
+{
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        VEC_TYPE vec1 = vec0.tan();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::TAN, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange && isUnmodified, "TAN");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::tan(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::TAN, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange && isUnmodified, "TAN(function)");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericTANTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        output[i] = std::tan(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.tan();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "TAN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::tan(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "TAN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
+void genericMTANTest()
+{
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec1 = vec0.tan(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::MTAN, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "MTAN");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::tan(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::MTAN, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "MTAN(function)");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
+void genericCTANTest()
+{
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        VEC_TYPE vec1 = vec0.ctan();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::CTAN, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "CTAN");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::ctan(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::CTAN, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "CTAN(function)");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericCTANTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        output[i] = SCALAR_TYPE(1.0f)/std::tan(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.ctan();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "CTAN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::ctan(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "CTAN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
+void genericMCTANTest()
+{
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec1 = vec0.ctan(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::MCTAN, VEC_LEN, 0.1f);
         vec0.store(values);
         bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "COS");
+        CHECK_CONDITION((inRange && isUnmodified), "MCTAN");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
         VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::cos(vec0);
+        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::ctan(mask, vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::COS, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::MCTAN, VEC_LEN, 0.1f);
         vec0.store(values);
         bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "COS(function)");
+        CHECK_CONDITION((inRange && isUnmodified), "MCTAN(function)");
     }
 }
 
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericCOSTest_random()
+void genericATANTest_random()
 {
     std::random_device rd;
     std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10), SCALAR_TYPE(10));
 
     SCALAR_TYPE inputA[VEC_LEN];
     SCALAR_TYPE output[VEC_LEN];
 
     for (int i = 0; i < VEC_LEN; i++) {
-        inputA[i] = randomValue<SCALAR_TYPE>(gen);
-        output[i] = std::cos(inputA[i]);
+        inputA[i] = dist(gen);
+        output[i] = std::atan(inputA[i]);
     }
 
     {
         SCALAR_TYPE values[VEC_LEN];
         VEC_TYPE vec0(inputA);
-        VEC_TYPE vec1 = vec0.cos();
+        VEC_TYPE vec1 = vec0.atan();
         vec1.store(values);
         bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
         bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange & isUnmodified), "COS gen");
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
         VEC_TYPE vec0(inputA);
         VEC_TYPE vec1;
-        vec1 = UME::SIMD::FUNCTIONS::cos(vec0);
+        vec1 = UME::SIMD::FUNCTIONS::atan(vec0);
         vec1.store(values);
         bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
         bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange & isUnmodified), "COS(function) gen");
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN(function) gen");
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
-void genericMCOSTest()
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericATAN2Test_random()
 {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10), SCALAR_TYPE(10));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputB[i] = dist(gen);
+        output[i] = std::atan2(inputA[i], inputB[i]);
+    }
+
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        MASK_TYPE mask(DATA_SET::inputs::maskA);
-        VEC_TYPE vec1 = vec0.cos(mask);
-        vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::MCOS, VEC_LEN, 0.1f);
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2 = vec0.atan2(vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "MCOS");
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN2 gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        MASK_TYPE mask(DATA_SET::inputs::maskA);
-        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::cos(mask, vec0);
-        vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::MCOS, VEC_LEN, 0.1f);
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::atan2(vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "MCOS(function)");
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN2(function) gen");
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
-void genericTANTest()
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericPOWVTest_random()
 {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.5), SCALAR_TYPE(2));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-50), SCALAR_TYPE(50));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distB(gen);
+        output[i] = std::pow(inputA[i], inputB[i]);
+    }
+
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        VEC_TYPE vec1 = vec0.tan();
-        vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::TAN, VEC_LEN, 0.1f);
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2 = vec0.pow(vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION(inRange && isUnmodified, "TAN");
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWV gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::tan(vec0);
-        vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::TAN, VEC_LEN, 0.1f);
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::pow(vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION(inRange && isUnmodified, "TAN(function)");
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWV(function) gen");
     }
 }
 
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericTANTest_random()
+void genericPOWSTest_random()
 {
     std::random_device rd;
     std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.5), SCALAR_TYPE(2));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-50), SCALAR_TYPE(50));
 
     SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB = distB(gen);
     SCALAR_TYPE output[VEC_LEN];
 
     for (int i = 0; i < VEC_LEN; i++) {
-        inputA[i] = randomValue<SCALAR_TYPE>(gen);
-        output[i] = std::tan(inputA[i]);
+        inputA[i] = distA(gen);
+        output[i] = std::pow(inputA[i], inputB);
     }
 
     {
         SCALAR_TYPE values[VEC_LEN];
         VEC_TYPE vec0(inputA);
-        VEC_TYPE vec1 = vec0.tan();
+        VEC_TYPE vec1 = vec0.pow(inputB);
         vec1.store(values);
         bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
         bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange & isUnmodified), "TAN gen");
+        CHECK_CONDITION((inRange & isUnmodified), "POWS gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
         VEC_TYPE vec0(inputA);
         VEC_TYPE vec1;
-        vec1 = UME::SIMD::FUNCTIONS::tan(vec0);
+        vec1 = UME::SIMD::FUNCTIONS::pow(vec0, inputB);
         vec1.store(values);
         bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
         bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange & isUnmodified), "TAN(function) gen");
+        CHECK_CONDITION((inRange & isUnmodified), "POWS(function) gen");
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
-void genericMTANTest()
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, UME::SIMD::Precision PRECISION>
+void genericPrecisionTest_random(SCALAR_TYPE errMargin, std::string const & tier)
 {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distExp(SCALAR_TYPE(-80), SCALAR_TYPE(80));
+    std::uniform_real_distribution<SCALAR_TYPE> distLog(SCALAR_TYPE(1e-6), SCALAR_TYPE(1e6));
+    std::uniform_real_distribution<SCALAR_TYPE> distTrig(SCALAR_TYPE(-100), SCALAR_TYPE(100));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE inputC[VEC_LEN];
+    bool inputMask[VEC_LEN];
+    SCALAR_TYPE outputExp[VEC_LEN];
+    SCALAR_TYPE outputMExp[VEC_LEN];
+    SCALAR_TYPE outputLog[VEC_LEN];
+    SCALAR_TYPE outputSin[VEC_LEN];
+    SCALAR_TYPE outputCos[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distExp(gen);
+        inputB[i] = distLog(gen);
+        inputC[i] = distTrig(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        outputExp[i] = std::exp(inputA[i]);
+        outputMExp[i] = inputMask[i] ? outputExp[i] : inputA[i];
+        outputLog[i] = std::log(inputB[i]);
+        outputSin[i] = std::sin(inputC[i]);
+        outputCos[i] = std::cos(inputC[i]);
+    }
+
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        MASK_TYPE mask(DATA_SET::inputs::maskA);
-        VEC_TYPE vec1 = vec0.tan(mask);
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::exp<PRECISION>(vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::MTAN, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, outputExp, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "MTAN");
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXP<" + tier + "> gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        MASK_TYPE mask(DATA_SET::inputs::maskA);
-        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::tan(mask, vec0);
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::exp<PRECISION>(mask, vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::MTAN, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, outputMExp, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "MTAN(function)");
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MEXP<" + tier + "> gen");
     }
-}
-
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
-void genericCTANTest()
-{
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        VEC_TYPE vec1 = vec0.ctan();
+        VEC_TYPE vec0(inputB);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::log<PRECISION>(vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::CTAN, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, outputLog, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "CTAN");
+        bool isUnmodified = valuesInRange(values, inputB, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "LOG<" + tier + "> gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::ctan(vec0);
+        VEC_TYPE vec0(inputC);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::sin<PRECISION>(vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::CTAN, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, outputSin, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "CTAN(function)");
+        bool isUnmodified = valuesInRange(values, inputC, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SIN<" + tier + "> gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputC);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::cos<PRECISION>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputCos, VEC_LEN, errMargin);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputC, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COS<" + tier + "> gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputC);
+        VEC_TYPE vec1, vec2;
+        UME::SIMD::FUNCTIONS::sincos<PRECISION>(vec0, vec1, vec2);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputSin, VEC_LEN, errMargin);
+        vec2.store(values);
+        inRange &= valuesInRange(values, outputCos, VEC_LEN, errMargin);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputC, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SINCOS<" + tier + "> gen");
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericCTANTest_random()
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, int BITS>
+void genericRCPBitsTest_random()
 {
     std::random_device rd;
     std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distRcp(SCALAR_TYPE(1e-3), SCALAR_TYPE(1e3));
+    std::uniform_real_distribution<SCALAR_TYPE> distRsqrt(SCALAR_TYPE(1e-6), SCALAR_TYPE(1e6));
+    // Below full precision the result has at least BITS correct bits, at full
+    // precision it is within 1 ulp.
+    SCALAR_TYPE errMargin = (BITS < std::numeric_limits<SCALAR_TYPE>::digits) ?
+        std::ldexp(SCALAR_TYPE(1), -BITS) :
+        2 * std::numeric_limits<SCALAR_TYPE>::epsilon();
+    std::string tier = std::to_string(BITS);
 
     SCALAR_TYPE inputA[VEC_LEN];
-    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    bool inputMask[VEC_LEN];
+    SCALAR_TYPE outputRcp[VEC_LEN];
+    SCALAR_TYPE outputMRcp[VEC_LEN];
+    SCALAR_TYPE outputRsqrt[VEC_LEN];
+    SCALAR_TYPE outputMRsqrt[VEC_LEN];
 
     for (int i = 0; i < VEC_LEN; i++) {
-        inputA[i] = randomValue<SCALAR_TYPE>(gen);
-        output[i] = SCALAR_TYPE(1.0f)/std::tan(inputA[i]);
+        inputA[i] = randomValue<bool>(gen) ? distRcp(gen) : -distRcp(gen);
+        inputB[i] = distRsqrt(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        outputRcp[i] = SCALAR_TYPE(1.0L / (long double)inputA[i]);
+        outputMRcp[i] = inputMask[i] ? outputRcp[i] : inputA[i];
+        outputRsqrt[i] = SCALAR_TYPE(1.0L / std::sqrt((long double)inputB[i]));
+        outputMRsqrt[i] = inputMask[i] ? outputRsqrt[i] : inputB[i];
     }
 
     {
         SCALAR_TYPE values[VEC_LEN];
         VEC_TYPE vec0(inputA);
-        VEC_TYPE vec1 = vec0.ctan();
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::rcp<BITS>(vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        bool inRange = valuesInRange(values, outputRcp, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange & isUnmodified), "CTAN gen");
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange & isUnmodified), "RCP<" + tier + "> gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
         VEC_TYPE vec0(inputA);
-        VEC_TYPE vec1;
-        vec1 = UME::SIMD::FUNCTIONS::ctan(vec0);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::rcp<BITS>(mask, vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        bool inRange = valuesInRange(values, outputMRcp, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange & isUnmodified), "CTAN(function) gen");
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION((inRange & isUnmodified), "MRCP<" + tier + "> gen");
     }
-}
-
-template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
-void genericMCTANTest()
-{
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        MASK_TYPE mask(DATA_SET::inputs::maskA);
-        VEC_TYPE vec1 = vec0.ctan(mask);
+        VEC_TYPE vec0(inputB);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::rsqrt<BITS>(vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::MCTAN, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, outputRsqrt, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "MCTAN");
+        bool isUnmodified = valuesExact(values, inputB, VEC_LEN);
+        CHECK_CONDITION((inRange & isUnmodified), "RSQRT<" + tier + "> gen");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        MASK_TYPE mask(DATA_SET::inputs::maskA);
-        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::ctan(mask, vec0);
+        VEC_TYPE vec0(inputB);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::rsqrt<BITS>(mask, vec0);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::MCTAN, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, outputMRsqrt, VEC_LEN, errMargin);
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "MCTAN(function)");
+        bool isUnmodified = valuesExact(values, inputB, VEC_LEN);
+        CHECK_CONDITION((inRange & isUnmodified), "MRSQRT<" + tier + "> gen");
+    }
+    {
+        // The estimates have at least the number of bits they claim.
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2 = vec0.rcpe();
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputRcp, VEC_LEN, std::ldexp(SCALAR_TYPE(1), -VEC_TYPE::rcpeBits()) + std::numeric_limits<SCALAR_TYPE>::epsilon());
+        VEC_TYPE vec3 = vec1.rsqrte();
+        vec3.store(values);
+        inRange &= valuesInRange(values, outputRsqrt, VEC_LEN, std::ldexp(SCALAR_TYPE(1), -VEC_TYPE::rsqrteBits()) + std::numeric_limits<SCALAR_TYPE>::epsilon());
+        CHECK_CONDITION(inRange, "RCPE/RSQRTE gen");
     }
 }
 
@@ -10890,6 +12573,36 @@ void genericUTOFTest()
     CHECK_CONDITION(inRange, "UTOF");
 }
 
+template<typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, typename FLOAT_VEC_TYPE, typename FLOAT_SCALAR_TYPE, int VEC_LEN>
+void genericUTOFTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> shiftDist(0, int(sizeof(UINT_SCALAR_TYPE) * 8 - 1));
+
+    UINT_SCALAR_TYPE inputA[VEC_LEN];
+    FLOAT_SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        // Full range values of varying magnitude. Conversion has to be rounded
+        // in the same way as the scalar one.
+        inputA[i] = UINT_SCALAR_TYPE(randomValue<UINT_SCALAR_TYPE>(gen) >> shiftDist(gen));
+    }
+    inputA[0] = std::numeric_limits<UINT_SCALAR_TYPE>::max();
+    inputA[VEC_LEN - 1] = std::numeric_limits<UINT_SCALAR_TYPE>::min();
+    for (int i = 0; i < VEC_LEN; i++) {
+        output[i] = FLOAT_SCALAR_TYPE(inputA[i]);
+    }
+    {
+        FLOAT_SCALAR_TYPE values[VEC_LEN];
+        UINT_VEC_TYPE vec0(inputA);
+        FLOAT_VEC_TYPE vec1 = FLOAT_VEC_TYPE(vec0);
+        vec1.store(values);
+        bool exact = valuesExact(values, output, VEC_LEN);
+        CHECK_CONDITION(exact, "UTOF gen");
+    }
+}
+
 template<typename INT_VEC_TYPE, typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericITOUTest()
 {
@@ -10914,6 +12627,36 @@ void genericITOFTest()
     CHECK_CONDITION(inRange, "ITOF");
 }
 
+template<typename INT_VEC_TYPE, typename INT_SCALAR_TYPE, typename FLOAT_VEC_TYPE, typename FLOAT_SCALAR_TYPE, int VEC_LEN>
+void genericITOFTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> shiftDist(0, int(sizeof(INT_SCALAR_TYPE) * 8 - 1));
+
+    INT_SCALAR_TYPE inputA[VEC_LEN];
+    FLOAT_SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        // Full range values of varying magnitude. Conversion has to be rounded
+        // in the same way as the scalar one.
+        inputA[i] = INT_SCALAR_TYPE(randomValue<INT_SCALAR_TYPE>(gen) >> shiftDist(gen));
+    }
+    inputA[0] = std::numeric_limits<INT_SCALAR_TYPE>::max();
+    inputA[VEC_LEN - 1] = std::numeric_limits<INT_SCALAR_TYPE>::min();
+    for (int i = 0; i < VEC_LEN; i++) {
+        output[i] = FLOAT_SCALAR_TYPE(inputA[i]);
+    }
+    {
+        FLOAT_SCALAR_TYPE values[VEC_LEN];
+        INT_VEC_TYPE vec0(inputA);
+        FLOAT_VEC_TYPE vec1 = FLOAT_VEC_TYPE(vec0);
+        vec1.store(values);
+        bool exact = valuesExact(values, output, VEC_LEN);
+        CHECK_CONDITION(exact, "ITOF gen");
+    }
+}
+
 template<typename FLOAT_VEC_TYPE, typename UINT_VEC_TYPE, typename UINT_SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericFTOUTest()
 {
@@ -10947,7 +12690,22 @@ void genericFTOUTest_random()
         bool exact = valuesExact(values, output, VEC_LEN);
         CHECK_CONDITION(exact, "FTOU gen");
     }
-    //EXTEND THIS TEST WITH FIXED RANGE THAT CAN BE REPRESENTED AS UNSINGED
+    {
+        // Values within the range of the destination type, with fractional parts.
+        std::uniform_int_distribution<int> fractionDist(0, 1023);
+        std::uniform_int_distribution<int> shiftDist(0, int(sizeof(UINT_SCALAR_TYPE) * 8 - 1));
+        for (int i = 0; i < VEC_LEN; i++) {
+            FLOAT_SCALAR_TYPE t0 = FLOAT_SCALAR_TYPE(randomValue<UINT_SCALAR_TYPE>(gen)) * FLOAT_SCALAR_TYPE(fractionDist(gen)) / FLOAT_SCALAR_TYPE(1024);
+            inputA[i] = std::ldexp(t0, -shiftDist(gen));
+            output[i] = UINT_SCALAR_TYPE(inputA[i]);
+        }
+        UINT_SCALAR_TYPE values[VEC_LEN];
+        FLOAT_VEC_TYPE vec0(inputA);
+        UINT_VEC_TYPE vec1 = UINT_VEC_TYPE(vec0);
+        vec1.store(values);
+        bool exact = valuesExact(values, output, VEC_LEN);
+        CHECK_CONDITION(exact, "FTOU in range gen");
+    }
 }
 
 template<typename FLOAT_VEC_TYPE, typename INT_VEC_TYPE, typename INT_SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
@@ -10983,6 +12741,22 @@ void genericFTOITest_random()
         bool exact = valuesExact(values, output, VEC_LEN);
         CHECK_CONDITION(exact, "FTOI gen");
     }
+    {
+        // Values within the range of the destination type, with fractional parts.
+        std::uniform_int_distribution<int> fractionDist(0, 1023);
+        std::uniform_int_distribution<int> shiftDist(0, int(sizeof(INT_SCALAR_TYPE) * 8 - 1));
+        for (int i = 0; i < VEC_LEN; i++) {
+            FLOAT_SCALAR_TYPE t0 = FLOAT_SCALAR_TYPE(randomValue<INT_SCALAR_TYPE>(gen)) * FLOAT_SCALAR_TYPE(fractionDist(gen)) / FLOAT_SCALAR_TYPE(1024);
+            inputA[i] = std::ldexp(t0, -shiftDist(gen));
+            output[i] = INT_SCALAR_TYPE(inputA[i]);
+        }
+        INT_SCALAR_TYPE values[VEC_LEN];
+        FLOAT_VEC_TYPE vec0(inputA);
+        INT_VEC_TYPE vec1 = INT_VEC_TYPE(vec0);
+        vec1.store(values);
+        bool exact = valuesExact(values, output, VEC_LEN);
+        CHECK_CONDITION(exact, "FTOI in range gen");
+    }
 }
 
 template<typename VEC_TYPE_X, typename SCALAR_TYPE_X, typename VEC_TYPE_Y, typename SCALAR_TYPE_Y, int VEC_LEN, typename DATA_SET>
@@ -11050,6 +12824,11 @@ void genericBaseInterfaceTest()
     genericLOAD_STORETest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMLOADTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericMSTORETest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericLOADTAIL_STORETAILTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMLOAD_MSTOREPageBoundaryTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericCOMPRESS_EXPANDTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericLOADINTERLEAVED_STOREINTERLEAVEDTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericTRANSPOSETest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOADA_STOREATest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMLOADATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericMSTOREATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
@@ -11217,6 +12996,8 @@ void genericIntegerInterfaceTest()
     genericREMVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericMREMVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericREMSTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMULSTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericDIVSTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
 
     genericLANDVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLORVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
@@ -11289,6 +13070,11 @@ void genericGatherScatterInterfaceTest()
     genericMSCATTERSTest_random<VEC_TYPE, SCALAR_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
     genericSCATTERVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
     genericMSCATTERVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
+    genericPERMUTEVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
+    genericSORTAKVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
+    genericSORTDKVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
+    genericSORTKVTest_vectorPayload<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericConflictTests<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>::scatterAdd();
 }
 
 template<typename VEC_TYPE, typename UINT_VEC_TYPE, typename SCALAR_TYPE, typename UINT_SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
@@ -11310,6 +13096,7 @@ void genericShiftRotateInterfaceTest()
     genericMRSHVATest_random<VEC_TYPE, UINT_VEC_TYPE, SCALAR_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericRSHSATest_random<VEC_TYPE, UINT_VEC_TYPE, SCALAR_TYPE, UINT_SCALAR_TYPE, VEC_LEN>();
     genericMRSHSATest_random<VEC_TYPE, UINT_VEC_TYPE, SCALAR_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericSHIFTWideCountTest_random<VEC_TYPE, UINT_VEC_TYPE, SCALAR_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericROLVTest<VEC_TYPE, UINT_VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMROLVTest<VEC_TYPE, UINT_VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     genericROLSTest<VEC_TYPE, UINT_VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
@@ -11371,8 +13158,15 @@ void genericFloatInterfaceTest()
     genericSQRTATest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMSQRTATest<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     
+    genericFNMADDVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMFNMADDVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericFNMSUBVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMFNMSUBVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericFMAExactTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    
     genericEXPTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericMEXPTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericEXP2Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOGTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOG2Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOG10Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
@@ -11385,6 +13179,20 @@ void genericFloatInterfaceTest()
     // MTAN
     genericCTANTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     // CTAN
+    genericATANTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericATAN2Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+
+    genericPOWVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericPOWSTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+
+    genericPrecisionTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, UME::SIMD::Precision::Fast>(SCALAR_TYPE(1e-4f), "Fast");
+    genericPrecisionTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, UME::SIMD::Precision::Default>(SCALAR_TYPE(0.01f), "Default");
+    genericPrecisionTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, UME::SIMD::Precision::Strict>(4 * std::numeric_limits<SCALAR_TYPE>::epsilon(), "Strict");
+
+    genericRCPBitsTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, 11>();
+    genericRCPBitsTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, 20>();
+    genericRCPBitsTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, std::numeric_limits<SCALAR_TYPE>::digits - 2>();
+    genericRCPBitsTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, std::numeric_limits<SCALAR_TYPE>::digits>();
 }
 
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
@@ -11423,6 +13231,8 @@ void genericMaskTest() {
     genericHLANDTest<MASK_TYPE, VEC_LEN, DATA_SET> ();
     genericHLORTest<MASK_TYPE, VEC_LEN, DATA_SET> ();
     genericHLXORTest<MASK_TYPE, VEC_LEN, DATA_SET> ();
+    genericMaskActiveTest_random<MASK_TYPE, VEC_LEN>();
+    genericMaskBitsTest_random<MASK_TYPE, VEC_LEN>::run();
 }
 
 template<
@@ -11441,8 +13251,11 @@ void genericUintTest() {
     genericIntegerInterfaceTest<UINT_VEC_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET> ();
     genericGatherScatterInterfaceTest<UINT_VEC_TYPE, UINT_SCALAR_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET> ();
     genericShiftRotateInterfaceTest<UINT_VEC_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
+    genericConflictTests<UINT_VEC_TYPE, UINT_SCALAR_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>::conflict();
+    genericLOOKUPTest_random<UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>();
     genericUTOITest<UINT_VEC_TYPE, INT_VEC_TYPE, INT_SCALAR_TYPE, VEC_LEN, DATA_SET> ();
     genericUTOFTest<UINT_VEC_TYPE, FLOAT_VEC_TYPE, FLOAT_SCALAR_TYPE, VEC_LEN, DATA_SET> ();
+    genericUTOFTest_random<UINT_VEC_TYPE, UINT_SCALAR_TYPE, FLOAT_VEC_TYPE, FLOAT_SCALAR_TYPE, VEC_LEN>();
     genericPackableInterfaceTest<UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>();
 }
 
@@ -11461,6 +13274,8 @@ template<
     genericIntegerInterfaceTest<UINT_VEC_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     genericGatherScatterInterfaceTest<UINT_VEC_TYPE, UINT_SCALAR_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     genericShiftRotateInterfaceTest<UINT_VEC_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, UINT_SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
+    genericConflictTests<UINT_VEC_TYPE, UINT_SCALAR_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>::conflict();
+    genericLOOKUPTest_random<UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN>();
     genericUTOITest<UINT_VEC_TYPE, INT_VEC_TYPE, INT_SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericPackableInterfaceTest<INT_VEC_TYPE, INT_SCALAR_TYPE, VEC_LEN>();
 }
@@ -11484,6 +13299,7 @@ void genericIntTest() {
     genericSignInterfaceTest<INT_VEC_TYPE, INT_SCALAR_TYPE  , MASK_TYPE, VEC_LEN, DATA_SET>();
     genericITOUTest<INT_VEC_TYPE, UINT_VEC_TYPE, UINT_SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericITOFTest<INT_VEC_TYPE, FLOAT_VEC_TYPE, FLOAT_SCALAR_TYPE, VEC_LEN, DATA_SET>();
+    genericITOFTest_random<INT_VEC_TYPE, INT_SCALAR_TYPE, FLOAT_VEC_TYPE, FLOAT_SCALAR_TYPE, VEC_LEN>();
     genericPackableInterfaceTest<INT_VEC_TYPE, INT_SCALAR_TYPE, VEC_LEN>();
 }
 
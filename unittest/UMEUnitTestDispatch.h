@@ -0,0 +1,86 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_DISPATCH_H_
+#define UME_UNIT_TEST_DISPATCH_H_
+
+#include "UMEUnitTestCommon.h"
+#include "../UMEDispatch.h"
+
+namespace DispatchTest {
+    int kernel_SCALAR(int x) { return x + UME::SIMD::DISPATCH::ISA_SCALAR; }
+    int kernel_SSE(int x) { return x + UME::SIMD::DISPATCH::ISA_SSE; }
+    int kernel_AVX(int x) { return x + UME::SIMD::DISPATCH::ISA_AVX; }
+    int kernel_AVX2(int x) { return x + UME::SIMD::DISPATCH::ISA_AVX2; }
+    int kernel_AVX512(int x) { return x + UME::SIMD::DISPATCH::ISA_AVX512; }
+}
+
+int test_dispatch(bool supressMessages)
+{
+    char header[] = "UME::SIMD::DISPATCH test";
+    INIT_TEST(header, supressMessages);
+
+    using namespace UME::SIMD::DISPATCH;
+
+    // The test binary runs, so the ISA it was compiled for has to be detected.
+#if defined(FORCE_SCALAR) || defined(FORCE_OPENMP)
+    ISA compiled = ISA_SCALAR;
+#elif defined(__AVX512F__)
+    ISA compiled = ISA_AVX512;
+#elif defined(__AVX2__)
+    ISA compiled = ISA_AVX2;
+#elif defined(__AVX__)
+    ISA compiled = ISA_AVX;
+#elif defined(__SSE4_2__)
+    ISA compiled = ISA_SSE;
+#else
+    ISA compiled = ISA_SCALAR;
+#endif
+    CHECK_CONDITION(compiled <= detectISA(), "detectISA");
+    CHECK_CONDITION(dispatchISA() <= detectISA(), "dispatchISA");
+    CHECK_CONDITION(isSupported(ISA_SCALAR), "isSupported");
+    {
+        using namespace DispatchTest;
+        auto kernel = UME_DISPATCH_CREATE(kernel);
+        CHECK_CONDITION(kernel.selectedISA() == dispatchISA(), "UME_DISPATCH_CREATE");
+        CHECK_CONDITION(kernel(10) == 10 + int(dispatchISA()), "UME_DISPATCH_CREATE call");
+    }
+    {
+        Dispatcher<int(*)(int)> kernel(&DispatchTest::kernel_SCALAR);
+        CHECK_CONDITION(kernel.selectedISA() == ISA_SCALAR, "Dispatcher scalar only");
+        kernel.set(ISA_AVX, &DispatchTest::kernel_AVX);
+        ISA expected = isSupported(ISA_AVX) ? ISA_AVX : ISA_SCALAR;
+        CHECK_CONDITION(kernel.selectedISA() == expected, "Dispatcher partial table");
+        CHECK_CONDITION(kernel.get()(1) == 1 + int(expected), "Dispatcher partial table call");
+    }
+
+    return g_failCount;
+}
+#endif
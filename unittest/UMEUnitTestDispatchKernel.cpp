@@ -0,0 +1,64 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+// Kernel unit of the runtime dispatch test (see UMEUnitTestDispatchMain.cpp). The Makefile
+// 'dispatch' target compiles it once per ISA: without ISA flags, with -msse4.2, -mavx,
+// -mavx2 -mfma and -march=skylake-avx512.
+
+#include "../UMEDispatchTarget.h"
+#include "../UMESimd.h"
+
+#define UME_UNIT_TEST_STRINGIFY_IMPL(X) #X
+#define UME_UNIT_TEST_STRINGIFY(X) UME_UNIT_TEST_STRINGIFY_IMPL(X)
+
+// Suffix of the ISA this unit was compiled for, e.g. "AVX2".
+const char* UME_DISPATCH_NAME(dispatchTestTarget)() {
+    return UME_UNIT_TEST_STRINGIFY(UME_DISPATCH_TARGET_ISA);
+}
+
+// y[i] = x[i] * 3 ^ x[i] >> 2 for even x[i], and x[i] for odd x[i].
+// Returns the sum of all y[i] (modulo 2^32).
+uint32_t UME_DISPATCH_NAME(dispatchTestKernel)(uint32_t const * x, uint32_t * y, int n) {
+    typedef UME::SIMD::SIMDVec<uint32_t, 8> VEC_T;
+    typedef UME::SIMD::SIMDVecMask<8>       MASK_T;
+
+    VEC_T sum(0u);
+    for (int i = 0; i < n; i += 8) {
+        uint32_t count = (n - i) < 8 ? uint32_t(n - i) : 8u;
+        VEC_T t0;
+        t0.loadTail(x + i, count);
+        VEC_T t1 = t0.mul(3u).bxor(t0.rsh(2u));
+        MASK_T t2 = t0.band(1u).cmpne(0u);
+        t1 = t1.blend(t2, t0);
+        t1.storeTail(y + i, count);
+        sum.adda(t1);
+    }
+    return sum.hadd();
+}
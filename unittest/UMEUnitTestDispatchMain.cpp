@@ -0,0 +1,105 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+// Runtime dispatch test with kernels compiled for different ISAs in separate units and linked
+// together. Built and run by the Makefile 'dispatch' target, without ISA flags. The test is run
+// once without limit, and once for each value of UME_DISPATCH_ISA.
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include "UMEUnitTestCommon.h"
+#include "../UMEDispatch.h"
+
+UME_DISPATCH_DECLARE(const char*, dispatchTestTarget, ());
+UME_DISPATCH_DECLARE(uint32_t, dispatchTestKernel, (uint32_t const *, uint32_t *, int));
+
+using namespace UME::SIMD::DISPATCH;
+
+// Case-insensitive comparison of a target suffix with isaName().
+static bool sameISAName(const char* target, ISA isa) {
+    const char* name = isaName(isa);
+    for (; *target != 0 && *name != 0; target++, name++) {
+        if (std::tolower(*target) != *name) return false;
+    }
+    return *target == *name;
+}
+
+int main()
+{
+    char header[] = "UME::SIMD::DISPATCH multi-unit test";
+    INIT_TEST(header, false);
+
+    const int LEN = 101;
+    uint32_t x[LEN], y[LEN], expected[LEN];
+    uint32_t expectedSum = 0;
+    for (int i = 0; i < LEN; i++) {
+        x[i] = uint32_t(i * 2654435761u);
+        expected[i] = (x[i] & 1u) ? x[i] : ((x[i] * 3u) ^ (x[i] >> 2));
+        expectedSum += expected[i];
+    }
+
+    // Highest ISA allowed by UME_DISPATCH_ISA.
+    ISA limit = detectISA();
+    const char* env = std::getenv("UME_DISPATCH_ISA");
+    for (int i = 0; env != nullptr && i < ISA_COUNT; i++) {
+        if (std::strcmp(env, isaName(ISA(i))) == 0 && ISA(i) < limit) limit = ISA(i);
+    }
+    std::cout << "Detected ISA: " << isaName(detectISA()) << ", UME_DISPATCH_ISA: "
+              << (env != nullptr ? env : "(not set)") << std::endl;
+    CHECK_CONDITION(dispatchISA() == limit, "UME_DISPATCH_ISA limit");
+
+    // Every version the processor can run computes the same results.
+    uint32_t (*kernels[ISA_COUNT])(uint32_t const *, uint32_t *, int) = {
+        &dispatchTestKernel_SCALAR, &dispatchTestKernel_SSE, &dispatchTestKernel_AVX,
+        &dispatchTestKernel_AVX2, &dispatchTestKernel_AVX512 };
+    const char* (*targets[ISA_COUNT])() = {
+        &dispatchTestTarget_SCALAR, &dispatchTestTarget_SSE, &dispatchTestTarget_AVX,
+        &dispatchTestTarget_AVX2, &dispatchTestTarget_AVX512 };
+    for (int i = 0; i <= int(detectISA()); i++) {
+        for (int j = 0; j < LEN; j++) y[j] = 0;
+        uint32_t sum = kernels[i](x, y, LEN);
+        bool exact = (sum == expectedSum) && sameISAName(targets[i](), ISA(i));
+        for (int j = 0; j < LEN; j++) exact &= (y[j] == expected[j]);
+        CHECK_CONDITION(exact, std::string("kernel version ") + isaName(ISA(i)));
+    }
+
+    // The dispatcher selects the highest allowed version.
+    auto kernel = UME_DISPATCH_CREATE(dispatchTestKernel);
+    auto target = UME_DISPATCH_CREATE(dispatchTestTarget);
+    for (int j = 0; j < LEN; j++) y[j] = 0;
+    bool exact = kernel(x, y, LEN) == expectedSum;
+    for (int j = 0; j < LEN; j++) exact &= (y[j] == expected[j]);
+    CHECK_CONDITION(kernel.selectedISA() == limit && sameISAName(target(), limit), "UME_DISPATCH_CREATE selection");
+    CHECK_CONDITION(exact, "UME_DISPATCH_CREATE call");
+
+    return g_failCount == 0 ? 0 : 1;
+}
@@ -32,14 +32,18 @@
 
 #include "UMEUnitTestCommon.h"
 #include "../UMEMemory.h"
+#include "../UMEContainers.h"
+#include "../UMEArena.h"
 #include <string>
+#include <thread>
+#include <vector>
 
 template<typename SCALAR_T, int SIMD_STRIDE>
 void generic_AlignedAllocatorTest(std::string const & scalar_type) {
     
     UME::AlignedAllocator<SCALAR_T, SIMD_STRIDE> allocator;
     
-    SCALAR_T* mem = allocator.allocate(sizeof(SCALAR_T)*100);
+    SCALAR_T* mem = allocator.allocate(100);
     //SCALAR_T* mem = nullptr;
     int alignment = UME::SIMD::SIMDVec<SCALAR_T, SIMD_STRIDE>::alignment();
     bool isAligned = ((uint64_t(mem) % alignment) == 0);
@@ -51,7 +55,316 @@ void generic_AlignedAllocatorTest(std::string const & scalar_type) {
     msg.append(">");
     check_condition(isAligned && !isNullptr, msg.c_str());
     
-    allocator.deallocate(mem, sizeof(SCALAR_T)*100);
+    allocator.deallocate(mem, 100);
+}
+
+template<typename SCALAR_T, int SIMD_STRIDE>
+void generic_AlignedAllocatorVectorTest(std::string const & scalar_type) {
+    std::vector<SCALAR_T, UME::AlignedAllocator<SCALAR_T, SIMD_STRIDE>> v;
+    bool isAligned = true;
+    bool isCorrect = true;
+    for (int i = 0; i < 100; i++) {
+        v.push_back(SCALAR_T(i));
+        isAligned = isAligned && ((uint64_t(v.data()) % UME::SIMD::SIMDVec<SCALAR_T, SIMD_STRIDE>::alignment()) == 0);
+    }
+    for (int i = 0; i < 100; i++) isCorrect = isCorrect && (v[i] == SCALAR_T(i));
+
+    std::string msg = "ALLOCATOR std::vector <";
+    msg.append(scalar_type);
+    msg.append(", ");
+    msg.append(std::to_string(SIMD_STRIDE));
+    msg.append(">");
+    check_condition(isAligned && isCorrect, msg.c_str());
+}
+
+template<typename SCALAR_T, int SIMD_STRIDE>
+void generic_AlignedVectorTest(std::string const & scalar_type) {
+    typedef UME::SIMD::SIMDVec<SCALAR_T, SIMD_STRIDE> VEC_T;
+    std::string msg = std::string("<") + scalar_type + ", " + std::to_string(SIMD_STRIDE) + ">";
+
+    // Padding, alignment and zero tail
+    {
+        UME::AlignedVector<SCALAR_T, SIMD_STRIDE> v(37, SCALAR_T(3));
+        bool isAligned = ((uint64_t(v.data()) % VEC_T::alignment()) == 0);
+        bool isPadded = (v.size() == 37) && (v.paddedSize() % SIMD_STRIDE == 0) && (v.paddedSize() >= 37)
+            && (v.vecCount() * SIMD_STRIDE == v.paddedSize());
+        bool isCorrect = true;
+        for (std::size_t i = 0; i < v.paddedSize(); i++) {
+            isCorrect = isCorrect && (v.data()[i] == ((i < 37) ? SCALAR_T(3) : SCALAR_T(0)));
+        }
+        check_condition(isAligned && isPadded && isCorrect, (std::string("ALIGNEDVECTOR construct ") + msg).c_str());
+    }
+    // vec()/setVec() keep the tail zero
+    {
+        UME::AlignedVector<SCALAR_T, SIMD_STRIDE> v(37);
+        for (std::size_t i = 0; i < v.size(); i++) v[i] = SCALAR_T(i % 64);
+        for (std::size_t i = 0; i < v.vecCount(); i++) {
+            v.setVec(i, v.vec(i) + VEC_T(SCALAR_T(1)));
+        }
+        bool isCorrect = true;
+        for (std::size_t i = 0; i < v.paddedSize(); i++) {
+            isCorrect = isCorrect && (v.data()[i] == ((i < 37) ? SCALAR_T(i % 64 + 1) : SCALAR_T(0)));
+        }
+        check_condition(isCorrect, (std::string("ALIGNEDVECTOR vec/setVec ") + msg).c_str());
+    }
+    // Growth and shrinking
+    {
+        UME::AlignedVector<SCALAR_T, SIMD_STRIDE> v;
+        bool isAligned = true;
+        for (int i = 0; i < 100; i++) {
+            v.push_back(SCALAR_T(i));
+            isAligned = isAligned && ((uint64_t(v.data()) % VEC_T::alignment()) == 0);
+        }
+        UME::AlignedVector<SCALAR_T, SIMD_STRIDE> w(v);
+        v.resize(50);
+        bool isCorrect = (v.size() == 50) && (w.size() == 100);
+        for (std::size_t i = 0; i < v.capacity(); i++) {
+            isCorrect = isCorrect && (v.data()[i] == ((i < 50) ? SCALAR_T(i) : SCALAR_T(0)));
+        }
+        for (std::size_t i = 0; i < w.size(); i++) isCorrect = isCorrect && (w[i] == SCALAR_T(i));
+        check_condition(isAligned && isCorrect, (std::string("ALIGNEDVECTOR resize ") + msg).c_str());
+    }
+}
+
+template<typename CONTAINER_T, int SIMD_STRIDE>
+void generic_SoAContainerTest(std::string const & name) {
+    typedef UME::SIMD::SIMDVec<float, SIMD_STRIDE>   VEC_F;
+    typedef UME::SIMD::SIMDVec<double, SIMD_STRIDE>  VEC_D;
+    typedef UME::SIMD::SIMDVec<int32_t, SIMD_STRIDE> VEC_I;
+    std::string msg = "<" + std::to_string(SIMD_STRIDE) + ">";
+
+    // push_back, get and alignment of vector access
+    {
+        CONTAINER_T c;
+        for (int i = 0; i < 37; i++) c.push_back(float(i), double(2 * i), int32_t(3 * i));
+        bool isCorrect = (c.size() == 37) && (c.vecCount() == (37 + SIMD_STRIDE - 1) / SIMD_STRIDE);
+        for (int i = 0; i < 37; i++) {
+            isCorrect = isCorrect && (c.template get<0>(i) == float(i))
+                && (c.template get<1>(i) == double(2 * i)) && (c.template get<2>(i) == int32_t(3 * i));
+        }
+        for (std::size_t i = 0; i < c.vecCount(); i++) {
+            isCorrect = isCorrect && ((uint64_t(&c.template get<0>(i * SIMD_STRIDE)) % VEC_F::alignment()) == 0)
+                && ((uint64_t(&c.template get<1>(i * SIMD_STRIDE)) % VEC_D::alignment()) == 0)
+                && ((uint64_t(&c.template get<2>(i * SIMD_STRIDE)) % VEC_I::alignment()) == 0);
+        }
+        check_condition(isCorrect, (name + " push_back/get " + msg).c_str());
+    }
+    // load/store keep elements past size() zero
+    {
+        CONTAINER_T c(37);
+        for (int i = 0; i < 37; i++) {
+            c.template get<0>(i) = float(i);
+            c.template get<2>(i) = int32_t(i);
+        }
+        for (std::size_t i = 0; i < c.vecCount(); i++) {
+            VEC_F x = c.template load<0>(i);
+            VEC_I n = c.template load<2>(i);
+            c.template store<0>(i, x + VEC_F(1.0f));
+            c.template store<1>(i, VEC_D(0.5));
+            c.template store<2>(i, n * VEC_I(2));
+        }
+        bool isCorrect = true;
+        for (int i = 0; i < 37; i++) {
+            isCorrect = isCorrect && (c.template get<0>(i) == float(i + 1))
+                && (c.template get<1>(i) == 0.5) && (c.template get<2>(i) == int32_t(2 * i));
+        }
+        VEC_F x = c.template load<0>(c.vecCount() - 1);
+        VEC_D y = c.template load<1>(c.vecCount() - 1);
+        for (int i = 37 % SIMD_STRIDE; i > 0 && i < SIMD_STRIDE; i++) {
+            isCorrect = isCorrect && (x[i] == 0.0f) && (y[i] == 0.0);
+        }
+        check_condition(isCorrect, (name + " load/store " + msg).c_str());
+    }
+    // resize and copy
+    {
+        CONTAINER_T c;
+        for (int i = 0; i < 100; i++) c.push_back(float(i), double(i), int32_t(i));
+        CONTAINER_T d(c);
+        c.resize(50);
+        c.resize(60);
+        bool isCorrect = (c.size() == 60) && (d.size() == 100);
+        for (int i = 0; i < 60; i++) {
+            isCorrect = isCorrect && (c.template get<1>(i) == ((i < 50) ? double(i) : 0.0));
+        }
+        for (int i = 0; i < 100; i++) isCorrect = isCorrect && (d.template get<2>(i) == int32_t(i));
+        check_condition(isCorrect, (name + " resize " + msg).c_str());
+    }
+}
+
+void AlignedArenaTest() {
+    // Alignment and reuse of freed buffers
+    {
+        UME::AlignedArena arena;
+        bool isCorrect = true;
+        std::size_t sizes[] = { 1, 24, 64, 100, 4096, 5000, 65536 };
+        std::size_t alignments[] = { 16, 32, 64, 128, 4096 };
+        for (std::size_t s : sizes) {
+            for (std::size_t a : alignments) {
+                char* p = (char*)arena.allocate(s, a);
+                isCorrect = isCorrect && (p != nullptr) && ((uint64_t(p) % a) == 0);
+                for (std::size_t i = 0; i < s; i++) p[i] = char(i);
+                arena.deallocate(p, s, a);
+                char* q = (char*)arena.allocate(s, a);
+                isCorrect = isCorrect && (q == p);
+            }
+        }
+        check_condition(isCorrect, "ALIGNEDARENA allocate/deallocate");
+    }
+    // Live buffers do not overlap
+    {
+        UME::AlignedArena arena(4096);
+        bool isCorrect = true;
+        std::vector<uint32_t*> buffers;
+        for (uint32_t i = 0; i < 200; i++) {
+            std::size_t n = 1 + (i * 37) % 300;
+            uint32_t* p = (uint32_t*)arena.allocate(n * sizeof(uint32_t), 32);
+            for (std::size_t j = 0; j < n; j++) p[j] = i;
+            buffers.push_back(p);
+        }
+        for (uint32_t i = 0; i < 200; i++) {
+            std::size_t n = 1 + (i * 37) % 300;
+            for (std::size_t j = 0; j < n; j++) isCorrect = isCorrect && (buffers[i][j] == i);
+        }
+        check_condition(isCorrect, "ALIGNEDARENA no overlap");
+    }
+    // reset() reuses blocks, large buffers bypass the blocks
+    {
+        UME::AlignedArena arena;
+        void* p0 = arena.allocate(1000, 64);
+        arena.allocate(3000, 64);
+        std::size_t reserved = arena.reservedBytes();
+        arena.reset();
+        void* p1 = arena.allocate(1000, 64);
+        void* p2 = arena.allocate(UME_ARENA_MAX_CLASS * 4, 128);
+        bool isCorrect = (p0 == p1) && (reserved > 0) && (arena.reservedBytes() == reserved)
+            && (p2 != nullptr) && ((uint64_t(p2) % 128) == 0);
+        arena.deallocate(p2, UME_ARENA_MAX_CLASS * 4, 128);
+        arena.release();
+        isCorrect = isCorrect && (arena.reservedBytes() == 0);
+        check_condition(isCorrect, "ALIGNEDARENA reset/release");
+    }
+    // Thread-local arenas
+    {
+        UME::AlignedArena* a0 = &UME::AlignedArena::threadLocal();
+        UME::AlignedArena* a1 = nullptr;
+        std::thread t([&a1]() { a1 = &UME::AlignedArena::threadLocal(); });
+        t.join();
+        bool isCorrect = (a0 == &UME::AlignedArena::threadLocal()) && (a1 != nullptr) && (a1 != a0);
+        check_condition(isCorrect, "ALIGNEDARENA threadLocal");
+    }
+#if defined(UME_ARENA_PMR)
+    // Polymorphic memory resource
+    {
+        UME::AlignedArena arena;
+        UME::AlignedArenaResource resource(arena);
+        std::pmr::vector<double> v(&resource);
+        for (int i = 0; i < 1000; i++) v.push_back(double(i));
+        bool isCorrect = (uint64_t(v.data()) % alignof(double) == 0);
+        for (int i = 0; i < 1000; i++) isCorrect = isCorrect && (v[i] == double(i));
+        check_condition(isCorrect, "ALIGNEDARENA memory_resource");
+    }
+#endif
+}
+
+void AllocationPolicyTest() {
+    UME::AllocationPolicy policies[] = {
+        UME::AllocationPolicy(),
+        UME::AllocationPolicy::huge(),
+        UME::AllocationPolicy::bind(0x1),
+        UME::AllocationPolicy::interleave(0x1)
+    };
+    const char* names[] = { "default", "huge", "bind", "interleave" };
+    for (int i = 0; i < 4; i++) {
+        std::size_t size = 3 * 1024 * 1024 + 100;
+        char* p = (char*)UME::DynamicMemory::AlignedMalloc(size, 64, policies[i]);
+        bool isCorrect = (p != nullptr) && ((uint64_t(p) % 64) == 0);
+        if (policies[i].hugeAlign) isCorrect = isCorrect && ((uint64_t(p) % UME::AllocationPolicy::HUGE_PAGE_BYTES) == 0);
+        if (p != nullptr) {
+            for (std::size_t j = 0; j < size; j += 4096) p[j] = char(j);
+            p[size - 1] = 1;
+            for (std::size_t j = 0; j < size; j += 4096) isCorrect = isCorrect && (p[j] == char(j));
+        }
+        UME::DynamicMemory::AlignedFree(p, size, policies[i]);
+        check_condition(isCorrect, (std::string("ALLOCATION POLICY ") + names[i]).c_str());
+    }
+    // Allocator with a policy
+    {
+        UME::AlignedAllocator<float, 8> allocator(UME::AllocationPolicy::huge());
+        std::vector<float, UME::AlignedAllocator<float, 8>> v(1000, 1.0f, allocator);
+        bool isCorrect = ((uint64_t(v.data()) % UME::AllocationPolicy::HUGE_PAGE_BYTES) == 0)
+            && (v.get_allocator() == allocator) && (v.get_allocator() != UME::AlignedAllocator<float, 8>());
+        for (int i = 0; i < 1000; i++) isCorrect = isCorrect && (v[i] == 1.0f);
+        check_condition(isCorrect, "ALLOCATION POLICY std::vector");
+    }
+    // Allocation failure is reported with std::bad_alloc
+    {
+        UME::AlignedAllocator<float, 8> allocator(UME::AllocationPolicy::huge());
+        bool isCorrect = false;
+        try {
+            allocator.allocate(std::size_t(1) << 52);
+        }
+        catch (std::bad_alloc const &) {
+            isCorrect = true;
+        }
+        check_condition(isCorrect, "ALLOCATION POLICY bad_alloc");
+    }
+    // Containers with a policy
+    {
+        UME::AllocationPolicy huge = UME::AllocationPolicy::huge();
+        UME::AlignedVector<float, 8> v(1000, 1.0f, huge);
+        for (int i = 0; i < 5000; i++) v.push_back(float(i));
+        UME::AlignedVector<float, 8> w(v);
+        bool isCorrect = ((uint64_t(v.data()) % UME::AllocationPolicy::HUGE_PAGE_BYTES) == 0)
+            && ((uint64_t(w.data()) % UME::AllocationPolicy::HUGE_PAGE_BYTES) == 0)
+            && (v.policy() == huge) && (w.policy() == huge) && (w.size() == 6000);
+        for (int i = 0; i < 6000; i++) isCorrect = isCorrect && (w[i] == (i < 1000 ? 1.0f : float(i - 1000)));
+        check_condition(isCorrect, "ALLOCATION POLICY AlignedVector");
+
+        UME::SoA<8, float, int32_t> soa(100, huge);
+        UME::AoSoA<8, float, int32_t> aosoa(100, huge);
+        isCorrect = ((uint64_t(soa.data<0>()) % UME::AllocationPolicy::HUGE_PAGE_BYTES) == 0)
+            && ((uint64_t(soa.data<1>()) % UME::AllocationPolicy::HUGE_PAGE_BYTES) == 0)
+            && ((uint64_t(&aosoa.get<0>(0)) % UME::AllocationPolicy::HUGE_PAGE_BYTES) == 0)
+            && (soa.policy() == huge) && (aosoa.policy() == huge);
+        for (int i = 0; i < 1000; i++) {
+            soa.push_back(float(i), i);
+            aosoa.push_back(float(i), i);
+        }
+        for (int i = 0; i < 1000; i++) {
+            isCorrect = isCorrect && (soa.get<0>(100 + i) == float(i)) && (soa.get<1>(100 + i) == i)
+                && (aosoa.get<0>(100 + i) == float(i)) && (aosoa.get<1>(100 + i) == i);
+        }
+        check_condition(isCorrect, "ALLOCATION POLICY SoA/AoSoA");
+    }
+}
+
+void MemCopyTest() {
+    std::size_t sizes[] = { 0, 1, 63, 64, 65, 1000, 4096 + 13 };
+    std::vector<char> src(8192), dst(8192);
+    for (std::size_t i = 0; i < src.size(); i++) src[i] = char(i * 13 + 1);
+    bool copyCorrect = true, setCorrect = true;
+    for (std::size_t size : sizes) {
+        for (std::size_t offset = 0; offset < 40; offset += 3) {
+            for (int streaming = 0; streaming < 2; streaming++) {
+                std::fill(dst.begin(), dst.end(), char(0));
+                if (streaming) UME::DynamicMemory::StreamCopy(&dst[offset], &src[offset + 1], size);
+                else UME::DynamicMemory::MemCopy(&dst[offset], &src[offset + 1], size);
+                for (std::size_t i = 0; i < dst.size(); i++) {
+                    char expected = (i >= offset && i < offset + size) ? src[i + 1] : char(0);
+                    copyCorrect = copyCorrect && (dst[i] == expected);
+                }
+                std::fill(dst.begin(), dst.end(), char(0));
+                if (streaming) UME::DynamicMemory::StreamSet(&dst[offset], 0xA5, size);
+                else UME::DynamicMemory::MemSet(&dst[offset], 0xA5, size);
+                for (std::size_t i = 0; i < dst.size(); i++) {
+                    char expected = (i >= offset && i < offset + size) ? char(0xA5) : char(0);
+                    setCorrect = setCorrect && (dst[i] == expected);
+                }
+            }
+        }
+    }
+    check_condition(copyCorrect, "MEMCOPY/STREAMCOPY");
+    check_condition(setCorrect, "MEMSET/STREAMSET");
 }
 
 int test_allocators(bool supressMessages)
@@ -122,6 +435,33 @@ int test_allocators(bool supressMessages)
     generic_AlignedAllocatorTest<double, 4> (std::string("double(64b)"));
     generic_AlignedAllocatorTest<double, 8> (std::string("double(64b)"));
     generic_AlignedAllocatorTest<double, 16> (std::string("double(64b)"));
+
+    generic_AlignedAllocatorVectorTest<uint8_t, 32> (std::string("uint8_t"));
+    generic_AlignedAllocatorVectorTest<int32_t, 8> (std::string("int32_t"));
+    generic_AlignedAllocatorVectorTest<float, 16> (std::string("float(32b)"));
+    generic_AlignedAllocatorVectorTest<double, 8> (std::string("double(64b)"));
+
+    generic_AlignedVectorTest<uint8_t, 32> (std::string("uint8_t"));
+    generic_AlignedVectorTest<int16_t, 16> (std::string("int16_t"));
+    generic_AlignedVectorTest<int32_t, 8> (std::string("int32_t"));
+    generic_AlignedVectorTest<float, 1> (std::string("float(32b)"));
+    generic_AlignedVectorTest<float, 8> (std::string("float(32b)"));
+    generic_AlignedVectorTest<float, 16> (std::string("float(32b)"));
+    generic_AlignedVectorTest<double, 4> (std::string("double(64b)"));
+    generic_AlignedVectorTest<double, 8> (std::string("double(64b)"));
+
+    generic_SoAContainerTest<UME::SoA<1, float, double, int32_t>, 1> (std::string("SOA"));
+    generic_SoAContainerTest<UME::SoA<4, float, double, int32_t>, 4> (std::string("SOA"));
+    generic_SoAContainerTest<UME::SoA<8, float, double, int32_t>, 8> (std::string("SOA"));
+    generic_SoAContainerTest<UME::SoA<16, float, double, int32_t>, 16> (std::string("SOA"));
+    generic_SoAContainerTest<UME::AoSoA<1, float, double, int32_t>, 1> (std::string("AOSOA"));
+    generic_SoAContainerTest<UME::AoSoA<4, float, double, int32_t>, 4> (std::string("AOSOA"));
+    generic_SoAContainerTest<UME::AoSoA<8, float, double, int32_t>, 8> (std::string("AOSOA"));
+    generic_SoAContainerTest<UME::AoSoA<16, float, double, int32_t>, 16> (std::string("AOSOA"));
+
+    AlignedArenaTest();
+    AllocationPolicyTest();
+    MemCopyTest();
     
     return g_failCount;
 }
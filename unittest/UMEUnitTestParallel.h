@@ -0,0 +1,182 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_PARALLEL_H_
+#define UME_UNIT_TEST_PARALLEL_H_
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "UMEUnitTestCommon.h"
+#include "../UMEParallel.h"
+
+int test_parallel(bool supressMessages)
+{
+    char header[] = "UME::SIMD::PARALLEL test";
+    INIT_TEST(header, supressMessages);
+
+    using namespace UME::SIMD;
+    typedef SIMD8_32u VEC_T;
+
+    // More threads than cores, to exercise stealing on any machine.
+    PARALLEL::ThreadPool pool(4, false);
+    CHECK_CONDITION(pool.size() == 4, "ThreadPool size");
+
+    {
+        const std::size_t LEN = 100003;
+        std::vector<std::atomic<int> > visited(LEN);
+        for (std::size_t i = 0; i < LEN; i++) visited[i] = 0;
+        std::atomic<int> badThreadId(0);
+        PARALLEL::parallel_for(LEN, 1000, [&](unsigned int id, std::size_t begin, std::size_t end) {
+            if (id >= pool.size()) badThreadId++;
+            for (std::size_t i = begin; i < end; i++) visited[i]++;
+        }, pool);
+        bool exact = badThreadId == 0;
+        for (std::size_t i = 0; i < LEN; i++) exact &= (visited[i] == 1);
+        CHECK_CONDITION(exact, "parallel_for");
+    }
+    {
+        // Without stealing, thread 'id' processes exactly its own block of chunks.
+        const std::size_t LEN = 100003;
+        const std::size_t CHUNK = 1000;
+        const std::size_t CHUNKS = (LEN + CHUNK - 1) / CHUNK;
+        std::vector<std::atomic<int> > visited(LEN);
+        for (std::size_t i = 0; i < LEN; i++) visited[i] = 0;
+        std::atomic<int> badThreadId(0);
+        PARALLEL::parallel_for_static(LEN, CHUNK, [&](unsigned int id, std::size_t begin, std::size_t end) {
+            std::size_t chunk = begin / CHUNK;
+            if (chunk < CHUNKS * id / pool.size() || chunk >= CHUNKS * (id + 1) / pool.size()) badThreadId++;
+            for (std::size_t i = begin; i < end; i++) visited[i]++;
+        }, pool);
+        bool exact = badThreadId == 0;
+        for (std::size_t i = 0; i < LEN; i++) exact &= (visited[i] == 1);
+        CHECK_CONDITION(exact, "parallel_for_static");
+    }
+    {
+        // Nested calls run on the calling thread.
+        std::atomic<int> count(0);
+        PARALLEL::parallel_for(10, 1, [&](unsigned int, std::size_t, std::size_t) {
+            PARALLEL::parallel_for(10, 1, [&](unsigned int, std::size_t, std::size_t) { count++; }, pool);
+        }, pool);
+        CHECK_CONDITION(count == 100, "parallel_for (nested)");
+    }
+    {
+        // An exception thrown on the calling thread or on a worker reaches the caller after
+        // all threads have finished, and the pool stays usable.
+        for (unsigned int thrower = 0; thrower < pool.size(); thrower++) {
+            std::atomic<int> finished(0);
+            bool caught = false;
+            try {
+                pool.run([&](unsigned int id) {
+                    if (id == thrower) throw std::runtime_error("parallel");
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    finished++;
+                });
+            }
+            catch (std::runtime_error const &) {
+                caught = true;
+            }
+            CHECK_CONDITION(caught && finished == int(pool.size()) - 1, "ThreadPool::run (exception)");
+        }
+
+        std::atomic<int> workerCalls(0);
+        PARALLEL::parallel_for(10, 1, [&](unsigned int id, std::size_t, std::size_t) {
+            if (id != 0) workerCalls++;
+            // Give the workers time to start, so that the check does not depend on scheduling.
+            for (int k = 0; id == 0 && workerCalls == 0 && k < 1000; k++) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }, pool);
+        CHECK_CONDITION(workerCalls > 0 && !PARALLEL::insideParallelRegion(), "parallel_for (after exception)");
+    }
+    {
+        const std::size_t LEN = 3 * PARALLEL::chunkLength<VEC_T>() + 13;
+        std::vector<uint32_t> x(LEN + 1), y(LEN + 1);
+
+        PARALLEL::first_touch<VEC_T>(&x[1], LEN, 7, pool);
+        bool exact = x[0] == 0;
+        for (std::size_t i = 1; i <= LEN; i++) exact &= (x[i] == 7);
+        CHECK_CONDITION(exact, "first_touch");
+
+        uint32_t sum = 0, maxVal = 0, sumSq = 0;
+        for (std::size_t i = 0; i < LEN; i++) {
+            x[i] = uint32_t(i % 1000);
+            sum += x[i];
+            sumSq += x[i] * x[i];
+            maxVal = x[i] > maxVal ? x[i] : maxVal;
+        }
+
+        PARALLEL::transform<VEC_T>(&x[0], &y[0], LEN, [](VEC_T const & a) { return a * uint32_t(3); }, pool);
+        exact = y[LEN] == 0;
+        for (std::size_t i = 0; i < LEN; i++) exact &= (y[i] == 3 * x[i]);
+        CHECK_CONDITION(exact, "transform");
+
+        PARALLEL::transform<VEC_T>(&x[0], &y[0], &y[0], LEN, [](VEC_T const & a, VEC_T const & b) { return b - a; }, pool);
+        exact = y[LEN] == 0;
+        for (std::size_t i = 0; i < LEN; i++) exact &= (y[i] == 2 * x[i]);
+        CHECK_CONDITION(exact, "transform (binary)");
+
+        CHECK_CONDITION(PARALLEL::reduce<VEC_T>(&x[0], LEN, pool) == sum, "reduce");
+
+        uint32_t t0 = PARALLEL::reduce<VEC_T>(&x[0], LEN, 0,
+            [](VEC_T const & a, VEC_T const & b) { return a.max(b); }, pool);
+        CHECK_CONDITION(t0 == maxVal, "reduce (max)");
+
+        uint32_t t1 = PARALLEL::transform_reduce<VEC_T>(&x[0], LEN, 0,
+            [](VEC_T const & a, VEC_T const & b) { return a + b; },
+            [](VEC_T const & a) { return a * a; }, pool);
+        CHECK_CONDITION(t1 == sumSq, "transform_reduce");
+
+        CHECK_CONDITION(PARALLEL::reduce<VEC_T>(&x[0], 0, pool) == 0, "reduce (empty)");
+    }
+    {
+        const std::size_t LEN = 5 * UME_PARALLEL_CHUNK_BYTES + 77;
+        std::vector<char> x(LEN + 2), y(LEN + 2, 0);
+        for (std::size_t i = 0; i < x.size(); i++) x[i] = char(i * 7);
+        PARALLEL::memCopy(&y[1], &x[1], LEN, pool);
+        bool exact = (y[0] == 0) && (y[LEN + 1] == 0);
+        for (std::size_t i = 1; i <= LEN; i++) exact &= (y[i] == x[i]);
+        CHECK_CONDITION(exact, "memCopy");
+
+        PARALLEL::memSet(&y[1], 0x5A, LEN, pool);
+        exact = (y[0] == 0) && (y[LEN + 1] == 0);
+        for (std::size_t i = 1; i <= LEN; i++) exact &= (y[i] == 0x5A);
+        CHECK_CONDITION(exact, "memSet");
+    }
+    {
+        // Default pool.
+        std::vector<float> x(5000, 0.5f);
+        CHECK_CONDITION(PARALLEL::reduce<SIMD8_32f>(&x[0], x.size()) == 2500.0f, "reduce (global pool)");
+    }
+
+    return g_failCount;
+}
+#endif
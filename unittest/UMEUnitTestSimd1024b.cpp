@@ -406,6 +406,7 @@ int test_UME_SIMD16_64i(bool supressMessages) {
     genericIntTest<
         SIMD16_64i, int64_t,
         SIMD16_64u, uint64_t,
+        SIMD16_64f, double,
         SIMDMask16,
         SIMDSwizzle16,
         16,
@@ -3118,6 +3118,7 @@ int test_UME_SIMD2_64i(bool supressMessages)
     genericIntTest<
         SIMD2_64i, int64_t,
         SIMD2_64u, uint64_t,
+        SIMD2_64f, double,
         SIMDMask2,
         SIMDSwizzle2,
         2,
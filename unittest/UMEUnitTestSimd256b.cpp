@@ -739,6 +739,7 @@ int test_UME_SIMD4_64i(bool supressMessages)
     genericIntTest<
         SIMD4_64i, int64_t,
         SIMD4_64u, uint64_t,
+        SIMD4_64f, double,
         SIMDMask4,
         SIMDSwizzle4,
         4,
@@ -706,6 +706,7 @@ int test_UME_SIMD8_64i(bool supressMessages) {
     genericIntTest<
         SIMD8_64i, int64_t,
         SIMD8_64u, uint64_t,
+        SIMD8_64f, double,
         SIMDMask8,
         SIMDSwizzle8,
         8,